@@ -0,0 +1,30 @@
+#include <iostream>
+#include <chrono>
+
+#include "../canary.hpp"
+#include "../canary/command.hpp"
+
+int main(int argc, char** argv) {
+    // Spawn overhead: many short commands that print a line each
+    const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 500;
+
+    Canary::TaskGraph graph;
+    graph.Reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        graph.Add(Canary::CommandTask("echo " + std::to_string(i), { "echo", std::to_string(i) }));
+    }
+
+    Canary::ExecutionOptions options;
+    options.verbose = false;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Canary::ExecuteGraph(graph, options);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    double us = std::chrono::duration<double, std::micro>(end - start).count();
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << count << " commands";
+    }
+    std::cout << ": " << us / 1000 << " ms (" << us / count << " us per command)" << std::endl;
+}
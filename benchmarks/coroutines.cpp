@@ -0,0 +1,63 @@
+#include <iostream>
+#include <chrono>
+#include <thread>
+
+#include "../canary.hpp"
+#include "../canary/coroutine.hpp"
+
+#if defined(CANARY_COROUTINES)
+
+Canary::Async Wait(std::chrono::milliseconds duration) {
+    co_await Canary::SleepFor(duration);
+}
+
+// Run count tasks that wait 50 ms each on four workers
+template<class MakeTask>
+double Measure(std::size_t count, MakeTask makeTask) {
+    Canary::TaskGraph graph;
+    graph.Reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        graph.Add(makeTask(i));
+    }
+
+    Canary::ExecutionOptions options;
+    options.verbose = false;
+    options.workers = 4;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Canary::ExecuteGraph(graph, options);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void Print(const char* name, std::size_t count, double ms) {
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << count << " " << name;
+    }
+    std::cout << ": " << ms << " ms" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    // I/O-bound steps: blocking tasks hold a worker while they wait,
+    // coroutine tasks hand it back to the graph until they resume
+    const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 2000;
+    const std::chrono::milliseconds wait(50);
+
+    Print("blocking tasks", count / 10, Measure(count / 10, [wait](std::size_t i) {
+        return Canary::Task("Blocking " + std::to_string(i), [wait] { std::this_thread::sleep_for(wait); });
+    }));
+
+    Print("coroutine tasks", count, Measure(count, [wait](std::size_t i) {
+        return Canary::AsyncTask("Coroutine " + std::to_string(i), [wait] { return Wait(wait); });
+    }));
+}
+
+#else
+
+int main() {
+    std::cout << "Coroutine tasks need C++20" << std::endl;
+}
+
+#endif
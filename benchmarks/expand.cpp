@@ -0,0 +1,84 @@
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../canary.hpp"
+#include "../canary/shortcode.hpp"
+
+// Shortcodes replaced with std::string::find, byte by byte around colons
+void Naive(const std::string& text, std::string& out) {
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        std::size_t open = text.find(':', pos);
+        std::size_t close = open == std::string::npos ? std::string::npos : text.find(':', open + 1);
+        if (close == std::string::npos) {
+            out.append(text, pos, std::string::npos);
+            return;
+        }
+
+        const char* emoji = Canary::Emoji::Find(text.substr(open + 1, close - open - 1));
+        if (emoji == nullptr) {
+            out.append(text, pos, close - pos);
+            pos = close;
+            continue;
+        }
+        out.append(text, pos, open - pos);
+        out += emoji;
+        pos = close + 1;
+    }
+}
+
+template<class Expand>
+void Measure(const char* name, const std::vector<std::string>& lines, std::size_t bytes, Expand expand) {
+    std::string out;
+    std::size_t written = 0;
+    Canary::Timer timer;
+    for (const std::string& line : lines) {
+        out.clear();
+        expand(line, out);
+        written += out.size();
+    }
+    double seconds = static_cast<double>(timer.Elapsed().count()) / 1e9;
+
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << name;
+    }
+    std::cout << ": " << static_cast<double>(bytes) / 1e6 / seconds << " MB/s, "
+              << static_cast<double>(lines.size()) / 1e6 / seconds << " M lines/s"
+              << (written == 42 ? " " : "") << std::endl;
+}
+
+int main(int argc, char** argv) {
+    // Notification lines, one in four with a shortcode, some with plain colons
+    const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    const char* words[] = { "build", "finished", "for", "branch", "main", "in", "12:34", "deploy", "note:", "the" };
+    const char* shortcodes[] = { ":rocket:", ":white_check_mark:", ":x:", ":warning:", ":tada:" };
+
+    std::mt19937 random(42);
+    std::vector<std::string> lines;
+    std::size_t bytes = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string line;
+        if (random() % 4 == 0) line += std::string(shortcodes[random() % 5]) + " ";
+        while (line.size() < 80) line += std::string(words[random() % 10]) + " ";
+        bytes += line.size();
+        lines.push_back(std::move(line));
+    }
+
+    Measure("Canary::Emoji::Expand", lines, bytes, [](const std::string& line, std::string& out) {
+        Canary::Emoji::Expand(line.data(), line.size(), out);
+    });
+
+    // All lines through one stream, as a log would go
+    std::ostringstream stream;
+    Canary::Emoji::Expander expander(stream);
+    Measure("Canary::Emoji::Expander", lines, bytes, [&expander](const std::string& line, std::string&) {
+        expander.Write(line);
+    });
+    Measure("std::string::find", lines, bytes, [](const std::string& line, std::string& out) {
+        Naive(line, out);
+    });
+}
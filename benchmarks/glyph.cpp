@@ -0,0 +1,66 @@
+#include <iostream>
+#include <string>
+
+#include "../canary.hpp"
+#include "../canary/emoji_table.hpp"
+
+// Average cost of one status line in nanoseconds
+template<class Line>
+double Cost(std::size_t count, Line line) {
+    std::string out;
+    std::size_t written = 0;
+    Canary::Timer timer;
+    for (std::size_t i = 0; i < count; ++i) {
+        out.clear();
+        line(i, out);
+        written += out.size();
+    }
+    double ns = static_cast<double>(timer.Elapsed().count()) / static_cast<double>(count);
+
+    // Keep the lines from being optimized away
+    if (written == 42) std::cout << "";
+    return ns;
+}
+
+void Print(const char* name, double ns) {
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << name;
+    }
+    std::cout << ": " << ns << " ns per line" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    // Status lines with one of four emojis: the constants against the glyph table in both modes
+    const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 10000000;
+    const Canary::Emoji::Id ids[] = {
+        Canary::Emoji::Id::white_check_mark, Canary::Emoji::Id::x, Canary::Emoji::Id::warning, Canary::Emoji::Id::zap
+    };
+
+    Print("Constants", Cost(count, [](std::size_t i, std::string& out) {
+        switch (i % 4) {
+        case 0: out.append(Canary::Emoji::white_check_mark, Canary::Emoji::Length(Canary::Emoji::white_check_mark)); break;
+        case 1: out.append(Canary::Emoji::x, Canary::Emoji::Length(Canary::Emoji::x)); break;
+        case 2: out.append(Canary::Emoji::warning, Canary::Emoji::Length(Canary::Emoji::warning)); break;
+        default: out.append(Canary::Emoji::zap, Canary::Emoji::Length(Canary::Emoji::zap)); break;
+        }
+        out += "step finished";
+    }));
+
+    Print("One constant", Cost(count, [](std::size_t, std::string& out) {
+        out.append(Canary::Emoji::zap, Canary::Emoji::Length(Canary::Emoji::zap));
+        out += "step finished";
+    }));
+
+    for (Canary::Emoji::Mode mode : { Canary::Emoji::Mode::Emoji, Canary::Emoji::Mode::Text }) {
+        Canary::Emoji::SetMode(mode);
+        Print(mode == Canary::Emoji::Mode::Emoji ? "Glyph, emoji" : "Glyph, text", Cost(count, [&ids](std::size_t i, std::string& out) {
+            Canary::Emoji::AppendGlyph(out, ids[i % 4]);
+            out += " step finished";
+        }));
+        Print(mode == Canary::Emoji::Mode::Emoji ? "One glyph, emoji" : "One glyph, text", Cost(count, [](std::size_t, std::string& out) {
+            Canary::Emoji::AppendGlyph(out, Canary::Emoji::Id::zap);
+            out += " step finished";
+        }));
+    }
+}
@@ -0,0 +1,72 @@
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../canary.hpp"
+#include "../canary/compose.hpp"
+#include "../canary/emoji_table.hpp"
+#include "../canary/grapheme.hpp"
+
+template<class Segment>
+void Measure(const char* name, const std::string& text, std::size_t rounds, Segment segment) {
+    std::size_t clusters = 0;
+    Canary::Timer timer;
+    for (std::size_t round = 0; round < rounds; ++round) {
+        clusters += segment(text);
+    }
+    double seconds = static_cast<double>(timer.Elapsed().count()) / 1e9;
+
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << name;
+    }
+    std::cout << ": " << static_cast<double>(text.size() * rounds) / 1e6 / seconds << " MB/s, "
+              << static_cast<double>(clusters) / 1e6 / seconds << " M clusters/s" << std::endl;
+}
+
+void Run(const char* name, const std::string& text, std::size_t rounds) {
+    std::cout << name << " (" << text.size() << " bytes, " << Canary::Grapheme::Count(text) << " clusters)" << std::endl;
+
+    Measure("  Count", text, rounds, [](const std::string& text) {
+        return Canary::Grapheme::Count(text);
+    });
+    Measure("  Clusters", text, rounds, [](const std::string& text) {
+        std::size_t count = 0;
+        for (Canary::Grapheme::Cluster cluster : Canary::Grapheme::Clusters(text)) {
+            count += cluster.size != 0;
+        }
+        return count;
+    });
+}
+
+int main(int argc, char** argv) {
+    // Log lines with an emoji in one of four, text that is all emojis and their sequences, and accented text
+    const std::size_t rounds = argc > 1 ? std::stoul(argv[1]) : 20;
+    std::mt19937 random(42);
+
+    std::string log;
+    const char* words[] = { "build", "finished", "for", "branch", "main", "in", "12:34", "deploy", "note:", "the" };
+    while (log.size() < 1 << 20) {
+        if (random() % 4 == 0) log += Canary::Emoji::At(random() % Canary::Emoji::Count()).emoji;
+        for (int i = 0; i < 8; ++i) {
+            log += words[random() % 10];
+            log += ' ';
+        }
+        log += '\n';
+    }
+
+    std::string emojis;
+    while (emojis.size() < 1 << 20) {
+        emojis += Canary::Emoji::At(random() % Canary::Emoji::Count()).emoji;
+        if (random() % 8 == 0) emojis += Canary::Emoji::WithTone<Canary::Emoji::ok_hand, Canary::Emoji::Tone::Medium>::Value;
+    }
+
+    std::string accented;
+    const char* letters[] = { "e\xCC\x81", "a", "\xC3\xA9", "n\xCC\x83", " ", "o", "\xE1\x84\x80\xE1\x85\xA1", "\xED\x95\x9C" };
+    while (accented.size() < 1 << 20) accented += letters[random() % 8];
+
+    Run("Log lines", log, rounds);
+    Run("Emojis", emojis, rounds);
+    Run("Accented", accented, rounds);
+}
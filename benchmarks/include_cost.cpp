@@ -0,0 +1,99 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../canary.hpp"
+
+// Compile time of translation units that print two emojis, from all of Canary, the umbrella header, one group or the module
+
+struct Unit {
+    const char* name;
+    std::string source;
+    std::string flags;
+};
+
+// The average time of a command in milliseconds, or a negative number if it fails
+double Time(const std::string& command, std::size_t rounds) {
+    Canary::Timer timer;
+    for (std::size_t round = 0; round < rounds; ++round) {
+        if (std::system(command.c_str()) != 0) return -1;
+    }
+    return static_cast<double>(timer.Elapsed().count()) / 1e6 / static_cast<double>(rounds);
+}
+
+std::size_t FileSize(const std::string& path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    return in ? static_cast<std::size_t>(in.tellg()) : 0;
+}
+
+void Write(const std::string& path, const std::string& text) {
+    std::ofstream(path) << text;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t rounds = argc > 1 ? std::stoul(argv[1]) : 5;
+    const char* compiler = std::getenv("CXX") != nullptr ? std::getenv("CXX") : "c++";
+    const char* temporary = std::getenv("TMPDIR") != nullptr ? std::getenv("TMPDIR") : "/tmp";
+
+    // The repository, from the path of this file, which is relative to where it was compiled
+    std::string file = __FILE__;
+    std::string root = file.substr(0, file.find_last_of('/') + 1) + "..";
+    char cwd[4096];
+    if (root[0] != '/' && getcwd(cwd, sizeof(cwd)) != nullptr) root = std::string(cwd) + "/" + root;
+    std::string directory = std::string(temporary) + "/canary_include_cost";
+    std::system(("mkdir -p " + directory).c_str());
+
+    const std::string body =
+        "int main() {\n"
+        "    static_assert(Canary::Emoji::Length(Canary::Emoji::zap) == 4, \"\");\n"
+        "    std::printf(\"%sDone %s\\n\", Canary::Emoji::zap, Canary::Emoji::rocket);\n"
+        "}\n";
+    const std::string std = " -std=c++20 -I" + root;
+
+    // The floor: the same unit with the two constants it uses and nothing else
+    const std::string floor =
+        "#include <cstddef>\n#include <cstdio>\n"
+        "namespace Canary {\nnamespace Emoji {\n"
+        "    template<std::size_t N> constexpr std::size_t Length(const char (&)[N]) { return N - 1; }\n"
+        "    inline constexpr char zap[] = \"\\xE2\\x9A\\xA1 \";\n"
+        "    inline constexpr char rocket[] = \"\\xF0\\x9F\\x9A\\x80 \";\n"
+        "}\n}\n";
+
+    std::vector<Unit> units = {
+        { "two constants", floor + body, std },
+        { "canary.hpp", "#include <cstdio>\n#include \"canary.hpp\"\n" + body, std },
+        { "canary/emoji.hpp", "#include <cstdio>\n#include \"canary/emoji.hpp\"\n" + body, std },
+        { "canary/emoji/travel_places.hpp", "#include <cstdio>\n#include \"canary/emoji/travel_places.hpp\"\n" + body, std },
+    };
+
+    // The module, if the compiler builds it with -fmodules-ts
+    std::string module = " -std=c++20 -fmodules-ts -I" + root;
+    std::string build = std::string("cd ") + directory + " && " + compiler + module
+        + " -c -x c++ " + root + "/canary/emoji.cppm -o emoji.o > /dev/null 2>&1";
+    if (std::system(build.c_str()) == 0) {
+        units.push_back({ "import canary.emoji", "#include <cstdio>\nimport canary.emoji;\n" + body, module });
+    } else {
+        std::cout << "No module, " << compiler << " does not build canary/emoji.cppm with -fmodules-ts" << std::endl;
+    }
+
+    for (const Unit& unit : units) {
+        std::string source = directory + "/unit.cpp";
+        std::string object = directory + "/unit.o";
+        Write(source, unit.source);
+
+        std::string compile = std::string("cd ") + directory + " && " + compiler + unit.flags;
+        double parse = Time(compile + " -fsyntax-only " + source, rounds);
+        double codegen = Time(compile + " -c " + source + " -o " + object, rounds);
+
+        {
+            Canary::Ansi::Bold bold(std::cout);
+            std::cout << unit.name;
+        }
+        std::cout << ": " << parse << " ms to parse, " << codegen << " ms to compile, "
+                  << FileSize(object) << " bytes of object code" << std::endl;
+    }
+}
@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../canary.hpp"
+#include "../canary/parallel.hpp"
+
+// About cost microseconds of floating point work
+double Work(std::size_t cost) {
+    double value = 1;
+    for (std::size_t i = 0; i < cost * 100; ++i) {
+        value = std::sqrt(value + static_cast<double>(i));
+    }
+    return value;
+}
+
+template<class Cost>
+double Measure(unsigned workers, std::size_t count, Cost cost) {
+    std::vector<double> results(count);
+
+    Canary::ExecutionOptions options;
+    options.verbose = false;
+    options.workers = workers;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Canary::ParallelFor(0, count, [&](std::size_t i) { results[i] = Work(cost(i)); }, options);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+template<class Cost>
+void Scale(const char* name, std::size_t count, Cost cost) {
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << name;
+    }
+    std::cout << std::endl;
+
+    // Warm up, the first loop also calibrates the timer
+    Measure(1, count, cost);
+
+    double single = 0;
+    for (unsigned workers = 1; workers <= 64; workers *= 2) {
+        double ms = Measure(workers, count, cost);
+        if (workers == 1) single = ms;
+        std::printf("%4u threads %10.1f ms %6.2fx\n", workers, ms, single / ms);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 100000;
+    std::cout << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+
+    // Every item costs the same
+    Scale("Uniform", count, [](std::size_t) { return std::size_t(1); });
+
+    // The cost grows with the index, the last slices hold most of the work
+    Scale("Skewed", count, [count](std::size_t i) { return 1 + 4 * i / count; });
+
+    // Almost all items are cheap, every thousandth is expensive
+    Scale("Heavy tail", count, [](std::size_t i) { return i % 1000 == 0 ? std::size_t(500) : std::size_t(0); });
+}
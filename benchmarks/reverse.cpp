@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../canary.hpp"
+#include "../canary/shortcode.hpp"
+
+// Longest match by trying every length at every position in a hash map
+template<class Fn>
+void NaiveScan(const std::unordered_map<std::string, const char*>& names, const std::string& text, Fn fn) {
+    std::size_t i = 0;
+    while (i < text.size()) {
+        std::size_t length = std::min(text.size() - i, Canary::detail::EmojiTable::longestEmoji);
+        for (; length > 0; --length) {
+            auto it = names.find(text.substr(i, length));
+            if (it != names.end()) {
+                fn(i, length, it->second);
+                break;
+            }
+        }
+        i += length > 0 ? length : 1;
+    }
+}
+
+template<class Scan>
+void Measure(const char* name, const std::string& text, Scan scan) {
+    std::size_t found = 0;
+    Canary::Timer timer;
+    scan(text, [&found](std::size_t, std::size_t, const char*) { ++found; });
+    double seconds = static_cast<double>(timer.Elapsed().count()) / 1e9;
+
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << name;
+    }
+    std::cout << ": " << static_cast<double>(text.size()) / 1e6 / seconds << " MB/s, " << found << " emojis" << std::endl;
+}
+
+void Compare(const char* title, const std::string& text, const std::unordered_map<std::string, const char*>& names) {
+    std::cout << title << " (" << text.size() / 1000 << " kB)" << std::endl;
+    Measure("  Canary::Emoji::Scan", text, [](const std::string& text, std::function<void(std::size_t, std::size_t, const char*)> fn) {
+        Canary::Emoji::Scan(text.data(), text.size(), fn);
+    });
+    Measure("  std::unordered_map", text, [&names](const std::string& text, std::function<void(std::size_t, std::size_t, const char*)> fn) {
+        NaiveScan(names, text, fn);
+    });
+}
+
+int main(int argc, char** argv) {
+    const std::size_t size = argc > 1 ? std::stoul(argv[1]) : 10000000;
+
+    std::unordered_map<std::string, const char*> names;
+    std::vector<std::string> emojis;
+    for (std::size_t i = 0; i < Canary::Emoji::Count(); ++i) {
+        Canary::Emoji::Entry entry = Canary::Emoji::At(i);
+        names.emplace(std::string(entry.emoji, entry.length), entry.name);
+        emojis.push_back(std::string(entry.emoji, entry.length));
+    }
+
+    // Log lines, every tenth with an emoji
+    std::mt19937 random(42);
+    std::string log;
+    while (log.size() < size) {
+        log += "2017-06-01 12:00:00 worker 3 finished job 1234 in 56 ms ";
+        if (random() % 10 == 0) log += emojis[random() % emojis.size()];
+        log += "\n";
+    }
+
+    // Nothing but emojis
+    std::string dense;
+    while (dense.size() < size / 10) {
+        dense += emojis[random() % emojis.size()];
+    }
+
+    Compare("Log lines", log, names);
+    Compare("Emojis only", dense, names);
+}
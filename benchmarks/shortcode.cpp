@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../canary.hpp"
+#include "../canary/shortcode.hpp"
+
+// Average cost of one lookup in nanoseconds
+template<class Find>
+double Cost(const std::vector<std::string>& names, std::size_t rounds, Find find) {
+    std::size_t found = 0;
+    Canary::Timer timer;
+    for (std::size_t round = 0; round < rounds; ++round) {
+        for (const std::string& name : names) {
+            if (find(name) != nullptr) ++found;
+        }
+    }
+    double ns = static_cast<double>(timer.Elapsed().count()) / static_cast<double>(rounds * names.size());
+
+    // Keep the lookups from being optimized away
+    if (found == 42) std::cout << "";
+    return ns;
+}
+
+void Print(const char* name, double ns) {
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << name;
+    }
+    std::cout << ": " << ns << " ns per lookup" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    // Name to emoji: the perfect hash against std::unordered_map
+    const std::size_t rounds = argc > 1 ? std::stoul(argv[1]) : 1000;
+
+    std::unordered_map<std::string, const char*> map;
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < Canary::Emoji::Count(); ++i) {
+        map.emplace(Canary::Emoji::At(i).name, Canary::Emoji::At(i).emoji);
+        names.push_back(Canary::Emoji::At(i).name);
+    }
+
+    // One in eight lookups misses
+    for (std::size_t i = 0; i < Canary::Emoji::Count() / 8; ++i) {
+        names.push_back(names[i * 7] + "_x");
+    }
+    std::shuffle(names.begin(), names.end(), std::mt19937(42));
+
+    Print("Canary::Emoji::Find", Cost(names, rounds, [](const std::string& name) {
+        return Canary::Emoji::Find(name);
+    }));
+    Print("std::unordered_map", Cost(names, rounds, [&map](const std::string& name) -> const char* {
+        auto it = map.find(name);
+        return it != map.end() ? it->second : nullptr;
+    }));
+}
@@ -0,0 +1,63 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include "../canary.hpp"
+
+// Time a function in nanoseconds
+template<class F>
+double Measure(F fn) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+void Report(const char* name, double ns, std::size_t count) {
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << name;
+    }
+    std::cout << ": " << ns / 1e6 << " ms (" << ns / count << " ns per task)" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t count = 100000;
+    std::size_t counter = 0;
+
+    Canary::ExecutionOptions quiet;
+    quiet.verbose = false;
+
+    // Generate the task list from data
+    std::vector<Canary::Task> tasks;
+    double build = Measure([&]() {
+        tasks.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            tasks.emplace_back("Task " + std::to_string(i), [&counter]() { ++counter; });
+        }
+    });
+
+    // Hand the list over and run it sequentially
+    double run = Measure([&]() {
+        Canary::ExecuteTasks(std::move(tasks), quiet);
+    });
+
+    // The same tasks without dependencies on the graph executor
+    Canary::TaskGraph graph;
+    graph.Reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        graph.Add(Canary::Task("Task " + std::to_string(i), [&counter]() { ++counter; }));
+    }
+
+    Canary::ExecutionOptions single = quiet;
+    single.workers = 1;
+    double runGraph = Measure([&]() {
+        Canary::ExecuteGraph(graph, single);
+    });
+
+    std::cout << std::endl;
+    Report("Build list", build, count);
+    Report("ExecuteTasks", run, count);
+    Report("ExecuteGraph (1 worker)", runGraph, count);
+    std::cout << counter << " tasks executed." << std::endl;
+}
@@ -0,0 +1,44 @@
+#include <iostream>
+#include <chrono>
+
+#include "../canary.hpp"
+
+// Average cost of one call of now in nanoseconds
+template<class Now>
+double Cost(std::size_t count, Now now) {
+    auto sink = now();
+    Canary::Timer timer;
+    for (std::size_t i = 0; i < count; ++i) {
+        sink += now();
+    }
+    double ns = static_cast<double>(timer.Elapsed().count()) / count;
+
+    // Keep the calls from being optimized away
+    if (sink == 42) std::cout << "";
+    return ns;
+}
+
+int main(int argc, char** argv) {
+    // Reading the clock: Canary::Timer against steady_clock
+    const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 10000000;
+
+    double timer = Cost(count, [] { return Canary::Timer::Now(); });
+    double steady = Cost(count, [] {
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    });
+
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << "Canary::Timer";
+    }
+    std::cout << " (" << (Canary::Timer::CycleCounter() ? "cycle counter" : "steady_clock") << "): "
+              << timer << " ns per read" << std::endl;
+    {
+        Canary::Ansi::Bold bold(std::cout);
+        std::cout << "steady_clock";
+    }
+    std::cout << ": " << steady << " ns per read" << std::endl;
+
+    // The cost of timing a scope
+    Canary::ScopedTimer scope("Empty scope");
+}
@@ -18,3 +18,4 @@
 
 #include "canary/ansi.hpp"
 #include "canary/emoji.hpp"
+#include "canary/tasks.hpp"
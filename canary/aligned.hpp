@@ -0,0 +1,72 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Canary {
+
+    namespace detail {
+
+        /**
+            Destroys an object of MakeAligned and frees the block it was
+            placed in, whose address is stored right in front of it
+         */
+        template<class T>
+        struct AlignedDelete {
+            void operator()(T* object) const {
+                void* block = reinterpret_cast<void**>(object)[-1];
+                object->~T();
+                ::operator delete(block);
+            }
+        };
+
+        template<class T>
+        using AlignedPtr = std::unique_ptr<T, AlignedDelete<T>>;
+
+        /**
+            new T(args...) that honors alignas(64), which keeps the
+            counters of different threads on cache lines of their own.
+            Before C++17 new only guarantees the alignment of
+            std::max_align_t, so the object is placed at the first
+            aligned address of a larger block.
+         */
+        template<class T, class... Args>
+        AlignedPtr<T> MakeAligned(Args&&... args) {
+            const std::size_t alignment = alignof(T) > alignof(void*) ? alignof(T) : alignof(void*);
+            void* block = ::operator new(sizeof(void*) + alignment - 1 + sizeof(T));
+
+            std::uintptr_t address = (reinterpret_cast<std::uintptr_t>(block) + sizeof(void*) + alignment - 1)
+                                     & ~static_cast<std::uintptr_t>(alignment - 1);
+            void* memory = reinterpret_cast<void*>(address);
+            static_cast<void**>(memory)[-1] = block;
+
+            try {
+                return AlignedPtr<T>(new (memory) T(std::forward<Args>(args)...));
+            } catch (...) {
+                ::operator delete(block);
+                throw;
+            }
+        }
+
+    } /* namespace detail */
+
+} /* namespace Canary */
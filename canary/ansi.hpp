@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 namespace Canary {
@@ -189,7 +190,9 @@ namespace Ansi {
         struct EscapeSequence {
         public:
             struct InnerBase {
-                using Pointer = InnerBase*;
+                using Pointer = std::unique_ptr<InnerBase>;
+
+                virtual ~InnerBase() {}
 
                 virtual void Print(const std::string& string) = 0;
             };
@@ -215,6 +218,10 @@ namespace Ansi {
                 EscapeCode<L> code(out);
             }
 
+            EscapeSequence(EscapeSequence&& other) : reset(other.reset), out(std::move(other.out)) {
+                other.reset = false;
+            }
+
             virtual ~EscapeSequence() {
                 if (reset) {
                     // Print reset
@@ -246,8 +253,7 @@ namespace Ansi {
          */
         template<class T, class L>
         T& operator<<(T& out, EscapeSequence<L> sequence) {
-            EscapeSequence<L> code(out);
-            code.CancelReset();
+            EscapeCode<L> code(out);
             return out;
         }
 
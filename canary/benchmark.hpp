@@ -0,0 +1,364 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ansi.hpp"
+#include "status.hpp"
+#include "storage.hpp"
+#include "timer.hpp"
+
+namespace Canary {
+
+    /**
+        The distribution of the run times of one task
+     */
+    struct BenchmarkStatistics {
+        std::chrono::nanoseconds min{0};
+        std::chrono::nanoseconds mean{0};
+        std::chrono::nanoseconds median{0};
+        std::chrono::nanoseconds p99{0};
+        std::chrono::nanoseconds stddev{0};
+
+        // Runs outside of the Tukey fences, 1.5 interquartile ranges
+        // below the first or above the third quartile
+        std::size_t outliers = 0;
+
+        std::size_t runs = 0;
+
+        /**
+            Evaluate the run times, they get sorted
+         */
+        static BenchmarkStatistics Of(std::vector<std::chrono::nanoseconds>& samples) {
+            BenchmarkStatistics statistics;
+            const std::size_t size = samples.size();
+            statistics.runs = size;
+            if (size == 0) return statistics;
+
+            std::sort(samples.begin(), samples.end());
+
+            double sum = 0;
+            for (auto sample : samples) sum += static_cast<double>(sample.count());
+            double mean = sum / static_cast<double>(size);
+
+            double squares = 0;
+            for (auto sample : samples) {
+                double deviation = static_cast<double>(sample.count()) - mean;
+                squares += deviation * deviation;
+            }
+
+            statistics.min = samples.front();
+            statistics.mean = Nanoseconds(mean);
+            statistics.median = Nanoseconds(Quantile(samples, 0.5));
+            statistics.p99 = samples[static_cast<std::size_t>(std::ceil(0.99 * static_cast<double>(size))) - 1];
+            statistics.stddev = Nanoseconds(size > 1 ? std::sqrt(squares / static_cast<double>(size - 1)) : 0);
+
+            double q1 = Quantile(samples, 0.25), q3 = Quantile(samples, 0.75);
+            double low = q1 - 1.5 * (q3 - q1), high = q3 + 1.5 * (q3 - q1);
+            for (auto sample : samples) {
+                double value = static_cast<double>(sample.count());
+                if (value < low || value > high) ++statistics.outliers;
+            }
+            return statistics;
+        }
+
+    private:
+        // Linear interpolation between the closest ranks
+        static double Quantile(const std::vector<std::chrono::nanoseconds>& sorted, double q) {
+            double rank = q * static_cast<double>(sorted.size() - 1);
+            std::size_t lower = static_cast<std::size_t>(rank);
+            std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+            double fraction = rank - static_cast<double>(lower);
+            return static_cast<double>(sorted[lower].count()) * (1 - fraction) +
+                   static_cast<double>(sorted[upper].count()) * fraction;
+        }
+
+        static std::chrono::nanoseconds Nanoseconds(double value) {
+            return std::chrono::nanoseconds(static_cast<std::int64_t>(std::llround(value)));
+        }
+    };
+
+    /**
+        Benchmark
+
+        Turns ExecuteTasks into a benchmark harness: pass it as the
+        benchmark of the ExecutionOptions and every task runs a few
+        warmup times and then the given number of measured times, one
+        task after another. Output of the runs is discarded, observers
+        are not notified. At the end, a table shows the distribution of
+        the run times of every task.
+
+        Medians can be saved as a baseline and compared against in later
+        runs. Tasks whose median got slower than the tolerance allows
+        are regressions and printed in red, faster ones in green.
+
+        The baseline file starts with the magic "CNRYBNC" and a version
+        byte, followed by the number of entries and the entries, each
+        the length of the name, the name and the median in nanoseconds.
+        All integers are little endian.
+
+        Example:
+
+            Canary::Benchmark benchmark(50, 5);
+            benchmark.CompareTo("parser.baseline");
+
+            Canary::ExecutionOptions options;
+            options.benchmark = &benchmark;
+            Canary::ExecuteTasks(std::move(tasks), options);
+
+            if (benchmark.Regressions() == 0) benchmark.Save("parser.baseline");
+     */
+    class Benchmark {
+    public:
+        struct Result {
+            std::string name, emoji;
+            BenchmarkStatistics statistics;
+
+            // The median of the baseline, zero without one
+            std::chrono::nanoseconds baseline{0};
+
+            // The error of a failed run, the task was not measured
+            std::string error;
+
+            // Relative change of the median against the baseline
+            double Change() const {
+                if (baseline <= std::chrono::nanoseconds::zero()) return 0;
+                return static_cast<double>(statistics.median.count()) / static_cast<double>(baseline.count()) - 1;
+            }
+        };
+
+        explicit Benchmark(unsigned runs = 20, unsigned warmup = 3) : runs(std::max(1u, runs)), warmup(warmup) {}
+
+        unsigned Runs() const {
+            return runs;
+        }
+
+        unsigned Warmup() const {
+            return warmup;
+        }
+
+        /**
+            Compare against the medians saved in the file. A median that
+            is more than the tolerance slower is a regression. A missing
+            file is an empty baseline.
+         */
+        void CompareTo(const std::string& path, double tolerance = 0.05) {
+            this->tolerance = tolerance;
+            baseline.clear();
+
+            std::string data;
+            std::size_t pos = Magic().size();
+            std::uint64_t count = 0;
+            if (!detail::ReadFile(path, data) || data.compare(0, pos, Magic()) != 0 ||
+                !detail::ReadInteger(data, pos, 4, count)) {
+                return;
+            }
+
+            for (std::uint64_t i = 0; i < count; ++i) {
+                std::string name;
+                std::uint64_t median = 0;
+                if (!detail::ReadString(data, pos, name) || !detail::ReadInteger(data, pos, 8, median)) {
+                    baseline.clear();
+                    return;
+                }
+                baseline[std::move(name)] = std::chrono::nanoseconds(static_cast<std::int64_t>(median));
+            }
+        }
+
+        /**
+            Write the medians of the last execution as a baseline. Tasks
+            that failed keep their median from the compared baseline.
+         */
+        void Save(const std::string& path) const {
+            std::unordered_map<std::string, std::chrono::nanoseconds> medians = baseline;
+            for (const Result& result : results) {
+                if (result.error.empty()) medians[result.name] = result.statistics.median;
+            }
+
+            std::string data = Magic();
+            detail::WriteInteger(data, 4, medians.size());
+            for (const auto& entry : medians) {
+                detail::WriteString(data, entry.first);
+                detail::WriteInteger(data, 8, static_cast<std::uint64_t>(entry.second.count()));
+            }
+            detail::ReplaceFile(path, data);
+        }
+
+        // One result per task of the last execution, in order
+        const std::vector<Result>& Results() const {
+            return results;
+        }
+
+        // Number of tasks that got slower than the tolerance allows
+        std::size_t Regressions() const {
+            std::size_t count = 0;
+            for (const Result& result : results) {
+                if (Regression(result)) ++count;
+            }
+            return count;
+        }
+
+        /**
+            Print the table of the last execution
+         */
+        void Print(std::ostream& out = std::cout) const {
+            std::string text;
+            AppendStyle<Ansi::Bold>(text);
+            text += "Benchmark:";
+            AppendStyle<Ansi::Reset>(text);
+            text += " " + std::to_string(runs) + (runs == 1 ? " run" : " runs") + " after " +
+                    std::to_string(warmup) + " warmup\n";
+
+            AppendStyle<Ansi::Faint>(text);
+            text += "       min       mean     median        p99     stddev";
+            if (!baseline.empty()) text += "  baseline";
+            AppendStyle<Ansi::Reset>(text);
+            text += "\n";
+
+            char numbers[96];
+            for (const Result& result : results) {
+                if (!result.error.empty()) {
+                    AppendStyle<Ansi::RedForeground>(text);
+                    text += "    failed";
+                    AppendStyle<Ansi::Reset>(text);
+                    text += "  ";
+                    AppendName(text, result);
+                    AppendStyle<Ansi::Faint>(text);
+                    text += " (" + result.error + ")";
+                    AppendStyle<Ansi::Reset>(text);
+                    text += "\n";
+                    continue;
+                }
+
+                const BenchmarkStatistics& statistics = result.statistics;
+                bool regression = Regression(result);
+                if (regression) AppendStyle<Ansi::RedForeground>(text);
+                std::snprintf(numbers, sizeof(numbers), "%10s %10s %10s %10s %10s",
+                              detail::FormatDuration(statistics.min).c_str(), detail::FormatDuration(statistics.mean).c_str(),
+                              detail::FormatDuration(statistics.median).c_str(), detail::FormatDuration(statistics.p99).c_str(),
+                              detail::FormatDuration(statistics.stddev).c_str());
+                text += numbers;
+
+                if (!baseline.empty()) {
+                    if (result.baseline <= std::chrono::nanoseconds::zero()) {
+                        AppendStyle<Ansi::Faint>(text);
+                        text += "       new";
+                    } else {
+                        double change = result.Change();
+                        if (!regression && change < -tolerance) {
+                            AppendStyle<Ansi::GreenForeground>(text);
+                        } else if (!regression) {
+                            AppendStyle<Ansi::Faint>(text);
+                        }
+                        std::snprintf(numbers, sizeof(numbers), "  %+7.1f%%", 100 * change);
+                        text += numbers;
+                    }
+                }
+                AppendStyle<Ansi::Reset>(text);
+                text += "  ";
+                AppendName(text, result);
+
+                // Many outliers make the numbers unreliable
+                if (statistics.outliers > 0) {
+                    AppendStyle<Ansi::YellowForeground>(text);
+                    text += " (" + std::to_string(statistics.outliers) +
+                            (statistics.outliers == 1 ? " outlier)" : " outliers)");
+                    AppendStyle<Ansi::Reset>(text);
+                }
+                text += "\n";
+            }
+
+            std::size_t regressions = Regressions();
+            if (regressions > 0) {
+                AppendStyle<Ansi::RedForeground>(text);
+                text += std::to_string(regressions) + (regressions == 1 ? " regression" : " regressions");
+                AppendStyle<Ansi::Reset>(text);
+                text += "\n";
+            }
+
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+            out.flush();
+        }
+
+        // Before the first task, called by ExecuteTasks
+        void Begin(std::size_t tasks) {
+            results.clear();
+            results.reserve(tasks);
+        }
+
+        // The run times of a task, called by ExecuteTasks
+        void Record(std::string name, std::string emoji, std::vector<std::chrono::nanoseconds>& samples) {
+            Result result = NewResult(std::move(name), std::move(emoji));
+            result.statistics = BenchmarkStatistics::Of(samples);
+            results.push_back(std::move(result));
+        }
+
+        // A task that failed, called by ExecuteTasks
+        void RecordFailure(std::string name, std::string emoji, std::string error) {
+            Result result = NewResult(std::move(name), std::move(emoji));
+            result.error = std::move(error);
+            results.push_back(std::move(result));
+        }
+
+    private:
+        template<class... Styles>
+        static void AppendStyle(std::string& out) {
+            detail::AppendStyle<Styles...>(out);
+        }
+
+        // Magic and format version
+        static std::string Magic() {
+            return std::string("CNRYBNC\x01", 8);
+        }
+
+        static void AppendName(std::string& out, const Result& result) {
+            detail::AppendTaskEmoji(out, result.emoji);
+            out += result.name;
+        }
+
+        Result NewResult(std::string name, std::string emoji) const {
+            Result result;
+            auto it = baseline.find(name);
+            if (it != baseline.end()) result.baseline = it->second;
+            result.name = std::move(name);
+            result.emoji = std::move(emoji);
+            return result;
+        }
+
+        bool Regression(const Result& result) const {
+            return result.error.empty() && result.baseline > std::chrono::nanoseconds::zero() &&
+                   result.Change() > tolerance;
+        }
+
+        unsigned runs;
+        unsigned warmup;
+        double tolerance = 0.05;
+        std::unordered_map<std::string, std::chrono::nanoseconds> baseline;
+        std::vector<Result> results;
+    };
+
+} /* namespace Canary */
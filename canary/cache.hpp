@@ -0,0 +1,159 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "storage.hpp"
+#include "tasks.hpp"
+
+namespace Canary {
+
+    /**
+        TaskCache
+
+        Remembers the digest of the inputs and parameters of every task
+        that succeeded, keyed by the message of the task, in a small
+        binary file. Pass it as the cache of the ExecutionOptions: tasks
+        that declare inputs or parameters are skipped, and printed as
+        cached, while their digest matches the one of their last
+        successful run. The messages of these tasks have to be unique.
+
+        The file starts with the magic "CNRYCCH" and a version byte,
+        followed by the number of entries and the entries, each the
+        length of the name, the name and the 64 bit digest. All integers
+        are little endian. A missing or broken file is an empty cache.
+
+        Example:
+
+            Canary::TaskCache cache(".canary-cache");
+
+            Canary::ExecutionOptions options;
+            options.cache = &cache;
+
+            graph.Add(Canary::CommandTask("Compile a.cpp", { "c++", "-c", "a.cpp" })
+                          .Inputs("a.cpp", "a.hpp")
+                          .Params("-O2"));
+            Canary::ExecuteGraph(graph, options);
+     */
+    class TaskCache : public DigestCache {
+    public:
+        // Loads the file, which is rewritten after executions that changed it
+        explicit TaskCache(std::string path = ".canary-cache") : path(std::move(path)) {
+            Load();
+        }
+
+        TaskCache(const TaskCache&) = delete;
+        TaskCache& operator=(const TaskCache&) = delete;
+
+        // True if the last successful run of the task had this digest
+        bool Fresh(const std::string& name, std::uint64_t digest) const override {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = digests.find(name);
+            return it != digests.end() && it->second == digest;
+        }
+
+        // Remember the digest of a successful run
+        void Store(const std::string& name, std::uint64_t digest) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto& stored = digests[name];
+            changed = changed || stored != digest;
+            stored = digest;
+        }
+
+        // The task failed, it has to run again next time
+        void Forget(const std::string& name) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            changed = digests.erase(name) > 0 || changed;
+        }
+
+        // Forget everything, all tasks run again
+        void Clear() {
+            std::lock_guard<std::mutex> lock(mutex);
+            changed = changed || !digests.empty();
+            digests.clear();
+        }
+
+        // Number of remembered tasks
+        std::size_t Size() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return digests.size();
+        }
+
+        /**
+            Read the file, replacing the remembered digests
+         */
+        void Load() {
+            std::unordered_map<std::string, std::uint64_t> loaded;
+
+            std::string data;
+            std::size_t pos = Magic().size();
+            std::uint64_t count = 0;
+            if (detail::ReadFile(path, data) && data.compare(0, pos, Magic()) == 0 &&
+                detail::ReadInteger(data, pos, 4, count)) {
+                for (std::uint64_t i = 0; i < count; ++i) {
+                    std::string name;
+                    std::uint64_t digest = 0;
+                    if (!detail::ReadString(data, pos, name) || !detail::ReadInteger(data, pos, 8, digest)) {
+                        loaded.clear();
+                        break;
+                    }
+                    loaded[std::move(name)] = digest;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            digests.swap(loaded);
+            changed = false;
+        }
+
+        /**
+            Write the file if anything changed since it was loaded or
+            saved, replacing it atomically
+         */
+        void Save() override {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!changed) return;
+
+            std::string data = Magic();
+            detail::WriteInteger(data, 4, digests.size());
+            for (const auto& entry : digests) {
+                detail::WriteString(data, entry.first);
+                detail::WriteInteger(data, 8, entry.second);
+            }
+
+            detail::ReplaceFile(path, data);
+            changed = false;
+        }
+
+    private:
+        // Magic and format version
+        static std::string Magic() {
+            return std::string("CNRYCCH\x01", 8);
+        }
+
+        std::string path;
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, std::uint64_t> digests;
+        bool changed = false;
+    };
+
+} /* namespace Canary */
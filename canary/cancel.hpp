@@ -0,0 +1,218 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace Canary {
+
+    /**
+        Thrown by tasks that stop early because they were cancelled
+     */
+    struct CancelledError : std::runtime_error {
+        CancelledError() : std::runtime_error("cancelled") {}
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+        Thrown by tasks that stop, or are failed, because they ran past
+        their deadline
+     */
+    struct DeadlineError : CancelledError {
+        using CancelledError::CancelledError;
+    };
+
+    namespace detail {
+
+        /**
+            The number of cancellations so far and the write end of a
+            pipe that gets a byte on every one, -1 if nobody listens.
+            The event loop of the coroutine tasks sleeps on the pipe and
+            only looks for cancelled waiters once the count changed.
+         */
+        inline std::atomic<unsigned long>& CancellationCount() {
+            static std::atomic<unsigned long> count{0};
+            return count;
+        }
+
+        inline std::atomic<int>& CancellationWakeFd() {
+            static std::atomic<int> fd{-1};
+            return fd;
+        }
+
+        // Only writes to a pipe, so it may be called from a signal handler
+        inline void NotifyCancellation() {
+            CancellationCount().fetch_add(1, std::memory_order_release);
+#if !defined(_WIN32)
+            int fd = CancellationWakeFd().load(std::memory_order_acquire);
+            if (fd >= 0) {
+                int saved = errno;
+                char byte = 0;
+                ssize_t written = ::write(fd, &byte, 1);
+                static_cast<void>(written);
+                errno = saved;
+            }
+#endif
+        }
+
+        /**
+            One level of cancellation: a flag and a deadline. Levels are
+            chained, a task is cancelled if its own level, the execution
+            or the source of the user is.
+         */
+        struct CancellationState {
+            using Clock = std::chrono::steady_clock;
+
+            explicit CancellationState(const CancellationState* parent = nullptr) : parent(parent) {}
+
+            void Cancel() {
+                cancelled.store(true, std::memory_order_relaxed);
+                NotifyCancellation();
+            }
+
+            bool Cancelled() const {
+                for (const CancellationState* state = this; state != nullptr; state = state->parent) {
+                    if (state->cancelled.load(std::memory_order_relaxed)) return true;
+                    if (state->deadline != Clock::time_point::max() && Clock::now() >= state->deadline) return true;
+                }
+                return false;
+            }
+
+            // True if only a deadline, not a cancellation, stops the task
+            bool Expired() const {
+                for (const CancellationState* state = this; state != nullptr; state = state->parent) {
+                    if (state->cancelled.load(std::memory_order_relaxed)) return false;
+                }
+                for (const CancellationState* state = this; state != nullptr; state = state->parent) {
+                    if (state->deadline != Clock::time_point::max() && Clock::now() >= state->deadline) return true;
+                }
+                return false;
+            }
+
+            std::atomic<bool> cancelled{false};
+            Clock::time_point deadline = Clock::time_point::max();
+            const CancellationState* parent;
+        };
+
+        // The cancellation of the task on the current thread
+        inline const CancellationState*& CurrentCancellationSlot() {
+            thread_local const CancellationState* current = nullptr;
+            return current;
+        }
+
+    } /* namespace detail */
+
+    /**
+        CancellationToken
+
+        Lets a task check if it should stop. Cancellation is cooperative:
+        long running tasks poll Cancelled() or call ThrowIfCancelled()
+        between steps. A default token is never cancelled.
+     */
+    class CancellationToken {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        CancellationToken() : state(nullptr) {}
+
+        explicit CancellationToken(const detail::CancellationState* state) : state(state) {}
+
+        bool Cancelled() const {
+            return state != nullptr && state->Cancelled();
+        }
+
+        /**
+            Throw a DeadlineError if the deadline passed, or a
+            CancelledError if the task was cancelled otherwise
+         */
+        void ThrowIfCancelled() const {
+            if (!Cancelled()) return;
+            if (state->Expired()) throw DeadlineError("deadline exceeded");
+            throw CancelledError();
+        }
+
+        // The earliest deadline, time_point::max() without one
+        Clock::time_point Deadline() const {
+            Clock::time_point deadline = Clock::time_point::max();
+            for (const detail::CancellationState* s = state; s != nullptr; s = s->parent) {
+                if (s->deadline < deadline) deadline = s->deadline;
+            }
+            return deadline;
+        }
+
+    private:
+        const detail::CancellationState* state;
+    };
+
+    /**
+        CancellationSource
+
+        Cancels executions from the outside, for example from a signal
+        handler or a UI thread. Pass it as the cancellation of the
+        ExecutionOptions: tasks that have not started are skipped and
+        the running ones see their token cancelled.
+     */
+    class CancellationSource {
+    public:
+        CancellationSource() : state(new detail::CancellationState()) {}
+
+        // Only sets a flag, so it may be called from a signal handler
+        void Cancel() {
+            state->Cancel();
+        }
+
+        bool Cancelled() const {
+            return state->Cancelled();
+        }
+
+        CancellationToken Token() const {
+            return CancellationToken(state.get());
+        }
+
+        const detail::CancellationState& State() const {
+            return *state;
+        }
+
+    private:
+        std::unique_ptr<detail::CancellationState> state;
+    };
+
+    /**
+        The token of the task that runs on the current thread, a token
+        that is never cancelled outside of tasks
+     */
+    inline CancellationToken CurrentCancellation() {
+        return CancellationToken(detail::CurrentCancellationSlot());
+    }
+
+    /**
+        True if the task on the current thread should stop
+     */
+    inline bool Cancelled() {
+        return CurrentCancellation().Cancelled();
+    }
+
+} /* namespace Canary */
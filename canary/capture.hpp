@@ -0,0 +1,410 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Canary {
+
+    /**
+        OutputBuffer
+
+        Collects the output of one task. The first bytes are kept in
+        memory, once the threshold is exceeded everything is moved into
+        an anonymous temporary file, so very chatty tasks do not grow
+        the memory.
+     */
+    class OutputBuffer {
+    public:
+        explicit OutputBuffer(std::size_t threshold = 1 << 20) : threshold(threshold) {}
+
+        OutputBuffer(OutputBuffer&& other)
+            : threshold(other.threshold), memory(std::move(other.memory)), file(other.file), size(other.size) {
+            other.file = nullptr;
+            other.size = 0;
+        }
+
+        OutputBuffer& operator=(OutputBuffer&& other) {
+            std::swap(threshold, other.threshold);
+            std::swap(memory, other.memory);
+            std::swap(file, other.file);
+            std::swap(size, other.size);
+            return *this;
+        }
+
+        OutputBuffer(const OutputBuffer&) = delete;
+        OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+        ~OutputBuffer() {
+            if (file != nullptr) std::fclose(file);
+        }
+
+        void Write(const char* data, std::size_t count) {
+            size += count;
+
+            if (file == nullptr && memory.size() + count > threshold) {
+                Spill();
+            }
+
+            if (file != nullptr) {
+                std::fwrite(data, 1, count, file);
+            } else {
+                memory.append(data, count);
+            }
+        }
+
+        std::size_t Size() const {
+            return size;
+        }
+
+        bool Empty() const {
+            return size == 0;
+        }
+
+        bool Spilled() const {
+            return file != nullptr;
+        }
+
+        /**
+            Calls fn(data, size) for consecutive pieces of the output
+         */
+        template<class F>
+        void ForEachChunk(F fn) const {
+            if (file == nullptr) {
+                if (!memory.empty()) fn(memory.data(), memory.size());
+                return;
+            }
+
+            char chunk[1 << 16];
+            std::fflush(file);
+            std::rewind(file);
+            std::size_t count;
+            while ((count = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+                fn(chunk, count);
+            }
+            std::fseek(file, 0, SEEK_END);
+        }
+
+        /**
+            Write the whole output to a stream, adding a final newline
+            if it is missing
+         */
+        void Replay(std::ostream& out) const {
+            char last = '\n';
+            ForEachChunk([&](const char* data, std::size_t count) {
+                out.write(data, static_cast<std::streamsize>(count));
+                last = data[count - 1];
+            });
+            if (last != '\n') out << '\n';
+        }
+
+        void Clear() {
+            if (file != nullptr) {
+                std::fclose(file);
+                file = nullptr;
+            }
+            memory.clear();
+            size = 0;
+        }
+
+    private:
+        void Spill() {
+            file = std::tmpfile();
+            if (file == nullptr) {
+                // No temporary file available, keep everything in memory
+                threshold = static_cast<std::size_t>(-1);
+                return;
+            }
+
+            std::fwrite(memory.data(), 1, memory.size(), file);
+            std::string().swap(memory);
+        }
+
+        std::size_t threshold;
+        std::string memory;
+        std::FILE* file = nullptr;
+        std::size_t size = 0;
+    };
+
+    namespace detail {
+
+        // The buffer the output of the current thread goes to
+        inline OutputBuffer*& CurrentOutputSlot() {
+            thread_local OutputBuffer* current = nullptr;
+            return current;
+        }
+
+        /**
+            RoutingStreambuf
+
+            Sends everything that is written to the capture buffer of the
+            writing thread, or to the fallback if the thread does not
+            capture. It has no put area, so each write is routed on its own.
+         */
+        class RoutingStreambuf : public std::streambuf {
+        public:
+            explicit RoutingStreambuf(std::streambuf* fallback) : fallback(fallback), stream(nullptr) {}
+
+            // Falls back to whatever buffer the stream has at the time of writing
+            explicit RoutingStreambuf(std::ostream& stream) : fallback(nullptr), stream(&stream) {}
+
+            std::streambuf* Fallback() const {
+                return stream != nullptr ? stream->rdbuf() : fallback;
+            }
+
+        protected:
+            int_type overflow(int_type ch) override {
+                if (traits_type::eq_int_type(ch, traits_type::eof())) return traits_type::not_eof(ch);
+
+                char c = traits_type::to_char_type(ch);
+                return xsputn(&c, 1) == 1 ? ch : traits_type::eof();
+            }
+
+            std::streamsize xsputn(const char* data, std::streamsize count) override {
+                if (OutputBuffer* output = CurrentOutputSlot()) {
+                    output->Write(data, static_cast<std::size_t>(count));
+                    return count;
+                }
+                return Fallback()->sputn(data, count);
+            }
+
+            int sync() override {
+                return CurrentOutputSlot() != nullptr ? 0 : Fallback()->pubsync();
+            }
+
+        private:
+            std::streambuf* fallback;
+            std::ostream* stream;
+        };
+
+        // One routed stream per thread and standard stream
+        template<std::ostream& (*Standard)()>
+        std::ostream& ThreadStream() {
+            thread_local RoutingStreambuf buffer(Standard());
+            thread_local std::ostream stream(&buffer);
+            return stream;
+        }
+
+        inline std::ostream& StandardOut() {
+            return std::cout;
+        }
+
+        inline std::ostream& StandardErr() {
+            return std::cerr;
+        }
+
+        /**
+            Routes std::cout and std::cerr through RoutingStreambufs while
+            it exists, so tasks that print directly are captured as well
+         */
+        class StandardStreamRedirect {
+        public:
+            StandardStreamRedirect() : out(std::cout.rdbuf()), err(std::cerr.rdbuf()) {
+                std::cout.flush();
+                std::cout.rdbuf(&out);
+                std::cerr.rdbuf(&err);
+            }
+
+            StandardStreamRedirect(const StandardStreamRedirect&) = delete;
+            StandardStreamRedirect& operator=(const StandardStreamRedirect&) = delete;
+
+            ~StandardStreamRedirect() {
+                std::cout.rdbuf(out.Fallback());
+                std::cerr.rdbuf(err.Fallback());
+            }
+
+            // True if the standard streams are already routed
+            static bool Active() {
+                return dynamic_cast<RoutingStreambuf*>(std::cout.rdbuf()) != nullptr;
+            }
+
+        private:
+            RoutingStreambuf out, err;
+        };
+
+    } /* namespace detail */
+
+    /**
+        The buffer that captures the output of the current thread,
+        nullptr if the output is not captured
+     */
+    inline OutputBuffer* CurrentOutput() {
+        return detail::CurrentOutputSlot();
+    }
+
+    /**
+        Stream for the output of in-process tasks. It writes into the
+        buffer of the running task, or to std::cout outside of a task.
+     */
+    inline std::ostream& Out() {
+        return detail::ThreadStream<detail::StandardOut>();
+    }
+
+    /**
+        Like Out(), but falls back to std::cerr. Inside a task both
+        streams go to the same buffer to keep their relative order.
+     */
+    inline std::ostream& Err() {
+        return detail::ThreadStream<detail::StandardErr>();
+    }
+
+    /**
+        CaptureScope
+
+        Captures the output of the current thread into a buffer while it
+        exists. Scopes can be nested, the previous buffer is restored at
+        the end.
+     */
+    class CaptureScope {
+    public:
+        explicit CaptureScope(OutputBuffer& buffer) : previous(detail::CurrentOutputSlot()) {
+            detail::CurrentOutputSlot() = &buffer;
+        }
+
+        CaptureScope(const CaptureScope&) = delete;
+        CaptureScope& operator=(const CaptureScope&) = delete;
+
+        ~CaptureScope() {
+            detail::CurrentOutputSlot() = previous;
+        }
+
+    private:
+        OutputBuffer* previous;
+    };
+
+#if !defined(_WIN32)
+    /**
+        CapturePipe
+
+        A pipe to capture the output of a subprocess: hand WriteEnd() to
+        the child as its stdout and stderr, close it in the parent and
+        drain the read end into an OutputBuffer. Both ends are close on
+        exec, dup2 in the child clears the flag for the copy.
+
+        Example:
+
+            Canary::CapturePipe pipe;
+            pid_t pid = fork();
+            if (pid == 0) {
+                dup2(pipe.WriteEnd(), 1);
+                dup2(pipe.WriteEnd(), 2);
+                execlp("make", "make", nullptr);
+                _exit(127);
+            }
+            pipe.CloseWriteEnd();
+            pipe.Drain(*Canary::CurrentOutput());
+     */
+    class CapturePipe {
+    public:
+        CapturePipe() {
+#if defined(__linux__)
+            // Atomically, another thread may spawn a process right now
+            int result = ::pipe2(fds, O_CLOEXEC);
+#else
+            int result = ::pipe(fds);
+            if (result == 0) {
+                ::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+                ::fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+            }
+#endif
+            if (result != 0) {
+                throw std::system_error(errno, std::generic_category(), "Canary::CapturePipe");
+            }
+        }
+
+        CapturePipe(const CapturePipe&) = delete;
+        CapturePipe& operator=(const CapturePipe&) = delete;
+
+        ~CapturePipe() {
+            Close(fds[0]);
+            Close(fds[1]);
+        }
+
+        int ReadEnd() const {
+            return fds[0];
+        }
+
+        int WriteEnd() const {
+            return fds[1];
+        }
+
+        void CloseWriteEnd() {
+            Close(fds[1]);
+        }
+
+        // Give up the ownership of the read end
+        int ReleaseReadEnd() {
+            return Release(fds[0]);
+        }
+
+        // Give up the ownership of the write end
+        int ReleaseWriteEnd() {
+            return Release(fds[1]);
+        }
+
+        /**
+            Read into the buffer until all writers closed the pipe
+         */
+        void Drain(OutputBuffer& buffer) {
+            while (Read(buffer) > 0) {}
+        }
+
+        /**
+            Read once into the buffer. Returns the number of bytes, 0 at
+            the end and -1 if a non-blocking read end has no data.
+         */
+        long Read(OutputBuffer& buffer) {
+            char chunk[1 << 16];
+            for (;;) {
+                ssize_t count = ::read(fds[0], chunk, sizeof(chunk));
+                if (count > 0) buffer.Write(chunk, static_cast<std::size_t>(count));
+                if (count >= 0) return static_cast<long>(count);
+                if (errno != EINTR) return -1;
+            }
+        }
+
+    private:
+        static int Release(int& fd) {
+            int released = fd;
+            fd = -1;
+            return released;
+        }
+
+        static void Close(int& fd) {
+            if (fd >= 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+
+        int fds[2] = { -1, -1 };
+    };
+#endif
+
+} /* namespace Canary */
@@ -0,0 +1,461 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#if !defined(_WIN32)
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "cancel.hpp"
+#include "capture.hpp"
+#include "tasks.hpp"
+#include "usage.hpp"
+
+extern char** environ;
+
+namespace Canary {
+
+    /**
+        Thrown if a command could not be started or did not exit
+        successfully
+     */
+    struct CommandError : std::runtime_error {
+        CommandError(const std::string& message, int status = -1)
+            : std::runtime_error(message), status(status) {}
+
+        // The raw status of waitpid, -1 if the command did not start
+        int status;
+    };
+
+    namespace detail {
+
+        /**
+            The output of a command while the reactor drains it. The
+            command may stop waiting for the rest, then it sets buffer
+            to nullptr and the reactor closes the pipe.
+         */
+        struct PipeDrain {
+            explicit PipeDrain(OutputBuffer* buffer) : buffer(buffer) {}
+
+            std::mutex mutex;
+            std::condition_variable changed;
+            OutputBuffer* buffer;
+            bool drained = false;
+        };
+
+        /**
+            PipeReactor
+
+            One thread that drains the output pipes of all running
+            commands with poll, instead of a reader thread per child.
+            The pollfd list is only rebuilt when pipes are added or
+            closed, a self-pipe wakes the thread up for new pipes.
+         */
+        class PipeReactor {
+        public:
+            static PipeReactor& Instance() {
+                static PipeReactor reactor;
+                return reactor;
+            }
+
+            /**
+                Read from the non-blocking fd into the buffer of the drain
+                until the end, then close the fd and set drained
+             */
+            void Add(int fd, std::shared_ptr<PipeDrain> drain) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    added.push_back(Watch{ fd, std::move(drain) });
+                }
+                Wake();
+            }
+
+            // Stop reading for the drain and close its pipe
+            void Detach(PipeDrain& drain) {
+                {
+                    std::lock_guard<std::mutex> lock(drain.mutex);
+                    drain.buffer = nullptr;
+                }
+                Wake();
+            }
+
+            ~PipeReactor() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stopped = true;
+                }
+                Wake();
+                thread.join();
+
+                ::close(wake[0]);
+                ::close(wake[1]);
+            }
+
+        private:
+            struct Watch {
+                int fd;
+                std::shared_ptr<PipeDrain> drain;
+            };
+
+            PipeReactor() {
+                CapturePipe pipe;
+                wake[0] = pipe.ReleaseReadEnd();
+                wake[1] = pipe.ReleaseWriteEnd();
+                ::fcntl(wake[0], F_SETFL, O_NONBLOCK);
+                ::fcntl(wake[1], F_SETFL, O_NONBLOCK);
+
+                thread = std::thread(&PipeReactor::Loop, this);
+            }
+
+            void Wake() {
+                char byte = 0;
+                while (::write(wake[1], &byte, 1) < 0 && errno == EINTR) {}
+            }
+
+            void Loop() {
+                std::vector<pollfd> fds(1, pollfd{ wake[0], POLLIN, 0 });
+                std::vector<Watch> watches;
+                char chunk[1 << 16];
+
+                for (;;) {
+                    if (::poll(fds.data(), fds.size(), -1) < 0) {
+                        if (errno == EINTR) continue;
+                        break;
+                    }
+
+                    if (fds[0].revents != 0) {
+                        while (::read(wake[0], chunk, sizeof(chunk)) > 0) {}
+
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (stopped && added.empty() && watches.empty()) return;
+                        for (Watch& watch : added) {
+                            fds.push_back(pollfd{ watch.fd, POLLIN, 0 });
+                            watches.push_back(std::move(watch));
+                        }
+                        added.clear();
+
+                        // Pipes that a background process keeps open after
+                        // their command gave up on them
+                        for (std::size_t i = 1; i < fds.size();) {
+                            if (Detached(*watches[i - 1].drain)) {
+                                ::close(watches[i - 1].fd);
+                                Remove(fds, watches, i);
+                            } else {
+                                ++i;
+                            }
+                        }
+                    }
+
+                    // Drain the readable pipes, drop the closed ones
+                    for (std::size_t i = 1; i < fds.size();) {
+                        if (fds[i].revents == 0) {
+                            ++i;
+                            continue;
+                        }
+
+                        Watch& watch = watches[i - 1];
+                        PipeDrain& drain = *watch.drain;
+                        ssize_t count;
+                        while ((count = ::read(watch.fd, chunk, sizeof(chunk))) > 0) {
+                            std::lock_guard<std::mutex> lock(drain.mutex);
+                            if (drain.buffer != nullptr) drain.buffer->Write(chunk, static_cast<std::size_t>(count));
+                        }
+
+                        if (count == 0 || (errno != EAGAIN && errno != EINTR)) {
+                            ::close(watch.fd);
+                            {
+                                std::lock_guard<std::mutex> lock(drain.mutex);
+                                drain.drained = true;
+                                drain.changed.notify_all();
+                            }
+                            Remove(fds, watches, i);
+                        } else {
+                            fds[i].revents = 0;
+                            ++i;
+                        }
+                    }
+
+                    if (watches.empty()) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (stopped && added.empty()) return;
+                    }
+                }
+            }
+
+            static bool Detached(PipeDrain& drain) {
+                std::lock_guard<std::mutex> lock(drain.mutex);
+                return drain.buffer == nullptr;
+            }
+
+            static void Remove(std::vector<pollfd>& fds, std::vector<Watch>& watches, std::size_t i) {
+                fds[i] = fds.back();
+                fds.pop_back();
+                watches[i - 1] = std::move(watches.back());
+                watches.pop_back();
+            }
+
+            int wake[2];
+            std::mutex mutex;
+            std::vector<Watch> added;
+            bool stopped = false;
+            std::thread thread;
+        };
+
+        // "exited with status 2" or "killed by signal 9"
+        inline std::string DescribeStatus(int status) {
+            if (WIFEXITED(status)) {
+                return "exited with status " + std::to_string(WEXITSTATUS(status));
+            }
+            if (WIFSIGNALED(status)) {
+                return "killed by signal " + std::to_string(WTERMSIG(status)) + " (" + strsignal(WTERMSIG(status)) + ")";
+            }
+            return "stopped with status " + std::to_string(status);
+        }
+
+        /**
+            Wait until the command exited and its output is drained,
+            and return the status of waitpid. Processes the command
+            left running in the background may keep the pipe open, so
+            the rest of the output is only waited for a short while
+            after the exit. If the task is cancelled, the process group
+            of the command gets a SIGTERM, and a SIGKILL a second later
+            if it is still running.
+         */
+        inline int WaitForCommand(pid_t pid, PipeDrain& drain, rusage& usage) {
+            using Clock = std::chrono::steady_clock;
+            const std::chrono::milliseconds linger(100), grace(1000);
+
+            CancellationToken token = CurrentCancellation();
+            int status = 0;
+            bool exited = false;
+            bool terminated = false, killed = false;
+            Clock::time_point exitedAt, terminatedAt;
+
+            // The end of the pipe wakes us up, the exit does not. It
+            // usually follows right after, so it is polled for quickly.
+            const std::chrono::microseconds shortest(50), longest(20000);
+            std::chrono::microseconds interval = longest;
+            bool drained = false;
+
+            std::unique_lock<std::mutex> lock(drain.mutex);
+            for (;;) {
+                if (!exited) {
+                    pid_t result;
+                    while ((result = ::wait4(pid, &status, WNOHANG, &usage)) < 0 && errno == EINTR) {}
+                    if (result != 0) {
+                        exited = true;
+                        exitedAt = Clock::now();
+                    }
+                }
+                if (exited && drain.drained) break;
+                if (drain.drained && !drained) {
+                    drained = true;
+                    interval = shortest;
+                }
+
+                Clock::time_point now = Clock::now();
+                if (exited && now - exitedAt >= linger) {
+                    lock.unlock();
+                    PipeReactor::Instance().Detach(drain);
+                    break;
+                }
+
+                // Only while the group leader is not reaped, its id is ours
+                if (!exited && token.Cancelled()) {
+                    if (!terminated) {
+                        ::killpg(pid, SIGTERM);
+                        terminated = true;
+                        terminatedAt = now;
+                    } else if (!killed && now - terminatedAt >= grace) {
+                        ::killpg(pid, SIGKILL);
+                        killed = true;
+                    }
+                }
+
+                drain.changed.wait_for(lock, interval);
+                interval = std::min(2 * interval, longest);
+            }
+            return status;
+        }
+
+    } /* namespace detail */
+
+    /**
+        Command
+
+        An external program that is started with posix_spawnp. Its
+        stdout and stderr go through one pipe into an OutputBuffer, which
+        the shared reactor thread fills while the command runs. Stdin is
+        /dev/null.
+
+        Example:
+
+            Canary::Command({ "make", "-j4" })();
+            Canary::Command::Shell("ls | wc -l")();
+
+        Commands run in a process group of their own. If the task that
+        runs the command is cancelled, or runs past its deadline, the
+        group gets a SIGTERM, so it reaches the processes a shell
+        started as well. The command has finished once it exited;
+        processes it left running in the background do not hold up the
+        task.
+     */
+    class Command {
+    public:
+        explicit Command(std::vector<std::string> args) : args(std::move(args)) {
+            if (this->args.empty()) {
+                throw std::invalid_argument("Canary::Command: empty argument list");
+            }
+            name = this->args[0];
+        }
+
+        // Run a script with /bin/sh
+        static Command Shell(std::string script) {
+            Command command({ "/bin/sh", "-c", script });
+            command.name = std::move(script);
+            return command;
+        }
+
+        const std::vector<std::string>& Arguments() const {
+            return args;
+        }
+
+        /**
+            Run the command, capture its output into the buffer and
+            return the status of waitpid. Throws a CommandError if the
+            command could not be started.
+         */
+        int Run(OutputBuffer& output) const {
+            CapturePipe pipe;
+            ::fcntl(pipe.ReadEnd(), F_SETFL, O_NONBLOCK);
+
+            std::vector<char*> argv;
+            argv.reserve(args.size() + 1);
+            for (const std::string& arg : args) {
+                argv.push_back(const_cast<char*>(arg.c_str()));
+            }
+            argv.push_back(nullptr);
+
+            posix_spawn_file_actions_t actions;
+            posix_spawn_file_actions_init(&actions);
+            posix_spawn_file_actions_addopen(&actions, 0, "/dev/null", O_RDONLY, 0);
+            posix_spawn_file_actions_adddup2(&actions, pipe.WriteEnd(), 1);
+            posix_spawn_file_actions_adddup2(&actions, pipe.WriteEnd(), 2);
+
+            // A group of its own, to signal what a shell started as well
+            posix_spawnattr_t attributes;
+            posix_spawnattr_init(&attributes);
+            posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+            posix_spawnattr_setpgroup(&attributes, 0);
+
+            pid_t pid;
+            int error = posix_spawnp(&pid, argv[0], &actions, &attributes, argv.data(), environ);
+            posix_spawn_file_actions_destroy(&actions);
+            posix_spawnattr_destroy(&attributes);
+
+            if (error != 0) {
+                throw CommandError("cannot start '" + args[0] + "': " + std::strerror(error));
+            }
+
+            // Only the child writes now, the reactor sees the end once it
+            // and everything it started closed the pipe
+            pipe.CloseWriteEnd();
+
+            // Shared, the reactor may still hold it after we gave up on it
+            std::shared_ptr<detail::PipeDrain> drain = std::make_shared<detail::PipeDrain>(&output);
+            detail::PipeReactor::Instance().Add(pipe.ReleaseReadEnd(), drain);
+
+            // The CPU time and memory of the command count for the task
+            rusage usage = rusage();
+            int status = detail::WaitForCommand(pid, *drain, usage);
+            if (ResourceUsage* current = detail::CurrentUsageSlot()) {
+                detail::AddChildUsage(*current, usage);
+            }
+            return status;
+        }
+
+        /**
+            Run the command into the capture buffer of the current task,
+            or print its output afterwards if nothing is captured. Throws
+            a CancelledError if the task was cancelled meanwhile, or a
+            CommandError if the command fails.
+         */
+        void operator()() const {
+            OutputBuffer* output = CurrentOutput();
+            OutputBuffer local;
+
+            int status = Run(output != nullptr ? *output : local);
+            local.Replay(Out());
+
+            CurrentCancellation().ThrowIfCancelled();
+
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                throw CommandError("'" + name + "' " + detail::DescribeStatus(status), status);
+            }
+        }
+
+    private:
+        std::vector<std::string> args;
+
+        // Shown in error messages
+        std::string name;
+    };
+
+    /**
+        CommandTask
+
+        A task that runs an external command. The task fails, and is
+        printed in red, if the command exits with a non-zero status.
+
+        Example:
+
+            graph.Add(Canary::CommandTask(Canary::Emoji::hammer, "Compile a.cpp", { "c++", "-c", "a.cpp" }));
+     */
+    struct CommandTask : Task {
+        CommandTask(std::string emoji, std::string msg, std::vector<std::string> args)
+            : Task(std::move(emoji), std::move(msg), Command(std::move(args))) {}
+
+        CommandTask(std::string msg, std::vector<std::string> args)
+            : Task(std::move(msg), Command(std::move(args))) {}
+
+        CommandTask(std::string emoji, std::string msg, Command command)
+            : Task(std::move(emoji), std::move(msg), std::move(command)) {}
+    };
+
+} /* namespace Canary */
+
+#endif
@@ -0,0 +1,205 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "emoji/common.hpp"
+
+namespace Canary {
+
+    namespace Emoji {
+
+        /**
+            The Fitzpatrick skin tones, U+1F3FB to U+1F3FF
+         */
+        enum class Tone : std::uint8_t {
+            None,
+            Light,
+            MediumLight,
+            Medium,
+            MediumDark,
+            Dark
+        };
+
+        /**
+            The gender signs of ZWJ sequences, U+2640 and U+2642
+         */
+        enum class Gender : std::uint8_t {
+            None,
+            Woman,
+            Man
+        };
+
+    } /* namespace Emoji */
+
+    namespace detail {
+
+        /**
+            Indices 0 to N - 1 as a pack
+         */
+        template<std::size_t... I>
+        struct Indices {};
+
+        template<std::size_t N, std::size_t... I>
+        struct MakeIndicesImpl : MakeIndicesImpl<N - 1, N - 1, I...> {};
+
+        template<std::size_t... I>
+        struct MakeIndicesImpl<0, I...> {
+            using Type = Indices<I...>;
+        };
+
+        template<std::size_t N>
+        using MakeIndices = typename MakeIndicesImpl<N>::Type;
+
+        /**
+            A composed emoji as a static literal, like the constants
+         */
+        template<char... S>
+        struct EmojiLiteral {
+            static constexpr char Value[sizeof...(S) + 1] = { S..., 0 };
+        };
+
+        template<char... S>
+        constexpr char EmojiLiteral<S...>::Value[sizeof...(S) + 1];
+
+        // The length of a constant without its trailing space
+        constexpr std::size_t BaseLength(const char* base, std::size_t i = 0) {
+            return base[i] == ' ' || base[i] == '\0' ? i : BaseLength(base, i + 1);
+        }
+
+        // The length of the UTF-8 sequence of a lead byte
+        constexpr std::size_t LeadLength(char lead) {
+            return static_cast<unsigned char>(lead) < 0x80 ? 1
+                : static_cast<unsigned char>(lead) < 0xE0 ? 2
+                : static_cast<unsigned char>(lead) < 0xF0 ? 3
+                : 4;
+        }
+
+        // The bytes of U+FE0F VARIATION SELECTOR-16 after the first code
+        // point, which a skin tone replaces: 261D FE0F becomes 261D 1F3FB
+        constexpr std::size_t SelectorAfterFirst(const char* base, Emoji::Tone tone) {
+            return tone != Emoji::Tone::None
+                && BaseLength(base) >= LeadLength(base[0]) + 3
+                && base[LeadLength(base[0])] == '\xEF'
+                && base[LeadLength(base[0]) + 1] == '\xB8'
+                && base[LeadLength(base[0]) + 2] == '\x8F' ? 3 : 0;
+        }
+
+        constexpr std::size_t ComposedLength(const char* base, Emoji::Tone tone, Emoji::Gender gender) {
+            return BaseLength(base) - SelectorAfterFirst(base, tone)
+                + (tone != Emoji::Tone::None ? 4 : 0)
+                + (gender != Emoji::Gender::None ? 9 : 0)
+                + 1;
+        }
+
+        // The UTF-8 of a skin tone, F0 9F 8F BB to F0 9F 8F BF
+        constexpr char ToneByte(Emoji::Tone tone, std::size_t i) {
+            return i == 0 ? '\xF0' : i == 1 ? '\x9F' : i == 2 ? '\x8F' : static_cast<char>(0xBA + static_cast<unsigned>(tone));
+        }
+
+        // ZWJ, the gender sign and VARIATION SELECTOR-16
+        constexpr char GenderByte(Emoji::Gender gender, std::size_t i) {
+            return i < 3 ? "\xE2\x80\x8D"[i]
+                : i < 6 ? (gender == Emoji::Gender::Woman ? "\xE2\x99\x80" : "\xE2\x99\x82")[i - 3]
+                : "\xEF\xB8\x8F"[i - 6];
+        }
+
+        // After the tone: the rest of the base, the gender and the space
+        constexpr char RestByte(const char* base, std::size_t skip, Emoji::Gender gender, std::size_t i) {
+            return i < BaseLength(base) - LeadLength(base[0]) - skip
+                ? base[LeadLength(base[0]) + skip + i]
+                : gender != Emoji::Gender::None && i - (BaseLength(base) - LeadLength(base[0]) - skip) < 9
+                    ? GenderByte(gender, i - (BaseLength(base) - LeadLength(base[0]) - skip))
+                    : ' ';
+        }
+
+        /**
+            Byte i of the composed emoji: the first code point of the
+            base, the tone, the rest of the base, the gender sequence
+            and a space. The tone follows the first code point as that
+            is the modifier base in every sequence the constants have,
+            like U+1F469 of woman_technologist.
+         */
+        constexpr char ComposedByte(const char* base, Emoji::Tone tone, Emoji::Gender gender, std::size_t i) {
+            return i < LeadLength(base[0])
+                ? base[i]
+                : tone != Emoji::Tone::None && i - LeadLength(base[0]) < 4
+                    ? ToneByte(tone, i - LeadLength(base[0]))
+                    : RestByte(base, SelectorAfterFirst(base, tone), gender,
+                        i - LeadLength(base[0]) - (tone != Emoji::Tone::None ? 4 : 0));
+        }
+
+        template<const char* Base, Emoji::Tone tone, Emoji::Gender gender, class I>
+        struct ComposeImpl;
+
+        template<const char* Base, Emoji::Tone tone, Emoji::Gender gender, std::size_t... I>
+        struct ComposeImpl<Base, tone, gender, Indices<I...>> {
+            static_assert(tone == Emoji::Tone::None || EmojiModifiers<Base>::tone,
+                "the base of a skin tone has to be an Emoji_Modifier_Base, a person or a hand like ok_hand");
+            static_assert(gender == Emoji::Gender::None || EmojiModifiers<Base>::gender,
+                "the base of a gender has to be a neutral person like construction_worker_man, not a ZWJ sequence like policewoman");
+
+            using Type = EmojiLiteral<ComposedByte(Base, tone, gender, I)...>;
+        };
+
+    } /* namespace detail */
+
+    namespace Emoji {
+
+        /**
+            Compose
+
+            A base emoji with a skin tone and a gender, composed into a
+            static literal at compile time. Value is a constexpr character
+            array that ends in a space like the constants, so Length() and
+            View() work on it and nothing is built at runtime.
+
+            The base is a constant of emoji.hpp for a person or a hand. A
+            gender turns a neutral base into a ZWJ sequence, so it needs a
+            base without one: construction_worker_man, which is the neutral
+            U+1F477, but not construction_worker_woman. Bases that Unicode
+            has no such sequences for, like rocket with a tone, are
+            rejected at compile time.
+
+            Example:
+
+                using Canary::Emoji::Tone;
+                using Canary::Emoji::Gender;
+
+                // 👷🏽‍♀️
+                std::cout << Canary::Emoji::Compose<Canary::Emoji::construction_worker_man, Tone::Medium, Gender::Woman>::Value
+                          << "Deploying" << std::endl;
+
+                // 👌🏿
+                std::cout << Canary::Emoji::WithTone<Canary::Emoji::ok_hand, Tone::Dark>::Value << "Approved" << std::endl;
+         */
+        template<const char* Base, Tone tone = Tone::None, Gender gender = Gender::None>
+        using Compose = typename detail::ComposeImpl<
+            Base, tone, gender, detail::MakeIndices<detail::ComposedLength(Base, tone, gender)>
+        >::Type;
+
+        template<const char* Base, Tone tone>
+        using WithTone = Compose<Base, tone, Gender::None>;
+
+        template<const char* Base, Gender gender>
+        using WithGender = Compose<Base, Tone::None, gender>;
+
+    } /* namespace Emoji */
+
+} /* namespace Canary */
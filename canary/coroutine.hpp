@@ -0,0 +1,641 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+// Coroutine tasks need C++20 and poll
+#if defined(__cpp_impl_coroutine) && defined(__has_include) && !defined(_WIN32)
+#if __has_include(<coroutine>)
+#define CANARY_COROUTINES 1
+#endif
+#endif
+
+#if defined(CANARY_COROUTINES)
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "cancel.hpp"
+#include "capture.hpp"
+#include "tasks.hpp"
+#include "usage.hpp"
+
+namespace Canary {
+
+    /**
+        Async
+
+        The result type of coroutines that run as tasks. An Async starts
+        when it is awaited, or when the runner starts it as the body of
+        an AsyncTask, and rethrows its exception into the awaiting
+        coroutine.
+
+        Example:
+
+            Canary::Async Fetch() {
+                co_await Canary::SleepFor(std::chrono::milliseconds(100));
+            }
+
+            Canary::Async Build() {
+                co_await Fetch();
+                int status = co_await Canary::ChildExit(pid);
+            }
+     */
+    class Async {
+    public:
+        struct promise_type;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        struct promise_type {
+            std::exception_ptr error;
+
+            // The coroutine that awaits this one
+            std::coroutine_handle<> continuation;
+
+            // Called when a started coroutine finishes that nobody awaits
+            void (*completion)(void*, std::exception_ptr) = nullptr;
+            void* completionContext = nullptr;
+
+            struct FinalAwaiter {
+                bool await_ready() noexcept {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(Handle handle) noexcept {
+                    promise_type& promise = handle.promise();
+                    if (promise.continuation) return promise.continuation;
+
+                    // A started coroutine owns its frame
+                    auto completion = promise.completion;
+                    void* context = promise.completionContext;
+                    std::exception_ptr error = std::move(promise.error);
+                    handle.destroy();
+
+                    completion(context, std::move(error));
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() noexcept {}
+            };
+
+            Async get_return_object() {
+                return Async(Handle::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() {}
+
+            void unhandled_exception() {
+                error = std::current_exception();
+            }
+        };
+
+        Async(Async&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+        Async& operator=(Async&& other) noexcept {
+            std::swap(handle, other.handle);
+            return *this;
+        }
+
+        Async(const Async&) = delete;
+        Async& operator=(const Async&) = delete;
+
+        ~Async() {
+            if (handle) handle.destroy();
+        }
+
+        // Run the child until it finishes, then continue the awaiting coroutine
+        auto operator co_await() && noexcept {
+            struct Awaiter {
+                Handle child;
+
+                bool await_ready() noexcept {
+                    return !child || child.done();
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                    child.promise().continuation = awaiting;
+                    return child;
+                }
+
+                void await_resume() {
+                    if (child && child.promise().error) std::rethrow_exception(child.promise().error);
+                }
+            };
+            return Awaiter{ handle };
+        }
+
+        /**
+            Run the coroutine until its first suspension, it frees itself
+            when it finishes. completion(context, error) is called then,
+            on the thread that resumed it last.
+         */
+        void Start(void (*completion)(void*, std::exception_ptr), void* context) && {
+            Handle started = std::exchange(handle, nullptr);
+            started.promise().completion = completion;
+            started.promise().completionContext = context;
+            started.resume();
+        }
+
+    private:
+        explicit Async(Handle handle) : handle(handle) {}
+
+        Handle handle;
+    };
+
+    namespace detail {
+
+        // wait4 that adds the usage of the reaped child to the task
+        inline bool Reap(pid_t pid, int* status, ResourceUsage* usage, int options) {
+            rusage child;
+            pid_t reaped;
+            while ((reaped = ::wait4(pid, status, options, &child)) < 0 && errno == EINTR) {}
+            if (reaped != pid) return false;
+
+            if (usage != nullptr) AddChildUsage(*usage, child);
+            return true;
+        }
+
+        /**
+            EventLoop
+
+            One thread that resumes suspended coroutine tasks when their
+            timer expires, their fd gets ready or their child exits. Each
+            waiter remembers the capture buffer and the cancellation of the
+            task that suspended, which are restored while it is resumed.
+
+            Like the PipeReactor, the pollfd list only changes when waiters
+            come and go, and timers wait in a heap, so a wakeup only costs
+            what became ready. Waiters of cancelled tasks are resumed early,
+            so the awaitables can throw a CancelledError. The loop sleeps
+            until the next deadline of a task at most and cancellations
+            wake it up through its self-pipe; only then it looks at all
+            waiters.
+         */
+        class EventLoop {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            static EventLoop& Instance() {
+                static EventLoop loop;
+                return loop;
+            }
+
+            void AddTimer(Clock::time_point time, std::coroutine_handle<> handle) {
+                Add(Waiter{ Kind::Timer, time, -1, 0, 0, nullptr, handle });
+            }
+
+            void AddFd(int fd, short events, short* revents, std::coroutine_handle<> handle) {
+                Add(Waiter{ Kind::Fd, Clock::time_point::max(), fd, events, 0, revents, handle });
+            }
+
+            void AddChild(pid_t pid, int* status, std::coroutine_handle<> handle) {
+                // Without pidfds, the children are polled with waitpid
+                Waiter waiter{ Kind::Child, Clock::now() + ChildInterval(), -1, POLLIN, pid, nullptr, handle };
+                waiter.status = status;
+#if defined(SYS_pidfd_open)
+                waiter.fd = static_cast<int>(::syscall(SYS_pidfd_open, pid, 0));
+#endif
+                Add(std::move(waiter));
+            }
+
+            ~EventLoop() {
+                CancellationWakeFd().store(-1, std::memory_order_release);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stopped = true;
+                }
+                Wake();
+                thread.join();
+
+                ::close(wake[0]);
+                ::close(wake[1]);
+            }
+
+        private:
+            enum class Kind { Timer, Fd, Child };
+
+            struct Waiter {
+                Kind kind;
+                Clock::time_point time;
+                int fd;
+                short events;
+                pid_t pid;
+                short* revents;
+                std::coroutine_handle<> handle;
+
+                int* status = nullptr;
+                bool terminated = false;
+                OutputBuffer* output = CurrentOutputSlot();
+                const CancellationState* cancellation = CurrentCancellationSlot();
+                ResourceUsage* usage = CurrentUsageSlot();
+                Clock::time_point deadline = CancellationToken(CurrentCancellationSlot()).Deadline();
+            };
+
+            // Orders the timer heap, the earliest on top
+            struct Later {
+                bool operator()(const Waiter& a, const Waiter& b) const {
+                    return a.time > b.time;
+                }
+            };
+
+            static std::chrono::milliseconds ChildInterval() {
+                return std::chrono::milliseconds(20);
+            }
+
+            EventLoop() {
+                CapturePipe pipe;
+                wake[0] = pipe.ReleaseReadEnd();
+                wake[1] = pipe.ReleaseWriteEnd();
+                ::fcntl(wake[0], F_SETFL, O_NONBLOCK);
+                ::fcntl(wake[1], F_SETFL, O_NONBLOCK);
+                CancellationWakeFd().store(wake[1], std::memory_order_release);
+
+                thread = std::thread(&EventLoop::Loop, this);
+            }
+
+            void Add(Waiter waiter) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    added.push_back(std::move(waiter));
+                }
+                Wake();
+            }
+
+            void Wake() {
+                char byte = 0;
+                while (::write(wake[1], &byte, 1) < 0 && errno == EINTR) {}
+            }
+
+            void Resume(const Waiter& waiter) {
+                CurrentOutputSlot() = waiter.output;
+                CurrentCancellationSlot() = waiter.cancellation;
+                CurrentUsageSlot() = waiter.usage;
+                waiter.handle.resume();
+                CurrentOutputSlot() = nullptr;
+                CurrentCancellationSlot() = nullptr;
+                CurrentUsageSlot() = nullptr;
+            }
+
+            // A waiter with an fd goes into the pollfd list, the others into the timer heap
+            void Insert(Waiter waiter) {
+                if (waiter.deadline != Clock::time_point::max()) {
+                    deadlines.push_back(waiter.deadline);
+                    std::push_heap(deadlines.begin(), deadlines.end(), std::greater<Clock::time_point>());
+                }
+
+                if (waiter.fd >= 0) {
+                    fds.push_back(pollfd{ waiter.fd, waiter.events, 0 });
+                    polled.push_back(std::move(waiter));
+                } else {
+                    timers.push_back(std::move(waiter));
+                    std::push_heap(timers.begin(), timers.end(), Later());
+                }
+            }
+
+            void RemovePolled(std::size_t i) {
+                fds[i] = fds.back();
+                fds.pop_back();
+                polled[i - 1] = std::move(polled.back());
+                polled.pop_back();
+            }
+
+            // The fd of the waiter has events, true if it is done
+            bool Ready(Waiter& waiter, short revents) {
+                if (waiter.kind == Kind::Fd) {
+                    *waiter.revents = revents;
+                    return true;
+                }
+
+                // The pidfd is readable once the child exited
+                Reap(waiter.pid, waiter.status, waiter.usage, WNOHANG);
+                ::close(waiter.fd);
+                return true;
+            }
+
+            // True if the task of the waiter was cancelled. Children get a
+            // SIGTERM instead and are still waited for, to reap them.
+            static bool Abandoned(Waiter& waiter) {
+                if (waiter.cancellation == nullptr || !waiter.cancellation->Cancelled()) return false;
+                if (waiter.kind != Kind::Child) return true;
+
+                if (!waiter.terminated) {
+                    ::kill(waiter.pid, SIGTERM);
+                    waiter.terminated = true;
+                }
+                return false;
+            }
+
+            // After a cancellation or a deadline, move the waiters of cancelled tasks to ready
+            void Cancel(std::vector<Waiter>& ready) {
+                for (std::size_t i = 1; i < fds.size();) {
+                    if (Abandoned(polled[i - 1])) {
+                        ready.push_back(std::move(polled[i - 1]));
+                        RemovePolled(i);
+                    } else {
+                        ++i;
+                    }
+                }
+
+                auto end = std::stable_partition(timers.begin(), timers.end(), [](Waiter& waiter) {
+                    return !Abandoned(waiter);
+                });
+                std::move(end, timers.end(), std::back_inserter(ready));
+                timers.erase(end, timers.end());
+                std::make_heap(timers.begin(), timers.end(), Later());
+            }
+
+            void Loop() {
+                fds.assign(1, pollfd{ wake[0], POLLIN, 0 });
+                unsigned long cancellations = CancellationCount().load(std::memory_order_acquire);
+                std::vector<Waiter> ready;
+                char buffer[256];
+
+                for (;;) {
+                    bool scan = false;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (stopped && added.empty() && polled.empty() && timers.empty()) return;
+                        for (Waiter& waiter : added) {
+                            // Its task may have been cancelled before we last looked
+                            if (waiter.cancellation != nullptr && waiter.cancellation->Cancelled()) scan = true;
+                            Insert(std::move(waiter));
+                        }
+                        added.clear();
+                    }
+
+                    // Sleep until the next timer or deadline
+                    Clock::time_point now = Clock::now();
+                    Clock::time_point until = Clock::time_point::max();
+                    if (!timers.empty()) until = timers.front().time;
+                    if (!deadlines.empty()) until = std::min(until, deadlines.front());
+
+                    int timeout = scan ? 0 : -1;
+                    if (!scan && until != Clock::time_point::max()) {
+                        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(until - now).count() + 1;
+                        timeout = static_cast<int>(std::max<long long>(0, std::min<long long>(wait, 1000)));
+                    }
+
+                    if (::poll(fds.data(), fds.size(), timeout) < 0 && errno != EINTR) return;
+                    if (fds[0].revents != 0) {
+                        while (::read(wake[0], buffer, sizeof(buffer)) > 0) {}
+                        fds[0].revents = 0;
+                    }
+
+                    // Resume after collecting, resumed coroutines add new waiters
+                    for (std::size_t i = 1; i < fds.size();) {
+                        if (fds[i].revents != 0 && Ready(polled[i - 1], fds[i].revents)) {
+                            ready.push_back(std::move(polled[i - 1]));
+                            RemovePolled(i);
+                        } else {
+                            fds[i].revents = 0;
+                            ++i;
+                        }
+                    }
+
+                    now = Clock::now();
+                    while (!timers.empty() && timers.front().time <= now) {
+                        std::pop_heap(timers.begin(), timers.end(), Later());
+                        Waiter& waiter = timers.back();
+                        if (waiter.kind == Kind::Timer || Reap(waiter.pid, waiter.status, waiter.usage, WNOHANG)) {
+                            ready.push_back(std::move(waiter));
+                            timers.pop_back();
+                        } else {
+                            waiter.time = now + ChildInterval();
+                            std::push_heap(timers.begin(), timers.end(), Later());
+                        }
+                    }
+
+                    while (!deadlines.empty() && deadlines.front() <= now) {
+                        std::pop_heap(deadlines.begin(), deadlines.end(), std::greater<Clock::time_point>());
+                        deadlines.pop_back();
+                        scan = true;
+                    }
+
+                    unsigned long count = CancellationCount().load(std::memory_order_acquire);
+                    if (count != cancellations) {
+                        cancellations = count;
+                        scan = true;
+                    }
+                    if (scan) Cancel(ready);
+
+                    for (const Waiter& waiter : ready) {
+                        Resume(waiter);
+                    }
+                    ready.clear();
+                }
+            }
+
+            int wake[2];
+            std::mutex mutex;
+            std::vector<Waiter> added;
+            bool stopped = false;
+            std::thread thread;
+
+            // Only touched by the loop: the waiter of fds[i] is polled[i - 1],
+            // fds[0] is the self-pipe. Deadlines may be of finished waiters.
+            std::vector<pollfd> fds;
+            std::vector<Waiter> polled;
+            std::vector<Waiter> timers;
+            std::vector<Clock::time_point> deadlines;
+        };
+
+        // Base of the awaitables: resumes with a CancelledError if the task was cancelled
+        struct CancellableAwaiter {
+            void ThrowIfCancelled() const {
+                CurrentCancellation().ThrowIfCancelled();
+            }
+        };
+
+    } /* namespace detail */
+
+    /**
+        Run a coroutine from a normal function, blocks until it finishes
+        and rethrows its exception
+     */
+    inline void Wait(Async async) {
+        struct State {
+            std::mutex mutex;
+            std::condition_variable finished;
+            bool done = false;
+            std::exception_ptr error;
+        } state;
+
+        std::move(async).Start([](void* context, std::exception_ptr error) {
+            State& state = *static_cast<State*>(context);
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.error = std::move(error);
+            state.done = true;
+            state.finished.notify_one();
+        }, &state);
+
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.finished.wait(lock, [&state] { return state.done; });
+        if (state.error) std::rethrow_exception(state.error);
+    }
+
+    /**
+        Suspend the coroutine for the given time
+     */
+    template<class Rep, class Period>
+    auto SleepFor(std::chrono::duration<Rep, Period> duration) {
+        struct Awaiter : detail::CancellableAwaiter {
+            detail::EventLoop::Clock::time_point time;
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                detail::EventLoop::Instance().AddTimer(time, handle);
+            }
+
+            void await_resume() const {
+                ThrowIfCancelled();
+            }
+        };
+        return Awaiter{ {}, detail::EventLoop::Clock::now() +
+                                std::chrono::duration_cast<detail::EventLoop::Clock::duration>(duration) };
+    }
+
+    /**
+        Suspend the coroutine until the fd has the given poll events,
+        returns the events that occurred
+     */
+    inline auto WaitFor(int fd, short events) {
+        struct Awaiter : detail::CancellableAwaiter {
+            int fd;
+            short events;
+            short revents = 0;
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                detail::EventLoop::Instance().AddFd(fd, events, &revents, handle);
+            }
+
+            short await_resume() const {
+                ThrowIfCancelled();
+                return revents;
+            }
+        };
+        return Awaiter{ {}, fd, events };
+    }
+
+    // Suspend until the fd can be read without blocking
+    inline auto Readable(int fd) {
+        return WaitFor(fd, POLLIN);
+    }
+
+    // Suspend until the fd can be written without blocking
+    inline auto Writable(int fd) {
+        return WaitFor(fd, POLLOUT);
+    }
+
+    /**
+        Suspend the coroutine until the child process exits, returns its
+        status like waitpid. The child is reaped.
+     */
+    inline auto ChildExit(pid_t pid) {
+        struct Awaiter : detail::CancellableAwaiter {
+            pid_t pid;
+            int status = 0;
+
+            bool await_ready() noexcept {
+                return detail::Reap(pid, &status, detail::CurrentUsageSlot(), WNOHANG);
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                detail::EventLoop::Instance().AddChild(pid, &status, handle);
+            }
+
+            int await_resume() const {
+                ThrowIfCancelled();
+                return status;
+            }
+        };
+        return Awaiter{ {}, pid };
+    }
+
+    /**
+        AsyncTask
+
+        A task whose work is a coroutine, for steps that mostly wait on
+        timers, sockets, pipes or child processes. ExecuteGraph starts
+        it on a worker, which moves on to other tasks as soon as the
+        coroutine suspends. The event loop resumes it once the awaited
+        event happened, so a few workers keep thousands of them going.
+        ExecuteTasks, which runs one task after another, blocks until
+        the coroutine finished. Needs C++20.
+
+        Example:
+
+            Canary::Async Download(std::string url) {
+                pid_t pid = StartCurl(url);
+                int status = co_await Canary::ChildExit(pid);
+                if (status != 0) throw std::runtime_error("curl failed");
+            }
+
+            graph.Add(Canary::AsyncTask("Download", [] { return Download("https://..."); }));
+     */
+    struct AsyncTask : Task {
+        AsyncTask(std::string emoji, std::string msg, std::function<Async()> fn)
+            : Task(std::move(emoji), std::move(msg), nullptr) {
+            Bind(std::move(fn));
+        }
+
+        AsyncTask(std::string msg, std::function<Async()> fn) : Task(std::move(msg), nullptr) {
+            Bind(std::move(fn));
+        }
+
+    private:
+        void Bind(std::function<Async()> body) {
+            coroutine = [body](void (*done)(void*, std::exception_ptr), void* context) {
+                body().Start(done, context);
+            };
+            fn = [body] { Wait(body()); };
+        }
+    };
+
+} /* namespace Canary */
+
+#endif
@@ -0,0 +1,47 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+// The emoji constants and the composition of modifiers as a C++20 module.
+// A translation unit imports it or includes the emoji headers, not both.
+//
+// Example:
+//
+//     import canary.emoji;
+//
+//     std::cout << Canary::Emoji::zap << "Done" << std::endl;
+
+module;
+
+// The headers the emoji headers include, first, so that the module has
+// only Canary in it and importers share the standard library with it
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__has_include)
+#if __has_include(<string_view>)
+#include <string_view>
+#endif
+#endif
+
+export module canary.emoji;
+
+export {
+#include "emoji.hpp"
+#include "compose.hpp"
+}
@@ -14,1443 +14,39 @@
    limitations under the License.
  */
 
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
 #pragma once
 
-namespace Canary {
-namespace Emoji {
+/**
+    All emoji constants and View(). The constants are in one header
+    per group, to include only the ones a translation unit uses:
+
+        emoji/smileys_emotion.hpp  Smileys & Emotion, 128 emojis
+        emoji/people_body.hpp      People & Body, 198 emojis
+        emoji/animals_nature.hpp   Animals & Nature, 105 emojis
+        emoji/food_drink.hpp       Food & Drink, 91 emojis
+        emoji/travel_places.hpp    Travel & Places, 199 emojis
+        emoji/activities.hpp       Activities, 64 emojis
+        emoji/objects.hpp          Objects, 192 emojis
+        emoji/symbols.hpp          Symbols, 202 emojis
+        emoji/flags.hpp            Flags, 253 emojis
 
-    const char* one_hundred = "\xF0\x9F\x92\xAF ";
-    const char* one_two_three_four = "\xF0\x9F\x94\xA2 ";
-    const char* grinning = "\xF0\x9F\x98\x80 ";
-    const char* grimacing = "\xF0\x9F\x98\xAC ";
-    const char* grin = "\xF0\x9F\x98\x81 ";
-    const char* joy = "\xF0\x9F\x98\x82 ";
-    const char* rofl = "\xF0\x9F\xA4\xA3 ";
-    const char* smiley = "\xF0\x9F\x98\x83 ";
-    const char* smile = "\xF0\x9F\x98\x84 ";
-    const char* sweat_smile = "\xF0\x9F\x98\x85 ";
-    const char* laughing = "\xF0\x9F\x98\x86 ";
-    const char* innocent = "\xF0\x9F\x98\x87 ";
-    const char* wink = "\xF0\x9F\x98\x89 ";
-    const char* blush = "\xF0\x9F\x98\x8A ";
-    const char* slightly_smiling_face = "\xF0\x9F\x99\x82 ";
-    const char* upside_down_face = "\xF0\x9F\x99\x83 ";
-    const char* relaxed = "\xE2\x98\xBA\xEF\xB8\x8F ";
-    const char* yum = "\xF0\x9F\x98\x8B ";
-    const char* relieved = "\xF0\x9F\x98\x8C ";
-    const char* heart_eyes = "\xF0\x9F\x98\x8D ";
-    const char* kissing_heart = "\xF0\x9F\x98\x98 ";
-    const char* kissing = "\xF0\x9F\x98\x97 ";
-    const char* kissing_smiling_eyes = "\xF0\x9F\x98\x99 ";
-    const char* kissing_closed_eyes = "\xF0\x9F\x98\x9A ";
-    const char* stuck_out_tongue_winking_eye = "\xF0\x9F\x98\x9C ";
-    const char* stuck_out_tongue_closed_eyes = "\xF0\x9F\x98\x9D ";
-    const char* stuck_out_tongue = "\xF0\x9F\x98\x9B ";
-    const char* money_mouth_face = "\xF0\x9F\xA4\x91 ";
-    const char* nerd_face = "\xF0\x9F\xA4\x93 ";
-    const char* sunglasses = "\xF0\x9F\x98\x8E ";
-    const char* clown_face = "\xF0\x9F\xA4\xA1 ";
-    const char* cowboy_hat_face = "\xF0\x9F\xA4\xA0 ";
-    const char* hugs = "\xF0\x9F\xA4\x97 ";
-    const char* smirk = "\xF0\x9F\x98\x8F ";
-    const char* no_mouth = "\xF0\x9F\x98\xB6 ";
-    const char* neutral_face = "\xF0\x9F\x98\x90 ";
-    const char* expressionless = "\xF0\x9F\x98\x91 ";
-    const char* unamused = "\xF0\x9F\x98\x92 ";
-    const char* roll_eyes = "\xF0\x9F\x99\x84 ";
-    const char* thinking = "\xF0\x9F\xA4\x94 ";
-    const char* lying_face = "\xF0\x9F\xA4\xA5 ";
-    const char* flushed = "\xF0\x9F\x98\xB3 ";
-    const char* disappointed = "\xF0\x9F\x98\x9E ";
-    const char* worried = "\xF0\x9F\x98\x9F ";
-    const char* angry = "\xF0\x9F\x98\xA0 ";
-    const char* rage = "\xF0\x9F\x98\xA1 ";
-    const char* pensive = "\xF0\x9F\x98\x94 ";
-    const char* confused = "\xF0\x9F\x98\x95 ";
-    const char* slightly_frowning_face = "\xF0\x9F\x99\x81 ";
-    const char* frowning_face = "\xE2\x98\xB9 ";
-    const char* persevere = "\xF0\x9F\x98\xA3 ";
-    const char* confounded = "\xF0\x9F\x98\x96 ";
-    const char* tired_face = "\xF0\x9F\x98\xAB ";
-    const char* weary = "\xF0\x9F\x98\xA9 ";
-    const char* triumph = "\xF0\x9F\x98\xA4 ";
-    const char* open_mouth = "\xF0\x9F\x98\xAE ";
-    const char* scream = "\xF0\x9F\x98\xB1 ";
-    const char* fearful = "\xF0\x9F\x98\xA8 ";
-    const char* cold_sweat = "\xF0\x9F\x98\xB0 ";
-    const char* hushed = "\xF0\x9F\x98\xAF ";
-    const char* frowning = "\xF0\x9F\x98\xA6 ";
-    const char* anguished = "\xF0\x9F\x98\xA7 ";
-    const char* cry = "\xF0\x9F\x98\xA2 ";
-    const char* disappointed_relieved = "\xF0\x9F\x98\xA5 ";
-    const char* drooling_face = "\xF0\x9F\xA4\xA4 ";
-    const char* sleepy = "\xF0\x9F\x98\xAA ";
-    const char* sweat = "\xF0\x9F\x98\x93 ";
-    const char* sob = "\xF0\x9F\x98\xAD ";
-    const char* dizzy_face = "\xF0\x9F\x98\xB5 ";
-    const char* astonished = "\xF0\x9F\x98\xB2 ";
-    const char* zipper_mouth_face = "\xF0\x9F\xA4\x90 ";
-    const char* nauseated_face = "\xF0\x9F\xA4\xA2 ";
-    const char* sneezing_face = "\xF0\x9F\xA4\xA7 ";
-    const char* mask = "\xF0\x9F\x98\xB7 ";
-    const char* face_with_thermometer = "\xF0\x9F\xA4\x92 ";
-    const char* face_with_head_bandage = "\xF0\x9F\xA4\x95 ";
-    const char* sleeping = "\xF0\x9F\x98\xB4 ";
-    const char* zzz = "\xF0\x9F\x92\xA4 ";
-    const char* poop = "\xF0\x9F\x92\xA9 ";
-    const char* smiling_imp = "\xF0\x9F\x98\x88 ";
-    const char* imp = "\xF0\x9F\x91\xBF ";
-    const char* japanese_ogre = "\xF0\x9F\x91\xB9 ";
-    const char* japanese_goblin = "\xF0\x9F\x91\xBA ";
-    const char* skull = "\xF0\x9F\x92\x80 ";
-    const char* ghost = "\xF0\x9F\x91\xBB ";
-    const char* alien = "\xF0\x9F\x91\xBD ";
-    const char* robot = "\xF0\x9F\xA4\x96 ";
-    const char* smiley_cat = "\xF0\x9F\x98\xBA ";
-    const char* smile_cat = "\xF0\x9F\x98\xB8 ";
-    const char* joy_cat = "\xF0\x9F\x98\xB9 ";
-    const char* heart_eyes_cat = "\xF0\x9F\x98\xBB ";
-    const char* smirk_cat = "\xF0\x9F\x98\xBC ";
-    const char* kissing_cat = "\xF0\x9F\x98\xBD ";
-    const char* scream_cat = "\xF0\x9F\x99\x80 ";
-    const char* crying_cat_face = "\xF0\x9F\x98\xBF ";
-    const char* pouting_cat = "\xF0\x9F\x98\xBE ";
-    const char* raised_hands = "\xF0\x9F\x99\x8C ";
-    const char* clap = "\xF0\x9F\x91\x8F ";
-    const char* wave = "\xF0\x9F\x91\x8B ";
-    const char* call_me_hand = "\xF0\x9F\xA4\x99 ";
-    const char* plus_one = "\xF0\x9F\x91\x8D ";
-    const char* minus_one = "\xF0\x9F\x91\x8E ";
-    const char* facepunch = "\xF0\x9F\x91\x8A ";
-    const char* fist = "\xE2\x9C\x8A ";
-    const char* fist_left = "\xF0\x9F\xA4\x9B ";
-    const char* fist_right = "\xF0\x9F\xA4\x9C ";
-    const char* v = "\xE2\x9C\x8C ";
-    const char* ok_hand = "\xF0\x9F\x91\x8C ";
-    const char* raised_hand = "\xE2\x9C\x8B ";
-    const char* raised_back_of_hand = "\xF0\x9F\xA4\x9A ";
-    const char* open_hands = "\xF0\x9F\x91\x90 ";
-    const char* muscle = "\xF0\x9F\x92\xAA ";
-    const char* pray = "\xF0\x9F\x99\x8F ";
-    const char* handshake = "\xF0\x9F\xA4\x9D ";
-    const char* point_up = "\xE2\x98\x9D ";
-    const char* point_up_2 = "\xF0\x9F\x91\x86 ";
-    const char* point_down = "\xF0\x9F\x91\x87 ";
-    const char* point_left = "\xF0\x9F\x91\x88 ";
-    const char* point_right = "\xF0\x9F\x91\x89 ";
-    const char* fu = "\xF0\x9F\x96\x95 ";
-    const char* raised_hand_with_fingers_splayed = "\xF0\x9F\x96\x90 ";
-    const char* metal = "\xF0\x9F\xA4\x98 ";
-    const char* crossed_fingers = "\xF0\x9F\xA4\x9E ";
-    const char* vulcan_salute = "\xF0\x9F\x96\x96 ";
-    const char* writing_hand = "\xE2\x9C\x8D ";
-    const char* selfie = "\xF0\x9F\xA4\xB3 ";
-    const char* nail_care = "\xF0\x9F\x92\x85 ";
-    const char* lips = "\xF0\x9F\x91\x84 ";
-    const char* tongue = "\xF0\x9F\x91\x85 ";
-    const char* ear = "\xF0\x9F\x91\x82 ";
-    const char* nose = "\xF0\x9F\x91\x83 ";
-    const char* eye = "\xF0\x9F\x91\x81 ";
-    const char* eyes = "\xF0\x9F\x91\x80 ";
-    const char* bust_in_silhouette = "\xF0\x9F\x91\xA4 ";
-    const char* busts_in_silhouette = "\xF0\x9F\x91\xA5 ";
-    const char* speaking_head = "\xF0\x9F\x97\xA3 ";
-    const char* baby = "\xF0\x9F\x91\xB6 ";
-    const char* boy = "\xF0\x9F\x91\xA6 ";
-    const char* girl = "\xF0\x9F\x91\xA7 ";
-    const char* man = "\xF0\x9F\x91\xA8 ";
-    const char* woman = "\xF0\x9F\x91\xA9 ";
-    const char* blonde_woman = "\xF0\x9F\x91\xB1\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* blonde_man = "\xF0\x9F\x91\xB1 ";
-    const char* older_man = "\xF0\x9F\x91\xB4 ";
-    const char* older_woman = "\xF0\x9F\x91\xB5 ";
-    const char* man_with_gua_pi_mao = "\xF0\x9F\x91\xB2 ";
-    const char* woman_with_turban = "\xF0\x9F\x91\xB3\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* man_with_turban = "\xF0\x9F\x91\xB3 ";
-    const char* policewoman = "\xF0\x9F\x91\xAE\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* policeman = "\xF0\x9F\x91\xAE ";
-    const char* construction_worker_woman = "\xF0\x9F\x91\xB7\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* construction_worker_man = "\xF0\x9F\x91\xB7 ";
-    const char* guardswoman = "\xF0\x9F\x92\x82\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* guardsman = "\xF0\x9F\x92\x82 ";
-    const char* female_detective = "\xF0\x9F\x95\xB5\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* male_detective = "\xF0\x9F\x95\xB5 ";
-    const char* woman_health_worker = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9A\x95\xEF\xB8\x8F ";
-    const char* man_health_worker = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9A\x95\xEF\xB8\x8F ";
-    const char* woman_farmer = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8C\xBE ";
-    const char* man_farmer = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8C\xBE ";
-    const char* woman_cook = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8D\xB3 ";
-    const char* man_cook = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8D\xB3 ";
-    const char* woman_student = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\x93 ";
-    const char* man_student = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8E\x93 ";
-    const char* woman_singer = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\xA4 ";
-    const char* man_singer = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8E\xA4 ";
-    const char* woman_teacher = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8F\xAB ";
-    const char* man_teacher = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8F\xAB ";
-    const char* woman_factory_worker = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8F\xAD ";
-    const char* man_factory_worker = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8F\xAD ";
-    const char* woman_technologist = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB ";
-    const char* man_technologist = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x92\xBB ";
-    const char* woman_office_worker = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBC ";
-    const char* man_office_worker = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x92\xBC ";
-    const char* woman_mechanic = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x94\xA7 ";
-    const char* man_mechanic = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x94\xA7 ";
-    const char* woman_scientist = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x94\xAC ";
-    const char* man_scientist = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x94\xAC ";
-    const char* woman_artist = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\xA8 ";
-    const char* man_artist = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8E\xA8 ";
-    const char* woman_firefighter = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x9A\x92 ";
-    const char* man_firefighter = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x9A\x92 ";
-    const char* woman_pilot = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9C\x88\xEF\xB8\x8F ";
-    const char* man_pilot = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9C\x88\xEF\xB8\x8F ";
-    const char* woman_astronaut = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x9A\x80 ";
-    const char* man_astronaut = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x9A\x80 ";
-    const char* woman_judge = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9A\x96\xEF\xB8\x8F ";
-    const char* man_judge = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9A\x96\xEF\xB8\x8F ";
-    const char* mrs_claus = "\xF0\x9F\xA4\xB6 ";
-    const char* santa = "\xF0\x9F\x8E\x85 ";
-    const char* angel = "\xF0\x9F\x91\xBC ";
-    const char* pregnant_woman = "\xF0\x9F\xA4\xB0 ";
-    const char* princess = "\xF0\x9F\x91\xB8 ";
-    const char* prince = "\xF0\x9F\xA4\xB4 ";
-    const char* bride_with_veil = "\xF0\x9F\x91\xB0 ";
-    const char* man_in_tuxedo = "\xF0\x9F\xA4\xB5 ";
-    const char* running_woman = "\xF0\x9F\x8F\x83\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* running_man = "\xF0\x9F\x8F\x83 ";
-    const char* walking_woman = "\xF0\x9F\x9A\xB6\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* walking_man = "\xF0\x9F\x9A\xB6 ";
-    const char* dancer = "\xF0\x9F\x92\x83 ";
-    const char* man_dancing = "\xF0\x9F\x95\xBA ";
-    const char* dancing_women = "\xF0\x9F\x91\xAF ";
-    const char* dancing_men = "\xF0\x9F\x91\xAF\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* couple = "\xF0\x9F\x91\xAB ";
-    const char* two_men_holding_hands = "\xF0\x9F\x91\xAC ";
-    const char* two_women_holding_hands = "\xF0\x9F\x91\xAD ";
-    const char* bowing_woman = "\xF0\x9F\x99\x87\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* bowing_man = "\xF0\x9F\x99\x87 ";
-    const char* man_facepalming = "\xF0\x9F\xA4\xA6 ";
-    const char* woman_facepalming = "\xF0\x9F\xA4\xA6\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* woman_shrugging = "\xF0\x9F\xA4\xB7 ";
-    const char* man_shrugging = "\xF0\x9F\xA4\xB7\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* tipping_hand_woman = "\xF0\x9F\x92\x81 ";
-    const char* tipping_hand_man = "\xF0\x9F\x92\x81\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* no_good_woman = "\xF0\x9F\x99\x85 ";
-    const char* no_good_man = "\xF0\x9F\x99\x85\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* ok_woman = "\xF0\x9F\x99\x86 ";
-    const char* ok_man = "\xF0\x9F\x99\x86\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* raising_hand_woman = "\xF0\x9F\x99\x8B ";
-    const char* raising_hand_man = "\xF0\x9F\x99\x8B\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* pouting_woman = "\xF0\x9F\x99\x8E ";
-    const char* pouting_man = "\xF0\x9F\x99\x8E\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* frowning_woman = "\xF0\x9F\x99\x8D ";
-    const char* frowning_man = "\xF0\x9F\x99\x8D\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* haircut_woman = "\xF0\x9F\x92\x87 ";
-    const char* haircut_man = "\xF0\x9F\x92\x87\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* massage_woman = "\xF0\x9F\x92\x86 ";
-    const char* massage_man = "\xF0\x9F\x92\x86\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* couple_with_heart_woman_man = "\xF0\x9F\x92\x91 ";
-    const char* couple_with_heart_woman_woman = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x91\xA9 ";
-    const char* couple_with_heart_man_man = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x91\xA8 ";
-    const char* couplekiss_man_woman = "\xF0\x9F\x92\x8F ";
-    const char* couplekiss_woman_woman = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x92\x8B\xE2\x80\x8D\xF0\x9F\x91\xA9 ";
-    const char* couplekiss_man_man = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x92\x8B\xE2\x80\x8D\xF0\x9F\x91\xA8 ";
-    const char* family_man_woman_boy = "\xF0\x9F\x91\xAA ";
-    const char* family_man_woman_girl = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* family_man_woman_girl_boy = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_man_woman_boy_boy = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_man_woman_girl_girl = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* family_woman_woman_boy = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_woman_woman_girl = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* family_woman_woman_girl_boy = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_woman_woman_boy_boy = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_woman_woman_girl_girl = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* family_man_man_boy = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_man_man_girl = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* family_man_man_girl_boy = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_man_man_boy_boy = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_man_man_girl_girl = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* family_woman_boy = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_woman_girl = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* family_woman_girl_boy = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_woman_boy_boy = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_woman_girl_girl = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* family_man_boy = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_man_girl = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* family_man_girl_boy = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_man_boy_boy = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
-    const char* family_man_girl_girl = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
-    const char* womans_clothes = "\xF0\x9F\x91\x9A ";
-    const char* tshirt = "\xF0\x9F\x91\x95 ";
-    const char* jeans = "\xF0\x9F\x91\x96 ";
-    const char* necktie = "\xF0\x9F\x91\x94 ";
-    const char* dress = "\xF0\x9F\x91\x97 ";
-    const char* bikini = "\xF0\x9F\x91\x99 ";
-    const char* kimono = "\xF0\x9F\x91\x98 ";
-    const char* lipstick = "\xF0\x9F\x92\x84 ";
-    const char* kiss = "\xF0\x9F\x92\x8B ";
-    const char* footprints = "\xF0\x9F\x91\xA3 ";
-    const char* high_heel = "\xF0\x9F\x91\xA0 ";
-    const char* sandal = "\xF0\x9F\x91\xA1 ";
-    const char* boot = "\xF0\x9F\x91\xA2 ";
-    const char* mans_shoe = "\xF0\x9F\x91\x9E ";
-    const char* athletic_shoe = "\xF0\x9F\x91\x9F ";
-    const char* womans_hat = "\xF0\x9F\x91\x92 ";
-    const char* tophat = "\xF0\x9F\x8E\xA9 ";
-    const char* rescue_worker_helmet = "\xE2\x9B\x91 ";
-    const char* mortar_board = "\xF0\x9F\x8E\x93 ";
-    const char* crown = "\xF0\x9F\x91\x91 ";
-    const char* school_satchel = "\xF0\x9F\x8E\x92 ";
-    const char* pouch = "\xF0\x9F\x91\x9D ";
-    const char* purse = "\xF0\x9F\x91\x9B ";
-    const char* handbag = "\xF0\x9F\x91\x9C ";
-    const char* briefcase = "\xF0\x9F\x92\xBC ";
-    const char* eyeglasses = "\xF0\x9F\x91\x93 ";
-    const char* dark_sunglasses = "\xF0\x9F\x95\xB6 ";
-    const char* ring = "\xF0\x9F\x92\x8D ";
-    const char* closed_umbrella = "\xF0\x9F\x8C\x82 ";
-    const char* dog = "\xF0\x9F\x90\xB6 ";
-    const char* cat = "\xF0\x9F\x90\xB1 ";
-    const char* mouse = "\xF0\x9F\x90\xAD ";
-    const char* hamster = "\xF0\x9F\x90\xB9 ";
-    const char* rabbit = "\xF0\x9F\x90\xB0 ";
-    const char* fox_face = "\xF0\x9F\xA6\x8A ";
-    const char* bear = "\xF0\x9F\x90\xBB ";
-    const char* panda_face = "\xF0\x9F\x90\xBC ";
-    const char* koala = "\xF0\x9F\x90\xA8 ";
-    const char* tiger = "\xF0\x9F\x90\xAF ";
-    const char* lion = "\xF0\x9F\xA6\x81 ";
-    const char* cow = "\xF0\x9F\x90\xAE ";
-    const char* pig = "\xF0\x9F\x90\xB7 ";
-    const char* pig_nose = "\xF0\x9F\x90\xBD ";
-    const char* frog = "\xF0\x9F\x90\xB8 ";
-    const char* squid = "\xF0\x9F\xA6\x91 ";
-    const char* octopus = "\xF0\x9F\x90\x99 ";
-    const char* shrimp = "\xF0\x9F\xA6\x90 ";
-    const char* monkey_face = "\xF0\x9F\x90\xB5 ";
-    const char* gorilla = "\xF0\x9F\xA6\x8D ";
-    const char* see_no_evil = "\xF0\x9F\x99\x88 ";
-    const char* hear_no_evil = "\xF0\x9F\x99\x89 ";
-    const char* speak_no_evil = "\xF0\x9F\x99\x8A ";
-    const char* monkey = "\xF0\x9F\x90\x92 ";
-    const char* chicken = "\xF0\x9F\x90\x94 ";
-    const char* penguin = "\xF0\x9F\x90\xA7 ";
-    const char* bird = "\xF0\x9F\x90\xA6 ";
-    const char* baby_chick = "\xF0\x9F\x90\xA4 ";
-    const char* hatching_chick = "\xF0\x9F\x90\xA3 ";
-    const char* hatched_chick = "\xF0\x9F\x90\xA5 ";
-    const char* duck = "\xF0\x9F\xA6\x86 ";
-    const char* eagle = "\xF0\x9F\xA6\x85 ";
-    const char* owl = "\xF0\x9F\xA6\x89 ";
-    const char* bat = "\xF0\x9F\xA6\x87 ";
-    const char* wolf = "\xF0\x9F\x90\xBA ";
-    const char* boar = "\xF0\x9F\x90\x97 ";
-    const char* horse = "\xF0\x9F\x90\xB4 ";
-    const char* unicorn = "\xF0\x9F\xA6\x84 ";
-    const char* honeybee = "\xF0\x9F\x90\x9D ";
-    const char* bug = "\xF0\x9F\x90\x9B ";
-    const char* butterfly = "\xF0\x9F\xA6\x8B ";
-    const char* snail = "\xF0\x9F\x90\x8C ";
-    const char* beetle = "\xF0\x9F\x90\x9E ";
-    const char* ant = "\xF0\x9F\x90\x9C ";
-    const char* spider = "\xF0\x9F\x95\xB7 ";
-    const char* scorpion = "\xF0\x9F\xA6\x82 ";
-    const char* crab = "\xF0\x9F\xA6\x80 ";
-    const char* snake = "\xF0\x9F\x90\x8D ";
-    const char* lizard = "\xF0\x9F\xA6\x8E ";
-    const char* turtle = "\xF0\x9F\x90\xA2 ";
-    const char* tropical_fish = "\xF0\x9F\x90\xA0 ";
-    const char* fish = "\xF0\x9F\x90\x9F ";
-    const char* blowfish = "\xF0\x9F\x90\xA1 ";
-    const char* dolphin = "\xF0\x9F\x90\xAC ";
-    const char* shark = "\xF0\x9F\xA6\x88 ";
-    const char* whale = "\xF0\x9F\x90\xB3 ";
-    const char* whale2 = "\xF0\x9F\x90\x8B ";
-    const char* crocodile = "\xF0\x9F\x90\x8A ";
-    const char* leopard = "\xF0\x9F\x90\x86 ";
-    const char* tiger2 = "\xF0\x9F\x90\x85 ";
-    const char* water_buffalo = "\xF0\x9F\x90\x83 ";
-    const char* ox = "\xF0\x9F\x90\x82 ";
-    const char* cow2 = "\xF0\x9F\x90\x84 ";
-    const char* deer = "\xF0\x9F\xA6\x8C ";
-    const char* dromedary_camel = "\xF0\x9F\x90\xAA ";
-    const char* camel = "\xF0\x9F\x90\xAB ";
-    const char* elephant = "\xF0\x9F\x90\x98 ";
-    const char* rhinoceros = "\xF0\x9F\xA6\x8F ";
-    const char* goat = "\xF0\x9F\x90\x90 ";
-    const char* ram = "\xF0\x9F\x90\x8F ";
-    const char* sheep = "\xF0\x9F\x90\x91 ";
-    const char* racehorse = "\xF0\x9F\x90\x8E ";
-    const char* pig2 = "\xF0\x9F\x90\x96 ";
-    const char* rat = "\xF0\x9F\x90\x80 ";
-    const char* mouse2 = "\xF0\x9F\x90\x81 ";
-    const char* rooster = "\xF0\x9F\x90\x93 ";
-    const char* turkey = "\xF0\x9F\xA6\x83 ";
-    const char* dove = "\xF0\x9F\x95\x8A ";
-    const char* dog2 = "\xF0\x9F\x90\x95 ";
-    const char* poodle = "\xF0\x9F\x90\xA9 ";
-    const char* cat2 = "\xF0\x9F\x90\x88 ";
-    const char* rabbit2 = "\xF0\x9F\x90\x87 ";
-    const char* chipmunk = "\xF0\x9F\x90\xBF ";
-    const char* paw_prints = "\xF0\x9F\x90\xBE ";
-    const char* dragon = "\xF0\x9F\x90\x89 ";
-    const char* dragon_face = "\xF0\x9F\x90\xB2 ";
-    const char* cactus = "\xF0\x9F\x8C\xB5 ";
-    const char* christmas_tree = "\xF0\x9F\x8E\x84 ";
-    const char* evergreen_tree = "\xF0\x9F\x8C\xB2 ";
-    const char* deciduous_tree = "\xF0\x9F\x8C\xB3 ";
-    const char* palm_tree = "\xF0\x9F\x8C\xB4 ";
-    const char* seedling = "\xF0\x9F\x8C\xB1 ";
-    const char* herb = "\xF0\x9F\x8C\xBF ";
-    const char* shamrock = "\xE2\x98\x98 ";
-    const char* four_leaf_clover = "\xF0\x9F\x8D\x80 ";
-    const char* bamboo = "\xF0\x9F\x8E\x8D ";
-    const char* tanabata_tree = "\xF0\x9F\x8E\x8B ";
-    const char* leaves = "\xF0\x9F\x8D\x83 ";
-    const char* fallen_leaf = "\xF0\x9F\x8D\x82 ";
-    const char* maple_leaf = "\xF0\x9F\x8D\x81 ";
-    const char* ear_of_rice = "\xF0\x9F\x8C\xBE ";
-    const char* hibiscus = "\xF0\x9F\x8C\xBA ";
-    const char* sunflower = "\xF0\x9F\x8C\xBB ";
-    const char* rose = "\xF0\x9F\x8C\xB9 ";
-    const char* wilted_flower = "\xF0\x9F\xA5\x80 ";
-    const char* tulip = "\xF0\x9F\x8C\xB7 ";
-    const char* blossom = "\xF0\x9F\x8C\xBC ";
-    const char* cherry_blossom = "\xF0\x9F\x8C\xB8 ";
-    const char* bouquet = "\xF0\x9F\x92\x90 ";
-    const char* mushroom = "\xF0\x9F\x8D\x84 ";
-    const char* chestnut = "\xF0\x9F\x8C\xB0 ";
-    const char* jack_o_lantern = "\xF0\x9F\x8E\x83 ";
-    const char* shell = "\xF0\x9F\x90\x9A ";
-    const char* spider_web = "\xF0\x9F\x95\xB8 ";
-    const char* earth_americas = "\xF0\x9F\x8C\x8E ";
-    const char* earth_africa = "\xF0\x9F\x8C\x8D ";
-    const char* earth_asia = "\xF0\x9F\x8C\x8F ";
-    const char* full_moon = "\xF0\x9F\x8C\x95 ";
-    const char* waning_gibbous_moon = "\xF0\x9F\x8C\x96 ";
-    const char* last_quarter_moon = "\xF0\x9F\x8C\x97 ";
-    const char* waning_crescent_moon = "\xF0\x9F\x8C\x98 ";
-    const char* new_moon = "\xF0\x9F\x8C\x91 ";
-    const char* waxing_crescent_moon = "\xF0\x9F\x8C\x92 ";
-    const char* first_quarter_moon = "\xF0\x9F\x8C\x93 ";
-    const char* waxing_gibbous_moon = "\xF0\x9F\x8C\x94 ";
-    const char* new_moon_with_face = "\xF0\x9F\x8C\x9A ";
-    const char* full_moon_with_face = "\xF0\x9F\x8C\x9D ";
-    const char* first_quarter_moon_with_face = "\xF0\x9F\x8C\x9B ";
-    const char* last_quarter_moon_with_face = "\xF0\x9F\x8C\x9C ";
-    const char* sun_with_face = "\xF0\x9F\x8C\x9E ";
-    const char* crescent_moon = "\xF0\x9F\x8C\x99 ";
-    const char* star = "\xE2\xAD\x90 ";
-    const char* star2 = "\xF0\x9F\x8C\x9F ";
-    const char* dizzy = "\xF0\x9F\x92\xAB ";
-    const char* sparkles = "\xE2\x9C\xA8 ";
-    const char* comet = "\xE2\x98\x84 ";
-    const char* sunny = "\xE2\x98\x80\xEF\xB8\x8F ";
-    const char* sun_behind_small_cloud = "\xF0\x9F\x8C\xA4 ";
-    const char* partly_sunny = "\xE2\x9B\x85 ";
-    const char* sun_behind_large_cloud = "\xF0\x9F\x8C\xA5 ";
-    const char* sun_behind_rain_cloud = "\xF0\x9F\x8C\xA6 ";
-    const char* cloud = "\xE2\x98\x81\xEF\xB8\x8F ";
-    const char* cloud_with_rain = "\xF0\x9F\x8C\xA7 ";
-    const char* cloud_with_lightning_and_rain = "\xE2\x9B\x88 ";
-    const char* cloud_with_lightning = "\xF0\x9F\x8C\xA9 ";
-    const char* zap = "\xE2\x9A\xA1 ";
-    const char* fire = "\xF0\x9F\x94\xA5 ";
-    const char* boom = "\xF0\x9F\x92\xA5 ";
-    const char* snowflake = "\xE2\x9D\x84\xEF\xB8\x8F ";
-    const char* cloud_with_snow = "\xF0\x9F\x8C\xA8 ";
-    const char* snowman = "\xE2\x9B\x84 ";
-    const char* snowman_with_snow = "\xE2\x98\x83 ";
-    const char* wind_face = "\xF0\x9F\x8C\xAC ";
-    const char* dash = "\xF0\x9F\x92\xA8 ";
-    const char* tornado = "\xF0\x9F\x8C\xAA ";
-    const char* fog = "\xF0\x9F\x8C\xAB ";
-    const char* open_umbrella = "\xE2\x98\x82 ";
-    const char* umbrella = "\xE2\x98\x94 ";
-    const char* droplet = "\xF0\x9F\x92\xA7 ";
-    const char* sweat_drops = "\xF0\x9F\x92\xA6 ";
-    const char* ocean = "\xF0\x9F\x8C\x8A ";
-    const char* green_apple = "\xF0\x9F\x8D\x8F ";
-    const char* apple = "\xF0\x9F\x8D\x8E ";
-    const char* pear = "\xF0\x9F\x8D\x90 ";
-    const char* tangerine = "\xF0\x9F\x8D\x8A ";
-    const char* lemon = "\xF0\x9F\x8D\x8B ";
-    const char* banana = "\xF0\x9F\x8D\x8C ";
-    const char* watermelon = "\xF0\x9F\x8D\x89 ";
-    const char* grapes = "\xF0\x9F\x8D\x87 ";
-    const char* strawberry = "\xF0\x9F\x8D\x93 ";
-    const char* melon = "\xF0\x9F\x8D\x88 ";
-    const char* cherries = "\xF0\x9F\x8D\x92 ";
-    const char* peach = "\xF0\x9F\x8D\x91 ";
-    const char* pineapple = "\xF0\x9F\x8D\x8D ";
-    const char* kiwi_fruit = "\xF0\x9F\xA5\x9D ";
-    const char* avocado = "\xF0\x9F\xA5\x91 ";
-    const char* tomato = "\xF0\x9F\x8D\x85 ";
-    const char* eggplant = "\xF0\x9F\x8D\x86 ";
-    const char* cucumber = "\xF0\x9F\xA5\x92 ";
-    const char* carrot = "\xF0\x9F\xA5\x95 ";
-    const char* hot_pepper = "\xF0\x9F\x8C\xB6 ";
-    const char* potato = "\xF0\x9F\xA5\x94 ";
-    const char* corn = "\xF0\x9F\x8C\xBD ";
-    const char* sweet_potato = "\xF0\x9F\x8D\xA0 ";
-    const char* peanuts = "\xF0\x9F\xA5\x9C ";
-    const char* honey_pot = "\xF0\x9F\x8D\xAF ";
-    const char* croissant = "\xF0\x9F\xA5\x90 ";
-    const char* bread = "\xF0\x9F\x8D\x9E ";
-    const char* baguette_bread = "\xF0\x9F\xA5\x96 ";
-    const char* cheese = "\xF0\x9F\xA7\x80 ";
-    const char* egg = "\xF0\x9F\xA5\x9A ";
-    const char* bacon = "\xF0\x9F\xA5\x93 ";
-    const char* pancakes = "\xF0\x9F\xA5\x9E ";
-    const char* poultry_leg = "\xF0\x9F\x8D\x97 ";
-    const char* meat_on_bone = "\xF0\x9F\x8D\x96 ";
-    const char* fried_shrimp = "\xF0\x9F\x8D\xA4 ";
-    const char* fried_egg = "\xF0\x9F\x8D\xB3 ";
-    const char* hamburger = "\xF0\x9F\x8D\x94 ";
-    const char* fries = "\xF0\x9F\x8D\x9F ";
-    const char* stuffed_flatbread = "\xF0\x9F\xA5\x99 ";
-    const char* hotdog = "\xF0\x9F\x8C\xAD ";
-    const char* pizza = "\xF0\x9F\x8D\x95 ";
-    const char* spaghetti = "\xF0\x9F\x8D\x9D ";
-    const char* taco = "\xF0\x9F\x8C\xAE ";
-    const char* burrito = "\xF0\x9F\x8C\xAF ";
-    const char* green_salad = "\xF0\x9F\xA5\x97 ";
-    const char* shallow_pan_of_food = "\xF0\x9F\xA5\x98 ";
-    const char* ramen = "\xF0\x9F\x8D\x9C ";
-    const char* stew = "\xF0\x9F\x8D\xB2 ";
-    const char* fish_cake = "\xF0\x9F\x8D\xA5 ";
-    const char* sushi = "\xF0\x9F\x8D\xA3 ";
-    const char* bento = "\xF0\x9F\x8D\xB1 ";
-    const char* curry = "\xF0\x9F\x8D\x9B ";
-    const char* rice_ball = "\xF0\x9F\x8D\x99 ";
-    const char* rice = "\xF0\x9F\x8D\x9A ";
-    const char* rice_cracker = "\xF0\x9F\x8D\x98 ";
-    const char* oden = "\xF0\x9F\x8D\xA2 ";
-    const char* dango = "\xF0\x9F\x8D\xA1 ";
-    const char* shaved_ice = "\xF0\x9F\x8D\xA7 ";
-    const char* ice_cream = "\xF0\x9F\x8D\xA8 ";
-    const char* icecream = "\xF0\x9F\x8D\xA6 ";
-    const char* cake = "\xF0\x9F\x8D\xB0 ";
-    const char* birthday = "\xF0\x9F\x8E\x82 ";
-    const char* custard = "\xF0\x9F\x8D\xAE ";
-    const char* candy = "\xF0\x9F\x8D\xAC ";
-    const char* lollipop = "\xF0\x9F\x8D\xAD ";
-    const char* chocolate_bar = "\xF0\x9F\x8D\xAB ";
-    const char* popcorn = "\xF0\x9F\x8D\xBF ";
-    const char* doughnut = "\xF0\x9F\x8D\xA9 ";
-    const char* cookie = "\xF0\x9F\x8D\xAA ";
-    const char* milk_glass = "\xF0\x9F\xA5\x9B ";
-    const char* beer = "\xF0\x9F\x8D\xBA ";
-    const char* beers = "\xF0\x9F\x8D\xBB ";
-    const char* clinking_glasses = "\xF0\x9F\xA5\x82 ";
-    const char* wine_glass = "\xF0\x9F\x8D\xB7 ";
-    const char* tumbler_glass = "\xF0\x9F\xA5\x83 ";
-    const char* cocktail = "\xF0\x9F\x8D\xB8 ";
-    const char* tropical_drink = "\xF0\x9F\x8D\xB9 ";
-    const char* champagne = "\xF0\x9F\x8D\xBE ";
-    const char* sake = "\xF0\x9F\x8D\xB6 ";
-    const char* tea = "\xF0\x9F\x8D\xB5 ";
-    const char* coffee = "\xE2\x98\x95 ";
-    const char* baby_bottle = "\xF0\x9F\x8D\xBC ";
-    const char* spoon = "\xF0\x9F\xA5\x84 ";
-    const char* fork_and_knife = "\xF0\x9F\x8D\xB4 ";
-    const char* plate_with_cutlery = "\xF0\x9F\x8D\xBD ";
-    const char* soccer = "\xE2\x9A\xBD ";
-    const char* basketball = "\xF0\x9F\x8F\x80 ";
-    const char* football = "\xF0\x9F\x8F\x88 ";
-    const char* baseball = "\xE2\x9A\xBE ";
-    const char* tennis = "\xF0\x9F\x8E\xBE ";
-    const char* volleyball = "\xF0\x9F\x8F\x90 ";
-    const char* rugby_football = "\xF0\x9F\x8F\x89 ";
-    const char* eight_ball = "\xF0\x9F\x8E\xB1 ";
-    const char* golf = "\xE2\x9B\xB3 ";
-    const char* golfing_woman = "\xF0\x9F\x8F\x8C\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* golfing_man = "\xF0\x9F\x8F\x8C ";
-    const char* ping_pong = "\xF0\x9F\x8F\x93 ";
-    const char* badminton = "\xF0\x9F\x8F\xB8 ";
-    const char* goal_net = "\xF0\x9F\xA5\x85 ";
-    const char* ice_hockey = "\xF0\x9F\x8F\x92 ";
-    const char* field_hockey = "\xF0\x9F\x8F\x91 ";
-    const char* cricket = "\xF0\x9F\x8F\x8F ";
-    const char* ski = "\xF0\x9F\x8E\xBF ";
-    const char* skier = "\xE2\x9B\xB7 ";
-    const char* snowboarder = "\xF0\x9F\x8F\x82 ";
-    const char* person_fencing = "\xF0\x9F\xA4\xBA ";
-    const char* women_wrestling = "\xF0\x9F\xA4\xBC\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* men_wrestling = "\xF0\x9F\xA4\xBC\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* woman_cartwheeling = "\xF0\x9F\xA4\xB8\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* man_cartwheeling = "\xF0\x9F\xA4\xB8\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* woman_playing_handball = "\xF0\x9F\xA4\xBE\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* man_playing_handball = "\xF0\x9F\xA4\xBE\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* ice_skate = "\xE2\x9B\xB8 ";
-    const char* bow_and_arrow = "\xF0\x9F\x8F\xB9 ";
-    const char* fishing_pole_and_fish = "\xF0\x9F\x8E\xA3 ";
-    const char* boxing_glove = "\xF0\x9F\xA5\x8A ";
-    const char* martial_arts_uniform = "\xF0\x9F\xA5\x8B ";
-    const char* rowing_woman = "\xF0\x9F\x9A\xA3\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* rowing_man = "\xF0\x9F\x9A\xA3 ";
-    const char* swimming_woman = "\xF0\x9F\x8F\x8A\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* swimming_man = "\xF0\x9F\x8F\x8A ";
-    const char* woman_playing_water_polo = "\xF0\x9F\xA4\xBD\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* man_playing_water_polo = "\xF0\x9F\xA4\xBD\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* surfing_woman = "\xF0\x9F\x8F\x84\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* surfing_man = "\xF0\x9F\x8F\x84 ";
-    const char* bath = "\xF0\x9F\x9B\x80 ";
-    const char* basketball_woman = "\xE2\x9B\xB9\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* basketball_man = "\xE2\x9B\xB9 ";
-    const char* weight_lifting_woman = "\xF0\x9F\x8F\x8B\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* weight_lifting_man = "\xF0\x9F\x8F\x8B ";
-    const char* biking_woman = "\xF0\x9F\x9A\xB4\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* biking_man = "\xF0\x9F\x9A\xB4 ";
-    const char* mountain_biking_woman = "\xF0\x9F\x9A\xB5\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* mountain_biking_man = "\xF0\x9F\x9A\xB5 ";
-    const char* horse_racing = "\xF0\x9F\x8F\x87 ";
-    const char* business_suit_levitating = "\xF0\x9F\x95\xB4 ";
-    const char* trophy = "\xF0\x9F\x8F\x86 ";
-    const char* running_shirt_with_sash = "\xF0\x9F\x8E\xBD ";
-    const char* medal_sports = "\xF0\x9F\x8F\x85 ";
-    const char* medal_military = "\xF0\x9F\x8E\x96 ";
-    const char* first_place_medal = "\xF0\x9F\xA5\x87 ";
-    const char* second_place_medal = "\xF0\x9F\xA5\x88 ";
-    const char* third_place_medal = "\xF0\x9F\xA5\x89 ";
-    const char* reminder_ribbon = "\xF0\x9F\x8E\x97 ";
-    const char* rosette = "\xF0\x9F\x8F\xB5 ";
-    const char* ticket = "\xF0\x9F\x8E\xAB ";
-    const char* tickets = "\xF0\x9F\x8E\x9F ";
-    const char* performing_arts = "\xF0\x9F\x8E\xAD ";
-    const char* art = "\xF0\x9F\x8E\xA8 ";
-    const char* circus_tent = "\xF0\x9F\x8E\xAA ";
-    const char* woman_juggling = "\xF0\x9F\xA4\xB9\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
-    const char* man_juggling = "\xF0\x9F\xA4\xB9\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
-    const char* microphone = "\xF0\x9F\x8E\xA4 ";
-    const char* headphones = "\xF0\x9F\x8E\xA7 ";
-    const char* musical_score = "\xF0\x9F\x8E\xBC ";
-    const char* musical_keyboard = "\xF0\x9F\x8E\xB9 ";
-    const char* drum = "\xF0\x9F\xA5\x81 ";
-    const char* saxophone = "\xF0\x9F\x8E\xB7 ";
-    const char* trumpet = "\xF0\x9F\x8E\xBA ";
-    const char* guitar = "\xF0\x9F\x8E\xB8 ";
-    const char* violin = "\xF0\x9F\x8E\xBB ";
-    const char* clapper = "\xF0\x9F\x8E\xAC ";
-    const char* video_game = "\xF0\x9F\x8E\xAE ";
-    const char* space_invader = "\xF0\x9F\x91\xBE ";
-    const char* dart = "\xF0\x9F\x8E\xAF ";
-    const char* game_die = "\xF0\x9F\x8E\xB2 ";
-    const char* slot_machine = "\xF0\x9F\x8E\xB0 ";
-    const char* bowling = "\xF0\x9F\x8E\xB3 ";
-    const char* red_car = "\xF0\x9F\x9A\x97 ";
-    const char* taxi = "\xF0\x9F\x9A\x95 ";
-    const char* blue_car = "\xF0\x9F\x9A\x99 ";
-    const char* bus = "\xF0\x9F\x9A\x8C ";
-    const char* trolleybus = "\xF0\x9F\x9A\x8E ";
-    const char* racing_car = "\xF0\x9F\x8F\x8E ";
-    const char* police_car = "\xF0\x9F\x9A\x93 ";
-    const char* ambulance = "\xF0\x9F\x9A\x91 ";
-    const char* fire_engine = "\xF0\x9F\x9A\x92 ";
-    const char* minibus = "\xF0\x9F\x9A\x90 ";
-    const char* truck = "\xF0\x9F\x9A\x9A ";
-    const char* articulated_lorry = "\xF0\x9F\x9A\x9B ";
-    const char* tractor = "\xF0\x9F\x9A\x9C ";
-    const char* kick_scooter = "\xF0\x9F\x9B\xB4 ";
-    const char* motorcycle = "\xF0\x9F\x8F\x8D ";
-    const char* bike = "\xF0\x9F\x9A\xB2 ";
-    const char* motor_scooter = "\xF0\x9F\x9B\xB5 ";
-    const char* rotating_light = "\xF0\x9F\x9A\xA8 ";
-    const char* oncoming_police_car = "\xF0\x9F\x9A\x94 ";
-    const char* oncoming_bus = "\xF0\x9F\x9A\x8D ";
-    const char* oncoming_automobile = "\xF0\x9F\x9A\x98 ";
-    const char* oncoming_taxi = "\xF0\x9F\x9A\x96 ";
-    const char* aerial_tramway = "\xF0\x9F\x9A\xA1 ";
-    const char* mountain_cableway = "\xF0\x9F\x9A\xA0 ";
-    const char* suspension_railway = "\xF0\x9F\x9A\x9F ";
-    const char* railway_car = "\xF0\x9F\x9A\x83 ";
-    const char* train = "\xF0\x9F\x9A\x8B ";
-    const char* monorail = "\xF0\x9F\x9A\x9D ";
-    const char* bullettrain_side = "\xF0\x9F\x9A\x84 ";
-    const char* bullettrain_front = "\xF0\x9F\x9A\x85 ";
-    const char* light_rail = "\xF0\x9F\x9A\x88 ";
-    const char* mountain_railway = "\xF0\x9F\x9A\x9E ";
-    const char* steam_locomotive = "\xF0\x9F\x9A\x82 ";
-    const char* train2 = "\xF0\x9F\x9A\x86 ";
-    const char* metro = "\xF0\x9F\x9A\x87 ";
-    const char* tram = "\xF0\x9F\x9A\x8A ";
-    const char* station = "\xF0\x9F\x9A\x89 ";
-    const char* helicopter = "\xF0\x9F\x9A\x81 ";
-    const char* small_airplane = "\xF0\x9F\x9B\xA9 ";
-    const char* airplane = "\xE2\x9C\x88\xEF\xB8\x8F ";
-    const char* flight_departure = "\xF0\x9F\x9B\xAB ";
-    const char* flight_arrival = "\xF0\x9F\x9B\xAC ";
-    const char* sailboat = "\xE2\x9B\xB5 ";
-    const char* motor_boat = "\xF0\x9F\x9B\xA5 ";
-    const char* speedboat = "\xF0\x9F\x9A\xA4 ";
-    const char* ferry = "\xE2\x9B\xB4 ";
-    const char* passenger_ship = "\xF0\x9F\x9B\xB3 ";
-    const char* rocket = "\xF0\x9F\x9A\x80 ";
-    const char* artificial_satellite = "\xF0\x9F\x9B\xB0 ";
-    const char* seat = "\xF0\x9F\x92\xBA ";
-    const char* canoe = "\xF0\x9F\x9B\xB6 ";
-    const char* anchor = "\xE2\x9A\x93 ";
-    const char* construction = "\xF0\x9F\x9A\xA7 ";
-    const char* fuelpump = "\xE2\x9B\xBD ";
-    const char* busstop = "\xF0\x9F\x9A\x8F ";
-    const char* vertical_traffic_light = "\xF0\x9F\x9A\xA6 ";
-    const char* traffic_light = "\xF0\x9F\x9A\xA5 ";
-    const char* checkered_flag = "\xF0\x9F\x8F\x81 ";
-    const char* ship = "\xF0\x9F\x9A\xA2 ";
-    const char* ferris_wheel = "\xF0\x9F\x8E\xA1 ";
-    const char* roller_coaster = "\xF0\x9F\x8E\xA2 ";
-    const char* carousel_horse = "\xF0\x9F\x8E\xA0 ";
-    const char* building_construction = "\xF0\x9F\x8F\x97 ";
-    const char* foggy = "\xF0\x9F\x8C\x81 ";
-    const char* tokyo_tower = "\xF0\x9F\x97\xBC ";
-    const char* factory = "\xF0\x9F\x8F\xAD ";
-    const char* fountain = "\xE2\x9B\xB2 ";
-    const char* rice_scene = "\xF0\x9F\x8E\x91 ";
-    const char* mountain = "\xE2\x9B\xB0 ";
-    const char* mountain_snow = "\xF0\x9F\x8F\x94 ";
-    const char* mount_fuji = "\xF0\x9F\x97\xBB ";
-    const char* volcano = "\xF0\x9F\x8C\x8B ";
-    const char* japan = "\xF0\x9F\x97\xBE ";
-    const char* camping = "\xF0\x9F\x8F\x95 ";
-    const char* tent = "\xE2\x9B\xBA ";
-    const char* national_park = "\xF0\x9F\x8F\x9E ";
-    const char* motorway = "\xF0\x9F\x9B\xA3 ";
-    const char* railway_track = "\xF0\x9F\x9B\xA4 ";
-    const char* sunrise = "\xF0\x9F\x8C\x85 ";
-    const char* sunrise_over_mountains = "\xF0\x9F\x8C\x84 ";
-    const char* desert = "\xF0\x9F\x8F\x9C ";
-    const char* beach_umbrella = "\xF0\x9F\x8F\x96 ";
-    const char* desert_island = "\xF0\x9F\x8F\x9D ";
-    const char* city_sunrise = "\xF0\x9F\x8C\x87 ";
-    const char* city_sunset = "\xF0\x9F\x8C\x86 ";
-    const char* cityscape = "\xF0\x9F\x8F\x99 ";
-    const char* night_with_stars = "\xF0\x9F\x8C\x83 ";
-    const char* bridge_at_night = "\xF0\x9F\x8C\x89 ";
-    const char* milky_way = "\xF0\x9F\x8C\x8C ";
-    const char* stars = "\xF0\x9F\x8C\xA0 ";
-    const char* sparkler = "\xF0\x9F\x8E\x87 ";
-    const char* fireworks = "\xF0\x9F\x8E\x86 ";
-    const char* rainbow = "\xF0\x9F\x8C\x88 ";
-    const char* houses = "\xF0\x9F\x8F\x98 ";
-    const char* european_castle = "\xF0\x9F\x8F\xB0 ";
-    const char* japanese_castle = "\xF0\x9F\x8F\xAF ";
-    const char* stadium = "\xF0\x9F\x8F\x9F ";
-    const char* statue_of_liberty = "\xF0\x9F\x97\xBD ";
-    const char* house = "\xF0\x9F\x8F\xA0 ";
-    const char* house_with_garden = "\xF0\x9F\x8F\xA1 ";
-    const char* derelict_house = "\xF0\x9F\x8F\x9A ";
-    const char* office = "\xF0\x9F\x8F\xA2 ";
-    const char* department_store = "\xF0\x9F\x8F\xAC ";
-    const char* post_office = "\xF0\x9F\x8F\xA3 ";
-    const char* european_post_office = "\xF0\x9F\x8F\xA4 ";
-    const char* hospital = "\xF0\x9F\x8F\xA5 ";
-    const char* bank = "\xF0\x9F\x8F\xA6 ";
-    const char* hotel = "\xF0\x9F\x8F\xA8 ";
-    const char* convenience_store = "\xF0\x9F\x8F\xAA ";
-    const char* school = "\xF0\x9F\x8F\xAB ";
-    const char* love_hotel = "\xF0\x9F\x8F\xA9 ";
-    const char* wedding = "\xF0\x9F\x92\x92 ";
-    const char* classical_building = "\xF0\x9F\x8F\x9B ";
-    const char* church = "\xE2\x9B\xAA ";
-    const char* mosque = "\xF0\x9F\x95\x8C ";
-    const char* synagogue = "\xF0\x9F\x95\x8D ";
-    const char* kaaba = "\xF0\x9F\x95\x8B ";
-    const char* shinto_shrine = "\xE2\x9B\xA9 ";
-    const char* watch = "\xE2\x8C\x9A ";
-    const char* iphone = "\xF0\x9F\x93\xB1 ";
-    const char* calling = "\xF0\x9F\x93\xB2 ";
-    const char* computer = "\xF0\x9F\x92\xBB ";
-    const char* keyboard = "\xE2\x8C\xA8 ";
-    const char* desktop_computer = "\xF0\x9F\x96\xA5 ";
-    const char* printer = "\xF0\x9F\x96\xA8 ";
-    const char* computer_mouse = "\xF0\x9F\x96\xB1 ";
-    const char* trackball = "\xF0\x9F\x96\xB2 ";
-    const char* joystick = "\xF0\x9F\x95\xB9 ";
-    const char* clamp = "\xF0\x9F\x97\x9C ";
-    const char* minidisc = "\xF0\x9F\x92\xBD ";
-    const char* floppy_disk = "\xF0\x9F\x92\xBE ";
-    const char* cd = "\xF0\x9F\x92\xBF ";
-    const char* dvd = "\xF0\x9F\x93\x80 ";
-    const char* vhs = "\xF0\x9F\x93\xBC ";
-    const char* camera = "\xF0\x9F\x93\xB7 ";
-    const char* camera_flash = "\xF0\x9F\x93\xB8 ";
-    const char* video_camera = "\xF0\x9F\x93\xB9 ";
-    const char* movie_camera = "\xF0\x9F\x8E\xA5 ";
-    const char* film_projector = "\xF0\x9F\x93\xBD ";
-    const char* film_strip = "\xF0\x9F\x8E\x9E ";
-    const char* telephone_receiver = "\xF0\x9F\x93\x9E ";
-    const char* phone = "\xE2\x98\x8E\xEF\xB8\x8F ";
-    const char* pager = "\xF0\x9F\x93\x9F ";
-    const char* fax = "\xF0\x9F\x93\xA0 ";
-    const char* tv = "\xF0\x9F\x93\xBA ";
-    const char* radio = "\xF0\x9F\x93\xBB ";
-    const char* studio_microphone = "\xF0\x9F\x8E\x99 ";
-    const char* level_slider = "\xF0\x9F\x8E\x9A ";
-    const char* control_knobs = "\xF0\x9F\x8E\x9B ";
-    const char* stopwatch = "\xE2\x8F\xB1 ";
-    const char* timer_clock = "\xE2\x8F\xB2 ";
-    const char* alarm_clock = "\xE2\x8F\xB0 ";
-    const char* mantelpiece_clock = "\xF0\x9F\x95\xB0 ";
-    const char* hourglass_flowing_sand = "\xE2\x8F\xB3 ";
-    const char* hourglass = "\xE2\x8C\x9B ";
-    const char* satellite = "\xF0\x9F\x93\xA1 ";
-    const char* battery = "\xF0\x9F\x94\x8B ";
-    const char* electric_plug = "\xF0\x9F\x94\x8C ";
-    const char* bulb = "\xF0\x9F\x92\xA1 ";
-    const char* flashlight = "\xF0\x9F\x94\xA6 ";
-    const char* candle = "\xF0\x9F\x95\xAF ";
-    const char* wastebasket = "\xF0\x9F\x97\x91 ";
-    const char* oil_drum = "\xF0\x9F\x9B\xA2 ";
-    const char* money_with_wings = "\xF0\x9F\x92\xB8 ";
-    const char* dollar = "\xF0\x9F\x92\xB5 ";
-    const char* yen = "\xF0\x9F\x92\xB4 ";
-    const char* euro = "\xF0\x9F\x92\xB6 ";
-    const char* pound = "\xF0\x9F\x92\xB7 ";
-    const char* moneybag = "\xF0\x9F\x92\xB0 ";
-    const char* credit_card = "\xF0\x9F\x92\xB3 ";
-    const char* gem = "\xF0\x9F\x92\x8E ";
-    const char* balance_scale = "\xE2\x9A\x96 ";
-    const char* wrench = "\xF0\x9F\x94\xA7 ";
-    const char* hammer = "\xF0\x9F\x94\xA8 ";
-    const char* hammer_and_pick = "\xE2\x9A\x92 ";
-    const char* hammer_and_wrench = "\xF0\x9F\x9B\xA0 ";
-    const char* pick = "\xE2\x9B\x8F ";
-    const char* nut_and_bolt = "\xF0\x9F\x94\xA9 ";
-    const char* gear = "\xE2\x9A\x99 ";
-    const char* chains = "\xE2\x9B\x93 ";
-    const char* gun = "\xF0\x9F\x94\xAB ";
-    const char* bomb = "\xF0\x9F\x92\xA3 ";
-    const char* hocho = "\xF0\x9F\x94\xAA ";
-    const char* dagger = "\xF0\x9F\x97\xA1 ";
-    const char* crossed_swords = "\xE2\x9A\x94 ";
-    const char* shield = "\xF0\x9F\x9B\xA1 ";
-    const char* smoking = "\xF0\x9F\x9A\xAC ";
-    const char* skull_and_crossbones = "\xE2\x98\xA0 ";
-    const char* coffin = "\xE2\x9A\xB0 ";
-    const char* funeral_urn = "\xE2\x9A\xB1 ";
-    const char* amphora = "\xF0\x9F\x8F\xBA ";
-    const char* crystal_ball = "\xF0\x9F\x94\xAE ";
-    const char* prayer_beads = "\xF0\x9F\x93\xBF ";
-    const char* barber = "\xF0\x9F\x92\x88 ";
-    const char* alembic = "\xE2\x9A\x97 ";
-    const char* telescope = "\xF0\x9F\x94\xAD ";
-    const char* microscope = "\xF0\x9F\x94\xAC ";
-    const char* hole = "\xF0\x9F\x95\xB3 ";
-    const char* pill = "\xF0\x9F\x92\x8A ";
-    const char* syringe = "\xF0\x9F\x92\x89 ";
-    const char* thermometer = "\xF0\x9F\x8C\xA1 ";
-    const char* label = "\xF0\x9F\x8F\xB7 ";
-    const char* bookmark = "\xF0\x9F\x94\x96 ";
-    const char* toilet = "\xF0\x9F\x9A\xBD ";
-    const char* shower = "\xF0\x9F\x9A\xBF ";
-    const char* bathtub = "\xF0\x9F\x9B\x81 ";
-    const char* key = "\xF0\x9F\x94\x91 ";
-    const char* old_key = "\xF0\x9F\x97\x9D ";
-    const char* couch_and_lamp = "\xF0\x9F\x9B\x8B ";
-    const char* sleeping_bed = "\xF0\x9F\x9B\x8C ";
-    const char* bed = "\xF0\x9F\x9B\x8F ";
-    const char* door = "\xF0\x9F\x9A\xAA ";
-    const char* bellhop_bell = "\xF0\x9F\x9B\x8E ";
-    const char* framed_picture = "\xF0\x9F\x96\xBC ";
-    const char* world_map = "\xF0\x9F\x97\xBA ";
-    const char* parasol_on_ground = "\xE2\x9B\xB1 ";
-    const char* moyai = "\xF0\x9F\x97\xBF ";
-    const char* shopping = "\xF0\x9F\x9B\x8D ";
-    const char* shopping_cart = "\xF0\x9F\x9B\x92 ";
-    const char* balloon = "\xF0\x9F\x8E\x88 ";
-    const char* flags = "\xF0\x9F\x8E\x8F ";
-    const char* ribbon = "\xF0\x9F\x8E\x80 ";
-    const char* gift = "\xF0\x9F\x8E\x81 ";
-    const char* confetti_ball = "\xF0\x9F\x8E\x8A ";
-    const char* tada = "\xF0\x9F\x8E\x89 ";
-    const char* dolls = "\xF0\x9F\x8E\x8E ";
-    const char* wind_chime = "\xF0\x9F\x8E\x90 ";
-    const char* crossed_flags = "\xF0\x9F\x8E\x8C ";
-    const char* izakaya_lantern = "\xF0\x9F\x8F\xAE ";
-    const char* email = "\xE2\x9C\x89\xEF\xB8\x8F ";
-    const char* envelope_with_arrow = "\xF0\x9F\x93\xA9 ";
-    const char* incoming_envelope = "\xF0\x9F\x93\xA8 ";
-    const char* e_mail = "\xF0\x9F\x93\xA7 ";
-    const char* love_letter = "\xF0\x9F\x92\x8C ";
-    const char* postbox = "\xF0\x9F\x93\xAE ";
-    const char* mailbox_closed = "\xF0\x9F\x93\xAA ";
-    const char* mailbox = "\xF0\x9F\x93\xAB ";
-    const char* mailbox_with_mail = "\xF0\x9F\x93\xAC ";
-    const char* mailbox_with_no_mail = "\xF0\x9F\x93\xAD ";
-    const char* package = "\xF0\x9F\x93\xA6 ";
-    const char* postal_horn = "\xF0\x9F\x93\xAF ";
-    const char* inbox_tray = "\xF0\x9F\x93\xA5 ";
-    const char* outbox_tray = "\xF0\x9F\x93\xA4 ";
-    const char* scroll = "\xF0\x9F\x93\x9C ";
-    const char* page_with_curl = "\xF0\x9F\x93\x83 ";
-    const char* bookmark_tabs = "\xF0\x9F\x93\x91 ";
-    const char* bar_chart = "\xF0\x9F\x93\x8A ";
-    const char* chart_with_upwards_trend = "\xF0\x9F\x93\x88 ";
-    const char* chart_with_downwards_trend = "\xF0\x9F\x93\x89 ";
-    const char* page_facing_up = "\xF0\x9F\x93\x84 ";
-    const char* date = "\xF0\x9F\x93\x85 ";
-    const char* calendar = "\xF0\x9F\x93\x86 ";
-    const char* spiral_calendar = "\xF0\x9F\x97\x93 ";
-    const char* card_index = "\xF0\x9F\x93\x87 ";
-    const char* card_file_box = "\xF0\x9F\x97\x83 ";
-    const char* ballot_box = "\xF0\x9F\x97\xB3 ";
-    const char* file_cabinet = "\xF0\x9F\x97\x84 ";
-    const char* clipboard = "\xF0\x9F\x93\x8B ";
-    const char* spiral_notepad = "\xF0\x9F\x97\x92 ";
-    const char* file_folder = "\xF0\x9F\x93\x81 ";
-    const char* open_file_folder = "\xF0\x9F\x93\x82 ";
-    const char* card_index_dividers = "\xF0\x9F\x97\x82 ";
-    const char* newspaper_roll = "\xF0\x9F\x97\x9E ";
-    const char* newspaper = "\xF0\x9F\x93\xB0 ";
-    const char* notebook = "\xF0\x9F\x93\x93 ";
-    const char* closed_book = "\xF0\x9F\x93\x95 ";
-    const char* green_book = "\xF0\x9F\x93\x97 ";
-    const char* blue_book = "\xF0\x9F\x93\x98 ";
-    const char* orange_book = "\xF0\x9F\x93\x99 ";
-    const char* notebook_with_decorative_cover = "\xF0\x9F\x93\x94 ";
-    const char* ledger = "\xF0\x9F\x93\x92 ";
-    const char* books = "\xF0\x9F\x93\x9A ";
-    const char* open_book = "\xF0\x9F\x93\x96 ";
-    const char* link = "\xF0\x9F\x94\x97 ";
-    const char* paperclip = "\xF0\x9F\x93\x8E ";
-    const char* paperclips = "\xF0\x9F\x96\x87 ";
-    const char* scissors = "\xE2\x9C\x82\xEF\xB8\x8F ";
-    const char* triangular_ruler = "\xF0\x9F\x93\x90 ";
-    const char* straight_ruler = "\xF0\x9F\x93\x8F ";
-    const char* pushpin = "\xF0\x9F\x93\x8C ";
-    const char* round_pushpin = "\xF0\x9F\x93\x8D ";
-    const char* triangular_flag_on_post = "\xF0\x9F\x9A\xA9 ";
-    const char* white_flag = "\xF0\x9F\x8F\xB3 ";
-    const char* black_flag = "\xF0\x9F\x8F\xB4 ";
-    const char* rainbow_flag = "\xF0\x9F\x8F\xB3\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x8C\x88 ";
-    const char* closed_lock_with_key = "\xF0\x9F\x94\x90 ";
-    const char* lock = "\xF0\x9F\x94\x92 ";
-    const char* unlock = "\xF0\x9F\x94\x93 ";
-    const char* lock_with_ink_pen = "\xF0\x9F\x94\x8F ";
-    const char* pen = "\xF0\x9F\x96\x8A ";
-    const char* fountain_pen = "\xF0\x9F\x96\x8B ";
-    const char* black_nib = "\xE2\x9C\x92\xEF\xB8\x8F ";
-    const char* memo = "\xF0\x9F\x93\x9D ";
-    const char* pencil2 = "\xE2\x9C\x8F\xEF\xB8\x8F ";
-    const char* crayon = "\xF0\x9F\x96\x8D ";
-    const char* paintbrush = "\xF0\x9F\x96\x8C ";
-    const char* mag = "\xF0\x9F\x94\x8D ";
-    const char* mag_right = "\xF0\x9F\x94\x8E ";
-    const char* heart = "\xE2\x9D\xA4\xEF\xB8\x8F ";
-    const char* yellow_heart = "\xF0\x9F\x92\x9B ";
-    const char* green_heart = "\xF0\x9F\x92\x9A ";
-    const char* blue_heart = "\xF0\x9F\x92\x99 ";
-    const char* purple_heart = "\xF0\x9F\x92\x9C ";
-    const char* black_heart = "\xF0\x9F\x96\xA4 ";
-    const char* broken_heart = "\xF0\x9F\x92\x94 ";
-    const char* heavy_heart_exclamation = "\xE2\x9D\xA3 ";
-    const char* two_hearts = "\xF0\x9F\x92\x95 ";
-    const char* revolving_hearts = "\xF0\x9F\x92\x9E ";
-    const char* heartbeat = "\xF0\x9F\x92\x93 ";
-    const char* heartpulse = "\xF0\x9F\x92\x97 ";
-    const char* sparkling_heart = "\xF0\x9F\x92\x96 ";
-    const char* cupid = "\xF0\x9F\x92\x98 ";
-    const char* gift_heart = "\xF0\x9F\x92\x9D ";
-    const char* heart_decoration = "\xF0\x9F\x92\x9F ";
-    const char* peace_symbol = "\xE2\x98\xAE ";
-    const char* latin_cross = "\xE2\x9C\x9D ";
-    const char* star_and_crescent = "\xE2\x98\xAA ";
-    const char* om = "\xF0\x9F\x95\x89 ";
-    const char* wheel_of_dharma = "\xE2\x98\xB8 ";
-    const char* star_of_david = "\xE2\x9C\xA1 ";
-    const char* six_pointed_star = "\xF0\x9F\x94\xAF ";
-    const char* menorah = "\xF0\x9F\x95\x8E ";
-    const char* yin_yang = "\xE2\x98\xAF ";
-    const char* orthodox_cross = "\xE2\x98\xA6 ";
-    const char* place_of_worship = "\xF0\x9F\x9B\x90 ";
-    const char* ophiuchus = "\xE2\x9B\x8E ";
-    const char* aries = "\xE2\x99\x88 ";
-    const char* taurus = "\xE2\x99\x89 ";
-    const char* gemini = "\xE2\x99\x8A ";
-    const char* cancer = "\xE2\x99\x8B ";
-    const char* leo = "\xE2\x99\x8C ";
-    const char* virgo = "\xE2\x99\x8D ";
-    const char* libra = "\xE2\x99\x8E ";
-    const char* scorpius = "\xE2\x99\x8F ";
-    const char* sagittarius = "\xE2\x99\x90 ";
-    const char* capricorn = "\xE2\x99\x91 ";
-    const char* aquarius = "\xE2\x99\x92 ";
-    const char* pisces = "\xE2\x99\x93 ";
-    const char* id = "\xF0\x9F\x86\x94 ";
-    const char* atom_symbol = "\xE2\x9A\x9B ";
-    const char* u7a7a = "\xF0\x9F\x88\xB3 ";
-    const char* u5272 = "\xF0\x9F\x88\xB9 ";
-    const char* radioactive = "\xE2\x98\xA2 ";
-    const char* biohazard = "\xE2\x98\xA3 ";
-    const char* mobile_phone_off = "\xF0\x9F\x93\xB4 ";
-    const char* vibration_mode = "\xF0\x9F\x93\xB3 ";
-    const char* u6709 = "\xF0\x9F\x88\xB6 ";
-    const char* u7121 = "\xF0\x9F\x88\x9A ";
-    const char* u7533 = "\xF0\x9F\x88\xB8 ";
-    const char* u55b6 = "\xF0\x9F\x88\xBA ";
-    const char* u6708 = "\xF0\x9F\x88\xB7\xEF\xB8\x8F ";
-    const char* eight_pointed_black_star = "\xE2\x9C\xB4\xEF\xB8\x8F ";
-    const char* vs = "\xF0\x9F\x86\x9A ";
-    const char* accept = "\xF0\x9F\x89\x91 ";
-    const char* white_flower = "\xF0\x9F\x92\xAE ";
-    const char* ideograph_advantage = "\xF0\x9F\x89\x90 ";
-    const char* secret = "\xE3\x8A\x99\xEF\xB8\x8F ";
-    const char* congratulations = "\xE3\x8A\x97\xEF\xB8\x8F ";
-    const char* u5408 = "\xF0\x9F\x88\xB4 ";
-    const char* u6e80 = "\xF0\x9F\x88\xB5 ";
-    const char* u7981 = "\xF0\x9F\x88\xB2 ";
-    const char* a = "\xF0\x9F\x85\xB0\xEF\xB8\x8F ";
-    const char* b = "\xF0\x9F\x85\xB1\xEF\xB8\x8F ";
-    const char* ab = "\xF0\x9F\x86\x8E ";
-    const char* cl = "\xF0\x9F\x86\x91 ";
-    const char* o2 = "\xF0\x9F\x85\xBE\xEF\xB8\x8F ";
-    const char* sos = "\xF0\x9F\x86\x98 ";
-    const char* no_entry = "\xE2\x9B\x94 ";
-    const char* name_badge = "\xF0\x9F\x93\x9B ";
-    const char* no_entry_sign = "\xF0\x9F\x9A\xAB ";
-    const char* x = "\xE2\x9D\x8C ";
-    const char* o = "\xE2\xAD\x95 ";
-    const char* stop_sign = "\xF0\x9F\x9B\x91 ";
-    const char* anger = "\xF0\x9F\x92\xA2 ";
-    const char* hotsprings = "\xE2\x99\xA8\xEF\xB8\x8F ";
-    const char* no_pedestrians = "\xF0\x9F\x9A\xB7 ";
-    const char* do_not_litter = "\xF0\x9F\x9A\xAF ";
-    const char* no_bicycles = "\xF0\x9F\x9A\xB3 ";
-    const char* non_potable_water = "\xF0\x9F\x9A\xB1 ";
-    const char* underage = "\xF0\x9F\x94\x9E ";
-    const char* no_mobile_phones = "\xF0\x9F\x93\xB5 ";
-    const char* exclamation = "\xE2\x9D\x97 ";
-    const char* grey_exclamation = "\xE2\x9D\x95 ";
-    const char* question = "\xE2\x9D\x93 ";
-    const char* grey_question = "\xE2\x9D\x94 ";
-    const char* bangbang = "\xE2\x80\xBC\xEF\xB8\x8F ";
-    const char* interrobang = "\xE2\x81\x89\xEF\xB8\x8F ";
-    const char* low_brightness = "\xF0\x9F\x94\x85 ";
-    const char* high_brightness = "\xF0\x9F\x94\x86 ";
-    const char* trident = "\xF0\x9F\x94\xB1 ";
-    const char* fleur_de_lis = "\xE2\x9A\x9C ";
-    const char* part_alternation_mark = "\xE3\x80\xBD\xEF\xB8\x8F ";
-    const char* warning = "\xE2\x9A\xA0\xEF\xB8\x8F ";
-    const char* children_crossing = "\xF0\x9F\x9A\xB8 ";
-    const char* beginner = "\xF0\x9F\x94\xB0 ";
-    const char* recycle = "\xE2\x99\xBB\xEF\xB8\x8F ";
-    const char* u6307 = "\xF0\x9F\x88\xAF ";
-    const char* chart = "\xF0\x9F\x92\xB9 ";
-    const char* sparkle = "\xE2\x9D\x87\xEF\xB8\x8F ";
-    const char* eight_spoked_asterisk = "\xE2\x9C\xB3\xEF\xB8\x8F ";
-    const char* negative_squared_cross_mark = "\xE2\x9D\x8E ";
-    const char* white_check_mark = "\xE2\x9C\x85 ";
-    const char* diamond_shape_with_a_dot_inside = "\xF0\x9F\x92\xA0 ";
-    const char* cyclone = "\xF0\x9F\x8C\x80 ";
-    const char* loop = "\xE2\x9E\xBF ";
-    const char* globe_with_meridians = "\xF0\x9F\x8C\x90 ";
-    const char* m = "\xE2\x93\x82\xEF\xB8\x8F ";
-    const char* atm = "\xF0\x9F\x8F\xA7 ";
-    const char* sa = "\xF0\x9F\x88\x82\xEF\xB8\x8F ";
-    const char* passport_control = "\xF0\x9F\x9B\x82 ";
-    const char* customs = "\xF0\x9F\x9B\x83 ";
-    const char* baggage_claim = "\xF0\x9F\x9B\x84 ";
-    const char* left_luggage = "\xF0\x9F\x9B\x85 ";
-    const char* wheelchair = "\xE2\x99\xBF ";
-    const char* no_smoking = "\xF0\x9F\x9A\xAD ";
-    const char* wc = "\xF0\x9F\x9A\xBE ";
-    const char* parking = "\xF0\x9F\x85\xBF\xEF\xB8\x8F ";
-    const char* potable_water = "\xF0\x9F\x9A\xB0 ";
-    const char* mens = "\xF0\x9F\x9A\xB9 ";
-    const char* womens = "\xF0\x9F\x9A\xBA ";
-    const char* baby_symbol = "\xF0\x9F\x9A\xBC ";
-    const char* restroom = "\xF0\x9F\x9A\xBB ";
-    const char* put_litter_in_its_place = "\xF0\x9F\x9A\xAE ";
-    const char* cinema = "\xF0\x9F\x8E\xA6 ";
-    const char* signal_strength = "\xF0\x9F\x93\xB6 ";
-    const char* koko = "\xF0\x9F\x88\x81 ";
-    const char* ng = "\xF0\x9F\x86\x96 ";
-    const char* ok = "\xF0\x9F\x86\x97 ";
-    const char* up = "\xF0\x9F\x86\x99 ";
-    const char* cool = "\xF0\x9F\x86\x92 ";
-    const char* new_ = "\xF0\x9F\x86\x95 ";
-    const char* free = "\xF0\x9F\x86\x93 ";
-    const char* zero = "\x30\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* one = "\x31\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* two = "\x32\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* three = "\x33\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* four = "\x34\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* five = "\x35\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* six = "\x36\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* seven = "\x37\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* eight = "\x38\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* nine = "\x39\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* keycap_ten = "\xF0\x9F\x94\x9F ";
-    const char* asterisk = "\x2A\xE2\x83\xA3 ";
-    const char* arrow_forward = "\xE2\x96\xB6\xEF\xB8\x8F ";
-    const char* pause_button = "\xE2\x8F\xB8 ";
-    const char* next_track_button = "\xE2\x8F\xAD ";
-    const char* stop_button = "\xE2\x8F\xB9 ";
-    const char* record_button = "\xE2\x8F\xBA ";
-    const char* play_or_pause_button = "\xE2\x8F\xAF ";
-    const char* previous_track_button = "\xE2\x8F\xAE ";
-    const char* fast_forward = "\xE2\x8F\xA9 ";
-    const char* rewind = "\xE2\x8F\xAA ";
-    const char* twisted_rightwards_arrows = "\xF0\x9F\x94\x80 ";
-    const char* repeat = "\xF0\x9F\x94\x81 ";
-    const char* repeat_one = "\xF0\x9F\x94\x82 ";
-    const char* arrow_backward = "\xE2\x97\x80\xEF\xB8\x8F ";
-    const char* arrow_up_small = "\xF0\x9F\x94\xBC ";
-    const char* arrow_down_small = "\xF0\x9F\x94\xBD ";
-    const char* arrow_double_up = "\xE2\x8F\xAB ";
-    const char* arrow_double_down = "\xE2\x8F\xAC ";
-    const char* arrow_right = "\xE2\x9E\xA1\xEF\xB8\x8F ";
-    const char* arrow_left = "\xE2\xAC\x85\xEF\xB8\x8F ";
-    const char* arrow_up = "\xE2\xAC\x86\xEF\xB8\x8F ";
-    const char* arrow_down = "\xE2\xAC\x87\xEF\xB8\x8F ";
-    const char* arrow_upper_right = "\xE2\x86\x97\xEF\xB8\x8F ";
-    const char* arrow_lower_right = "\xE2\x86\x98\xEF\xB8\x8F ";
-    const char* arrow_lower_left = "\xE2\x86\x99\xEF\xB8\x8F ";
-    const char* arrow_upper_left = "\xE2\x86\x96\xEF\xB8\x8F ";
-    const char* arrow_up_down = "\xE2\x86\x95\xEF\xB8\x8F ";
-    const char* left_right_arrow = "\xE2\x86\x94\xEF\xB8\x8F ";
-    const char* arrows_counterclockwise = "\xF0\x9F\x94\x84 ";
-    const char* arrow_right_hook = "\xE2\x86\xAA\xEF\xB8\x8F ";
-    const char* leftwards_arrow_with_hook = "\xE2\x86\xA9\xEF\xB8\x8F ";
-    const char* arrow_heading_up = "\xE2\xA4\xB4\xEF\xB8\x8F ";
-    const char* arrow_heading_down = "\xE2\xA4\xB5\xEF\xB8\x8F ";
-    const char* hash = "\x23\xEF\xB8\x8F\xE2\x83\xA3 ";
-    const char* information_source = "\xE2\x84\xB9\xEF\xB8\x8F ";
-    const char* abc = "\xF0\x9F\x94\xA4 ";
-    const char* abcd = "\xF0\x9F\x94\xA1 ";
-    const char* capital_abcd = "\xF0\x9F\x94\xA0 ";
-    const char* symbols = "\xF0\x9F\x94\xA3 ";
-    const char* musical_note = "\xF0\x9F\x8E\xB5 ";
-    const char* notes = "\xF0\x9F\x8E\xB6 ";
-    const char* wavy_dash = "\xE3\x80\xB0\xEF\xB8\x8F ";
-    const char* curly_loop = "\xE2\x9E\xB0 ";
-    const char* heavy_check_mark = "\xE2\x9C\x94\xEF\xB8\x8F ";
-    const char* arrows_clockwise = "\xF0\x9F\x94\x83 ";
-    const char* heavy_plus_sign = "\xE2\x9E\x95 ";
-    const char* heavy_minus_sign = "\xE2\x9E\x96 ";
-    const char* heavy_division_sign = "\xE2\x9E\x97 ";
-    const char* heavy_multiplication_x = "\xE2\x9C\x96\xEF\xB8\x8F ";
-    const char* heavy_dollar_sign = "\xF0\x9F\x92\xB2 ";
-    const char* currency_exchange = "\xF0\x9F\x92\xB1 ";
-    const char* copyright = "\xC2\xA9\xEF\xB8\x8F ";
-    const char* registered = "\xC2\xAE\xEF\xB8\x8F ";
-    const char* tm = "\xE2\x84\xA2\xEF\xB8\x8F ";
-    const char* end = "\xF0\x9F\x94\x9A ";
-    const char* back = "\xF0\x9F\x94\x99 ";
-    const char* on = "\xF0\x9F\x94\x9B ";
-    const char* top = "\xF0\x9F\x94\x9D ";
-    const char* soon = "\xF0\x9F\x94\x9C ";
-    const char* ballot_box_with_check = "\xE2\x98\x91\xEF\xB8\x8F ";
-    const char* radio_button = "\xF0\x9F\x94\x98 ";
-    const char* white_circle = "\xE2\x9A\xAA ";
-    const char* black_circle = "\xE2\x9A\xAB ";
-    const char* red_circle = "\xF0\x9F\x94\xB4 ";
-    const char* large_blue_circle = "\xF0\x9F\x94\xB5 ";
-    const char* small_orange_diamond = "\xF0\x9F\x94\xB8 ";
-    const char* small_blue_diamond = "\xF0\x9F\x94\xB9 ";
-    const char* large_orange_diamond = "\xF0\x9F\x94\xB6 ";
-    const char* large_blue_diamond = "\xF0\x9F\x94\xB7 ";
-    const char* small_red_triangle = "\xF0\x9F\x94\xBA ";
-    const char* black_small_square = "\xE2\x96\xAA\xEF\xB8\x8F ";
-    const char* white_small_square = "\xE2\x96\xAB\xEF\xB8\x8F ";
-    const char* black_large_square = "\xE2\xAC\x9B ";
-    const char* white_large_square = "\xE2\xAC\x9C ";
-    const char* small_red_triangle_down = "\xF0\x9F\x94\xBB ";
-    const char* black_medium_square = "\xE2\x97\xBC\xEF\xB8\x8F ";
-    const char* white_medium_square = "\xE2\x97\xBB\xEF\xB8\x8F ";
-    const char* black_medium_small_square = "\xE2\x97\xBE ";
-    const char* white_medium_small_square = "\xE2\x97\xBD ";
-    const char* black_square_button = "\xF0\x9F\x94\xB2 ";
-    const char* white_square_button = "\xF0\x9F\x94\xB3 ";
-    const char* speaker = "\xF0\x9F\x94\x88 ";
-    const char* sound = "\xF0\x9F\x94\x89 ";
-    const char* loud_sound = "\xF0\x9F\x94\x8A ";
-    const char* mute = "\xF0\x9F\x94\x87 ";
-    const char* mega = "\xF0\x9F\x93\xA3 ";
-    const char* loudspeaker = "\xF0\x9F\x93\xA2 ";
-    const char* bell = "\xF0\x9F\x94\x94 ";
-    const char* no_bell = "\xF0\x9F\x94\x95 ";
-    const char* black_joker = "\xF0\x9F\x83\x8F ";
-    const char* mahjong = "\xF0\x9F\x80\x84 ";
-    const char* spades = "\xE2\x99\xA0\xEF\xB8\x8F ";
-    const char* clubs = "\xE2\x99\xA3\xEF\xB8\x8F ";
-    const char* hearts = "\xE2\x99\xA5\xEF\xB8\x8F ";
-    const char* diamonds = "\xE2\x99\xA6\xEF\xB8\x8F ";
-    const char* flower_playing_cards = "\xF0\x9F\x8E\xB4 ";
-    const char* thought_balloon = "\xF0\x9F\x92\xAD ";
-    const char* right_anger_bubble = "\xF0\x9F\x97\xAF ";
-    const char* speech_balloon = "\xF0\x9F\x92\xAC ";
-    const char* left_speech_bubble = "\xF0\x9F\x97\xA8 ";
-    const char* clock1 = "\xF0\x9F\x95\x90 ";
-    const char* clock2 = "\xF0\x9F\x95\x91 ";
-    const char* clock3 = "\xF0\x9F\x95\x92 ";
-    const char* clock4 = "\xF0\x9F\x95\x93 ";
-    const char* clock5 = "\xF0\x9F\x95\x94 ";
-    const char* clock6 = "\xF0\x9F\x95\x95 ";
-    const char* clock7 = "\xF0\x9F\x95\x96 ";
-    const char* clock8 = "\xF0\x9F\x95\x97 ";
-    const char* clock9 = "\xF0\x9F\x95\x98 ";
-    const char* clock10 = "\xF0\x9F\x95\x99 ";
-    const char* clock11 = "\xF0\x9F\x95\x9A ";
-    const char* clock12 = "\xF0\x9F\x95\x9B ";
-    const char* clock130 = "\xF0\x9F\x95\x9C ";
-    const char* clock230 = "\xF0\x9F\x95\x9D ";
-    const char* clock330 = "\xF0\x9F\x95\x9E ";
-    const char* clock430 = "\xF0\x9F\x95\x9F ";
-    const char* clock530 = "\xF0\x9F\x95\xA0 ";
-    const char* clock630 = "\xF0\x9F\x95\xA1 ";
-    const char* clock730 = "\xF0\x9F\x95\xA2 ";
-    const char* clock830 = "\xF0\x9F\x95\xA3 ";
-    const char* clock930 = "\xF0\x9F\x95\xA4 ";
-    const char* clock1030 = "\xF0\x9F\x95\xA5 ";
-    const char* clock1130 = "\xF0\x9F\x95\xA6 ";
-    const char* clock1230 = "\xF0\x9F\x95\xA7 ";
-    const char* afghanistan = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAB ";
-    const char* aland_islands = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBD ";
-    const char* albania = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB1 ";
-    const char* algeria = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xBF ";
-    const char* american_samoa = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB8 ";
-    const char* andorra = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xA9 ";
-    const char* angola = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB4 ";
-    const char* anguilla = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAE ";
-    const char* antarctica = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB6 ";
-    const char* antigua_barbuda = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAC ";
-    const char* argentina = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB7 ";
-    const char* armenia = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB2 ";
-    const char* aruba = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBC ";
-    const char* australia = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBA ";
-    const char* austria = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB9 ";
-    const char* azerbaijan = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBF ";
-    const char* bahamas = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB8 ";
-    const char* bahrain = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAD ";
-    const char* bangladesh = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xA9 ";
-    const char* barbados = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xA7 ";
-    const char* belarus = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xBE ";
-    const char* belgium = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAA ";
-    const char* belize = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xBF ";
-    const char* benin = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAF ";
-    const char* bermuda = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB2 ";
-    const char* bhutan = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB9 ";
-    const char* bolivia = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB4 ";
-    const char* caribbean_netherlands = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB6 ";
-    const char* bosnia_herzegovina = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xA6 ";
-    const char* botswana = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xBC ";
-    const char* brazil = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB7 ";
-    const char* british_indian_ocean_territory = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB4 ";
-    const char* british_virgin_islands = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xAC ";
-    const char* brunei = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB3 ";
-    const char* bulgaria = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAC ";
-    const char* burkina_faso = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAB ";
-    const char* burundi = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAE ";
-    const char* cape_verde = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBB ";
-    const char* cambodia = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAD ";
-    const char* cameroon = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB2 ";
-    const char* canada = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xA6 ";
-    const char* canary_islands = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xA8 ";
-    const char* cayman_islands = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xBE ";
-    const char* central_african_republic = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAB ";
-    const char* chad = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xA9 ";
-    const char* chile = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB1 ";
-    const char* cn = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB3 ";
-    const char* christmas_island = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBD ";
-    const char* cocos_islands = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xA8 ";
-    const char* colombia = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB4 ";
-    const char* comoros = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB2 ";
-    const char* congo_brazzaville = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAC ";
-    const char* congo_kinshasa = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xA9 ";
-    const char* cook_islands = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB0 ";
-    const char* costa_rica = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB7 ";
-    const char* croatia = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB7 ";
-    const char* cuba = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBA ";
-    const char* curacao = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBC ";
-    const char* cyprus = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBE ";
-    const char* czech_republic = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBF ";
-    const char* denmark = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xB0 ";
-    const char* djibouti = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAF ";
-    const char* dominica = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xB2 ";
-    const char* dominican_republic = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xB4 ";
-    const char* ecuador = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xA8 ";
-    const char* egypt = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xAC ";
-    const char* el_salvador = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBB ";
-    const char* equatorial_guinea = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB6 ";
-    const char* eritrea = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xB7 ";
-    const char* estonia = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xAA ";
-    const char* ethiopia = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xB9 ";
-    const char* eu = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xBA ";
-    const char* falkland_islands = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB0 ";
-    const char* faroe_islands = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB4 ";
-    const char* fiji = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xAF ";
-    const char* finland = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xAE ";
-    const char* fr = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7 ";
-    const char* french_guiana = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAB ";
-    const char* french_polynesia = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAB ";
-    const char* french_southern_territories = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAB ";
-    const char* gabon = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xA6 ";
-    const char* gambia = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB2 ";
-    const char* georgia = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAA ";
-    const char* de = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA ";
-    const char* ghana = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAD ";
-    const char* gibraltar = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAE ";
-    const char* greece = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB7 ";
-    const char* greenland = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB1 ";
-    const char* grenada = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xA9 ";
-    const char* guadeloupe = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB5 ";
-    const char* guam = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xBA ";
-    const char* guatemala = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB9 ";
-    const char* guernsey = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAC ";
-    const char* guinea = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB3 ";
-    const char* guinea_bissau = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xBC ";
-    const char* guyana = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xBE ";
-    const char* haiti = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB9 ";
-    const char* honduras = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB3 ";
-    const char* hong_kong = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB0 ";
-    const char* hungary = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xBA ";
-    const char* iceland = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB8 ";
-    const char* india = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB3 ";
-    const char* indonesia = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xA9 ";
-    const char* iran = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB7 ";
-    const char* iraq = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB6 ";
-    const char* ireland = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xAA ";
-    const char* isle_of_man = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB2 ";
-    const char* israel = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB1 ";
-    const char* it = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB9 ";
-    const char* cote_divoire = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAE ";
-    const char* jamaica = "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB2 ";
-    const char* jp = "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB5 ";
-    const char* jersey = "\xF0\x9F\x87\xAF\xF0\x9F\x87\xAA ";
-    const char* jordan = "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB4 ";
-    const char* kazakhstan = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xBF ";
-    const char* kenya = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAA ";
-    const char* kiribati = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAE ";
-    const char* kosovo = "\xF0\x9F\x87\xBD\xF0\x9F\x87\xB0 ";
-    const char* kuwait = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xBC ";
-    const char* kyrgyzstan = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAC ";
-    const char* laos = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xA6 ";
-    const char* latvia = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xBB ";
-    const char* lebanon = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xA7 ";
-    const char* lesotho = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB8 ";
-    const char* liberia = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB7 ";
-    const char* libya = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xBE ";
-    const char* liechtenstein = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xAE ";
-    const char* lithuania = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB9 ";
-    const char* luxembourg = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xBA ";
-    const char* macau = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB4 ";
-    const char* macedonia = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB0 ";
-    const char* madagascar = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xAC ";
-    const char* malawi = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBC ";
-    const char* malaysia = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBE ";
-    const char* maldives = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBB ";
-    const char* mali = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB1 ";
-    const char* malta = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB9 ";
-    const char* marshall_islands = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xAD ";
-    const char* martinique = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB6 ";
-    const char* mauritania = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB7 ";
-    const char* mauritius = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBA ";
-    const char* mayotte = "\xF0\x9F\x87\xBE\xF0\x9F\x87\xB9 ";
-    const char* mexico = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBD ";
-    const char* micronesia = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB2 ";
-    const char* moldova = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xA9 ";
-    const char* monaco = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xA8 ";
-    const char* mongolia = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB3 ";
-    const char* montenegro = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xAA ";
-    const char* montserrat = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB8 ";
-    const char* morocco = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xA6 ";
-    const char* mozambique = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBF ";
-    const char* myanmar = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB2 ";
-    const char* namibia = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xA6 ";
-    const char* nauru = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB7 ";
-    const char* nepal = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB5 ";
-    const char* netherlands = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB1 ";
-    const char* new_caledonia = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xA8 ";
-    const char* new_zealand = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xBF ";
-    const char* nicaragua = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAE ";
-    const char* niger = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAA ";
-    const char* nigeria = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAC ";
-    const char* niue = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xBA ";
-    const char* norfolk_island = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAB ";
-    const char* northern_mariana_islands = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB5 ";
-    const char* north_korea = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB5 ";
-    const char* norway = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB4 ";
-    const char* oman = "\xF0\x9F\x87\xB4\xF0\x9F\x87\xB2 ";
-    const char* pakistan = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB0 ";
-    const char* palau = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xBC ";
-    const char* palestinian_territories = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB8 ";
-    const char* panama = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xA6 ";
-    const char* papua_new_guinea = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAC ";
-    const char* paraguay = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xBE ";
-    const char* peru = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAA ";
-    const char* philippines = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAD ";
-    const char* pitcairn_islands = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB3 ";
-    const char* poland = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB1 ";
-    const char* portugal = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB9 ";
-    const char* puerto_rico = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB7 ";
-    const char* qatar = "\xF0\x9F\x87\xB6\xF0\x9F\x87\xA6 ";
-    const char* reunion = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xAA ";
-    const char* romania = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xB4 ";
-    const char* ru = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xBA ";
-    const char* rwanda = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xBC ";
-    const char* st_barthelemy = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB1 ";
-    const char* st_helena = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAD ";
-    const char* st_kitts_nevis = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB3 ";
-    const char* st_lucia = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xA8 ";
-    const char* st_pierre_miquelon = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB2 ";
-    const char* st_vincent_grenadines = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xA8 ";
-    const char* samoa = "\xF0\x9F\x87\xBC\xF0\x9F\x87\xB8 ";
-    const char* san_marino = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB2 ";
-    const char* sao_tome_principe = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB9 ";
-    const char* saudi_arabia = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA6 ";
-    const char* senegal = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB3 ";
-    const char* serbia = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xB8 ";
-    const char* seychelles = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA8 ";
-    const char* sierra_leone = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB1 ";
-    const char* singapore = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAC ";
-    const char* sint_maarten = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBD ";
-    const char* slovakia = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB0 ";
-    const char* slovenia = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAE ";
-    const char* solomon_islands = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA7 ";
-    const char* somalia = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB4 ";
-    const char* south_africa = "\xF0\x9F\x87\xBF\xF0\x9F\x87\xA6 ";
-    const char* south_georgia_south_sandwich_islands = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB8 ";
-    const char* kr = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB7 ";
-    const char* south_sudan = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB8 ";
-    const char* es = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xB8 ";
-    const char* sri_lanka = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB0 ";
-    const char* sudan = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA9 ";
-    const char* suriname = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB7 ";
-    const char* swaziland = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBF ";
-    const char* sweden = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAA ";
-    const char* switzerland = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAD ";
-    const char* syria = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBE ";
-    const char* taiwan = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xBC ";
-    const char* tajikistan = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAF ";
-    const char* tanzania = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xBF ";
-    const char* thailand = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAD ";
-    const char* timor_leste = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB1 ";
-    const char* togo = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAC ";
-    const char* tokelau = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB0 ";
-    const char* tonga = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB4 ";
-    const char* trinidad_tobago = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB9 ";
-    const char* tunisia = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB3 ";
-    const char* tr = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB7 ";
-    const char* turkmenistan = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB2 ";
-    const char* turks_caicos_islands = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xA8 ";
-    const char* tuvalu = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xBB ";
-    const char* uganda = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xAC ";
-    const char* ukraine = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xA6 ";
-    const char* united_arab_emirates = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAA ";
-    const char* uk = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xA7 ";
-    const char* us = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xB8 ";
-    const char* us_virgin_islands = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xAE ";
-    const char* uruguay = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xBE ";
-    const char* uzbekistan = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xBF ";
-    const char* vanuatu = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xBA ";
-    const char* vatican_city = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xA6 ";
-    const char* venezuela = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xAA ";
-    const char* vietnam = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xB3 ";
-    const char* wallis_futuna = "\xF0\x9F\x87\xBC\xF0\x9F\x87\xAB ";
-    const char* western_sahara = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xAD ";
-    const char* yemen = "\xF0\x9F\x87\xBE\xF0\x9F\x87\xAA ";
-    const char* zambia = "\xF0\x9F\x87\xBF\xF0\x9F\x87\xB2 ";
-    const char* zimbabwe = "\xF0\x9F\x87\xBF\xF0\x9F\x87\xBC ";
+    Example:
+
+        #include "canary/emoji/travel_places.hpp"
+
+        std::cout << Canary::Emoji::zap << "Done" << std::endl;
+ */
 
-} /* namespace Emoji */
-} /* namespace Canary */
+#include "emoji/view.hpp"
+#include "emoji/smileys_emotion.hpp"
+#include "emoji/people_body.hpp"
+#include "emoji/animals_nature.hpp"
+#include "emoji/food_drink.hpp"
+#include "emoji/travel_places.hpp"
+#include "emoji/activities.hpp"
+#include "emoji/objects.hpp"
+#include "emoji/symbols.hpp"
+#include "emoji/flags.hpp"
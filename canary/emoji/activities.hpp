@@ -0,0 +1,95 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // Activities
+
+    CANARY_INLINE_VARIABLE constexpr char jack_o_lantern[] = "\xF0\x9F\x8E\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char christmas_tree[] = "\xF0\x9F\x8E\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char fireworks[] = "\xF0\x9F\x8E\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char sparkler[] = "\xF0\x9F\x8E\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char sparkles[] = "\xE2\x9C\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char balloon[] = "\xF0\x9F\x8E\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char tada[] = "\xF0\x9F\x8E\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char confetti_ball[] = "\xF0\x9F\x8E\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char tanabata_tree[] = "\xF0\x9F\x8E\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char bamboo[] = "\xF0\x9F\x8E\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char dolls[] = "\xF0\x9F\x8E\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char flags[] = "\xF0\x9F\x8E\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char wind_chime[] = "\xF0\x9F\x8E\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char rice_scene[] = "\xF0\x9F\x8E\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char ribbon[] = "\xF0\x9F\x8E\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char gift[] = "\xF0\x9F\x8E\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char reminder_ribbon[] = "\xF0\x9F\x8E\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char tickets[] = "\xF0\x9F\x8E\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char ticket[] = "\xF0\x9F\x8E\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char medal_military[] = "\xF0\x9F\x8E\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char trophy[] = "\xF0\x9F\x8F\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char medal_sports[] = "\xF0\x9F\x8F\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char first_place_medal[] = "\xF0\x9F\xA5\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char second_place_medal[] = "\xF0\x9F\xA5\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char third_place_medal[] = "\xF0\x9F\xA5\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char soccer[] = "\xE2\x9A\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char baseball[] = "\xE2\x9A\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char basketball[] = "\xF0\x9F\x8F\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char volleyball[] = "\xF0\x9F\x8F\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char football[] = "\xF0\x9F\x8F\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char rugby_football[] = "\xF0\x9F\x8F\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char tennis[] = "\xF0\x9F\x8E\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char bowling[] = "\xF0\x9F\x8E\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char cricket[] = "\xF0\x9F\x8F\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char field_hockey[] = "\xF0\x9F\x8F\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char ice_hockey[] = "\xF0\x9F\x8F\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char ping_pong[] = "\xF0\x9F\x8F\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char badminton[] = "\xF0\x9F\x8F\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char boxing_glove[] = "\xF0\x9F\xA5\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char martial_arts_uniform[] = "\xF0\x9F\xA5\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char goal_net[] = "\xF0\x9F\xA5\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char golf[] = "\xE2\x9B\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char ice_skate[] = "\xE2\x9B\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char fishing_pole_and_fish[] = "\xF0\x9F\x8E\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char running_shirt_with_sash[] = "\xF0\x9F\x8E\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char ski[] = "\xF0\x9F\x8E\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char dart[] = "\xF0\x9F\x8E\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char gun[] = "\xF0\x9F\x94\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char eight_ball[] = "\xF0\x9F\x8E\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char crystal_ball[] = "\xF0\x9F\x94\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char video_game[] = "\xF0\x9F\x8E\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char joystick[] = "\xF0\x9F\x95\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char slot_machine[] = "\xF0\x9F\x8E\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char game_die[] = "\xF0\x9F\x8E\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char spades[] = "\xE2\x99\xA0\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char hearts[] = "\xE2\x99\xA5\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char diamonds[] = "\xE2\x99\xA6\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char clubs[] = "\xE2\x99\xA3\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char black_joker[] = "\xF0\x9F\x83\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char mahjong[] = "\xF0\x9F\x80\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char flower_playing_cards[] = "\xF0\x9F\x8E\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char performing_arts[] = "\xF0\x9F\x8E\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char framed_picture[] = "\xF0\x9F\x96\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char art[] = "\xF0\x9F\x8E\xA8 ";
+
+} /* namespace Emoji */
+} /* namespace Canary */
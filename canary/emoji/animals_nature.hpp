@@ -0,0 +1,136 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // Animals & Nature
+
+    CANARY_INLINE_VARIABLE constexpr char monkey_face[] = "\xF0\x9F\x90\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char monkey[] = "\xF0\x9F\x90\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char gorilla[] = "\xF0\x9F\xA6\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char dog[] = "\xF0\x9F\x90\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char dog2[] = "\xF0\x9F\x90\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char poodle[] = "\xF0\x9F\x90\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char wolf[] = "\xF0\x9F\x90\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char fox_face[] = "\xF0\x9F\xA6\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char cat[] = "\xF0\x9F\x90\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char cat2[] = "\xF0\x9F\x90\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char lion[] = "\xF0\x9F\xA6\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char tiger[] = "\xF0\x9F\x90\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char tiger2[] = "\xF0\x9F\x90\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char leopard[] = "\xF0\x9F\x90\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char horse[] = "\xF0\x9F\x90\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char racehorse[] = "\xF0\x9F\x90\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char unicorn[] = "\xF0\x9F\xA6\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char deer[] = "\xF0\x9F\xA6\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char cow[] = "\xF0\x9F\x90\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char ox[] = "\xF0\x9F\x90\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char water_buffalo[] = "\xF0\x9F\x90\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char cow2[] = "\xF0\x9F\x90\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char pig[] = "\xF0\x9F\x90\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char pig2[] = "\xF0\x9F\x90\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char boar[] = "\xF0\x9F\x90\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char pig_nose[] = "\xF0\x9F\x90\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char ram[] = "\xF0\x9F\x90\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char sheep[] = "\xF0\x9F\x90\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char goat[] = "\xF0\x9F\x90\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char dromedary_camel[] = "\xF0\x9F\x90\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char camel[] = "\xF0\x9F\x90\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char elephant[] = "\xF0\x9F\x90\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char rhinoceros[] = "\xF0\x9F\xA6\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char mouse[] = "\xF0\x9F\x90\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char mouse2[] = "\xF0\x9F\x90\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char rat[] = "\xF0\x9F\x90\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char hamster[] = "\xF0\x9F\x90\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char rabbit[] = "\xF0\x9F\x90\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char rabbit2[] = "\xF0\x9F\x90\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char chipmunk[] = "\xF0\x9F\x90\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char bat[] = "\xF0\x9F\xA6\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char bear[] = "\xF0\x9F\x90\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char koala[] = "\xF0\x9F\x90\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char panda_face[] = "\xF0\x9F\x90\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char paw_prints[] = "\xF0\x9F\x90\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char turkey[] = "\xF0\x9F\xA6\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char chicken[] = "\xF0\x9F\x90\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char rooster[] = "\xF0\x9F\x90\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char hatching_chick[] = "\xF0\x9F\x90\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char baby_chick[] = "\xF0\x9F\x90\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char hatched_chick[] = "\xF0\x9F\x90\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char bird[] = "\xF0\x9F\x90\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char penguin[] = "\xF0\x9F\x90\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char dove[] = "\xF0\x9F\x95\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char eagle[] = "\xF0\x9F\xA6\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char duck[] = "\xF0\x9F\xA6\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char owl[] = "\xF0\x9F\xA6\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char frog[] = "\xF0\x9F\x90\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char crocodile[] = "\xF0\x9F\x90\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char turtle[] = "\xF0\x9F\x90\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char lizard[] = "\xF0\x9F\xA6\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char snake[] = "\xF0\x9F\x90\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char dragon_face[] = "\xF0\x9F\x90\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char dragon[] = "\xF0\x9F\x90\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char whale[] = "\xF0\x9F\x90\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char whale2[] = "\xF0\x9F\x90\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char dolphin[] = "\xF0\x9F\x90\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char fish[] = "\xF0\x9F\x90\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char tropical_fish[] = "\xF0\x9F\x90\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char blowfish[] = "\xF0\x9F\x90\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char shark[] = "\xF0\x9F\xA6\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char octopus[] = "\xF0\x9F\x90\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char shell[] = "\xF0\x9F\x90\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char snail[] = "\xF0\x9F\x90\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char butterfly[] = "\xF0\x9F\xA6\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char bug[] = "\xF0\x9F\x90\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char ant[] = "\xF0\x9F\x90\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char honeybee[] = "\xF0\x9F\x90\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char beetle[] = "\xF0\x9F\x90\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char spider[] = "\xF0\x9F\x95\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char spider_web[] = "\xF0\x9F\x95\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char scorpion[] = "\xF0\x9F\xA6\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char bouquet[] = "\xF0\x9F\x92\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char cherry_blossom[] = "\xF0\x9F\x8C\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char white_flower[] = "\xF0\x9F\x92\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char rosette[] = "\xF0\x9F\x8F\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char rose[] = "\xF0\x9F\x8C\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char wilted_flower[] = "\xF0\x9F\xA5\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char hibiscus[] = "\xF0\x9F\x8C\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char sunflower[] = "\xF0\x9F\x8C\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char blossom[] = "\xF0\x9F\x8C\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char tulip[] = "\xF0\x9F\x8C\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char seedling[] = "\xF0\x9F\x8C\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char evergreen_tree[] = "\xF0\x9F\x8C\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char deciduous_tree[] = "\xF0\x9F\x8C\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char palm_tree[] = "\xF0\x9F\x8C\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char cactus[] = "\xF0\x9F\x8C\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char ear_of_rice[] = "\xF0\x9F\x8C\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char herb[] = "\xF0\x9F\x8C\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char shamrock[] = "\xE2\x98\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char four_leaf_clover[] = "\xF0\x9F\x8D\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char maple_leaf[] = "\xF0\x9F\x8D\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char fallen_leaf[] = "\xF0\x9F\x8D\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char leaves[] = "\xF0\x9F\x8D\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char mushroom[] = "\xF0\x9F\x8D\x84 ";
+
+} /* namespace Emoji */
+} /* namespace Canary */
@@ -0,0 +1,75 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include <cstddef>
+
+// Inline variables have one definition across all translation units,
+// before C++17 constexpr variables have a copy in every unit that uses them
+#if defined(__cpp_inline_variables)
+#define CANARY_INLINE_VARIABLE inline
+#else
+#define CANARY_INLINE_VARIABLE
+#endif
+
+namespace Canary {
+namespace detail {
+
+    /**
+        Whether Compose may add a skin tone or a gender sign to an
+        emoji constant. The header of a group sets them for its emojis
+        that have such sequences in emoji-test.txt.
+     */
+    template<bool Tone, bool Gender>
+    struct ModifierFlags {
+        static constexpr bool tone = Tone;
+        static constexpr bool gender = Gender;
+    };
+
+    template<const char* E>
+    struct EmojiModifiers : ModifierFlags<false, false> {};
+
+} /* namespace detail */
+
+namespace Emoji {
+
+    /**
+        The emojis are constexpr character arrays: their length is part
+        of their type and they still convert to const char* and
+        std::string like string literals. Length() gives the length
+        without strlen, as does View() of view.hpp.
+
+        Every constant ends in a space, to print it before a message.
+        The emoji table of emoji_table.hpp has them without. The
+        constants are in one header per group in canary/emoji, which
+        all include this one.
+
+        Example:
+
+            std::string line;
+            line.append(Canary::Emoji::rocket, Canary::Emoji::Length(Canary::Emoji::rocket));
+     */
+    template<std::size_t N>
+    constexpr std::size_t Length(const char (&)[N]) {
+        return N - 1;
+    }
+
+} /* namespace Emoji */
+} /* namespace Canary */
@@ -0,0 +1,284 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // Flags
+
+    CANARY_INLINE_VARIABLE constexpr char checkered_flag[] = "\xF0\x9F\x8F\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char triangular_flag_on_post[] = "\xF0\x9F\x9A\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char crossed_flags[] = "\xF0\x9F\x8E\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char black_flag[] = "\xF0\x9F\x8F\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char white_flag[] = "\xF0\x9F\x8F\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char rainbow_flag[] = "\xF0\x9F\x8F\xB3\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x8C\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char andorra[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char united_arab_emirates[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char afghanistan[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char antigua_barbuda[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char anguilla[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char albania[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char armenia[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char angola[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char antarctica[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char argentina[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char american_samoa[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char austria[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char australia[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char aruba[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char aland_islands[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char azerbaijan[] = "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char bosnia_herzegovina[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char barbados[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char bangladesh[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char belgium[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char burkina_faso[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char bulgaria[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char bahrain[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char burundi[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char benin[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char st_barthelemy[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char bermuda[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char brunei[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char bolivia[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char caribbean_netherlands[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char brazil[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char bahamas[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char bhutan[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char botswana[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char belarus[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char belize[] = "\xF0\x9F\x87\xA7\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char canada[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char cocos_islands[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char congo_kinshasa[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char central_african_republic[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char congo_brazzaville[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char switzerland[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char cote_divoire[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char cook_islands[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char chile[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char cameroon[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char cn[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char colombia[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char costa_rica[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char cuba[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char cape_verde[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char curacao[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char christmas_island[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char cyprus[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char czech_republic[] = "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char de[] = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char djibouti[] = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char denmark[] = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char dominica[] = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char dominican_republic[] = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char algeria[] = "\xF0\x9F\x87\xA9\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char ecuador[] = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char estonia[] = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char egypt[] = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char western_sahara[] = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char eritrea[] = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char es[] = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char ethiopia[] = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char eu[] = "\xF0\x9F\x87\xAA\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char finland[] = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char fiji[] = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char falkland_islands[] = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char micronesia[] = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char faroe_islands[] = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char fr[] = "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char gabon[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char uk[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char grenada[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char georgia[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char french_guiana[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char guernsey[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char ghana[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char gibraltar[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char greenland[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char gambia[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char guinea[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char guadeloupe[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char equatorial_guinea[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char greece[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char south_georgia_south_sandwich_islands[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char guatemala[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char guam[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char guinea_bissau[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char guyana[] = "\xF0\x9F\x87\xAC\xF0\x9F\x87\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char hong_kong[] = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char honduras[] = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char croatia[] = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char haiti[] = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char hungary[] = "\xF0\x9F\x87\xAD\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char canary_islands[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char indonesia[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char ireland[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char israel[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char isle_of_man[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char india[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char british_indian_ocean_territory[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char iraq[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char iran[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char iceland[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char it[] = "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char jersey[] = "\xF0\x9F\x87\xAF\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char jamaica[] = "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char jordan[] = "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char jp[] = "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char kenya[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char kyrgyzstan[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char cambodia[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char kiribati[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char comoros[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char st_kitts_nevis[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char north_korea[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char kr[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char kuwait[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char cayman_islands[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char kazakhstan[] = "\xF0\x9F\x87\xB0\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char laos[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char lebanon[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char st_lucia[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char liechtenstein[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char sri_lanka[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char liberia[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char lesotho[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char lithuania[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char luxembourg[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char latvia[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char libya[] = "\xF0\x9F\x87\xB1\xF0\x9F\x87\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char morocco[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char monaco[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char moldova[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char montenegro[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char madagascar[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char marshall_islands[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char macedonia[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char mali[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char myanmar[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char mongolia[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char macau[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char northern_mariana_islands[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char martinique[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char mauritania[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char montserrat[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char malta[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char mauritius[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char maldives[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char malawi[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char mexico[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char malaysia[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char mozambique[] = "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char namibia[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char new_caledonia[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char niger[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char norfolk_island[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char nigeria[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char nicaragua[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char netherlands[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char norway[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char nepal[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char nauru[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char niue[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char new_zealand[] = "\xF0\x9F\x87\xB3\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char oman[] = "\xF0\x9F\x87\xB4\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char panama[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char peru[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char french_polynesia[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char papua_new_guinea[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char philippines[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char pakistan[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char poland[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char st_pierre_miquelon[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char pitcairn_islands[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char puerto_rico[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char palestinian_territories[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char portugal[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char palau[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char paraguay[] = "\xF0\x9F\x87\xB5\xF0\x9F\x87\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char qatar[] = "\xF0\x9F\x87\xB6\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char reunion[] = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char romania[] = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char serbia[] = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char ru[] = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char rwanda[] = "\xF0\x9F\x87\xB7\xF0\x9F\x87\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char saudi_arabia[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char solomon_islands[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char seychelles[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char sudan[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char sweden[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char singapore[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char st_helena[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char slovenia[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char slovakia[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char sierra_leone[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char san_marino[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char senegal[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char somalia[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char suriname[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char south_sudan[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char sao_tome_principe[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char el_salvador[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char sint_maarten[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char syria[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char swaziland[] = "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char turks_caicos_islands[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char chad[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char french_southern_territories[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char togo[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char thailand[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char tajikistan[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char tokelau[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char timor_leste[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char turkmenistan[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char tunisia[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char tonga[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char tr[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char trinidad_tobago[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char tuvalu[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char taiwan[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char tanzania[] = "\xF0\x9F\x87\xB9\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char ukraine[] = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char uganda[] = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char us[] = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char uruguay[] = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char uzbekistan[] = "\xF0\x9F\x87\xBA\xF0\x9F\x87\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char vatican_city[] = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char st_vincent_grenadines[] = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char venezuela[] = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char british_virgin_islands[] = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char us_virgin_islands[] = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char vietnam[] = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char vanuatu[] = "\xF0\x9F\x87\xBB\xF0\x9F\x87\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char wallis_futuna[] = "\xF0\x9F\x87\xBC\xF0\x9F\x87\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char samoa[] = "\xF0\x9F\x87\xBC\xF0\x9F\x87\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char kosovo[] = "\xF0\x9F\x87\xBD\xF0\x9F\x87\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char yemen[] = "\xF0\x9F\x87\xBE\xF0\x9F\x87\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char mayotte[] = "\xF0\x9F\x87\xBE\xF0\x9F\x87\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char south_africa[] = "\xF0\x9F\x87\xBF\xF0\x9F\x87\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char zambia[] = "\xF0\x9F\x87\xBF\xF0\x9F\x87\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char zimbabwe[] = "\xF0\x9F\x87\xBF\xF0\x9F\x87\xBC ";
+
+} /* namespace Emoji */
+} /* namespace Canary */
@@ -0,0 +1,122 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // Food & Drink
+
+    CANARY_INLINE_VARIABLE constexpr char grapes[] = "\xF0\x9F\x8D\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char melon[] = "\xF0\x9F\x8D\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char watermelon[] = "\xF0\x9F\x8D\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char tangerine[] = "\xF0\x9F\x8D\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char lemon[] = "\xF0\x9F\x8D\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char banana[] = "\xF0\x9F\x8D\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char pineapple[] = "\xF0\x9F\x8D\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char apple[] = "\xF0\x9F\x8D\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char green_apple[] = "\xF0\x9F\x8D\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char pear[] = "\xF0\x9F\x8D\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char peach[] = "\xF0\x9F\x8D\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char cherries[] = "\xF0\x9F\x8D\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char strawberry[] = "\xF0\x9F\x8D\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char kiwi_fruit[] = "\xF0\x9F\xA5\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char tomato[] = "\xF0\x9F\x8D\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char avocado[] = "\xF0\x9F\xA5\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char eggplant[] = "\xF0\x9F\x8D\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char potato[] = "\xF0\x9F\xA5\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char carrot[] = "\xF0\x9F\xA5\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char corn[] = "\xF0\x9F\x8C\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char hot_pepper[] = "\xF0\x9F\x8C\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char cucumber[] = "\xF0\x9F\xA5\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char peanuts[] = "\xF0\x9F\xA5\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char chestnut[] = "\xF0\x9F\x8C\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char bread[] = "\xF0\x9F\x8D\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char croissant[] = "\xF0\x9F\xA5\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char baguette_bread[] = "\xF0\x9F\xA5\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char pancakes[] = "\xF0\x9F\xA5\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char cheese[] = "\xF0\x9F\xA7\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char meat_on_bone[] = "\xF0\x9F\x8D\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char poultry_leg[] = "\xF0\x9F\x8D\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char bacon[] = "\xF0\x9F\xA5\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char hamburger[] = "\xF0\x9F\x8D\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char fries[] = "\xF0\x9F\x8D\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char pizza[] = "\xF0\x9F\x8D\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char hotdog[] = "\xF0\x9F\x8C\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char taco[] = "\xF0\x9F\x8C\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char burrito[] = "\xF0\x9F\x8C\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char stuffed_flatbread[] = "\xF0\x9F\xA5\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char egg[] = "\xF0\x9F\xA5\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char fried_egg[] = "\xF0\x9F\x8D\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char shallow_pan_of_food[] = "\xF0\x9F\xA5\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char stew[] = "\xF0\x9F\x8D\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char green_salad[] = "\xF0\x9F\xA5\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char popcorn[] = "\xF0\x9F\x8D\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char bento[] = "\xF0\x9F\x8D\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char rice_cracker[] = "\xF0\x9F\x8D\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char rice_ball[] = "\xF0\x9F\x8D\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char rice[] = "\xF0\x9F\x8D\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char curry[] = "\xF0\x9F\x8D\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char ramen[] = "\xF0\x9F\x8D\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char spaghetti[] = "\xF0\x9F\x8D\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char sweet_potato[] = "\xF0\x9F\x8D\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char oden[] = "\xF0\x9F\x8D\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char sushi[] = "\xF0\x9F\x8D\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char fried_shrimp[] = "\xF0\x9F\x8D\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char fish_cake[] = "\xF0\x9F\x8D\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char dango[] = "\xF0\x9F\x8D\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char crab[] = "\xF0\x9F\xA6\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char shrimp[] = "\xF0\x9F\xA6\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char squid[] = "\xF0\x9F\xA6\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char icecream[] = "\xF0\x9F\x8D\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char shaved_ice[] = "\xF0\x9F\x8D\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char ice_cream[] = "\xF0\x9F\x8D\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char doughnut[] = "\xF0\x9F\x8D\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char cookie[] = "\xF0\x9F\x8D\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char birthday[] = "\xF0\x9F\x8E\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char cake[] = "\xF0\x9F\x8D\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char chocolate_bar[] = "\xF0\x9F\x8D\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char candy[] = "\xF0\x9F\x8D\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char lollipop[] = "\xF0\x9F\x8D\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char custard[] = "\xF0\x9F\x8D\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char honey_pot[] = "\xF0\x9F\x8D\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char baby_bottle[] = "\xF0\x9F\x8D\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char milk_glass[] = "\xF0\x9F\xA5\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char coffee[] = "\xE2\x98\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char tea[] = "\xF0\x9F\x8D\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char sake[] = "\xF0\x9F\x8D\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char champagne[] = "\xF0\x9F\x8D\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char wine_glass[] = "\xF0\x9F\x8D\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char cocktail[] = "\xF0\x9F\x8D\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char tropical_drink[] = "\xF0\x9F\x8D\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char beer[] = "\xF0\x9F\x8D\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char beers[] = "\xF0\x9F\x8D\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char clinking_glasses[] = "\xF0\x9F\xA5\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char tumbler_glass[] = "\xF0\x9F\xA5\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char plate_with_cutlery[] = "\xF0\x9F\x8D\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char fork_and_knife[] = "\xF0\x9F\x8D\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char spoon[] = "\xF0\x9F\xA5\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char hocho[] = "\xF0\x9F\x94\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char amphora[] = "\xF0\x9F\x8F\xBA ";
+
+} /* namespace Emoji */
+} /* namespace Canary */
@@ -0,0 +1,223 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // Objects
+
+    CANARY_INLINE_VARIABLE constexpr char eyeglasses[] = "\xF0\x9F\x91\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char dark_sunglasses[] = "\xF0\x9F\x95\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char necktie[] = "\xF0\x9F\x91\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char tshirt[] = "\xF0\x9F\x91\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char jeans[] = "\xF0\x9F\x91\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char dress[] = "\xF0\x9F\x91\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char kimono[] = "\xF0\x9F\x91\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char bikini[] = "\xF0\x9F\x91\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char womans_clothes[] = "\xF0\x9F\x91\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char purse[] = "\xF0\x9F\x91\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char handbag[] = "\xF0\x9F\x91\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char pouch[] = "\xF0\x9F\x91\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char shopping[] = "\xF0\x9F\x9B\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char school_satchel[] = "\xF0\x9F\x8E\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char mans_shoe[] = "\xF0\x9F\x91\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char athletic_shoe[] = "\xF0\x9F\x91\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char high_heel[] = "\xF0\x9F\x91\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char sandal[] = "\xF0\x9F\x91\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char boot[] = "\xF0\x9F\x91\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char crown[] = "\xF0\x9F\x91\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char womans_hat[] = "\xF0\x9F\x91\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char tophat[] = "\xF0\x9F\x8E\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char mortar_board[] = "\xF0\x9F\x8E\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char rescue_worker_helmet[] = "\xE2\x9B\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char prayer_beads[] = "\xF0\x9F\x93\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char lipstick[] = "\xF0\x9F\x92\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char ring[] = "\xF0\x9F\x92\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char gem[] = "\xF0\x9F\x92\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char mute[] = "\xF0\x9F\x94\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char speaker[] = "\xF0\x9F\x94\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char sound[] = "\xF0\x9F\x94\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char loud_sound[] = "\xF0\x9F\x94\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char loudspeaker[] = "\xF0\x9F\x93\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char mega[] = "\xF0\x9F\x93\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char postal_horn[] = "\xF0\x9F\x93\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char bell[] = "\xF0\x9F\x94\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char no_bell[] = "\xF0\x9F\x94\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char musical_score[] = "\xF0\x9F\x8E\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char musical_note[] = "\xF0\x9F\x8E\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char notes[] = "\xF0\x9F\x8E\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char studio_microphone[] = "\xF0\x9F\x8E\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char level_slider[] = "\xF0\x9F\x8E\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char control_knobs[] = "\xF0\x9F\x8E\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char microphone[] = "\xF0\x9F\x8E\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char headphones[] = "\xF0\x9F\x8E\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char radio[] = "\xF0\x9F\x93\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char saxophone[] = "\xF0\x9F\x8E\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char guitar[] = "\xF0\x9F\x8E\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char musical_keyboard[] = "\xF0\x9F\x8E\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char trumpet[] = "\xF0\x9F\x8E\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char violin[] = "\xF0\x9F\x8E\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char drum[] = "\xF0\x9F\xA5\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char iphone[] = "\xF0\x9F\x93\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char calling[] = "\xF0\x9F\x93\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char phone[] = "\xE2\x98\x8E\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char telephone_receiver[] = "\xF0\x9F\x93\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char pager[] = "\xF0\x9F\x93\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char fax[] = "\xF0\x9F\x93\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char battery[] = "\xF0\x9F\x94\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char electric_plug[] = "\xF0\x9F\x94\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char computer[] = "\xF0\x9F\x92\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char desktop_computer[] = "\xF0\x9F\x96\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char printer[] = "\xF0\x9F\x96\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char keyboard[] = "\xE2\x8C\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char computer_mouse[] = "\xF0\x9F\x96\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char trackball[] = "\xF0\x9F\x96\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char minidisc[] = "\xF0\x9F\x92\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char floppy_disk[] = "\xF0\x9F\x92\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char cd[] = "\xF0\x9F\x92\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char dvd[] = "\xF0\x9F\x93\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char movie_camera[] = "\xF0\x9F\x8E\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char film_strip[] = "\xF0\x9F\x8E\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char film_projector[] = "\xF0\x9F\x93\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char clapper[] = "\xF0\x9F\x8E\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char tv[] = "\xF0\x9F\x93\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char camera[] = "\xF0\x9F\x93\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char camera_flash[] = "\xF0\x9F\x93\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char video_camera[] = "\xF0\x9F\x93\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char vhs[] = "\xF0\x9F\x93\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char mag[] = "\xF0\x9F\x94\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char mag_right[] = "\xF0\x9F\x94\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char candle[] = "\xF0\x9F\x95\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char bulb[] = "\xF0\x9F\x92\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char flashlight[] = "\xF0\x9F\x94\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char izakaya_lantern[] = "\xF0\x9F\x8F\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char notebook_with_decorative_cover[] = "\xF0\x9F\x93\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char closed_book[] = "\xF0\x9F\x93\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char open_book[] = "\xF0\x9F\x93\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char green_book[] = "\xF0\x9F\x93\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char blue_book[] = "\xF0\x9F\x93\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char orange_book[] = "\xF0\x9F\x93\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char books[] = "\xF0\x9F\x93\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char notebook[] = "\xF0\x9F\x93\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char ledger[] = "\xF0\x9F\x93\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char page_with_curl[] = "\xF0\x9F\x93\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char scroll[] = "\xF0\x9F\x93\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char page_facing_up[] = "\xF0\x9F\x93\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char newspaper[] = "\xF0\x9F\x93\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char newspaper_roll[] = "\xF0\x9F\x97\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char bookmark_tabs[] = "\xF0\x9F\x93\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char bookmark[] = "\xF0\x9F\x94\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char label[] = "\xF0\x9F\x8F\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char moneybag[] = "\xF0\x9F\x92\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char yen[] = "\xF0\x9F\x92\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char dollar[] = "\xF0\x9F\x92\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char euro[] = "\xF0\x9F\x92\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char pound[] = "\xF0\x9F\x92\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char money_with_wings[] = "\xF0\x9F\x92\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char credit_card[] = "\xF0\x9F\x92\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char chart[] = "\xF0\x9F\x92\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char email[] = "\xE2\x9C\x89\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char e_mail[] = "\xF0\x9F\x93\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char incoming_envelope[] = "\xF0\x9F\x93\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char envelope_with_arrow[] = "\xF0\x9F\x93\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char outbox_tray[] = "\xF0\x9F\x93\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char inbox_tray[] = "\xF0\x9F\x93\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char package[] = "\xF0\x9F\x93\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char mailbox[] = "\xF0\x9F\x93\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char mailbox_closed[] = "\xF0\x9F\x93\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char mailbox_with_mail[] = "\xF0\x9F\x93\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char mailbox_with_no_mail[] = "\xF0\x9F\x93\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char postbox[] = "\xF0\x9F\x93\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char ballot_box[] = "\xF0\x9F\x97\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char pencil2[] = "\xE2\x9C\x8F\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char black_nib[] = "\xE2\x9C\x92\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char fountain_pen[] = "\xF0\x9F\x96\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char pen[] = "\xF0\x9F\x96\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char paintbrush[] = "\xF0\x9F\x96\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char crayon[] = "\xF0\x9F\x96\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char memo[] = "\xF0\x9F\x93\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char briefcase[] = "\xF0\x9F\x92\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char file_folder[] = "\xF0\x9F\x93\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char open_file_folder[] = "\xF0\x9F\x93\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char card_index_dividers[] = "\xF0\x9F\x97\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char date[] = "\xF0\x9F\x93\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char calendar[] = "\xF0\x9F\x93\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char spiral_notepad[] = "\xF0\x9F\x97\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char spiral_calendar[] = "\xF0\x9F\x97\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char card_index[] = "\xF0\x9F\x93\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char chart_with_upwards_trend[] = "\xF0\x9F\x93\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char chart_with_downwards_trend[] = "\xF0\x9F\x93\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char bar_chart[] = "\xF0\x9F\x93\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char clipboard[] = "\xF0\x9F\x93\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char pushpin[] = "\xF0\x9F\x93\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char round_pushpin[] = "\xF0\x9F\x93\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char paperclip[] = "\xF0\x9F\x93\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char paperclips[] = "\xF0\x9F\x96\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char straight_ruler[] = "\xF0\x9F\x93\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char triangular_ruler[] = "\xF0\x9F\x93\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char scissors[] = "\xE2\x9C\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char card_file_box[] = "\xF0\x9F\x97\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char file_cabinet[] = "\xF0\x9F\x97\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char wastebasket[] = "\xF0\x9F\x97\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char lock[] = "\xF0\x9F\x94\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char unlock[] = "\xF0\x9F\x94\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char lock_with_ink_pen[] = "\xF0\x9F\x94\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char closed_lock_with_key[] = "\xF0\x9F\x94\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char key[] = "\xF0\x9F\x94\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char old_key[] = "\xF0\x9F\x97\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char hammer[] = "\xF0\x9F\x94\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char pick[] = "\xE2\x9B\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char hammer_and_pick[] = "\xE2\x9A\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char hammer_and_wrench[] = "\xF0\x9F\x9B\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char dagger[] = "\xF0\x9F\x97\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char crossed_swords[] = "\xE2\x9A\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char bomb[] = "\xF0\x9F\x92\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char bow_and_arrow[] = "\xF0\x9F\x8F\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char shield[] = "\xF0\x9F\x9B\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char wrench[] = "\xF0\x9F\x94\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char nut_and_bolt[] = "\xF0\x9F\x94\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char gear[] = "\xE2\x9A\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char clamp[] = "\xF0\x9F\x97\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char balance_scale[] = "\xE2\x9A\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char link[] = "\xF0\x9F\x94\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char chains[] = "\xE2\x9B\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char alembic[] = "\xE2\x9A\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char microscope[] = "\xF0\x9F\x94\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char telescope[] = "\xF0\x9F\x94\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char satellite[] = "\xF0\x9F\x93\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char syringe[] = "\xF0\x9F\x92\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char pill[] = "\xF0\x9F\x92\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char door[] = "\xF0\x9F\x9A\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char bed[] = "\xF0\x9F\x9B\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char couch_and_lamp[] = "\xF0\x9F\x9B\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char toilet[] = "\xF0\x9F\x9A\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char shower[] = "\xF0\x9F\x9A\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char bathtub[] = "\xF0\x9F\x9B\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char shopping_cart[] = "\xF0\x9F\x9B\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char smoking[] = "\xF0\x9F\x9A\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char coffin[] = "\xE2\x9A\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char funeral_urn[] = "\xE2\x9A\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char moyai[] = "\xF0\x9F\x97\xBF ";
+
+} /* namespace Emoji */
+} /* namespace Canary */
@@ -0,0 +1,392 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // People & Body
+
+    CANARY_INLINE_VARIABLE constexpr char wave[] = "\xF0\x9F\x91\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char raised_back_of_hand[] = "\xF0\x9F\xA4\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char raised_hand_with_fingers_splayed[] = "\xF0\x9F\x96\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char raised_hand[] = "\xE2\x9C\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char vulcan_salute[] = "\xF0\x9F\x96\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char ok_hand[] = "\xF0\x9F\x91\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char v[] = "\xE2\x9C\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char crossed_fingers[] = "\xF0\x9F\xA4\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char metal[] = "\xF0\x9F\xA4\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char call_me_hand[] = "\xF0\x9F\xA4\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char point_left[] = "\xF0\x9F\x91\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char point_right[] = "\xF0\x9F\x91\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char point_up_2[] = "\xF0\x9F\x91\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char fu[] = "\xF0\x9F\x96\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char point_down[] = "\xF0\x9F\x91\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char point_up[] = "\xE2\x98\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char plus_one[] = "\xF0\x9F\x91\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char minus_one[] = "\xF0\x9F\x91\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char fist[] = "\xE2\x9C\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char facepunch[] = "\xF0\x9F\x91\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char fist_left[] = "\xF0\x9F\xA4\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char fist_right[] = "\xF0\x9F\xA4\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char clap[] = "\xF0\x9F\x91\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char raised_hands[] = "\xF0\x9F\x99\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char open_hands[] = "\xF0\x9F\x91\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char handshake[] = "\xF0\x9F\xA4\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char pray[] = "\xF0\x9F\x99\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char writing_hand[] = "\xE2\x9C\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char nail_care[] = "\xF0\x9F\x92\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char selfie[] = "\xF0\x9F\xA4\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char muscle[] = "\xF0\x9F\x92\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char ear[] = "\xF0\x9F\x91\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char nose[] = "\xF0\x9F\x91\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char eyes[] = "\xF0\x9F\x91\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char eye[] = "\xF0\x9F\x91\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char tongue[] = "\xF0\x9F\x91\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char lips[] = "\xF0\x9F\x91\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char baby[] = "\xF0\x9F\x91\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char boy[] = "\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char girl[] = "\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char blonde_man[] = "\xF0\x9F\x91\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char man[] = "\xF0\x9F\x91\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char woman[] = "\xF0\x9F\x91\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char blonde_woman[] = "\xF0\x9F\x91\xB1\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char older_man[] = "\xF0\x9F\x91\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char older_woman[] = "\xF0\x9F\x91\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char frowning_woman[] = "\xF0\x9F\x99\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char frowning_man[] = "\xF0\x9F\x99\x8D\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char pouting_woman[] = "\xF0\x9F\x99\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char pouting_man[] = "\xF0\x9F\x99\x8E\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char no_good_woman[] = "\xF0\x9F\x99\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char no_good_man[] = "\xF0\x9F\x99\x85\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char ok_woman[] = "\xF0\x9F\x99\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char ok_man[] = "\xF0\x9F\x99\x86\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char tipping_hand_woman[] = "\xF0\x9F\x92\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char tipping_hand_man[] = "\xF0\x9F\x92\x81\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char raising_hand_woman[] = "\xF0\x9F\x99\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char raising_hand_man[] = "\xF0\x9F\x99\x8B\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char bowing_man[] = "\xF0\x9F\x99\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char bowing_woman[] = "\xF0\x9F\x99\x87\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_facepalming[] = "\xF0\x9F\xA4\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char woman_facepalming[] = "\xF0\x9F\xA4\xA6\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char woman_shrugging[] = "\xF0\x9F\xA4\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char man_shrugging[] = "\xF0\x9F\xA4\xB7\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_health_worker[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9A\x95\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char woman_health_worker[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9A\x95\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_student[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8E\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char woman_student[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char man_teacher[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8F\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char woman_teacher[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8F\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char man_judge[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9A\x96\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char woman_judge[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9A\x96\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_farmer[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8C\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char woman_farmer[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8C\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char man_cook[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8D\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char woman_cook[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8D\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char man_mechanic[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x94\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char woman_mechanic[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x94\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char man_factory_worker[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8F\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char woman_factory_worker[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8F\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char man_office_worker[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x92\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char woman_office_worker[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char man_scientist[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x94\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char woman_scientist[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x94\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char man_technologist[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x92\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char woman_technologist[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char man_singer[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8E\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char woman_singer[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char man_artist[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8E\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char woman_artist[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char man_pilot[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9C\x88\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char woman_pilot[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9C\x88\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_astronaut[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x9A\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char woman_astronaut[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x9A\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char man_firefighter[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x9A\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char woman_firefighter[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x9A\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char policeman[] = "\xF0\x9F\x91\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char policewoman[] = "\xF0\x9F\x91\xAE\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char male_detective[] = "\xF0\x9F\x95\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char female_detective[] = "\xF0\x9F\x95\xB5\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char guardsman[] = "\xF0\x9F\x92\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char guardswoman[] = "\xF0\x9F\x92\x82\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char construction_worker_man[] = "\xF0\x9F\x91\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char construction_worker_woman[] = "\xF0\x9F\x91\xB7\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char prince[] = "\xF0\x9F\xA4\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char princess[] = "\xF0\x9F\x91\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char man_with_turban[] = "\xF0\x9F\x91\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char woman_with_turban[] = "\xF0\x9F\x91\xB3\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_with_gua_pi_mao[] = "\xF0\x9F\x91\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char man_in_tuxedo[] = "\xF0\x9F\xA4\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char bride_with_veil[] = "\xF0\x9F\x91\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char pregnant_woman[] = "\xF0\x9F\xA4\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char angel[] = "\xF0\x9F\x91\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char santa[] = "\xF0\x9F\x8E\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char mrs_claus[] = "\xF0\x9F\xA4\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char massage_woman[] = "\xF0\x9F\x92\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char massage_man[] = "\xF0\x9F\x92\x86\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char haircut_woman[] = "\xF0\x9F\x92\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char haircut_man[] = "\xF0\x9F\x92\x87\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char walking_man[] = "\xF0\x9F\x9A\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char walking_woman[] = "\xF0\x9F\x9A\xB6\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char running_man[] = "\xF0\x9F\x8F\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char running_woman[] = "\xF0\x9F\x8F\x83\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char dancer[] = "\xF0\x9F\x92\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char man_dancing[] = "\xF0\x9F\x95\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char business_suit_levitating[] = "\xF0\x9F\x95\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char dancing_women[] = "\xF0\x9F\x91\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char dancing_men[] = "\xF0\x9F\x91\xAF\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char person_fencing[] = "\xF0\x9F\xA4\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char horse_racing[] = "\xF0\x9F\x8F\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char skier[] = "\xE2\x9B\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char snowboarder[] = "\xF0\x9F\x8F\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char golfing_man[] = "\xF0\x9F\x8F\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char golfing_woman[] = "\xF0\x9F\x8F\x8C\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char surfing_man[] = "\xF0\x9F\x8F\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char surfing_woman[] = "\xF0\x9F\x8F\x84\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char rowing_man[] = "\xF0\x9F\x9A\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char rowing_woman[] = "\xF0\x9F\x9A\xA3\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char swimming_man[] = "\xF0\x9F\x8F\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char swimming_woman[] = "\xF0\x9F\x8F\x8A\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char basketball_man[] = "\xE2\x9B\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char basketball_woman[] = "\xE2\x9B\xB9\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char weight_lifting_man[] = "\xF0\x9F\x8F\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char weight_lifting_woman[] = "\xF0\x9F\x8F\x8B\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char biking_man[] = "\xF0\x9F\x9A\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char biking_woman[] = "\xF0\x9F\x9A\xB4\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char mountain_biking_man[] = "\xF0\x9F\x9A\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char mountain_biking_woman[] = "\xF0\x9F\x9A\xB5\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_cartwheeling[] = "\xF0\x9F\xA4\xB8\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char woman_cartwheeling[] = "\xF0\x9F\xA4\xB8\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char men_wrestling[] = "\xF0\x9F\xA4\xBC\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char women_wrestling[] = "\xF0\x9F\xA4\xBC\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_playing_water_polo[] = "\xF0\x9F\xA4\xBD\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char woman_playing_water_polo[] = "\xF0\x9F\xA4\xBD\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_playing_handball[] = "\xF0\x9F\xA4\xBE\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char woman_playing_handball[] = "\xF0\x9F\xA4\xBE\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char man_juggling[] = "\xF0\x9F\xA4\xB9\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char woman_juggling[] = "\xF0\x9F\xA4\xB9\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char bath[] = "\xF0\x9F\x9B\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char sleeping_bed[] = "\xF0\x9F\x9B\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char two_women_holding_hands[] = "\xF0\x9F\x91\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char couple[] = "\xF0\x9F\x91\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char two_men_holding_hands[] = "\xF0\x9F\x91\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char couplekiss_man_woman[] = "\xF0\x9F\x92\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char couplekiss_man_man[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x92\x8B\xE2\x80\x8D\xF0\x9F\x91\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char couplekiss_woman_woman[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x92\x8B\xE2\x80\x8D\xF0\x9F\x91\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char couple_with_heart_woman_man[] = "\xF0\x9F\x92\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char couple_with_heart_man_man[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x91\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char couple_with_heart_woman_woman[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x91\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_woman_girl[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_woman_girl_boy[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_woman_boy_boy[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_woman_girl_girl[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_man_boy[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_man_girl[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_man_girl_boy[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_man_boy_boy[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_man_girl_girl[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_woman_boy[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_woman_girl[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_woman_girl_boy[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_woman_boy_boy[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_woman_girl_girl[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_boy[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_boy_boy[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_girl[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_girl_boy[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_girl_girl[] = "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_boy[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_boy_boy[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_girl[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_girl_boy[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char family_woman_girl_girl[] = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char speaking_head[] = "\xF0\x9F\x97\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char bust_in_silhouette[] = "\xF0\x9F\x91\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char busts_in_silhouette[] = "\xF0\x9F\x91\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char family_man_woman_boy[] = "\xF0\x9F\x91\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char footprints[] = "\xF0\x9F\x91\xA3 ";
+
+} /* namespace Emoji */
+
+namespace detail {
+
+    // The emojis of the group that Compose gives a skin tone or a gender
+
+    template<> struct EmojiModifiers<Emoji::wave> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::raised_back_of_hand> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::raised_hand_with_fingers_splayed> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::raised_hand> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::vulcan_salute> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::ok_hand> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::v> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::crossed_fingers> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::metal> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::call_me_hand> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::point_left> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::point_right> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::point_up_2> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::fu> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::point_down> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::point_up> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::plus_one> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::minus_one> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::fist> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::facepunch> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::fist_left> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::fist_right> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::clap> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::raised_hands> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::open_hands> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::handshake> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::pray> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::writing_hand> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::nail_care> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::selfie> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::muscle> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::ear> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::nose> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::baby> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::boy> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::girl> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::blonde_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::blonde_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::older_man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::older_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::frowning_woman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::frowning_man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::pouting_woman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::pouting_man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::no_good_woman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::no_good_man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::ok_woman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::ok_man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::tipping_hand_woman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::tipping_hand_man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::raising_hand_woman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::raising_hand_man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::bowing_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::bowing_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_facepalming> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::woman_facepalming> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_shrugging> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::man_shrugging> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_health_worker> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_health_worker> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_student> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_student> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_teacher> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_teacher> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_judge> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_judge> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_farmer> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_farmer> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_cook> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_cook> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_mechanic> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_mechanic> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_factory_worker> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_factory_worker> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_office_worker> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_office_worker> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_scientist> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_scientist> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_technologist> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_technologist> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_singer> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_singer> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_artist> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_artist> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_pilot> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_pilot> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_astronaut> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_astronaut> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_firefighter> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_firefighter> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::policeman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::policewoman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::male_detective> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::female_detective> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::guardsman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::guardswoman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::construction_worker_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::construction_worker_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::prince> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::princess> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_with_turban> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::woman_with_turban> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_with_gua_pi_mao> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_in_tuxedo> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::bride_with_veil> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::pregnant_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::angel> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::santa> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::mrs_claus> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::massage_woman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::massage_man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::haircut_woman> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::haircut_man> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::walking_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::walking_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::running_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::running_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::dancer> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_dancing> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::business_suit_levitating> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::dancing_women> : ModifierFlags<false, true> {};
+    template<> struct EmojiModifiers<Emoji::horse_racing> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::snowboarder> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::golfing_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::golfing_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::surfing_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::surfing_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::rowing_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::rowing_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::swimming_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::swimming_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::basketball_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::basketball_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::weight_lifting_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::weight_lifting_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::biking_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::biking_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::mountain_biking_man> : ModifierFlags<true, true> {};
+    template<> struct EmojiModifiers<Emoji::mountain_biking_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_cartwheeling> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_cartwheeling> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_playing_water_polo> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_playing_water_polo> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_playing_handball> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_playing_handball> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::man_juggling> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::woman_juggling> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::bath> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::sleeping_bed> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::two_women_holding_hands> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::couple> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::two_men_holding_hands> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::couplekiss_man_woman> : ModifierFlags<true, false> {};
+    template<> struct EmojiModifiers<Emoji::couple_with_heart_woman_man> : ModifierFlags<true, false> {};
+
+} /* namespace detail */
+} /* namespace Canary */
@@ -0,0 +1,159 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // Smileys & Emotion
+
+    CANARY_INLINE_VARIABLE constexpr char grinning[] = "\xF0\x9F\x98\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char smiley[] = "\xF0\x9F\x98\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char smile[] = "\xF0\x9F\x98\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char grin[] = "\xF0\x9F\x98\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char laughing[] = "\xF0\x9F\x98\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char sweat_smile[] = "\xF0\x9F\x98\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char rofl[] = "\xF0\x9F\xA4\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char joy[] = "\xF0\x9F\x98\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char slightly_smiling_face[] = "\xF0\x9F\x99\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char upside_down_face[] = "\xF0\x9F\x99\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char wink[] = "\xF0\x9F\x98\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char blush[] = "\xF0\x9F\x98\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char innocent[] = "\xF0\x9F\x98\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char heart_eyes[] = "\xF0\x9F\x98\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char kissing_heart[] = "\xF0\x9F\x98\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char kissing[] = "\xF0\x9F\x98\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char relaxed[] = "\xE2\x98\xBA\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char kissing_closed_eyes[] = "\xF0\x9F\x98\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char kissing_smiling_eyes[] = "\xF0\x9F\x98\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char yum[] = "\xF0\x9F\x98\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char stuck_out_tongue[] = "\xF0\x9F\x98\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char stuck_out_tongue_winking_eye[] = "\xF0\x9F\x98\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char stuck_out_tongue_closed_eyes[] = "\xF0\x9F\x98\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char money_mouth_face[] = "\xF0\x9F\xA4\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char hugs[] = "\xF0\x9F\xA4\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char thinking[] = "\xF0\x9F\xA4\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char zipper_mouth_face[] = "\xF0\x9F\xA4\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char neutral_face[] = "\xF0\x9F\x98\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char expressionless[] = "\xF0\x9F\x98\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char no_mouth[] = "\xF0\x9F\x98\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char smirk[] = "\xF0\x9F\x98\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char unamused[] = "\xF0\x9F\x98\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char roll_eyes[] = "\xF0\x9F\x99\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char grimacing[] = "\xF0\x9F\x98\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char lying_face[] = "\xF0\x9F\xA4\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char relieved[] = "\xF0\x9F\x98\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char pensive[] = "\xF0\x9F\x98\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char sleepy[] = "\xF0\x9F\x98\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char drooling_face[] = "\xF0\x9F\xA4\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char sleeping[] = "\xF0\x9F\x98\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char mask[] = "\xF0\x9F\x98\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char face_with_thermometer[] = "\xF0\x9F\xA4\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char face_with_head_bandage[] = "\xF0\x9F\xA4\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char nauseated_face[] = "\xF0\x9F\xA4\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char sneezing_face[] = "\xF0\x9F\xA4\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char dizzy_face[] = "\xF0\x9F\x98\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char cowboy_hat_face[] = "\xF0\x9F\xA4\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char sunglasses[] = "\xF0\x9F\x98\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char nerd_face[] = "\xF0\x9F\xA4\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char confused[] = "\xF0\x9F\x98\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char worried[] = "\xF0\x9F\x98\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char slightly_frowning_face[] = "\xF0\x9F\x99\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char frowning_face[] = "\xE2\x98\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char open_mouth[] = "\xF0\x9F\x98\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char hushed[] = "\xF0\x9F\x98\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char astonished[] = "\xF0\x9F\x98\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char flushed[] = "\xF0\x9F\x98\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char frowning[] = "\xF0\x9F\x98\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char anguished[] = "\xF0\x9F\x98\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char fearful[] = "\xF0\x9F\x98\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char cold_sweat[] = "\xF0\x9F\x98\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char disappointed_relieved[] = "\xF0\x9F\x98\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char cry[] = "\xF0\x9F\x98\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char sob[] = "\xF0\x9F\x98\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char scream[] = "\xF0\x9F\x98\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char confounded[] = "\xF0\x9F\x98\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char persevere[] = "\xF0\x9F\x98\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char disappointed[] = "\xF0\x9F\x98\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char sweat[] = "\xF0\x9F\x98\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char weary[] = "\xF0\x9F\x98\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char tired_face[] = "\xF0\x9F\x98\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char triumph[] = "\xF0\x9F\x98\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char rage[] = "\xF0\x9F\x98\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char angry[] = "\xF0\x9F\x98\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char smiling_imp[] = "\xF0\x9F\x98\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char imp[] = "\xF0\x9F\x91\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char skull[] = "\xF0\x9F\x92\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char skull_and_crossbones[] = "\xE2\x98\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char poop[] = "\xF0\x9F\x92\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char clown_face[] = "\xF0\x9F\xA4\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char japanese_ogre[] = "\xF0\x9F\x91\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char japanese_goblin[] = "\xF0\x9F\x91\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char ghost[] = "\xF0\x9F\x91\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char alien[] = "\xF0\x9F\x91\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char space_invader[] = "\xF0\x9F\x91\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char robot[] = "\xF0\x9F\xA4\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char smiley_cat[] = "\xF0\x9F\x98\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char smile_cat[] = "\xF0\x9F\x98\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char joy_cat[] = "\xF0\x9F\x98\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char heart_eyes_cat[] = "\xF0\x9F\x98\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char smirk_cat[] = "\xF0\x9F\x98\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char kissing_cat[] = "\xF0\x9F\x98\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char scream_cat[] = "\xF0\x9F\x99\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char crying_cat_face[] = "\xF0\x9F\x98\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char pouting_cat[] = "\xF0\x9F\x98\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char see_no_evil[] = "\xF0\x9F\x99\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char hear_no_evil[] = "\xF0\x9F\x99\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char speak_no_evil[] = "\xF0\x9F\x99\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char love_letter[] = "\xF0\x9F\x92\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char cupid[] = "\xF0\x9F\x92\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char gift_heart[] = "\xF0\x9F\x92\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char sparkling_heart[] = "\xF0\x9F\x92\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char heartpulse[] = "\xF0\x9F\x92\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char heartbeat[] = "\xF0\x9F\x92\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char revolving_hearts[] = "\xF0\x9F\x92\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char two_hearts[] = "\xF0\x9F\x92\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char heart_decoration[] = "\xF0\x9F\x92\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char heavy_heart_exclamation[] = "\xE2\x9D\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char broken_heart[] = "\xF0\x9F\x92\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char heart[] = "\xE2\x9D\xA4\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char yellow_heart[] = "\xF0\x9F\x92\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char green_heart[] = "\xF0\x9F\x92\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char blue_heart[] = "\xF0\x9F\x92\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char purple_heart[] = "\xF0\x9F\x92\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char black_heart[] = "\xF0\x9F\x96\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char kiss[] = "\xF0\x9F\x92\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char one_hundred[] = "\xF0\x9F\x92\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char anger[] = "\xF0\x9F\x92\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char boom[] = "\xF0\x9F\x92\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char dizzy[] = "\xF0\x9F\x92\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char sweat_drops[] = "\xF0\x9F\x92\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char dash[] = "\xF0\x9F\x92\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char hole[] = "\xF0\x9F\x95\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char speech_balloon[] = "\xF0\x9F\x92\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char left_speech_bubble[] = "\xF0\x9F\x97\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char right_anger_bubble[] = "\xF0\x9F\x97\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char thought_balloon[] = "\xF0\x9F\x92\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char zzz[] = "\xF0\x9F\x92\xA4 ";
+
+} /* namespace Emoji */
+} /* namespace Canary */
@@ -0,0 +1,233 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // Symbols
+
+    CANARY_INLINE_VARIABLE constexpr char atm[] = "\xF0\x9F\x8F\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char put_litter_in_its_place[] = "\xF0\x9F\x9A\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char potable_water[] = "\xF0\x9F\x9A\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char wheelchair[] = "\xE2\x99\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char mens[] = "\xF0\x9F\x9A\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char womens[] = "\xF0\x9F\x9A\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char restroom[] = "\xF0\x9F\x9A\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char baby_symbol[] = "\xF0\x9F\x9A\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char wc[] = "\xF0\x9F\x9A\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char passport_control[] = "\xF0\x9F\x9B\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char customs[] = "\xF0\x9F\x9B\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char baggage_claim[] = "\xF0\x9F\x9B\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char left_luggage[] = "\xF0\x9F\x9B\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char warning[] = "\xE2\x9A\xA0\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char children_crossing[] = "\xF0\x9F\x9A\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char no_entry[] = "\xE2\x9B\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char no_entry_sign[] = "\xF0\x9F\x9A\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char no_bicycles[] = "\xF0\x9F\x9A\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char no_smoking[] = "\xF0\x9F\x9A\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char do_not_litter[] = "\xF0\x9F\x9A\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char non_potable_water[] = "\xF0\x9F\x9A\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char no_pedestrians[] = "\xF0\x9F\x9A\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char no_mobile_phones[] = "\xF0\x9F\x93\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char underage[] = "\xF0\x9F\x94\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char radioactive[] = "\xE2\x98\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char biohazard[] = "\xE2\x98\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_up[] = "\xE2\xAC\x86\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_upper_right[] = "\xE2\x86\x97\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_right[] = "\xE2\x9E\xA1\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_lower_right[] = "\xE2\x86\x98\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_down[] = "\xE2\xAC\x87\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_lower_left[] = "\xE2\x86\x99\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_left[] = "\xE2\xAC\x85\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_upper_left[] = "\xE2\x86\x96\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_up_down[] = "\xE2\x86\x95\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char left_right_arrow[] = "\xE2\x86\x94\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char leftwards_arrow_with_hook[] = "\xE2\x86\xA9\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_right_hook[] = "\xE2\x86\xAA\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_heading_up[] = "\xE2\xA4\xB4\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_heading_down[] = "\xE2\xA4\xB5\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char arrows_clockwise[] = "\xF0\x9F\x94\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char arrows_counterclockwise[] = "\xF0\x9F\x94\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char back[] = "\xF0\x9F\x94\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char end[] = "\xF0\x9F\x94\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char on[] = "\xF0\x9F\x94\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char soon[] = "\xF0\x9F\x94\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char top[] = "\xF0\x9F\x94\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char place_of_worship[] = "\xF0\x9F\x9B\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char atom_symbol[] = "\xE2\x9A\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char om[] = "\xF0\x9F\x95\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char star_of_david[] = "\xE2\x9C\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char wheel_of_dharma[] = "\xE2\x98\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char yin_yang[] = "\xE2\x98\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char latin_cross[] = "\xE2\x9C\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char orthodox_cross[] = "\xE2\x98\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char star_and_crescent[] = "\xE2\x98\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char peace_symbol[] = "\xE2\x98\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char menorah[] = "\xF0\x9F\x95\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char six_pointed_star[] = "\xF0\x9F\x94\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char aries[] = "\xE2\x99\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char taurus[] = "\xE2\x99\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char gemini[] = "\xE2\x99\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char cancer[] = "\xE2\x99\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char leo[] = "\xE2\x99\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char virgo[] = "\xE2\x99\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char libra[] = "\xE2\x99\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char scorpius[] = "\xE2\x99\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char sagittarius[] = "\xE2\x99\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char capricorn[] = "\xE2\x99\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char aquarius[] = "\xE2\x99\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char pisces[] = "\xE2\x99\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char ophiuchus[] = "\xE2\x9B\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char twisted_rightwards_arrows[] = "\xF0\x9F\x94\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char repeat[] = "\xF0\x9F\x94\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char repeat_one[] = "\xF0\x9F\x94\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_forward[] = "\xE2\x96\xB6\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char fast_forward[] = "\xE2\x8F\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char next_track_button[] = "\xE2\x8F\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char play_or_pause_button[] = "\xE2\x8F\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_backward[] = "\xE2\x97\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char rewind[] = "\xE2\x8F\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char previous_track_button[] = "\xE2\x8F\xAE ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_up_small[] = "\xF0\x9F\x94\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_double_up[] = "\xE2\x8F\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_down_small[] = "\xF0\x9F\x94\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char arrow_double_down[] = "\xE2\x8F\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char pause_button[] = "\xE2\x8F\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char stop_button[] = "\xE2\x8F\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char record_button[] = "\xE2\x8F\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char cinema[] = "\xF0\x9F\x8E\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char low_brightness[] = "\xF0\x9F\x94\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char high_brightness[] = "\xF0\x9F\x94\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char signal_strength[] = "\xF0\x9F\x93\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char vibration_mode[] = "\xF0\x9F\x93\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char mobile_phone_off[] = "\xF0\x9F\x93\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char heavy_multiplication_x[] = "\xE2\x9C\x96\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char heavy_plus_sign[] = "\xE2\x9E\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char heavy_minus_sign[] = "\xE2\x9E\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char heavy_division_sign[] = "\xE2\x9E\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char bangbang[] = "\xE2\x80\xBC\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char interrobang[] = "\xE2\x81\x89\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char question[] = "\xE2\x9D\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char grey_question[] = "\xE2\x9D\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char grey_exclamation[] = "\xE2\x9D\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char exclamation[] = "\xE2\x9D\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char wavy_dash[] = "\xE3\x80\xB0\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char currency_exchange[] = "\xF0\x9F\x92\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char heavy_dollar_sign[] = "\xF0\x9F\x92\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char recycle[] = "\xE2\x99\xBB\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char fleur_de_lis[] = "\xE2\x9A\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char trident[] = "\xF0\x9F\x94\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char name_badge[] = "\xF0\x9F\x93\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char beginner[] = "\xF0\x9F\x94\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char o[] = "\xE2\xAD\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char white_check_mark[] = "\xE2\x9C\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char ballot_box_with_check[] = "\xE2\x98\x91\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char heavy_check_mark[] = "\xE2\x9C\x94\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char x[] = "\xE2\x9D\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char negative_squared_cross_mark[] = "\xE2\x9D\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char curly_loop[] = "\xE2\x9E\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char loop[] = "\xE2\x9E\xBF ";
+    CANARY_INLINE_VARIABLE constexpr char part_alternation_mark[] = "\xE3\x80\xBD\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char eight_spoked_asterisk[] = "\xE2\x9C\xB3\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char eight_pointed_black_star[] = "\xE2\x9C\xB4\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char sparkle[] = "\xE2\x9D\x87\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char copyright[] = "\xC2\xA9\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char registered[] = "\xC2\xAE\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char tm[] = "\xE2\x84\xA2\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char hash[] = "\x23\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char asterisk[] = "\x2A\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char zero[] = "\x30\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char one[] = "\x31\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char two[] = "\x32\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char three[] = "\x33\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char four[] = "\x34\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char five[] = "\x35\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char six[] = "\x36\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char seven[] = "\x37\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char eight[] = "\x38\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char nine[] = "\x39\xEF\xB8\x8F\xE2\x83\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char keycap_ten[] = "\xF0\x9F\x94\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char capital_abcd[] = "\xF0\x9F\x94\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char abcd[] = "\xF0\x9F\x94\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char one_two_three_four[] = "\xF0\x9F\x94\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char symbols[] = "\xF0\x9F\x94\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char abc[] = "\xF0\x9F\x94\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char a[] = "\xF0\x9F\x85\xB0\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char ab[] = "\xF0\x9F\x86\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char b[] = "\xF0\x9F\x85\xB1\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char cl[] = "\xF0\x9F\x86\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char cool[] = "\xF0\x9F\x86\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char free[] = "\xF0\x9F\x86\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char information_source[] = "\xE2\x84\xB9\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char id[] = "\xF0\x9F\x86\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char m[] = "\xE2\x93\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char new_[] = "\xF0\x9F\x86\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char ng[] = "\xF0\x9F\x86\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char o2[] = "\xF0\x9F\x85\xBE\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char ok[] = "\xF0\x9F\x86\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char parking[] = "\xF0\x9F\x85\xBF\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char sos[] = "\xF0\x9F\x86\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char up[] = "\xF0\x9F\x86\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char vs[] = "\xF0\x9F\x86\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char koko[] = "\xF0\x9F\x88\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char sa[] = "\xF0\x9F\x88\x82\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char u6708[] = "\xF0\x9F\x88\xB7\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char u6709[] = "\xF0\x9F\x88\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char u6307[] = "\xF0\x9F\x88\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char ideograph_advantage[] = "\xF0\x9F\x89\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char u5272[] = "\xF0\x9F\x88\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char u7121[] = "\xF0\x9F\x88\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char u7981[] = "\xF0\x9F\x88\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char accept[] = "\xF0\x9F\x89\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char u7533[] = "\xF0\x9F\x88\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char u5408[] = "\xF0\x9F\x88\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char u7a7a[] = "\xF0\x9F\x88\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char congratulations[] = "\xE3\x8A\x97\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char secret[] = "\xE3\x8A\x99\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char u55b6[] = "\xF0\x9F\x88\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char u6e80[] = "\xF0\x9F\x88\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char red_circle[] = "\xF0\x9F\x94\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char large_blue_circle[] = "\xF0\x9F\x94\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char black_circle[] = "\xE2\x9A\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char white_circle[] = "\xE2\x9A\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char black_large_square[] = "\xE2\xAC\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char white_large_square[] = "\xE2\xAC\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char black_medium_square[] = "\xE2\x97\xBC\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char white_medium_square[] = "\xE2\x97\xBB\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char black_medium_small_square[] = "\xE2\x97\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char white_medium_small_square[] = "\xE2\x97\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char black_small_square[] = "\xE2\x96\xAA\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char white_small_square[] = "\xE2\x96\xAB\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char large_orange_diamond[] = "\xF0\x9F\x94\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char large_blue_diamond[] = "\xF0\x9F\x94\xB7 ";
+    CANARY_INLINE_VARIABLE constexpr char small_orange_diamond[] = "\xF0\x9F\x94\xB8 ";
+    CANARY_INLINE_VARIABLE constexpr char small_blue_diamond[] = "\xF0\x9F\x94\xB9 ";
+    CANARY_INLINE_VARIABLE constexpr char small_red_triangle[] = "\xF0\x9F\x94\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char small_red_triangle_down[] = "\xF0\x9F\x94\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char diamond_shape_with_a_dot_inside[] = "\xF0\x9F\x92\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char radio_button[] = "\xF0\x9F\x94\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char white_square_button[] = "\xF0\x9F\x94\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char black_square_button[] = "\xF0\x9F\x94\xB2 ";
+
+} /* namespace Emoji */
+} /* namespace Canary */
@@ -0,0 +1,230 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // Travel & Places
+
+    CANARY_INLINE_VARIABLE constexpr char earth_africa[] = "\xF0\x9F\x8C\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char earth_americas[] = "\xF0\x9F\x8C\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char earth_asia[] = "\xF0\x9F\x8C\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char globe_with_meridians[] = "\xF0\x9F\x8C\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char world_map[] = "\xF0\x9F\x97\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char japan[] = "\xF0\x9F\x97\xBE ";
+    CANARY_INLINE_VARIABLE constexpr char mountain_snow[] = "\xF0\x9F\x8F\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char mountain[] = "\xE2\x9B\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char volcano[] = "\xF0\x9F\x8C\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char mount_fuji[] = "\xF0\x9F\x97\xBB ";
+    CANARY_INLINE_VARIABLE constexpr char camping[] = "\xF0\x9F\x8F\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char beach_umbrella[] = "\xF0\x9F\x8F\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char desert[] = "\xF0\x9F\x8F\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char desert_island[] = "\xF0\x9F\x8F\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char national_park[] = "\xF0\x9F\x8F\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char stadium[] = "\xF0\x9F\x8F\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char classical_building[] = "\xF0\x9F\x8F\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char building_construction[] = "\xF0\x9F\x8F\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char houses[] = "\xF0\x9F\x8F\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char derelict_house[] = "\xF0\x9F\x8F\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char house[] = "\xF0\x9F\x8F\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char house_with_garden[] = "\xF0\x9F\x8F\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char office[] = "\xF0\x9F\x8F\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char post_office[] = "\xF0\x9F\x8F\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char european_post_office[] = "\xF0\x9F\x8F\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char hospital[] = "\xF0\x9F\x8F\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char bank[] = "\xF0\x9F\x8F\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char hotel[] = "\xF0\x9F\x8F\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char love_hotel[] = "\xF0\x9F\x8F\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char convenience_store[] = "\xF0\x9F\x8F\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char school[] = "\xF0\x9F\x8F\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char department_store[] = "\xF0\x9F\x8F\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char factory[] = "\xF0\x9F\x8F\xAD ";
+    CANARY_INLINE_VARIABLE constexpr char japanese_castle[] = "\xF0\x9F\x8F\xAF ";
+    CANARY_INLINE_VARIABLE constexpr char european_castle[] = "\xF0\x9F\x8F\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char wedding[] = "\xF0\x9F\x92\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char tokyo_tower[] = "\xF0\x9F\x97\xBC ";
+    CANARY_INLINE_VARIABLE constexpr char statue_of_liberty[] = "\xF0\x9F\x97\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char church[] = "\xE2\x9B\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char mosque[] = "\xF0\x9F\x95\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char synagogue[] = "\xF0\x9F\x95\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char shinto_shrine[] = "\xE2\x9B\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char kaaba[] = "\xF0\x9F\x95\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char fountain[] = "\xE2\x9B\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char tent[] = "\xE2\x9B\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char foggy[] = "\xF0\x9F\x8C\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char night_with_stars[] = "\xF0\x9F\x8C\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char cityscape[] = "\xF0\x9F\x8F\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char sunrise_over_mountains[] = "\xF0\x9F\x8C\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char sunrise[] = "\xF0\x9F\x8C\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char city_sunset[] = "\xF0\x9F\x8C\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char city_sunrise[] = "\xF0\x9F\x8C\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char bridge_at_night[] = "\xF0\x9F\x8C\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char hotsprings[] = "\xE2\x99\xA8\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char carousel_horse[] = "\xF0\x9F\x8E\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char ferris_wheel[] = "\xF0\x9F\x8E\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char roller_coaster[] = "\xF0\x9F\x8E\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char barber[] = "\xF0\x9F\x92\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char circus_tent[] = "\xF0\x9F\x8E\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char steam_locomotive[] = "\xF0\x9F\x9A\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char railway_car[] = "\xF0\x9F\x9A\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char bullettrain_side[] = "\xF0\x9F\x9A\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char bullettrain_front[] = "\xF0\x9F\x9A\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char train2[] = "\xF0\x9F\x9A\x86 ";
+    CANARY_INLINE_VARIABLE constexpr char metro[] = "\xF0\x9F\x9A\x87 ";
+    CANARY_INLINE_VARIABLE constexpr char light_rail[] = "\xF0\x9F\x9A\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char station[] = "\xF0\x9F\x9A\x89 ";
+    CANARY_INLINE_VARIABLE constexpr char tram[] = "\xF0\x9F\x9A\x8A ";
+    CANARY_INLINE_VARIABLE constexpr char monorail[] = "\xF0\x9F\x9A\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char mountain_railway[] = "\xF0\x9F\x9A\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char train[] = "\xF0\x9F\x9A\x8B ";
+    CANARY_INLINE_VARIABLE constexpr char bus[] = "\xF0\x9F\x9A\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char oncoming_bus[] = "\xF0\x9F\x9A\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char trolleybus[] = "\xF0\x9F\x9A\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char minibus[] = "\xF0\x9F\x9A\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char ambulance[] = "\xF0\x9F\x9A\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char fire_engine[] = "\xF0\x9F\x9A\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char police_car[] = "\xF0\x9F\x9A\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char oncoming_police_car[] = "\xF0\x9F\x9A\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char taxi[] = "\xF0\x9F\x9A\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char oncoming_taxi[] = "\xF0\x9F\x9A\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char red_car[] = "\xF0\x9F\x9A\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char oncoming_automobile[] = "\xF0\x9F\x9A\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char blue_car[] = "\xF0\x9F\x9A\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char truck[] = "\xF0\x9F\x9A\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char articulated_lorry[] = "\xF0\x9F\x9A\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char tractor[] = "\xF0\x9F\x9A\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char racing_car[] = "\xF0\x9F\x8F\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char motorcycle[] = "\xF0\x9F\x8F\x8D ";
+    CANARY_INLINE_VARIABLE constexpr char motor_scooter[] = "\xF0\x9F\x9B\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char bike[] = "\xF0\x9F\x9A\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char kick_scooter[] = "\xF0\x9F\x9B\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char busstop[] = "\xF0\x9F\x9A\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char motorway[] = "\xF0\x9F\x9B\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char railway_track[] = "\xF0\x9F\x9B\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char oil_drum[] = "\xF0\x9F\x9B\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char fuelpump[] = "\xE2\x9B\xBD ";
+    CANARY_INLINE_VARIABLE constexpr char rotating_light[] = "\xF0\x9F\x9A\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char traffic_light[] = "\xF0\x9F\x9A\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char vertical_traffic_light[] = "\xF0\x9F\x9A\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char stop_sign[] = "\xF0\x9F\x9B\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char construction[] = "\xF0\x9F\x9A\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char anchor[] = "\xE2\x9A\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char sailboat[] = "\xE2\x9B\xB5 ";
+    CANARY_INLINE_VARIABLE constexpr char canoe[] = "\xF0\x9F\x9B\xB6 ";
+    CANARY_INLINE_VARIABLE constexpr char speedboat[] = "\xF0\x9F\x9A\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char passenger_ship[] = "\xF0\x9F\x9B\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char ferry[] = "\xE2\x9B\xB4 ";
+    CANARY_INLINE_VARIABLE constexpr char motor_boat[] = "\xF0\x9F\x9B\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char ship[] = "\xF0\x9F\x9A\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char airplane[] = "\xE2\x9C\x88\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char small_airplane[] = "\xF0\x9F\x9B\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char flight_departure[] = "\xF0\x9F\x9B\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char flight_arrival[] = "\xF0\x9F\x9B\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char seat[] = "\xF0\x9F\x92\xBA ";
+    CANARY_INLINE_VARIABLE constexpr char helicopter[] = "\xF0\x9F\x9A\x81 ";
+    CANARY_INLINE_VARIABLE constexpr char suspension_railway[] = "\xF0\x9F\x9A\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char mountain_cableway[] = "\xF0\x9F\x9A\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char aerial_tramway[] = "\xF0\x9F\x9A\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char artificial_satellite[] = "\xF0\x9F\x9B\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char rocket[] = "\xF0\x9F\x9A\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char bellhop_bell[] = "\xF0\x9F\x9B\x8E ";
+    CANARY_INLINE_VARIABLE constexpr char hourglass[] = "\xE2\x8C\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char hourglass_flowing_sand[] = "\xE2\x8F\xB3 ";
+    CANARY_INLINE_VARIABLE constexpr char watch[] = "\xE2\x8C\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char alarm_clock[] = "\xE2\x8F\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char stopwatch[] = "\xE2\x8F\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char timer_clock[] = "\xE2\x8F\xB2 ";
+    CANARY_INLINE_VARIABLE constexpr char mantelpiece_clock[] = "\xF0\x9F\x95\xB0 ";
+    CANARY_INLINE_VARIABLE constexpr char clock12[] = "\xF0\x9F\x95\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char clock1230[] = "\xF0\x9F\x95\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char clock1[] = "\xF0\x9F\x95\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char clock130[] = "\xF0\x9F\x95\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char clock2[] = "\xF0\x9F\x95\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char clock230[] = "\xF0\x9F\x95\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char clock3[] = "\xF0\x9F\x95\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char clock330[] = "\xF0\x9F\x95\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char clock4[] = "\xF0\x9F\x95\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char clock430[] = "\xF0\x9F\x95\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char clock5[] = "\xF0\x9F\x95\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char clock530[] = "\xF0\x9F\x95\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char clock6[] = "\xF0\x9F\x95\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char clock630[] = "\xF0\x9F\x95\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char clock7[] = "\xF0\x9F\x95\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char clock730[] = "\xF0\x9F\x95\xA2 ";
+    CANARY_INLINE_VARIABLE constexpr char clock8[] = "\xF0\x9F\x95\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char clock830[] = "\xF0\x9F\x95\xA3 ";
+    CANARY_INLINE_VARIABLE constexpr char clock9[] = "\xF0\x9F\x95\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char clock930[] = "\xF0\x9F\x95\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char clock10[] = "\xF0\x9F\x95\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char clock1030[] = "\xF0\x9F\x95\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char clock11[] = "\xF0\x9F\x95\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char clock1130[] = "\xF0\x9F\x95\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char new_moon[] = "\xF0\x9F\x8C\x91 ";
+    CANARY_INLINE_VARIABLE constexpr char waxing_crescent_moon[] = "\xF0\x9F\x8C\x92 ";
+    CANARY_INLINE_VARIABLE constexpr char first_quarter_moon[] = "\xF0\x9F\x8C\x93 ";
+    CANARY_INLINE_VARIABLE constexpr char waxing_gibbous_moon[] = "\xF0\x9F\x8C\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char full_moon[] = "\xF0\x9F\x8C\x95 ";
+    CANARY_INLINE_VARIABLE constexpr char waning_gibbous_moon[] = "\xF0\x9F\x8C\x96 ";
+    CANARY_INLINE_VARIABLE constexpr char last_quarter_moon[] = "\xF0\x9F\x8C\x97 ";
+    CANARY_INLINE_VARIABLE constexpr char waning_crescent_moon[] = "\xF0\x9F\x8C\x98 ";
+    CANARY_INLINE_VARIABLE constexpr char crescent_moon[] = "\xF0\x9F\x8C\x99 ";
+    CANARY_INLINE_VARIABLE constexpr char new_moon_with_face[] = "\xF0\x9F\x8C\x9A ";
+    CANARY_INLINE_VARIABLE constexpr char first_quarter_moon_with_face[] = "\xF0\x9F\x8C\x9B ";
+    CANARY_INLINE_VARIABLE constexpr char last_quarter_moon_with_face[] = "\xF0\x9F\x8C\x9C ";
+    CANARY_INLINE_VARIABLE constexpr char thermometer[] = "\xF0\x9F\x8C\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char sunny[] = "\xE2\x98\x80\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char full_moon_with_face[] = "\xF0\x9F\x8C\x9D ";
+    CANARY_INLINE_VARIABLE constexpr char sun_with_face[] = "\xF0\x9F\x8C\x9E ";
+    CANARY_INLINE_VARIABLE constexpr char star[] = "\xE2\xAD\x90 ";
+    CANARY_INLINE_VARIABLE constexpr char star2[] = "\xF0\x9F\x8C\x9F ";
+    CANARY_INLINE_VARIABLE constexpr char stars[] = "\xF0\x9F\x8C\xA0 ";
+    CANARY_INLINE_VARIABLE constexpr char milky_way[] = "\xF0\x9F\x8C\x8C ";
+    CANARY_INLINE_VARIABLE constexpr char cloud[] = "\xE2\x98\x81\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char partly_sunny[] = "\xE2\x9B\x85 ";
+    CANARY_INLINE_VARIABLE constexpr char cloud_with_lightning_and_rain[] = "\xE2\x9B\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char sun_behind_small_cloud[] = "\xF0\x9F\x8C\xA4 ";
+    CANARY_INLINE_VARIABLE constexpr char sun_behind_large_cloud[] = "\xF0\x9F\x8C\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char sun_behind_rain_cloud[] = "\xF0\x9F\x8C\xA6 ";
+    CANARY_INLINE_VARIABLE constexpr char cloud_with_rain[] = "\xF0\x9F\x8C\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char cloud_with_snow[] = "\xF0\x9F\x8C\xA8 ";
+    CANARY_INLINE_VARIABLE constexpr char cloud_with_lightning[] = "\xF0\x9F\x8C\xA9 ";
+    CANARY_INLINE_VARIABLE constexpr char tornado[] = "\xF0\x9F\x8C\xAA ";
+    CANARY_INLINE_VARIABLE constexpr char fog[] = "\xF0\x9F\x8C\xAB ";
+    CANARY_INLINE_VARIABLE constexpr char wind_face[] = "\xF0\x9F\x8C\xAC ";
+    CANARY_INLINE_VARIABLE constexpr char cyclone[] = "\xF0\x9F\x8C\x80 ";
+    CANARY_INLINE_VARIABLE constexpr char rainbow[] = "\xF0\x9F\x8C\x88 ";
+    CANARY_INLINE_VARIABLE constexpr char closed_umbrella[] = "\xF0\x9F\x8C\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char open_umbrella[] = "\xE2\x98\x82 ";
+    CANARY_INLINE_VARIABLE constexpr char umbrella[] = "\xE2\x98\x94 ";
+    CANARY_INLINE_VARIABLE constexpr char parasol_on_ground[] = "\xE2\x9B\xB1 ";
+    CANARY_INLINE_VARIABLE constexpr char zap[] = "\xE2\x9A\xA1 ";
+    CANARY_INLINE_VARIABLE constexpr char snowflake[] = "\xE2\x9D\x84\xEF\xB8\x8F ";
+    CANARY_INLINE_VARIABLE constexpr char snowman_with_snow[] = "\xE2\x98\x83 ";
+    CANARY_INLINE_VARIABLE constexpr char snowman[] = "\xE2\x9B\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char comet[] = "\xE2\x98\x84 ";
+    CANARY_INLINE_VARIABLE constexpr char fire[] = "\xF0\x9F\x94\xA5 ";
+    CANARY_INLINE_VARIABLE constexpr char droplet[] = "\xF0\x9F\x92\xA7 ";
+    CANARY_INLINE_VARIABLE constexpr char ocean[] = "\xF0\x9F\x8C\x8A ";
+
+} /* namespace Emoji */
+} /* namespace Canary */
@@ -0,0 +1,47 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__has_include)
+#if __has_include(<string_view>) && __cplusplus >= 201703L
+#include <string_view>
+#define CANARY_STRING_VIEW 1
+#endif
+#endif
+
+namespace Canary {
+namespace Emoji {
+
+#if defined(CANARY_STRING_VIEW)
+    /**
+        An emoji constant as a std::string_view, in its own header as
+        <string_view> costs more to parse than all the constants of a
+        group
+     */
+    template<std::size_t N>
+    constexpr std::string_view View(const char (&emoji)[N]) {
+        return std::string_view(emoji, N - 1);
+    }
+#endif
+
+} /* namespace Emoji */
+} /* namespace Canary */
@@ -0,0 +1,9323 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Canary {
+
+    namespace detail {
+
+        // A node of the trie from emoji bytes to emojis
+        struct ReverseNode {
+            // Bit b is set if there is a child for the byte high | b
+            std::uint64_t children;
+            std::uint16_t first;
+            // The index + 1 of the emoji that ends here, 0 if none does
+            std::uint16_t emoji;
+            std::uint8_t high;
+        };
+
+        /**
+            The emoji tables, a template only to have one definition of
+            its static members in every program before C++17
+         */
+        template<class = void>
+        struct EmojiTables {
+            static constexpr std::size_t count = 1432;
+            static constexpr std::size_t groups = 10;
+
+            // The UTF-8 bytes of all emojis, each followed by a null character
+            static constexpr char bytes[] =
+                "\xF0\x9F\x98\x80\0" // grinning
+                "\xF0\x9F\x98\x83\0" // smiley
+                "\xF0\x9F\x98\x84\0" // smile
+                "\xF0\x9F\x98\x81\0" // grin
+                "\xF0\x9F\x98\x86\0" // laughing
+                "\xF0\x9F\x98\x85\0" // sweat_smile
+                "\xF0\x9F\xA4\xA3\0" // rofl
+                "\xF0\x9F\x98\x82\0" // joy
+                "\xF0\x9F\x99\x82\0" // slightly_smiling_face
+                "\xF0\x9F\x99\x83\0" // upside_down_face
+                "\xF0\x9F\x98\x89\0" // wink
+                "\xF0\x9F\x98\x8A\0" // blush
+                "\xF0\x9F\x98\x87\0" // innocent
+                "\xF0\x9F\x98\x8D\0" // heart_eyes
+                "\xF0\x9F\x98\x98\0" // kissing_heart
+                "\xF0\x9F\x98\x97\0" // kissing
+                "\xE2\x98\xBA\xEF\xB8\x8F\0" // relaxed
+                "\xF0\x9F\x98\x9A\0" // kissing_closed_eyes
+                "\xF0\x9F\x98\x99\0" // kissing_smiling_eyes
+                "\xF0\x9F\x98\x8B\0" // yum
+                "\xF0\x9F\x98\x9B\0" // stuck_out_tongue
+                "\xF0\x9F\x98\x9C\0" // stuck_out_tongue_winking_eye
+                "\xF0\x9F\x98\x9D\0" // stuck_out_tongue_closed_eyes
+                "\xF0\x9F\xA4\x91\0" // money_mouth_face
+                "\xF0\x9F\xA4\x97\0" // hugs
+                "\xF0\x9F\xA4\x94\0" // thinking
+                "\xF0\x9F\xA4\x90\0" // zipper_mouth_face
+                "\xF0\x9F\x98\x90\0" // neutral_face
+                "\xF0\x9F\x98\x91\0" // expressionless
+                "\xF0\x9F\x98\xB6\0" // no_mouth
+                "\xF0\x9F\x98\x8F\0" // smirk
+                "\xF0\x9F\x98\x92\0" // unamused
+                "\xF0\x9F\x99\x84\0" // roll_eyes
+                "\xF0\x9F\x98\xAC\0" // grimacing
+                "\xF0\x9F\xA4\xA5\0" // lying_face
+                "\xF0\x9F\x98\x8C\0" // relieved
+                "\xF0\x9F\x98\x94\0" // pensive
+                "\xF0\x9F\x98\xAA\0" // sleepy
+                "\xF0\x9F\xA4\xA4\0" // drooling_face
+                "\xF0\x9F\x98\xB4\0" // sleeping
+                "\xF0\x9F\x98\xB7\0" // mask
+                "\xF0\x9F\xA4\x92\0" // face_with_thermometer
+                "\xF0\x9F\xA4\x95\0" // face_with_head_bandage
+                "\xF0\x9F\xA4\xA2\0" // nauseated_face
+                "\xF0\x9F\xA4\xA7\0" // sneezing_face
+                "\xF0\x9F\x98\xB5\0" // dizzy_face
+                "\xF0\x9F\xA4\xA0\0" // cowboy_hat_face
+                "\xF0\x9F\x98\x8E\0" // sunglasses
+                "\xF0\x9F\xA4\x93\0" // nerd_face
+                "\xF0\x9F\x98\x95\0" // confused
+                "\xF0\x9F\x98\x9F\0" // worried
+                "\xF0\x9F\x99\x81\0" // slightly_frowning_face
+                "\xE2\x98\xB9\0" // frowning_face
+                "\xF0\x9F\x98\xAE\0" // open_mouth
+                "\xF0\x9F\x98\xAF\0" // hushed
+                "\xF0\x9F\x98\xB2\0" // astonished
+                "\xF0\x9F\x98\xB3\0" // flushed
+                "\xF0\x9F\x98\xA6\0" // frowning
+                "\xF0\x9F\x98\xA7\0" // anguished
+                "\xF0\x9F\x98\xA8\0" // fearful
+                "\xF0\x9F\x98\xB0\0" // cold_sweat
+                "\xF0\x9F\x98\xA5\0" // disappointed_relieved
+                "\xF0\x9F\x98\xA2\0" // cry
+                "\xF0\x9F\x98\xAD\0" // sob
+                "\xF0\x9F\x98\xB1\0" // scream
+                "\xF0\x9F\x98\x96\0" // confounded
+                "\xF0\x9F\x98\xA3\0" // persevere
+                "\xF0\x9F\x98\x9E\0" // disappointed
+                "\xF0\x9F\x98\x93\0" // sweat
+                "\xF0\x9F\x98\xA9\0" // weary
+                "\xF0\x9F\x98\xAB\0" // tired_face
+                "\xF0\x9F\x98\xA4\0" // triumph
+                "\xF0\x9F\x98\xA1\0" // rage
+                "\xF0\x9F\x98\xA0\0" // angry
+                "\xF0\x9F\x98\x88\0" // smiling_imp
+                "\xF0\x9F\x91\xBF\0" // imp
+                "\xF0\x9F\x92\x80\0" // skull
+                "\xE2\x98\xA0\0" // skull_and_crossbones
+                "\xF0\x9F\x92\xA9\0" // poop
+                "\xF0\x9F\xA4\xA1\0" // clown_face
+                "\xF0\x9F\x91\xB9\0" // japanese_ogre
+                "\xF0\x9F\x91\xBA\0" // japanese_goblin
+                "\xF0\x9F\x91\xBB\0" // ghost
+                "\xF0\x9F\x91\xBD\0" // alien
+                "\xF0\x9F\x91\xBE\0" // space_invader
+                "\xF0\x9F\xA4\x96\0" // robot
+                "\xF0\x9F\x98\xBA\0" // smiley_cat
+                "\xF0\x9F\x98\xB8\0" // smile_cat
+                "\xF0\x9F\x98\xB9\0" // joy_cat
+                "\xF0\x9F\x98\xBB\0" // heart_eyes_cat
+                "\xF0\x9F\x98\xBC\0" // smirk_cat
+                "\xF0\x9F\x98\xBD\0" // kissing_cat
+                "\xF0\x9F\x99\x80\0" // scream_cat
+                "\xF0\x9F\x98\xBF\0" // crying_cat_face
+                "\xF0\x9F\x98\xBE\0" // pouting_cat
+                "\xF0\x9F\x99\x88\0" // see_no_evil
+                "\xF0\x9F\x99\x89\0" // hear_no_evil
+                "\xF0\x9F\x99\x8A\0" // speak_no_evil
+                "\xF0\x9F\x92\x8C\0" // love_letter
+                "\xF0\x9F\x92\x98\0" // cupid
+                "\xF0\x9F\x92\x9D\0" // gift_heart
+                "\xF0\x9F\x92\x96\0" // sparkling_heart
+                "\xF0\x9F\x92\x97\0" // heartpulse
+                "\xF0\x9F\x92\x93\0" // heartbeat
+                "\xF0\x9F\x92\x9E\0" // revolving_hearts
+                "\xF0\x9F\x92\x95\0" // two_hearts
+                "\xF0\x9F\x92\x9F\0" // heart_decoration
+                "\xE2\x9D\xA3\0" // heavy_heart_exclamation
+                "\xF0\x9F\x92\x94\0" // broken_heart
+                "\xE2\x9D\xA4\xEF\xB8\x8F\0" // heart
+                "\xF0\x9F\x92\x9B\0" // yellow_heart
+                "\xF0\x9F\x92\x9A\0" // green_heart
+                "\xF0\x9F\x92\x99\0" // blue_heart
+                "\xF0\x9F\x92\x9C\0" // purple_heart
+                "\xF0\x9F\x96\xA4\0" // black_heart
+                "\xF0\x9F\x92\x8B\0" // kiss
+                "\xF0\x9F\x92\xAF\0" // one_hundred
+                "\xF0\x9F\x92\xA2\0" // anger
+                "\xF0\x9F\x92\xA5\0" // boom
+                "\xF0\x9F\x92\xAB\0" // dizzy
+                "\xF0\x9F\x92\xA6\0" // sweat_drops
+                "\xF0\x9F\x92\xA8\0" // dash
+                "\xF0\x9F\x95\xB3\0" // hole
+                "\xF0\x9F\x92\xAC\0" // speech_balloon
+                "\xF0\x9F\x97\xA8\0" // left_speech_bubble
+                "\xF0\x9F\x97\xAF\0" // right_anger_bubble
+                "\xF0\x9F\x92\xAD\0" // thought_balloon
+                "\xF0\x9F\x92\xA4\0" // zzz
+                "\xF0\x9F\x91\x8B\0" // wave
+                "\xF0\x9F\xA4\x9A\0" // raised_back_of_hand
+                "\xF0\x9F\x96\x90\0" // raised_hand_with_fingers_splayed
+                "\xE2\x9C\x8B\0" // raised_hand
+                "\xF0\x9F\x96\x96\0" // vulcan_salute
+                "\xF0\x9F\x91\x8C\0" // ok_hand
+                "\xE2\x9C\x8C\0" // v
+                "\xF0\x9F\xA4\x9E\0" // crossed_fingers
+                "\xF0\x9F\xA4\x98\0" // metal
+                "\xF0\x9F\xA4\x99\0" // call_me_hand
+                "\xF0\x9F\x91\x88\0" // point_left
+                "\xF0\x9F\x91\x89\0" // point_right
+                "\xF0\x9F\x91\x86\0" // point_up_2
+                "\xF0\x9F\x96\x95\0" // fu
+                "\xF0\x9F\x91\x87\0" // point_down
+                "\xE2\x98\x9D\0" // point_up
+                "\xF0\x9F\x91\x8D\0" // plus_one
+                "\xF0\x9F\x91\x8E\0" // minus_one
+                "\xE2\x9C\x8A\0" // fist
+                "\xF0\x9F\x91\x8A\0" // facepunch
+                "\xF0\x9F\xA4\x9B\0" // fist_left
+                "\xF0\x9F\xA4\x9C\0" // fist_right
+                "\xF0\x9F\x91\x8F\0" // clap
+                "\xF0\x9F\x99\x8C\0" // raised_hands
+                "\xF0\x9F\x91\x90\0" // open_hands
+                "\xF0\x9F\xA4\x9D\0" // handshake
+                "\xF0\x9F\x99\x8F\0" // pray
+                "\xE2\x9C\x8D\0" // writing_hand
+                "\xF0\x9F\x92\x85\0" // nail_care
+                "\xF0\x9F\xA4\xB3\0" // selfie
+                "\xF0\x9F\x92\xAA\0" // muscle
+                "\xF0\x9F\x91\x82\0" // ear
+                "\xF0\x9F\x91\x83\0" // nose
+                "\xF0\x9F\x91\x80\0" // eyes
+                "\xF0\x9F\x91\x81\0" // eye
+                "\xF0\x9F\x91\x85\0" // tongue
+                "\xF0\x9F\x91\x84\0" // lips
+                "\xF0\x9F\x91\xB6\0" // baby
+                "\xF0\x9F\x91\xA6\0" // boy
+                "\xF0\x9F\x91\xA7\0" // girl
+                "\xF0\x9F\x91\xB1\0" // blonde_man
+                "\xF0\x9F\x91\xA8\0" // man
+                "\xF0\x9F\x91\xA9\0" // woman
+                "\xF0\x9F\x91\xB1\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // blonde_woman
+                "\xF0\x9F\x91\xB4\0" // older_man
+                "\xF0\x9F\x91\xB5\0" // older_woman
+                "\xF0\x9F\x99\x8D\0" // frowning_woman
+                "\xF0\x9F\x99\x8D\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // frowning_man
+                "\xF0\x9F\x99\x8E\0" // pouting_woman
+                "\xF0\x9F\x99\x8E\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // pouting_man
+                "\xF0\x9F\x99\x85\0" // no_good_woman
+                "\xF0\x9F\x99\x85\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // no_good_man
+                "\xF0\x9F\x99\x86\0" // ok_woman
+                "\xF0\x9F\x99\x86\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // ok_man
+                "\xF0\x9F\x92\x81\0" // tipping_hand_woman
+                "\xF0\x9F\x92\x81\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // tipping_hand_man
+                "\xF0\x9F\x99\x8B\0" // raising_hand_woman
+                "\xF0\x9F\x99\x8B\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // raising_hand_man
+                "\xF0\x9F\x99\x87\0" // bowing_man
+                "\xF0\x9F\x99\x87\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // bowing_woman
+                "\xF0\x9F\xA4\xA6\0" // man_facepalming
+                "\xF0\x9F\xA4\xA6\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // woman_facepalming
+                "\xF0\x9F\xA4\xB7\0" // woman_shrugging
+                "\xF0\x9F\xA4\xB7\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // man_shrugging
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9A\x95\xEF\xB8\x8F\0" // man_health_worker
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9A\x95\xEF\xB8\x8F\0" // woman_health_worker
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8E\x93\0" // man_student
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\x93\0" // woman_student
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8F\xAB\0" // man_teacher
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8F\xAB\0" // woman_teacher
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9A\x96\xEF\xB8\x8F\0" // man_judge
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9A\x96\xEF\xB8\x8F\0" // woman_judge
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8C\xBE\0" // man_farmer
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8C\xBE\0" // woman_farmer
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8D\xB3\0" // man_cook
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8D\xB3\0" // woman_cook
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x94\xA7\0" // man_mechanic
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x94\xA7\0" // woman_mechanic
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8F\xAD\0" // man_factory_worker
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8F\xAD\0" // woman_factory_worker
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x92\xBC\0" // man_office_worker
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBC\0" // woman_office_worker
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x94\xAC\0" // man_scientist
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x94\xAC\0" // woman_scientist
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x92\xBB\0" // man_technologist
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB\0" // woman_technologist
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8E\xA4\0" // man_singer
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\xA4\0" // woman_singer
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x8E\xA8\0" // man_artist
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\xA8\0" // woman_artist
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9C\x88\xEF\xB8\x8F\0" // man_pilot
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9C\x88\xEF\xB8\x8F\0" // woman_pilot
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x9A\x80\0" // man_astronaut
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x9A\x80\0" // woman_astronaut
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x9A\x92\0" // man_firefighter
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x9A\x92\0" // woman_firefighter
+                "\xF0\x9F\x91\xAE\0" // policeman
+                "\xF0\x9F\x91\xAE\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // policewoman
+                "\xF0\x9F\x95\xB5\0" // male_detective
+                "\xF0\x9F\x95\xB5\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // female_detective
+                "\xF0\x9F\x92\x82\0" // guardsman
+                "\xF0\x9F\x92\x82\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // guardswoman
+                "\xF0\x9F\x91\xB7\0" // construction_worker_man
+                "\xF0\x9F\x91\xB7\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // construction_worker_woman
+                "\xF0\x9F\xA4\xB4\0" // prince
+                "\xF0\x9F\x91\xB8\0" // princess
+                "\xF0\x9F\x91\xB3\0" // man_with_turban
+                "\xF0\x9F\x91\xB3\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // woman_with_turban
+                "\xF0\x9F\x91\xB2\0" // man_with_gua_pi_mao
+                "\xF0\x9F\xA4\xB5\0" // man_in_tuxedo
+                "\xF0\x9F\x91\xB0\0" // bride_with_veil
+                "\xF0\x9F\xA4\xB0\0" // pregnant_woman
+                "\xF0\x9F\x91\xBC\0" // angel
+                "\xF0\x9F\x8E\x85\0" // santa
+                "\xF0\x9F\xA4\xB6\0" // mrs_claus
+                "\xF0\x9F\x92\x86\0" // massage_woman
+                "\xF0\x9F\x92\x86\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // massage_man
+                "\xF0\x9F\x92\x87\0" // haircut_woman
+                "\xF0\x9F\x92\x87\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // haircut_man
+                "\xF0\x9F\x9A\xB6\0" // walking_man
+                "\xF0\x9F\x9A\xB6\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // walking_woman
+                "\xF0\x9F\x8F\x83\0" // running_man
+                "\xF0\x9F\x8F\x83\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // running_woman
+                "\xF0\x9F\x92\x83\0" // dancer
+                "\xF0\x9F\x95\xBA\0" // man_dancing
+                "\xF0\x9F\x95\xB4\0" // business_suit_levitating
+                "\xF0\x9F\x91\xAF\0" // dancing_women
+                "\xF0\x9F\x91\xAF\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // dancing_men
+                "\xF0\x9F\xA4\xBA\0" // person_fencing
+                "\xF0\x9F\x8F\x87\0" // horse_racing
+                "\xE2\x9B\xB7\0" // skier
+                "\xF0\x9F\x8F\x82\0" // snowboarder
+                "\xF0\x9F\x8F\x8C\0" // golfing_man
+                "\xF0\x9F\x8F\x8C\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // golfing_woman
+                "\xF0\x9F\x8F\x84\0" // surfing_man
+                "\xF0\x9F\x8F\x84\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // surfing_woman
+                "\xF0\x9F\x9A\xA3\0" // rowing_man
+                "\xF0\x9F\x9A\xA3\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // rowing_woman
+                "\xF0\x9F\x8F\x8A\0" // swimming_man
+                "\xF0\x9F\x8F\x8A\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // swimming_woman
+                "\xE2\x9B\xB9\0" // basketball_man
+                "\xE2\x9B\xB9\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // basketball_woman
+                "\xF0\x9F\x8F\x8B\0" // weight_lifting_man
+                "\xF0\x9F\x8F\x8B\xEF\xB8\x8F\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // weight_lifting_woman
+                "\xF0\x9F\x9A\xB4\0" // biking_man
+                "\xF0\x9F\x9A\xB4\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // biking_woman
+                "\xF0\x9F\x9A\xB5\0" // mountain_biking_man
+                "\xF0\x9F\x9A\xB5\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // mountain_biking_woman
+                "\xF0\x9F\xA4\xB8\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // man_cartwheeling
+                "\xF0\x9F\xA4\xB8\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // woman_cartwheeling
+                "\xF0\x9F\xA4\xBC\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // men_wrestling
+                "\xF0\x9F\xA4\xBC\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // women_wrestling
+                "\xF0\x9F\xA4\xBD\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // man_playing_water_polo
+                "\xF0\x9F\xA4\xBD\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // woman_playing_water_polo
+                "\xF0\x9F\xA4\xBE\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // man_playing_handball
+                "\xF0\x9F\xA4\xBE\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // woman_playing_handball
+                "\xF0\x9F\xA4\xB9\xE2\x80\x8D\xE2\x99\x82\xEF\xB8\x8F\0" // man_juggling
+                "\xF0\x9F\xA4\xB9\xE2\x80\x8D\xE2\x99\x80\xEF\xB8\x8F\0" // woman_juggling
+                "\xF0\x9F\x9B\x80\0" // bath
+                "\xF0\x9F\x9B\x8C\0" // sleeping_bed
+                "\xF0\x9F\x91\xAD\0" // two_women_holding_hands
+                "\xF0\x9F\x91\xAB\0" // couple
+                "\xF0\x9F\x91\xAC\0" // two_men_holding_hands
+                "\xF0\x9F\x92\x8F\0" // couplekiss_man_woman
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x92\x8B\xE2\x80\x8D\xF0\x9F\x91\xA8\0" // couplekiss_man_man
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x92\x8B\xE2\x80\x8D\xF0\x9F\x91\xA9\0" // couplekiss_woman_woman
+                "\xF0\x9F\x92\x91\0" // couple_with_heart_woman_man
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x91\xA8\0" // couple_with_heart_man_man
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xE2\x9D\xA4\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x91\xA9\0" // couple_with_heart_woman_woman
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_man_woman_girl
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_man_woman_girl_boy
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_man_woman_boy_boy
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_man_woman_girl_girl
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_man_man_boy
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_man_man_girl
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_man_man_girl_boy
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_man_man_boy_boy
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_man_man_girl_girl
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_woman_woman_boy
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_woman_woman_girl
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_woman_woman_girl_boy
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_woman_woman_boy_boy
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_woman_woman_girl_girl
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_man_boy
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_man_boy_boy
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_man_girl
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_man_girl_boy
+                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_man_girl_girl
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_woman_boy
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA6\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_woman_boy_boy
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_woman_girl
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6\0" // family_woman_girl_boy
+                "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA7\0" // family_woman_girl_girl
+                "\xF0\x9F\x97\xA3\0" // speaking_head
+                "\xF0\x9F\x91\xA4\0" // bust_in_silhouette
+                "\xF0\x9F\x91\xA5\0" // busts_in_silhouette
+                "\xF0\x9F\x91\xAA\0" // family_man_woman_boy
+                "\xF0\x9F\x91\xA3\0" // footprints
+                "\xF0\x9F\x90\xB5\0" // monkey_face
+                "\xF0\x9F\x90\x92\0" // monkey
+                "\xF0\x9F\xA6\x8D\0" // gorilla
+                "\xF0\x9F\x90\xB6\0" // dog
+                "\xF0\x9F\x90\x95\0" // dog2
+                "\xF0\x9F\x90\xA9\0" // poodle
+                "\xF0\x9F\x90\xBA\0" // wolf
+                "\xF0\x9F\xA6\x8A\0" // fox_face
+                "\xF0\x9F\x90\xB1\0" // cat
+                "\xF0\x9F\x90\x88\0" // cat2
+                "\xF0\x9F\xA6\x81\0" // lion
+                "\xF0\x9F\x90\xAF\0" // tiger
+                "\xF0\x9F\x90\x85\0" // tiger2
+                "\xF0\x9F\x90\x86\0" // leopard
+                "\xF0\x9F\x90\xB4\0" // horse
+                "\xF0\x9F\x90\x8E\0" // racehorse
+                "\xF0\x9F\xA6\x84\0" // unicorn
+                "\xF0\x9F\xA6\x8C\0" // deer
+                "\xF0\x9F\x90\xAE\0" // cow
+                "\xF0\x9F\x90\x82\0" // ox
+                "\xF0\x9F\x90\x83\0" // water_buffalo
+                "\xF0\x9F\x90\x84\0" // cow2
+                "\xF0\x9F\x90\xB7\0" // pig
+                "\xF0\x9F\x90\x96\0" // pig2
+                "\xF0\x9F\x90\x97\0" // boar
+                "\xF0\x9F\x90\xBD\0" // pig_nose
+                "\xF0\x9F\x90\x8F\0" // ram
+                "\xF0\x9F\x90\x91\0" // sheep
+                "\xF0\x9F\x90\x90\0" // goat
+                "\xF0\x9F\x90\xAA\0" // dromedary_camel
+                "\xF0\x9F\x90\xAB\0" // camel
+                "\xF0\x9F\x90\x98\0" // elephant
+                "\xF0\x9F\xA6\x8F\0" // rhinoceros
+                "\xF0\x9F\x90\xAD\0" // mouse
+                "\xF0\x9F\x90\x81\0" // mouse2
+                "\xF0\x9F\x90\x80\0" // rat
+                "\xF0\x9F\x90\xB9\0" // hamster
+                "\xF0\x9F\x90\xB0\0" // rabbit
+                "\xF0\x9F\x90\x87\0" // rabbit2
+                "\xF0\x9F\x90\xBF\0" // chipmunk
+                "\xF0\x9F\xA6\x87\0" // bat
+                "\xF0\x9F\x90\xBB\0" // bear
+                "\xF0\x9F\x90\xA8\0" // koala
+                "\xF0\x9F\x90\xBC\0" // panda_face
+                "\xF0\x9F\x90\xBE\0" // paw_prints
+                "\xF0\x9F\xA6\x83\0" // turkey
+                "\xF0\x9F\x90\x94\0" // chicken
+                "\xF0\x9F\x90\x93\0" // rooster
+                "\xF0\x9F\x90\xA3\0" // hatching_chick
+                "\xF0\x9F\x90\xA4\0" // baby_chick
+                "\xF0\x9F\x90\xA5\0" // hatched_chick
+                "\xF0\x9F\x90\xA6\0" // bird
+                "\xF0\x9F\x90\xA7\0" // penguin
+                "\xF0\x9F\x95\x8A\0" // dove
+                "\xF0\x9F\xA6\x85\0" // eagle
+                "\xF0\x9F\xA6\x86\0" // duck
+                "\xF0\x9F\xA6\x89\0" // owl
+                "\xF0\x9F\x90\xB8\0" // frog
+                "\xF0\x9F\x90\x8A\0" // crocodile
+                "\xF0\x9F\x90\xA2\0" // turtle
+                "\xF0\x9F\xA6\x8E\0" // lizard
+                "\xF0\x9F\x90\x8D\0" // snake
+                "\xF0\x9F\x90\xB2\0" // dragon_face
+                "\xF0\x9F\x90\x89\0" // dragon
+                "\xF0\x9F\x90\xB3\0" // whale
+                "\xF0\x9F\x90\x8B\0" // whale2
+                "\xF0\x9F\x90\xAC\0" // dolphin
+                "\xF0\x9F\x90\x9F\0" // fish
+                "\xF0\x9F\x90\xA0\0" // tropical_fish
+                "\xF0\x9F\x90\xA1\0" // blowfish
+                "\xF0\x9F\xA6\x88\0" // shark
+                "\xF0\x9F\x90\x99\0" // octopus
+                "\xF0\x9F\x90\x9A\0" // shell
+                "\xF0\x9F\x90\x8C\0" // snail
+                "\xF0\x9F\xA6\x8B\0" // butterfly
+                "\xF0\x9F\x90\x9B\0" // bug
+                "\xF0\x9F\x90\x9C\0" // ant
+                "\xF0\x9F\x90\x9D\0" // honeybee
+                "\xF0\x9F\x90\x9E\0" // beetle
+                "\xF0\x9F\x95\xB7\0" // spider
+                "\xF0\x9F\x95\xB8\0" // spider_web
+                "\xF0\x9F\xA6\x82\0" // scorpion
+                "\xF0\x9F\x92\x90\0" // bouquet
+                "\xF0\x9F\x8C\xB8\0" // cherry_blossom
+                "\xF0\x9F\x92\xAE\0" // white_flower
+                "\xF0\x9F\x8F\xB5\0" // rosette
+                "\xF0\x9F\x8C\xB9\0" // rose
+                "\xF0\x9F\xA5\x80\0" // wilted_flower
+                "\xF0\x9F\x8C\xBA\0" // hibiscus
+                "\xF0\x9F\x8C\xBB\0" // sunflower
+                "\xF0\x9F\x8C\xBC\0" // blossom
+                "\xF0\x9F\x8C\xB7\0" // tulip
+                "\xF0\x9F\x8C\xB1\0" // seedling
+                "\xF0\x9F\x8C\xB2\0" // evergreen_tree
+                "\xF0\x9F\x8C\xB3\0" // deciduous_tree
+                "\xF0\x9F\x8C\xB4\0" // palm_tree
+                "\xF0\x9F\x8C\xB5\0" // cactus
+                "\xF0\x9F\x8C\xBE\0" // ear_of_rice
+                "\xF0\x9F\x8C\xBF\0" // herb
+                "\xE2\x98\x98\0" // shamrock
+                "\xF0\x9F\x8D\x80\0" // four_leaf_clover
+                "\xF0\x9F\x8D\x81\0" // maple_leaf
+                "\xF0\x9F\x8D\x82\0" // fallen_leaf
+                "\xF0\x9F\x8D\x83\0" // leaves
+                "\xF0\x9F\x8D\x84\0" // mushroom
+                "\xF0\x9F\x8D\x87\0" // grapes
+                "\xF0\x9F\x8D\x88\0" // melon
+                "\xF0\x9F\x8D\x89\0" // watermelon
+                "\xF0\x9F\x8D\x8A\0" // tangerine
+                "\xF0\x9F\x8D\x8B\0" // lemon
+                "\xF0\x9F\x8D\x8C\0" // banana
+                "\xF0\x9F\x8D\x8D\0" // pineapple
+                "\xF0\x9F\x8D\x8E\0" // apple
+                "\xF0\x9F\x8D\x8F\0" // green_apple
+                "\xF0\x9F\x8D\x90\0" // pear
+                "\xF0\x9F\x8D\x91\0" // peach
+                "\xF0\x9F\x8D\x92\0" // cherries
+                "\xF0\x9F\x8D\x93\0" // strawberry
+                "\xF0\x9F\xA5\x9D\0" // kiwi_fruit
+                "\xF0\x9F\x8D\x85\0" // tomato
+                "\xF0\x9F\xA5\x91\0" // avocado
+                "\xF0\x9F\x8D\x86\0" // eggplant
+                "\xF0\x9F\xA5\x94\0" // potato
+                "\xF0\x9F\xA5\x95\0" // carrot
+                "\xF0\x9F\x8C\xBD\0" // corn
+                "\xF0\x9F\x8C\xB6\0" // hot_pepper
+                "\xF0\x9F\xA5\x92\0" // cucumber
+                "\xF0\x9F\xA5\x9C\0" // peanuts
+                "\xF0\x9F\x8C\xB0\0" // chestnut
+                "\xF0\x9F\x8D\x9E\0" // bread
+                "\xF0\x9F\xA5\x90\0" // croissant
+                "\xF0\x9F\xA5\x96\0" // baguette_bread
+                "\xF0\x9F\xA5\x9E\0" // pancakes
+                "\xF0\x9F\xA7\x80\0" // cheese
+                "\xF0\x9F\x8D\x96\0" // meat_on_bone
+                "\xF0\x9F\x8D\x97\0" // poultry_leg
+                "\xF0\x9F\xA5\x93\0" // bacon
+                "\xF0\x9F\x8D\x94\0" // hamburger
+                "\xF0\x9F\x8D\x9F\0" // fries
+                "\xF0\x9F\x8D\x95\0" // pizza
+                "\xF0\x9F\x8C\xAD\0" // hotdog
+                "\xF0\x9F\x8C\xAE\0" // taco
+                "\xF0\x9F\x8C\xAF\0" // burrito
+                "\xF0\x9F\xA5\x99\0" // stuffed_flatbread
+                "\xF0\x9F\xA5\x9A\0" // egg
+                "\xF0\x9F\x8D\xB3\0" // fried_egg
+                "\xF0\x9F\xA5\x98\0" // shallow_pan_of_food
+                "\xF0\x9F\x8D\xB2\0" // stew
+                "\xF0\x9F\xA5\x97\0" // green_salad
+                "\xF0\x9F\x8D\xBF\0" // popcorn
+                "\xF0\x9F\x8D\xB1\0" // bento
+                "\xF0\x9F\x8D\x98\0" // rice_cracker
+                "\xF0\x9F\x8D\x99\0" // rice_ball
+                "\xF0\x9F\x8D\x9A\0" // rice
+                "\xF0\x9F\x8D\x9B\0" // curry
+                "\xF0\x9F\x8D\x9C\0" // ramen
+                "\xF0\x9F\x8D\x9D\0" // spaghetti
+                "\xF0\x9F\x8D\xA0\0" // sweet_potato
+                "\xF0\x9F\x8D\xA2\0" // oden
+                "\xF0\x9F\x8D\xA3\0" // sushi
+                "\xF0\x9F\x8D\xA4\0" // fried_shrimp
+                "\xF0\x9F\x8D\xA5\0" // fish_cake
+                "\xF0\x9F\x8D\xA1\0" // dango
+                "\xF0\x9F\xA6\x80\0" // crab
+                "\xF0\x9F\xA6\x90\0" // shrimp
+                "\xF0\x9F\xA6\x91\0" // squid
+                "\xF0\x9F\x8D\xA6\0" // icecream
+                "\xF0\x9F\x8D\xA7\0" // shaved_ice
+                "\xF0\x9F\x8D\xA8\0" // ice_cream
+                "\xF0\x9F\x8D\xA9\0" // doughnut
+                "\xF0\x9F\x8D\xAA\0" // cookie
+                "\xF0\x9F\x8E\x82\0" // birthday
+                "\xF0\x9F\x8D\xB0\0" // cake
+                "\xF0\x9F\x8D\xAB\0" // chocolate_bar
+                "\xF0\x9F\x8D\xAC\0" // candy
+                "\xF0\x9F\x8D\xAD\0" // lollipop
+                "\xF0\x9F\x8D\xAE\0" // custard
+                "\xF0\x9F\x8D\xAF\0" // honey_pot
+                "\xF0\x9F\x8D\xBC\0" // baby_bottle
+                "\xF0\x9F\xA5\x9B\0" // milk_glass
+                "\xE2\x98\x95\0" // coffee
+                "\xF0\x9F\x8D\xB5\0" // tea
+                "\xF0\x9F\x8D\xB6\0" // sake
+                "\xF0\x9F\x8D\xBE\0" // champagne
+                "\xF0\x9F\x8D\xB7\0" // wine_glass
+                "\xF0\x9F\x8D\xB8\0" // cocktail
+                "\xF0\x9F\x8D\xB9\0" // tropical_drink
+                "\xF0\x9F\x8D\xBA\0" // beer
+                "\xF0\x9F\x8D\xBB\0" // beers
+                "\xF0\x9F\xA5\x82\0" // clinking_glasses
+                "\xF0\x9F\xA5\x83\0" // tumbler_glass
+                "\xF0\x9F\x8D\xBD\0" // plate_with_cutlery
+                "\xF0\x9F\x8D\xB4\0" // fork_and_knife
+                "\xF0\x9F\xA5\x84\0" // spoon
+                "\xF0\x9F\x94\xAA\0" // hocho
+                "\xF0\x9F\x8F\xBA\0" // amphora
+                "\xF0\x9F\x8C\x8D\0" // earth_africa
+                "\xF0\x9F\x8C\x8E\0" // earth_americas
+                "\xF0\x9F\x8C\x8F\0" // earth_asia
+                "\xF0\x9F\x8C\x90\0" // globe_with_meridians
+                "\xF0\x9F\x97\xBA\0" // world_map
+                "\xF0\x9F\x97\xBE\0" // japan
+                "\xF0\x9F\x8F\x94\0" // mountain_snow
+                "\xE2\x9B\xB0\0" // mountain
+                "\xF0\x9F\x8C\x8B\0" // volcano
+                "\xF0\x9F\x97\xBB\0" // mount_fuji
+                "\xF0\x9F\x8F\x95\0" // camping
+                "\xF0\x9F\x8F\x96\0" // beach_umbrella
+                "\xF0\x9F\x8F\x9C\0" // desert
+                "\xF0\x9F\x8F\x9D\0" // desert_island
+                "\xF0\x9F\x8F\x9E\0" // national_park
+                "\xF0\x9F\x8F\x9F\0" // stadium
+                "\xF0\x9F\x8F\x9B\0" // classical_building
+                "\xF0\x9F\x8F\x97\0" // building_construction
+                "\xF0\x9F\x8F\x98\0" // houses
+                "\xF0\x9F\x8F\x9A\0" // derelict_house
+                "\xF0\x9F\x8F\xA0\0" // house
+                "\xF0\x9F\x8F\xA1\0" // house_with_garden
+                "\xF0\x9F\x8F\xA2\0" // office
+                "\xF0\x9F\x8F\xA3\0" // post_office
+                "\xF0\x9F\x8F\xA4\0" // european_post_office
+                "\xF0\x9F\x8F\xA5\0" // hospital
+                "\xF0\x9F\x8F\xA6\0" // bank
+                "\xF0\x9F\x8F\xA8\0" // hotel
+                "\xF0\x9F\x8F\xA9\0" // love_hotel
+                "\xF0\x9F\x8F\xAA\0" // convenience_store
+                "\xF0\x9F\x8F\xAB\0" // school
+                "\xF0\x9F\x8F\xAC\0" // department_store
+                "\xF0\x9F\x8F\xAD\0" // factory
+                "\xF0\x9F\x8F\xAF\0" // japanese_castle
+                "\xF0\x9F\x8F\xB0\0" // european_castle
+                "\xF0\x9F\x92\x92\0" // wedding
+                "\xF0\x9F\x97\xBC\0" // tokyo_tower
+                "\xF0\x9F\x97\xBD\0" // statue_of_liberty
+                "\xE2\x9B\xAA\0" // church
+                "\xF0\x9F\x95\x8C\0" // mosque
+                "\xF0\x9F\x95\x8D\0" // synagogue
+                "\xE2\x9B\xA9\0" // shinto_shrine
+                "\xF0\x9F\x95\x8B\0" // kaaba
+                "\xE2\x9B\xB2\0" // fountain
+                "\xE2\x9B\xBA\0" // tent
+                "\xF0\x9F\x8C\x81\0" // foggy
+                "\xF0\x9F\x8C\x83\0" // night_with_stars
+                "\xF0\x9F\x8F\x99\0" // cityscape
+                "\xF0\x9F\x8C\x84\0" // sunrise_over_mountains
+                "\xF0\x9F\x8C\x85\0" // sunrise
+                "\xF0\x9F\x8C\x86\0" // city_sunset
+                "\xF0\x9F\x8C\x87\0" // city_sunrise
+                "\xF0\x9F\x8C\x89\0" // bridge_at_night
+                "\xE2\x99\xA8\xEF\xB8\x8F\0" // hotsprings
+                "\xF0\x9F\x8E\xA0\0" // carousel_horse
+                "\xF0\x9F\x8E\xA1\0" // ferris_wheel
+                "\xF0\x9F\x8E\xA2\0" // roller_coaster
+                "\xF0\x9F\x92\x88\0" // barber
+                "\xF0\x9F\x8E\xAA\0" // circus_tent
+                "\xF0\x9F\x9A\x82\0" // steam_locomotive
+                "\xF0\x9F\x9A\x83\0" // railway_car
+                "\xF0\x9F\x9A\x84\0" // bullettrain_side
+                "\xF0\x9F\x9A\x85\0" // bullettrain_front
+                "\xF0\x9F\x9A\x86\0" // train2
+                "\xF0\x9F\x9A\x87\0" // metro
+                "\xF0\x9F\x9A\x88\0" // light_rail
+                "\xF0\x9F\x9A\x89\0" // station
+                "\xF0\x9F\x9A\x8A\0" // tram
+                "\xF0\x9F\x9A\x9D\0" // monorail
+                "\xF0\x9F\x9A\x9E\0" // mountain_railway
+                "\xF0\x9F\x9A\x8B\0" // train
+                "\xF0\x9F\x9A\x8C\0" // bus
+                "\xF0\x9F\x9A\x8D\0" // oncoming_bus
+                "\xF0\x9F\x9A\x8E\0" // trolleybus
+                "\xF0\x9F\x9A\x90\0" // minibus
+                "\xF0\x9F\x9A\x91\0" // ambulance
+                "\xF0\x9F\x9A\x92\0" // fire_engine
+                "\xF0\x9F\x9A\x93\0" // police_car
+                "\xF0\x9F\x9A\x94\0" // oncoming_police_car
+                "\xF0\x9F\x9A\x95\0" // taxi
+                "\xF0\x9F\x9A\x96\0" // oncoming_taxi
+                "\xF0\x9F\x9A\x97\0" // red_car
+                "\xF0\x9F\x9A\x98\0" // oncoming_automobile
+                "\xF0\x9F\x9A\x99\0" // blue_car
+                "\xF0\x9F\x9A\x9A\0" // truck
+                "\xF0\x9F\x9A\x9B\0" // articulated_lorry
+                "\xF0\x9F\x9A\x9C\0" // tractor
+                "\xF0\x9F\x8F\x8E\0" // racing_car
+                "\xF0\x9F\x8F\x8D\0" // motorcycle
+                "\xF0\x9F\x9B\xB5\0" // motor_scooter
+                "\xF0\x9F\x9A\xB2\0" // bike
+                "\xF0\x9F\x9B\xB4\0" // kick_scooter
+                "\xF0\x9F\x9A\x8F\0" // busstop
+                "\xF0\x9F\x9B\xA3\0" // motorway
+                "\xF0\x9F\x9B\xA4\0" // railway_track
+                "\xF0\x9F\x9B\xA2\0" // oil_drum
+                "\xE2\x9B\xBD\0" // fuelpump
+                "\xF0\x9F\x9A\xA8\0" // rotating_light
+                "\xF0\x9F\x9A\xA5\0" // traffic_light
+                "\xF0\x9F\x9A\xA6\0" // vertical_traffic_light
+                "\xF0\x9F\x9B\x91\0" // stop_sign
+                "\xF0\x9F\x9A\xA7\0" // construction
+                "\xE2\x9A\x93\0" // anchor
+                "\xE2\x9B\xB5\0" // sailboat
+                "\xF0\x9F\x9B\xB6\0" // canoe
+                "\xF0\x9F\x9A\xA4\0" // speedboat
+                "\xF0\x9F\x9B\xB3\0" // passenger_ship
+                "\xE2\x9B\xB4\0" // ferry
+                "\xF0\x9F\x9B\xA5\0" // motor_boat
+                "\xF0\x9F\x9A\xA2\0" // ship
+                "\xE2\x9C\x88\xEF\xB8\x8F\0" // airplane
+                "\xF0\x9F\x9B\xA9\0" // small_airplane
+                "\xF0\x9F\x9B\xAB\0" // flight_departure
+                "\xF0\x9F\x9B\xAC\0" // flight_arrival
+                "\xF0\x9F\x92\xBA\0" // seat
+                "\xF0\x9F\x9A\x81\0" // helicopter
+                "\xF0\x9F\x9A\x9F\0" // suspension_railway
+                "\xF0\x9F\x9A\xA0\0" // mountain_cableway
+                "\xF0\x9F\x9A\xA1\0" // aerial_tramway
+                "\xF0\x9F\x9B\xB0\0" // artificial_satellite
+                "\xF0\x9F\x9A\x80\0" // rocket
+                "\xF0\x9F\x9B\x8E\0" // bellhop_bell
+                "\xE2\x8C\x9B\0" // hourglass
+                "\xE2\x8F\xB3\0" // hourglass_flowing_sand
+                "\xE2\x8C\x9A\0" // watch
+                "\xE2\x8F\xB0\0" // alarm_clock
+                "\xE2\x8F\xB1\0" // stopwatch
+                "\xE2\x8F\xB2\0" // timer_clock
+                "\xF0\x9F\x95\xB0\0" // mantelpiece_clock
+                "\xF0\x9F\x95\x9B\0" // clock12
+                "\xF0\x9F\x95\xA7\0" // clock1230
+                "\xF0\x9F\x95\x90\0" // clock1
+                "\xF0\x9F\x95\x9C\0" // clock130
+                "\xF0\x9F\x95\x91\0" // clock2
+                "\xF0\x9F\x95\x9D\0" // clock230
+                "\xF0\x9F\x95\x92\0" // clock3
+                "\xF0\x9F\x95\x9E\0" // clock330
+                "\xF0\x9F\x95\x93\0" // clock4
+                "\xF0\x9F\x95\x9F\0" // clock430
+                "\xF0\x9F\x95\x94\0" // clock5
+                "\xF0\x9F\x95\xA0\0" // clock530
+                "\xF0\x9F\x95\x95\0" // clock6
+                "\xF0\x9F\x95\xA1\0" // clock630
+                "\xF0\x9F\x95\x96\0" // clock7
+                "\xF0\x9F\x95\xA2\0" // clock730
+                "\xF0\x9F\x95\x97\0" // clock8
+                "\xF0\x9F\x95\xA3\0" // clock830
+                "\xF0\x9F\x95\x98\0" // clock9
+                "\xF0\x9F\x95\xA4\0" // clock930
+                "\xF0\x9F\x95\x99\0" // clock10
+                "\xF0\x9F\x95\xA5\0" // clock1030
+                "\xF0\x9F\x95\x9A\0" // clock11
+                "\xF0\x9F\x95\xA6\0" // clock1130
+                "\xF0\x9F\x8C\x91\0" // new_moon
+                "\xF0\x9F\x8C\x92\0" // waxing_crescent_moon
+                "\xF0\x9F\x8C\x93\0" // first_quarter_moon
+                "\xF0\x9F\x8C\x94\0" // waxing_gibbous_moon
+                "\xF0\x9F\x8C\x95\0" // full_moon
+                "\xF0\x9F\x8C\x96\0" // waning_gibbous_moon
+                "\xF0\x9F\x8C\x97\0" // last_quarter_moon
+                "\xF0\x9F\x8C\x98\0" // waning_crescent_moon
+                "\xF0\x9F\x8C\x99\0" // crescent_moon
+                "\xF0\x9F\x8C\x9A\0" // new_moon_with_face
+                "\xF0\x9F\x8C\x9B\0" // first_quarter_moon_with_face
+                "\xF0\x9F\x8C\x9C\0" // last_quarter_moon_with_face
+                "\xF0\x9F\x8C\xA1\0" // thermometer
+                "\xE2\x98\x80\xEF\xB8\x8F\0" // sunny
+                "\xF0\x9F\x8C\x9D\0" // full_moon_with_face
+                "\xF0\x9F\x8C\x9E\0" // sun_with_face
+                "\xE2\xAD\x90\0" // star
+                "\xF0\x9F\x8C\x9F\0" // star2
+                "\xF0\x9F\x8C\xA0\0" // stars
+                "\xF0\x9F\x8C\x8C\0" // milky_way
+                "\xE2\x98\x81\xEF\xB8\x8F\0" // cloud
+                "\xE2\x9B\x85\0" // partly_sunny
+                "\xE2\x9B\x88\0" // cloud_with_lightning_and_rain
+                "\xF0\x9F\x8C\xA4\0" // sun_behind_small_cloud
+                "\xF0\x9F\x8C\xA5\0" // sun_behind_large_cloud
+                "\xF0\x9F\x8C\xA6\0" // sun_behind_rain_cloud
+                "\xF0\x9F\x8C\xA7\0" // cloud_with_rain
+                "\xF0\x9F\x8C\xA8\0" // cloud_with_snow
+                "\xF0\x9F\x8C\xA9\0" // cloud_with_lightning
+                "\xF0\x9F\x8C\xAA\0" // tornado
+                "\xF0\x9F\x8C\xAB\0" // fog
+                "\xF0\x9F\x8C\xAC\0" // wind_face
+                "\xF0\x9F\x8C\x80\0" // cyclone
+                "\xF0\x9F\x8C\x88\0" // rainbow
+                "\xF0\x9F\x8C\x82\0" // closed_umbrella
+                "\xE2\x98\x82\0" // open_umbrella
+                "\xE2\x98\x94\0" // umbrella
+                "\xE2\x9B\xB1\0" // parasol_on_ground
+                "\xE2\x9A\xA1\0" // zap
+                "\xE2\x9D\x84\xEF\xB8\x8F\0" // snowflake
+                "\xE2\x98\x83\0" // snowman_with_snow
+                "\xE2\x9B\x84\0" // snowman
+                "\xE2\x98\x84\0" // comet
+                "\xF0\x9F\x94\xA5\0" // fire
+                "\xF0\x9F\x92\xA7\0" // droplet
+                "\xF0\x9F\x8C\x8A\0" // ocean
+                "\xF0\x9F\x8E\x83\0" // jack_o_lantern
+                "\xF0\x9F\x8E\x84\0" // christmas_tree
+                "\xF0\x9F\x8E\x86\0" // fireworks
+                "\xF0\x9F\x8E\x87\0" // sparkler
+                "\xE2\x9C\xA8\0" // sparkles
+                "\xF0\x9F\x8E\x88\0" // balloon
+                "\xF0\x9F\x8E\x89\0" // tada
+                "\xF0\x9F\x8E\x8A\0" // confetti_ball
+                "\xF0\x9F\x8E\x8B\0" // tanabata_tree
+                "\xF0\x9F\x8E\x8D\0" // bamboo
+                "\xF0\x9F\x8E\x8E\0" // dolls
+                "\xF0\x9F\x8E\x8F\0" // flags
+                "\xF0\x9F\x8E\x90\0" // wind_chime
+                "\xF0\x9F\x8E\x91\0" // rice_scene
+                "\xF0\x9F\x8E\x80\0" // ribbon
+                "\xF0\x9F\x8E\x81\0" // gift
+                "\xF0\x9F\x8E\x97\0" // reminder_ribbon
+                "\xF0\x9F\x8E\x9F\0" // tickets
+                "\xF0\x9F\x8E\xAB\0" // ticket
+                "\xF0\x9F\x8E\x96\0" // medal_military
+                "\xF0\x9F\x8F\x86\0" // trophy
+                "\xF0\x9F\x8F\x85\0" // medal_sports
+                "\xF0\x9F\xA5\x87\0" // first_place_medal
+                "\xF0\x9F\xA5\x88\0" // second_place_medal
+                "\xF0\x9F\xA5\x89\0" // third_place_medal
+                "\xE2\x9A\xBD\0" // soccer
+                "\xE2\x9A\xBE\0" // baseball
+                "\xF0\x9F\x8F\x80\0" // basketball
+                "\xF0\x9F\x8F\x90\0" // volleyball
+                "\xF0\x9F\x8F\x88\0" // football
+                "\xF0\x9F\x8F\x89\0" // rugby_football
+                "\xF0\x9F\x8E\xBE\0" // tennis
+                "\xF0\x9F\x8E\xB3\0" // bowling
+                "\xF0\x9F\x8F\x8F\0" // cricket
+                "\xF0\x9F\x8F\x91\0" // field_hockey
+                "\xF0\x9F\x8F\x92\0" // ice_hockey
+                "\xF0\x9F\x8F\x93\0" // ping_pong
+                "\xF0\x9F\x8F\xB8\0" // badminton
+                "\xF0\x9F\xA5\x8A\0" // boxing_glove
+                "\xF0\x9F\xA5\x8B\0" // martial_arts_uniform
+                "\xF0\x9F\xA5\x85\0" // goal_net
+                "\xE2\x9B\xB3\0" // golf
+                "\xE2\x9B\xB8\0" // ice_skate
+                "\xF0\x9F\x8E\xA3\0" // fishing_pole_and_fish
+                "\xF0\x9F\x8E\xBD\0" // running_shirt_with_sash
+                "\xF0\x9F\x8E\xBF\0" // ski
+                "\xF0\x9F\x8E\xAF\0" // dart
+                "\xF0\x9F\x94\xAB\0" // gun
+                "\xF0\x9F\x8E\xB1\0" // eight_ball
+                "\xF0\x9F\x94\xAE\0" // crystal_ball
+                "\xF0\x9F\x8E\xAE\0" // video_game
+                "\xF0\x9F\x95\xB9\0" // joystick
+                "\xF0\x9F\x8E\xB0\0" // slot_machine
+                "\xF0\x9F\x8E\xB2\0" // game_die
+                "\xE2\x99\xA0\xEF\xB8\x8F\0" // spades
+                "\xE2\x99\xA5\xEF\xB8\x8F\0" // hearts
+                "\xE2\x99\xA6\xEF\xB8\x8F\0" // diamonds
+                "\xE2\x99\xA3\xEF\xB8\x8F\0" // clubs
+                "\xF0\x9F\x83\x8F\0" // black_joker
+                "\xF0\x9F\x80\x84\0" // mahjong
+                "\xF0\x9F\x8E\xB4\0" // flower_playing_cards
+                "\xF0\x9F\x8E\xAD\0" // performing_arts
+                "\xF0\x9F\x96\xBC\0" // framed_picture
+                "\xF0\x9F\x8E\xA8\0" // art
+                "\xF0\x9F\x91\x93\0" // eyeglasses
+                "\xF0\x9F\x95\xB6\0" // dark_sunglasses
+                "\xF0\x9F\x91\x94\0" // necktie
+                "\xF0\x9F\x91\x95\0" // tshirt
+                "\xF0\x9F\x91\x96\0" // jeans
+                "\xF0\x9F\x91\x97\0" // dress
+                "\xF0\x9F\x91\x98\0" // kimono
+                "\xF0\x9F\x91\x99\0" // bikini
+                "\xF0\x9F\x91\x9A\0" // womans_clothes
+                "\xF0\x9F\x91\x9B\0" // purse
+                "\xF0\x9F\x91\x9C\0" // handbag
+                "\xF0\x9F\x91\x9D\0" // pouch
+                "\xF0\x9F\x9B\x8D\0" // shopping
+                "\xF0\x9F\x8E\x92\0" // school_satchel
+                "\xF0\x9F\x91\x9E\0" // mans_shoe
+                "\xF0\x9F\x91\x9F\0" // athletic_shoe
+                "\xF0\x9F\x91\xA0\0" // high_heel
+                "\xF0\x9F\x91\xA1\0" // sandal
+                "\xF0\x9F\x91\xA2\0" // boot
+                "\xF0\x9F\x91\x91\0" // crown
+                "\xF0\x9F\x91\x92\0" // womans_hat
+                "\xF0\x9F\x8E\xA9\0" // tophat
+                "\xF0\x9F\x8E\x93\0" // mortar_board
+                "\xE2\x9B\x91\0" // rescue_worker_helmet
+                "\xF0\x9F\x93\xBF\0" // prayer_beads
+                "\xF0\x9F\x92\x84\0" // lipstick
+                "\xF0\x9F\x92\x8D\0" // ring
+                "\xF0\x9F\x92\x8E\0" // gem
+                "\xF0\x9F\x94\x87\0" // mute
+                "\xF0\x9F\x94\x88\0" // speaker
+                "\xF0\x9F\x94\x89\0" // sound
+                "\xF0\x9F\x94\x8A\0" // loud_sound
+                "\xF0\x9F\x93\xA2\0" // loudspeaker
+                "\xF0\x9F\x93\xA3\0" // mega
+                "\xF0\x9F\x93\xAF\0" // postal_horn
+                "\xF0\x9F\x94\x94\0" // bell
+                "\xF0\x9F\x94\x95\0" // no_bell
+                "\xF0\x9F\x8E\xBC\0" // musical_score
+                "\xF0\x9F\x8E\xB5\0" // musical_note
+                "\xF0\x9F\x8E\xB6\0" // notes
+                "\xF0\x9F\x8E\x99\0" // studio_microphone
+                "\xF0\x9F\x8E\x9A\0" // level_slider
+                "\xF0\x9F\x8E\x9B\0" // control_knobs
+                "\xF0\x9F\x8E\xA4\0" // microphone
+                "\xF0\x9F\x8E\xA7\0" // headphones
+                "\xF0\x9F\x93\xBB\0" // radio
+                "\xF0\x9F\x8E\xB7\0" // saxophone
+                "\xF0\x9F\x8E\xB8\0" // guitar
+                "\xF0\x9F\x8E\xB9\0" // musical_keyboard
+                "\xF0\x9F\x8E\xBA\0" // trumpet
+                "\xF0\x9F\x8E\xBB\0" // violin
+                "\xF0\x9F\xA5\x81\0" // drum
+                "\xF0\x9F\x93\xB1\0" // iphone
+                "\xF0\x9F\x93\xB2\0" // calling
+                "\xE2\x98\x8E\xEF\xB8\x8F\0" // phone
+                "\xF0\x9F\x93\x9E\0" // telephone_receiver
+                "\xF0\x9F\x93\x9F\0" // pager
+                "\xF0\x9F\x93\xA0\0" // fax
+                "\xF0\x9F\x94\x8B\0" // battery
+                "\xF0\x9F\x94\x8C\0" // electric_plug
+                "\xF0\x9F\x92\xBB\0" // computer
+                "\xF0\x9F\x96\xA5\0" // desktop_computer
+                "\xF0\x9F\x96\xA8\0" // printer
+                "\xE2\x8C\xA8\0" // keyboard
+                "\xF0\x9F\x96\xB1\0" // computer_mouse
+                "\xF0\x9F\x96\xB2\0" // trackball
+                "\xF0\x9F\x92\xBD\0" // minidisc
+                "\xF0\x9F\x92\xBE\0" // floppy_disk
+                "\xF0\x9F\x92\xBF\0" // cd
+                "\xF0\x9F\x93\x80\0" // dvd
+                "\xF0\x9F\x8E\xA5\0" // movie_camera
+                "\xF0\x9F\x8E\x9E\0" // film_strip
+                "\xF0\x9F\x93\xBD\0" // film_projector
+                "\xF0\x9F\x8E\xAC\0" // clapper
+                "\xF0\x9F\x93\xBA\0" // tv
+                "\xF0\x9F\x93\xB7\0" // camera
+                "\xF0\x9F\x93\xB8\0" // camera_flash
+                "\xF0\x9F\x93\xB9\0" // video_camera
+                "\xF0\x9F\x93\xBC\0" // vhs
+                "\xF0\x9F\x94\x8D\0" // mag
+                "\xF0\x9F\x94\x8E\0" // mag_right
+                "\xF0\x9F\x95\xAF\0" // candle
+                "\xF0\x9F\x92\xA1\0" // bulb
+                "\xF0\x9F\x94\xA6\0" // flashlight
+                "\xF0\x9F\x8F\xAE\0" // izakaya_lantern
+                "\xF0\x9F\x93\x94\0" // notebook_with_decorative_cover
+                "\xF0\x9F\x93\x95\0" // closed_book
+                "\xF0\x9F\x93\x96\0" // open_book
+                "\xF0\x9F\x93\x97\0" // green_book
+                "\xF0\x9F\x93\x98\0" // blue_book
+                "\xF0\x9F\x93\x99\0" // orange_book
+                "\xF0\x9F\x93\x9A\0" // books
+                "\xF0\x9F\x93\x93\0" // notebook
+                "\xF0\x9F\x93\x92\0" // ledger
+                "\xF0\x9F\x93\x83\0" // page_with_curl
+                "\xF0\x9F\x93\x9C\0" // scroll
+                "\xF0\x9F\x93\x84\0" // page_facing_up
+                "\xF0\x9F\x93\xB0\0" // newspaper
+                "\xF0\x9F\x97\x9E\0" // newspaper_roll
+                "\xF0\x9F\x93\x91\0" // bookmark_tabs
+                "\xF0\x9F\x94\x96\0" // bookmark
+                "\xF0\x9F\x8F\xB7\0" // label
+                "\xF0\x9F\x92\xB0\0" // moneybag
+                "\xF0\x9F\x92\xB4\0" // yen
+                "\xF0\x9F\x92\xB5\0" // dollar
+                "\xF0\x9F\x92\xB6\0" // euro
+                "\xF0\x9F\x92\xB7\0" // pound
+                "\xF0\x9F\x92\xB8\0" // money_with_wings
+                "\xF0\x9F\x92\xB3\0" // credit_card
+                "\xF0\x9F\x92\xB9\0" // chart
+                "\xE2\x9C\x89\xEF\xB8\x8F\0" // email
+                "\xF0\x9F\x93\xA7\0" // e_mail
+                "\xF0\x9F\x93\xA8\0" // incoming_envelope
+                "\xF0\x9F\x93\xA9\0" // envelope_with_arrow
+                "\xF0\x9F\x93\xA4\0" // outbox_tray
+                "\xF0\x9F\x93\xA5\0" // inbox_tray
+                "\xF0\x9F\x93\xA6\0" // package
+                "\xF0\x9F\x93\xAB\0" // mailbox
+                "\xF0\x9F\x93\xAA\0" // mailbox_closed
+                "\xF0\x9F\x93\xAC\0" // mailbox_with_mail
+                "\xF0\x9F\x93\xAD\0" // mailbox_with_no_mail
+                "\xF0\x9F\x93\xAE\0" // postbox
+                "\xF0\x9F\x97\xB3\0" // ballot_box
+                "\xE2\x9C\x8F\xEF\xB8\x8F\0" // pencil2
+                "\xE2\x9C\x92\xEF\xB8\x8F\0" // black_nib
+                "\xF0\x9F\x96\x8B\0" // fountain_pen
+                "\xF0\x9F\x96\x8A\0" // pen
+                "\xF0\x9F\x96\x8C\0" // paintbrush
+                "\xF0\x9F\x96\x8D\0" // crayon
+                "\xF0\x9F\x93\x9D\0" // memo
+                "\xF0\x9F\x92\xBC\0" // briefcase
+                "\xF0\x9F\x93\x81\0" // file_folder
+                "\xF0\x9F\x93\x82\0" // open_file_folder
+                "\xF0\x9F\x97\x82\0" // card_index_dividers
+                "\xF0\x9F\x93\x85\0" // date
+                "\xF0\x9F\x93\x86\0" // calendar
+                "\xF0\x9F\x97\x92\0" // spiral_notepad
+                "\xF0\x9F\x97\x93\0" // spiral_calendar
+                "\xF0\x9F\x93\x87\0" // card_index
+                "\xF0\x9F\x93\x88\0" // chart_with_upwards_trend
+                "\xF0\x9F\x93\x89\0" // chart_with_downwards_trend
+                "\xF0\x9F\x93\x8A\0" // bar_chart
+                "\xF0\x9F\x93\x8B\0" // clipboard
+                "\xF0\x9F\x93\x8C\0" // pushpin
+                "\xF0\x9F\x93\x8D\0" // round_pushpin
+                "\xF0\x9F\x93\x8E\0" // paperclip
+                "\xF0\x9F\x96\x87\0" // paperclips
+                "\xF0\x9F\x93\x8F\0" // straight_ruler
+                "\xF0\x9F\x93\x90\0" // triangular_ruler
+                "\xE2\x9C\x82\xEF\xB8\x8F\0" // scissors
+                "\xF0\x9F\x97\x83\0" // card_file_box
+                "\xF0\x9F\x97\x84\0" // file_cabinet
+                "\xF0\x9F\x97\x91\0" // wastebasket
+                "\xF0\x9F\x94\x92\0" // lock
+                "\xF0\x9F\x94\x93\0" // unlock
+                "\xF0\x9F\x94\x8F\0" // lock_with_ink_pen
+                "\xF0\x9F\x94\x90\0" // closed_lock_with_key
+                "\xF0\x9F\x94\x91\0" // key
+                "\xF0\x9F\x97\x9D\0" // old_key
+                "\xF0\x9F\x94\xA8\0" // hammer
+                "\xE2\x9B\x8F\0" // pick
+                "\xE2\x9A\x92\0" // hammer_and_pick
+                "\xF0\x9F\x9B\xA0\0" // hammer_and_wrench
+                "\xF0\x9F\x97\xA1\0" // dagger
+                "\xE2\x9A\x94\0" // crossed_swords
+                "\xF0\x9F\x92\xA3\0" // bomb
+                "\xF0\x9F\x8F\xB9\0" // bow_and_arrow
+                "\xF0\x9F\x9B\xA1\0" // shield
+                "\xF0\x9F\x94\xA7\0" // wrench
+                "\xF0\x9F\x94\xA9\0" // nut_and_bolt
+                "\xE2\x9A\x99\0" // gear
+                "\xF0\x9F\x97\x9C\0" // clamp
+                "\xE2\x9A\x96\0" // balance_scale
+                "\xF0\x9F\x94\x97\0" // link
+                "\xE2\x9B\x93\0" // chains
+                "\xE2\x9A\x97\0" // alembic
+                "\xF0\x9F\x94\xAC\0" // microscope
+                "\xF0\x9F\x94\xAD\0" // telescope
+                "\xF0\x9F\x93\xA1\0" // satellite
+                "\xF0\x9F\x92\x89\0" // syringe
+                "\xF0\x9F\x92\x8A\0" // pill
+                "\xF0\x9F\x9A\xAA\0" // door
+                "\xF0\x9F\x9B\x8F\0" // bed
+                "\xF0\x9F\x9B\x8B\0" // couch_and_lamp
+                "\xF0\x9F\x9A\xBD\0" // toilet
+                "\xF0\x9F\x9A\xBF\0" // shower
+                "\xF0\x9F\x9B\x81\0" // bathtub
+                "\xF0\x9F\x9B\x92\0" // shopping_cart
+                "\xF0\x9F\x9A\xAC\0" // smoking
+                "\xE2\x9A\xB0\0" // coffin
+                "\xE2\x9A\xB1\0" // funeral_urn
+                "\xF0\x9F\x97\xBF\0" // moyai
+                "\xF0\x9F\x8F\xA7\0" // atm
+                "\xF0\x9F\x9A\xAE\0" // put_litter_in_its_place
+                "\xF0\x9F\x9A\xB0\0" // potable_water
+                "\xE2\x99\xBF\0" // wheelchair
+                "\xF0\x9F\x9A\xB9\0" // mens
+                "\xF0\x9F\x9A\xBA\0" // womens
+                "\xF0\x9F\x9A\xBB\0" // restroom
+                "\xF0\x9F\x9A\xBC\0" // baby_symbol
+                "\xF0\x9F\x9A\xBE\0" // wc
+                "\xF0\x9F\x9B\x82\0" // passport_control
+                "\xF0\x9F\x9B\x83\0" // customs
+                "\xF0\x9F\x9B\x84\0" // baggage_claim
+                "\xF0\x9F\x9B\x85\0" // left_luggage
+                "\xE2\x9A\xA0\xEF\xB8\x8F\0" // warning
+                "\xF0\x9F\x9A\xB8\0" // children_crossing
+                "\xE2\x9B\x94\0" // no_entry
+                "\xF0\x9F\x9A\xAB\0" // no_entry_sign
+                "\xF0\x9F\x9A\xB3\0" // no_bicycles
+                "\xF0\x9F\x9A\xAD\0" // no_smoking
+                "\xF0\x9F\x9A\xAF\0" // do_not_litter
+                "\xF0\x9F\x9A\xB1\0" // non_potable_water
+                "\xF0\x9F\x9A\xB7\0" // no_pedestrians
+                "\xF0\x9F\x93\xB5\0" // no_mobile_phones
+                "\xF0\x9F\x94\x9E\0" // underage
+                "\xE2\x98\xA2\0" // radioactive
+                "\xE2\x98\xA3\0" // biohazard
+                "\xE2\xAC\x86\xEF\xB8\x8F\0" // arrow_up
+                "\xE2\x86\x97\xEF\xB8\x8F\0" // arrow_upper_right
+                "\xE2\x9E\xA1\xEF\xB8\x8F\0" // arrow_right
+                "\xE2\x86\x98\xEF\xB8\x8F\0" // arrow_lower_right
+                "\xE2\xAC\x87\xEF\xB8\x8F\0" // arrow_down
+                "\xE2\x86\x99\xEF\xB8\x8F\0" // arrow_lower_left
+                "\xE2\xAC\x85\xEF\xB8\x8F\0" // arrow_left
+                "\xE2\x86\x96\xEF\xB8\x8F\0" // arrow_upper_left
+                "\xE2\x86\x95\xEF\xB8\x8F\0" // arrow_up_down
+                "\xE2\x86\x94\xEF\xB8\x8F\0" // left_right_arrow
+                "\xE2\x86\xA9\xEF\xB8\x8F\0" // leftwards_arrow_with_hook
+                "\xE2\x86\xAA\xEF\xB8\x8F\0" // arrow_right_hook
+                "\xE2\xA4\xB4\xEF\xB8\x8F\0" // arrow_heading_up
+                "\xE2\xA4\xB5\xEF\xB8\x8F\0" // arrow_heading_down
+                "\xF0\x9F\x94\x83\0" // arrows_clockwise
+                "\xF0\x9F\x94\x84\0" // arrows_counterclockwise
+                "\xF0\x9F\x94\x99\0" // back
+                "\xF0\x9F\x94\x9A\0" // end
+                "\xF0\x9F\x94\x9B\0" // on
+                "\xF0\x9F\x94\x9C\0" // soon
+                "\xF0\x9F\x94\x9D\0" // top
+                "\xF0\x9F\x9B\x90\0" // place_of_worship
+                "\xE2\x9A\x9B\0" // atom_symbol
+                "\xF0\x9F\x95\x89\0" // om
+                "\xE2\x9C\xA1\0" // star_of_david
+                "\xE2\x98\xB8\0" // wheel_of_dharma
+                "\xE2\x98\xAF\0" // yin_yang
+                "\xE2\x9C\x9D\0" // latin_cross
+                "\xE2\x98\xA6\0" // orthodox_cross
+                "\xE2\x98\xAA\0" // star_and_crescent
+                "\xE2\x98\xAE\0" // peace_symbol
+                "\xF0\x9F\x95\x8E\0" // menorah
+                "\xF0\x9F\x94\xAF\0" // six_pointed_star
+                "\xE2\x99\x88\0" // aries
+                "\xE2\x99\x89\0" // taurus
+                "\xE2\x99\x8A\0" // gemini
+                "\xE2\x99\x8B\0" // cancer
+                "\xE2\x99\x8C\0" // leo
+                "\xE2\x99\x8D\0" // virgo
+                "\xE2\x99\x8E\0" // libra
+                "\xE2\x99\x8F\0" // scorpius
+                "\xE2\x99\x90\0" // sagittarius
+                "\xE2\x99\x91\0" // capricorn
+                "\xE2\x99\x92\0" // aquarius
+                "\xE2\x99\x93\0" // pisces
+                "\xE2\x9B\x8E\0" // ophiuchus
+                "\xF0\x9F\x94\x80\0" // twisted_rightwards_arrows
+                "\xF0\x9F\x94\x81\0" // repeat
+                "\xF0\x9F\x94\x82\0" // repeat_one
+                "\xE2\x96\xB6\xEF\xB8\x8F\0" // arrow_forward
+                "\xE2\x8F\xA9\0" // fast_forward
+                "\xE2\x8F\xAD\0" // next_track_button
+                "\xE2\x8F\xAF\0" // play_or_pause_button
+                "\xE2\x97\x80\xEF\xB8\x8F\0" // arrow_backward
+                "\xE2\x8F\xAA\0" // rewind
+                "\xE2\x8F\xAE\0" // previous_track_button
+                "\xF0\x9F\x94\xBC\0" // arrow_up_small
+                "\xE2\x8F\xAB\0" // arrow_double_up
+                "\xF0\x9F\x94\xBD\0" // arrow_down_small
+                "\xE2\x8F\xAC\0" // arrow_double_down
+                "\xE2\x8F\xB8\0" // pause_button
+                "\xE2\x8F\xB9\0" // stop_button
+                "\xE2\x8F\xBA\0" // record_button
+                "\xF0\x9F\x8E\xA6\0" // cinema
+                "\xF0\x9F\x94\x85\0" // low_brightness
+                "\xF0\x9F\x94\x86\0" // high_brightness
+                "\xF0\x9F\x93\xB6\0" // signal_strength
+                "\xF0\x9F\x93\xB3\0" // vibration_mode
+                "\xF0\x9F\x93\xB4\0" // mobile_phone_off
+                "\xE2\x9C\x96\xEF\xB8\x8F\0" // heavy_multiplication_x
+                "\xE2\x9E\x95\0" // heavy_plus_sign
+                "\xE2\x9E\x96\0" // heavy_minus_sign
+                "\xE2\x9E\x97\0" // heavy_division_sign
+                "\xE2\x80\xBC\xEF\xB8\x8F\0" // bangbang
+                "\xE2\x81\x89\xEF\xB8\x8F\0" // interrobang
+                "\xE2\x9D\x93\0" // question
+                "\xE2\x9D\x94\0" // grey_question
+                "\xE2\x9D\x95\0" // grey_exclamation
+                "\xE2\x9D\x97\0" // exclamation
+                "\xE3\x80\xB0\xEF\xB8\x8F\0" // wavy_dash
+                "\xF0\x9F\x92\xB1\0" // currency_exchange
+                "\xF0\x9F\x92\xB2\0" // heavy_dollar_sign
+                "\xE2\x99\xBB\xEF\xB8\x8F\0" // recycle
+                "\xE2\x9A\x9C\0" // fleur_de_lis
+                "\xF0\x9F\x94\xB1\0" // trident
+                "\xF0\x9F\x93\x9B\0" // name_badge
+                "\xF0\x9F\x94\xB0\0" // beginner
+                "\xE2\xAD\x95\0" // o
+                "\xE2\x9C\x85\0" // white_check_mark
+                "\xE2\x98\x91\xEF\xB8\x8F\0" // ballot_box_with_check
+                "\xE2\x9C\x94\xEF\xB8\x8F\0" // heavy_check_mark
+                "\xE2\x9D\x8C\0" // x
+                "\xE2\x9D\x8E\0" // negative_squared_cross_mark
+                "\xE2\x9E\xB0\0" // curly_loop
+                "\xE2\x9E\xBF\0" // loop
+                "\xE3\x80\xBD\xEF\xB8\x8F\0" // part_alternation_mark
+                "\xE2\x9C\xB3\xEF\xB8\x8F\0" // eight_spoked_asterisk
+                "\xE2\x9C\xB4\xEF\xB8\x8F\0" // eight_pointed_black_star
+                "\xE2\x9D\x87\xEF\xB8\x8F\0" // sparkle
+                "\xC2\xA9\xEF\xB8\x8F\0" // copyright
+                "\xC2\xAE\xEF\xB8\x8F\0" // registered
+                "\xE2\x84\xA2\xEF\xB8\x8F\0" // tm
+                "\x23\xEF\xB8\x8F\xE2\x83\xA3\0" // hash
+                "\x2A\xE2\x83\xA3\0" // asterisk
+                "\x30\xEF\xB8\x8F\xE2\x83\xA3\0" // zero
+                "\x31\xEF\xB8\x8F\xE2\x83\xA3\0" // one
+                "\x32\xEF\xB8\x8F\xE2\x83\xA3\0" // two
+                "\x33\xEF\xB8\x8F\xE2\x83\xA3\0" // three
+                "\x34\xEF\xB8\x8F\xE2\x83\xA3\0" // four
+                "\x35\xEF\xB8\x8F\xE2\x83\xA3\0" // five
+                "\x36\xEF\xB8\x8F\xE2\x83\xA3\0" // six
+                "\x37\xEF\xB8\x8F\xE2\x83\xA3\0" // seven
+                "\x38\xEF\xB8\x8F\xE2\x83\xA3\0" // eight
+                "\x39\xEF\xB8\x8F\xE2\x83\xA3\0" // nine
+                "\xF0\x9F\x94\x9F\0" // keycap_ten
+                "\xF0\x9F\x94\xA0\0" // capital_abcd
+                "\xF0\x9F\x94\xA1\0" // abcd
+                "\xF0\x9F\x94\xA2\0" // one_two_three_four
+                "\xF0\x9F\x94\xA3\0" // symbols
+                "\xF0\x9F\x94\xA4\0" // abc
+                "\xF0\x9F\x85\xB0\xEF\xB8\x8F\0" // a
+                "\xF0\x9F\x86\x8E\0" // ab
+                "\xF0\x9F\x85\xB1\xEF\xB8\x8F\0" // b
+                "\xF0\x9F\x86\x91\0" // cl
+                "\xF0\x9F\x86\x92\0" // cool
+                "\xF0\x9F\x86\x93\0" // free
+                "\xE2\x84\xB9\xEF\xB8\x8F\0" // information_source
+                "\xF0\x9F\x86\x94\0" // id
+                "\xE2\x93\x82\xEF\xB8\x8F\0" // m
+                "\xF0\x9F\x86\x95\0" // new_
+                "\xF0\x9F\x86\x96\0" // ng
+                "\xF0\x9F\x85\xBE\xEF\xB8\x8F\0" // o2
+                "\xF0\x9F\x86\x97\0" // ok
+                "\xF0\x9F\x85\xBF\xEF\xB8\x8F\0" // parking
+                "\xF0\x9F\x86\x98\0" // sos
+                "\xF0\x9F\x86\x99\0" // up
+                "\xF0\x9F\x86\x9A\0" // vs
+                "\xF0\x9F\x88\x81\0" // koko
+                "\xF0\x9F\x88\x82\xEF\xB8\x8F\0" // sa
+                "\xF0\x9F\x88\xB7\xEF\xB8\x8F\0" // u6708
+                "\xF0\x9F\x88\xB6\0" // u6709
+                "\xF0\x9F\x88\xAF\0" // u6307
+                "\xF0\x9F\x89\x90\0" // ideograph_advantage
+                "\xF0\x9F\x88\xB9\0" // u5272
+                "\xF0\x9F\x88\x9A\0" // u7121
+                "\xF0\x9F\x88\xB2\0" // u7981
+                "\xF0\x9F\x89\x91\0" // accept
+                "\xF0\x9F\x88\xB8\0" // u7533
+                "\xF0\x9F\x88\xB4\0" // u5408
+                "\xF0\x9F\x88\xB3\0" // u7a7a
+                "\xE3\x8A\x97\xEF\xB8\x8F\0" // congratulations
+                "\xE3\x8A\x99\xEF\xB8\x8F\0" // secret
+                "\xF0\x9F\x88\xBA\0" // u55b6
+                "\xF0\x9F\x88\xB5\0" // u6e80
+                "\xF0\x9F\x94\xB4\0" // red_circle
+                "\xF0\x9F\x94\xB5\0" // large_blue_circle
+                "\xE2\x9A\xAB\0" // black_circle
+                "\xE2\x9A\xAA\0" // white_circle
+                "\xE2\xAC\x9B\0" // black_large_square
+                "\xE2\xAC\x9C\0" // white_large_square
+                "\xE2\x97\xBC\xEF\xB8\x8F\0" // black_medium_square
+                "\xE2\x97\xBB\xEF\xB8\x8F\0" // white_medium_square
+                "\xE2\x97\xBE\0" // black_medium_small_square
+                "\xE2\x97\xBD\0" // white_medium_small_square
+                "\xE2\x96\xAA\xEF\xB8\x8F\0" // black_small_square
+                "\xE2\x96\xAB\xEF\xB8\x8F\0" // white_small_square
+                "\xF0\x9F\x94\xB6\0" // large_orange_diamond
+                "\xF0\x9F\x94\xB7\0" // large_blue_diamond
+                "\xF0\x9F\x94\xB8\0" // small_orange_diamond
+                "\xF0\x9F\x94\xB9\0" // small_blue_diamond
+                "\xF0\x9F\x94\xBA\0" // small_red_triangle
+                "\xF0\x9F\x94\xBB\0" // small_red_triangle_down
+                "\xF0\x9F\x92\xA0\0" // diamond_shape_with_a_dot_inside
+                "\xF0\x9F\x94\x98\0" // radio_button
+                "\xF0\x9F\x94\xB3\0" // white_square_button
+                "\xF0\x9F\x94\xB2\0" // black_square_button
+                "\xF0\x9F\x8F\x81\0" // checkered_flag
+                "\xF0\x9F\x9A\xA9\0" // triangular_flag_on_post
+                "\xF0\x9F\x8E\x8C\0" // crossed_flags
+                "\xF0\x9F\x8F\xB4\0" // black_flag
+                "\xF0\x9F\x8F\xB3\0" // white_flag
+                "\xF0\x9F\x8F\xB3\xEF\xB8\x8F\xE2\x80\x8D\xF0\x9F\x8C\x88\0" // rainbow_flag
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xA9\0" // andorra
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAA\0" // united_arab_emirates
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAB\0" // afghanistan
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAC\0" // antigua_barbuda
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xAE\0" // anguilla
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB1\0" // albania
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB2\0" // armenia
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB4\0" // angola
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB6\0" // antarctica
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB7\0" // argentina
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB8\0" // american_samoa
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xB9\0" // austria
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBA\0" // australia
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBC\0" // aruba
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBD\0" // aland_islands
+                "\xF0\x9F\x87\xA6\xF0\x9F\x87\xBF\0" // azerbaijan
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xA6\0" // bosnia_herzegovina
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xA7\0" // barbados
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xA9\0" // bangladesh
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAA\0" // belgium
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAB\0" // burkina_faso
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAC\0" // bulgaria
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAD\0" // bahrain
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAE\0" // burundi
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xAF\0" // benin
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB1\0" // st_barthelemy
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB2\0" // bermuda
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB3\0" // brunei
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB4\0" // bolivia
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB6\0" // caribbean_netherlands
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB7\0" // brazil
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB8\0" // bahamas
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xB9\0" // bhutan
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xBC\0" // botswana
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xBE\0" // belarus
+                "\xF0\x9F\x87\xA7\xF0\x9F\x87\xBF\0" // belize
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xA6\0" // canada
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xA8\0" // cocos_islands
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xA9\0" // congo_kinshasa
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAB\0" // central_african_republic
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAC\0" // congo_brazzaville
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAD\0" // switzerland
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xAE\0" // cote_divoire
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB0\0" // cook_islands
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB1\0" // chile
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB2\0" // cameroon
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB3\0" // cn
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB4\0" // colombia
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xB7\0" // costa_rica
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBA\0" // cuba
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBB\0" // cape_verde
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBC\0" // curacao
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBD\0" // christmas_island
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBE\0" // cyprus
+                "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBF\0" // czech_republic
+                "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA\0" // de
+                "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAF\0" // djibouti
+                "\xF0\x9F\x87\xA9\xF0\x9F\x87\xB0\0" // denmark
+                "\xF0\x9F\x87\xA9\xF0\x9F\x87\xB2\0" // dominica
+                "\xF0\x9F\x87\xA9\xF0\x9F\x87\xB4\0" // dominican_republic
+                "\xF0\x9F\x87\xA9\xF0\x9F\x87\xBF\0" // algeria
+                "\xF0\x9F\x87\xAA\xF0\x9F\x87\xA8\0" // ecuador
+                "\xF0\x9F\x87\xAA\xF0\x9F\x87\xAA\0" // estonia
+                "\xF0\x9F\x87\xAA\xF0\x9F\x87\xAC\0" // egypt
+                "\xF0\x9F\x87\xAA\xF0\x9F\x87\xAD\0" // western_sahara
+                "\xF0\x9F\x87\xAA\xF0\x9F\x87\xB7\0" // eritrea
+                "\xF0\x9F\x87\xAA\xF0\x9F\x87\xB8\0" // es
+                "\xF0\x9F\x87\xAA\xF0\x9F\x87\xB9\0" // ethiopia
+                "\xF0\x9F\x87\xAA\xF0\x9F\x87\xBA\0" // eu
+                "\xF0\x9F\x87\xAB\xF0\x9F\x87\xAE\0" // finland
+                "\xF0\x9F\x87\xAB\xF0\x9F\x87\xAF\0" // fiji
+                "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB0\0" // falkland_islands
+                "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB2\0" // micronesia
+                "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB4\0" // faroe_islands
+                "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7\0" // fr
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xA6\0" // gabon
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xA7\0" // uk
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xA9\0" // grenada
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAA\0" // georgia
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAB\0" // french_guiana
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAC\0" // guernsey
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAD\0" // ghana
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xAE\0" // gibraltar
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB1\0" // greenland
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB2\0" // gambia
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB3\0" // guinea
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB5\0" // guadeloupe
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB6\0" // equatorial_guinea
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB7\0" // greece
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB8\0" // south_georgia_south_sandwich_islands
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xB9\0" // guatemala
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xBA\0" // guam
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xBC\0" // guinea_bissau
+                "\xF0\x9F\x87\xAC\xF0\x9F\x87\xBE\0" // guyana
+                "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB0\0" // hong_kong
+                "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB3\0" // honduras
+                "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB7\0" // croatia
+                "\xF0\x9F\x87\xAD\xF0\x9F\x87\xB9\0" // haiti
+                "\xF0\x9F\x87\xAD\xF0\x9F\x87\xBA\0" // hungary
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xA8\0" // canary_islands
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xA9\0" // indonesia
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xAA\0" // ireland
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB1\0" // israel
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB2\0" // isle_of_man
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB3\0" // india
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB4\0" // british_indian_ocean_territory
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB6\0" // iraq
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB7\0" // iran
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB8\0" // iceland
+                "\xF0\x9F\x87\xAE\xF0\x9F\x87\xB9\0" // it
+                "\xF0\x9F\x87\xAF\xF0\x9F\x87\xAA\0" // jersey
+                "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB2\0" // jamaica
+                "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB4\0" // jordan
+                "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB5\0" // jp
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAA\0" // kenya
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAC\0" // kyrgyzstan
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAD\0" // cambodia
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xAE\0" // kiribati
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB2\0" // comoros
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB3\0" // st_kitts_nevis
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB5\0" // north_korea
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xB7\0" // kr
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xBC\0" // kuwait
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xBE\0" // cayman_islands
+                "\xF0\x9F\x87\xB0\xF0\x9F\x87\xBF\0" // kazakhstan
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xA6\0" // laos
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xA7\0" // lebanon
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xA8\0" // st_lucia
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xAE\0" // liechtenstein
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB0\0" // sri_lanka
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB7\0" // liberia
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB8\0" // lesotho
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xB9\0" // lithuania
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xBA\0" // luxembourg
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xBB\0" // latvia
+                "\xF0\x9F\x87\xB1\xF0\x9F\x87\xBE\0" // libya
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xA6\0" // morocco
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xA8\0" // monaco
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xA9\0" // moldova
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xAA\0" // montenegro
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xAC\0" // madagascar
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xAD\0" // marshall_islands
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB0\0" // macedonia
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB1\0" // mali
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB2\0" // myanmar
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB3\0" // mongolia
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB4\0" // macau
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB5\0" // northern_mariana_islands
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB6\0" // martinique
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB7\0" // mauritania
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB8\0" // montserrat
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xB9\0" // malta
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBA\0" // mauritius
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBB\0" // maldives
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBC\0" // malawi
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBD\0" // mexico
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBE\0" // malaysia
+                "\xF0\x9F\x87\xB2\xF0\x9F\x87\xBF\0" // mozambique
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xA6\0" // namibia
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xA8\0" // new_caledonia
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAA\0" // niger
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAB\0" // norfolk_island
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAC\0" // nigeria
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xAE\0" // nicaragua
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB1\0" // netherlands
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB4\0" // norway
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB5\0" // nepal
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xB7\0" // nauru
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xBA\0" // niue
+                "\xF0\x9F\x87\xB3\xF0\x9F\x87\xBF\0" // new_zealand
+                "\xF0\x9F\x87\xB4\xF0\x9F\x87\xB2\0" // oman
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xA6\0" // panama
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAA\0" // peru
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAB\0" // french_polynesia
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAC\0" // papua_new_guinea
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xAD\0" // philippines
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB0\0" // pakistan
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB1\0" // poland
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB2\0" // st_pierre_miquelon
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB3\0" // pitcairn_islands
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB7\0" // puerto_rico
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB8\0" // palestinian_territories
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xB9\0" // portugal
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xBC\0" // palau
+                "\xF0\x9F\x87\xB5\xF0\x9F\x87\xBE\0" // paraguay
+                "\xF0\x9F\x87\xB6\xF0\x9F\x87\xA6\0" // qatar
+                "\xF0\x9F\x87\xB7\xF0\x9F\x87\xAA\0" // reunion
+                "\xF0\x9F\x87\xB7\xF0\x9F\x87\xB4\0" // romania
+                "\xF0\x9F\x87\xB7\xF0\x9F\x87\xB8\0" // serbia
+                "\xF0\x9F\x87\xB7\xF0\x9F\x87\xBA\0" // ru
+                "\xF0\x9F\x87\xB7\xF0\x9F\x87\xBC\0" // rwanda
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA6\0" // saudi_arabia
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA7\0" // solomon_islands
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA8\0" // seychelles
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xA9\0" // sudan
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAA\0" // sweden
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAC\0" // singapore
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAD\0" // st_helena
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xAE\0" // slovenia
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB0\0" // slovakia
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB1\0" // sierra_leone
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB2\0" // san_marino
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB3\0" // senegal
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB4\0" // somalia
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB7\0" // suriname
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB8\0" // south_sudan
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xB9\0" // sao_tome_principe
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBB\0" // el_salvador
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBD\0" // sint_maarten
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBE\0" // syria
+                "\xF0\x9F\x87\xB8\xF0\x9F\x87\xBF\0" // swaziland
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xA8\0" // turks_caicos_islands
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xA9\0" // chad
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAB\0" // french_southern_territories
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAC\0" // togo
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAD\0" // thailand
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xAF\0" // tajikistan
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB0\0" // tokelau
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB1\0" // timor_leste
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB2\0" // turkmenistan
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB3\0" // tunisia
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB4\0" // tonga
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB7\0" // tr
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xB9\0" // trinidad_tobago
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xBB\0" // tuvalu
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xBC\0" // taiwan
+                "\xF0\x9F\x87\xB9\xF0\x9F\x87\xBF\0" // tanzania
+                "\xF0\x9F\x87\xBA\xF0\x9F\x87\xA6\0" // ukraine
+                "\xF0\x9F\x87\xBA\xF0\x9F\x87\xAC\0" // uganda
+                "\xF0\x9F\x87\xBA\xF0\x9F\x87\xB8\0" // us
+                "\xF0\x9F\x87\xBA\xF0\x9F\x87\xBE\0" // uruguay
+                "\xF0\x9F\x87\xBA\xF0\x9F\x87\xBF\0" // uzbekistan
+                "\xF0\x9F\x87\xBB\xF0\x9F\x87\xA6\0" // vatican_city
+                "\xF0\x9F\x87\xBB\xF0\x9F\x87\xA8\0" // st_vincent_grenadines
+                "\xF0\x9F\x87\xBB\xF0\x9F\x87\xAA\0" // venezuela
+                "\xF0\x9F\x87\xBB\xF0\x9F\x87\xAC\0" // british_virgin_islands
+                "\xF0\x9F\x87\xBB\xF0\x9F\x87\xAE\0" // us_virgin_islands
+                "\xF0\x9F\x87\xBB\xF0\x9F\x87\xB3\0" // vietnam
+                "\xF0\x9F\x87\xBB\xF0\x9F\x87\xBA\0" // vanuatu
+                "\xF0\x9F\x87\xBC\xF0\x9F\x87\xAB\0" // wallis_futuna
+                "\xF0\x9F\x87\xBC\xF0\x9F\x87\xB8\0" // samoa
+                "\xF0\x9F\x87\xBD\xF0\x9F\x87\xB0\0" // kosovo
+                "\xF0\x9F\x87\xBE\xF0\x9F\x87\xAA\0" // yemen
+                "\xF0\x9F\x87\xBE\xF0\x9F\x87\xB9\0" // mayotte
+                "\xF0\x9F\x87\xBF\xF0\x9F\x87\xA6\0" // south_africa
+                "\xF0\x9F\x87\xBF\xF0\x9F\x87\xB2\0" // zambia
+                "\xF0\x9F\x87\xBF\xF0\x9F\x87\xBC\0"; // zimbabwe
+            static constexpr std::uint16_t offsets[count] = {
+                0, 5, 10, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 75,
+                80, 87, 92, 97, 102, 107, 112, 117, 122, 127, 132, 137, 142, 147, 152, 157,
+                162, 167, 172, 177, 182, 187, 192, 197, 202, 207, 212, 217, 222, 227, 232, 237,
+                242, 247, 252, 257, 262, 266, 271, 276, 281, 286, 291, 296, 301, 306, 311, 316,
+                321, 326, 331, 336, 341, 346, 351, 356, 361, 366, 371, 376, 381, 386, 390, 395,
+                400, 405, 410, 415, 420, 425, 430, 435, 440, 445, 450, 455, 460, 465, 470, 475,
+                480, 485, 490, 495, 500, 505, 510, 515, 520, 525, 530, 535, 539, 544, 551, 556,
+                561, 566, 571, 576, 581, 586, 591, 596, 601, 606, 611, 616, 621, 626, 631, 636,
+                641, 646, 651, 656, 660, 665, 670, 674, 679, 684, 689, 694, 699, 704, 709, 714,
+                718, 723, 728, 732, 737, 742, 747, 752, 757, 762, 767, 772, 776, 781, 786, 791,
+                796, 801, 806, 811, 816, 821, 826, 831, 836, 841, 846, 851, 865, 870, 875, 880,
+                894, 899, 913, 918, 932, 937, 951, 956, 970, 975, 989, 994, 1008, 1013, 1027, 1032,
+                1046, 1060, 1074, 1086, 1098, 1110, 1122, 1136, 1150, 1162, 1174, 1186, 1198, 1210, 1222, 1234,
+                1246, 1258, 1270, 1282, 1294, 1306, 1318, 1330, 1342, 1354, 1366, 1380, 1394, 1406, 1418, 1430,
+                1442, 1447, 1461, 1466, 1483, 1488, 1502, 1507, 1521, 1526, 1531, 1536, 1550, 1555, 1560, 1565,
+                1570, 1575, 1580, 1585, 1590, 1604, 1609, 1623, 1628, 1642, 1647, 1661, 1666, 1671, 1676, 1681,
+                1695, 1700, 1705, 1709, 1714, 1719, 1736, 1741, 1755, 1760, 1774, 1779, 1793, 1797, 1813, 1818,
+                1835, 1840, 1854, 1859, 1873, 1887, 1901, 1915, 1929, 1943, 1957, 1971, 1985, 1999, 2013, 2018,
+                2023, 2028, 2033, 2038, 2043, 2071, 2099, 2104, 2125, 2146, 2165, 2191, 2217, 2243, 2262, 2281,
+                2307, 2333, 2359, 2378, 2397, 2423, 2449, 2475, 2487, 2506, 2518, 2537, 2556, 2568, 2587, 2599,
+                2618, 2637, 2642, 2647, 2652, 2657, 2662, 2667, 2672, 2677, 2682, 2687, 2692, 2697, 2702, 2707,
+                2712, 2717, 2722, 2727, 2732, 2737, 2742, 2747, 2752, 2757, 2762, 2767, 2772, 2777, 2782, 2787,
+                2792, 2797, 2802, 2807, 2812, 2817, 2822, 2827, 2832, 2837, 2842, 2847, 2852, 2857, 2862, 2867,
+                2872, 2877, 2882, 2887, 2892, 2897, 2902, 2907, 2912, 2917, 2922, 2927, 2932, 2937, 2942, 2947,
+                2952, 2957, 2962, 2967, 2972, 2977, 2982, 2987, 2992, 2997, 3002, 3007, 3012, 3017, 3022, 3027,
+                3032, 3037, 3042, 3047, 3052, 3057, 3062, 3067, 3072, 3077, 3082, 3087, 3092, 3097, 3102, 3107,
+                3112, 3117, 3122, 3127, 3132, 3137, 3142, 3147, 3152, 3157, 3161, 3166, 3171, 3176, 3181, 3186,
+                3191, 3196, 3201, 3206, 3211, 3216, 3221, 3226, 3231, 3236, 3241, 3246, 3251, 3256, 3261, 3266,
+                3271, 3276, 3281, 3286, 3291, 3296, 3301, 3306, 3311, 3316, 3321, 3326, 3331, 3336, 3341, 3346,
+                3351, 3356, 3361, 3366, 3371, 3376, 3381, 3386, 3391, 3396, 3401, 3406, 3411, 3416, 3421, 3426,
+                3431, 3436, 3441, 3446, 3451, 3456, 3461, 3466, 3471, 3476, 3481, 3486, 3491, 3496, 3501, 3506,
+                3511, 3516, 3521, 3526, 3531, 3536, 3541, 3546, 3551, 3556, 3561, 3565, 3570, 3575, 3580, 3585,
+                3590, 3595, 3600, 3605, 3610, 3615, 3620, 3625, 3630, 3635, 3640, 3645, 3650, 3655, 3660, 3665,
+                3670, 3675, 3679, 3684, 3689, 3694, 3699, 3704, 3709, 3714, 3719, 3724, 3729, 3734, 3739, 3744,
+                3749, 3754, 3759, 3764, 3769, 3774, 3779, 3784, 3789, 3794, 3799, 3804, 3809, 3814, 3819, 3824,
+                3829, 3833, 3838, 3843, 3847, 3852, 3856, 3860, 3865, 3870, 3875, 3880, 3885, 3890, 3895, 3900,
+                3907, 3912, 3917, 3922, 3927, 3932, 3937, 3942, 3947, 3952, 3957, 3962, 3967, 3972, 3977, 3982,
+                3987, 3992, 3997, 4002, 4007, 4012, 4017, 4022, 4027, 4032, 4037, 4042, 4047, 4052, 4057, 4062,
+                4067, 4072, 4077, 4082, 4087, 4092, 4097, 4102, 4107, 4112, 4117, 4121, 4126, 4131, 4136, 4141,
+                4146, 4150, 4154, 4159, 4164, 4169, 4173, 4178, 4183, 4190, 4195, 4200, 4205, 4210, 4215, 4220,
+                4225, 4230, 4235, 4240, 4245, 4249, 4253, 4257, 4261, 4265, 4269, 4274, 4279, 4284, 4289, 4294,
+                4299, 4304, 4309, 4314, 4319, 4324, 4329, 4334, 4339, 4344, 4349, 4354, 4359, 4364, 4369, 4374,
+                4379, 4384, 4389, 4394, 4399, 4404, 4409, 4414, 4419, 4424, 4429, 4434, 4439, 4444, 4449, 4454,
+                4459, 4466, 4471, 4476, 4480, 4485, 4490, 4495, 4502, 4506, 4510, 4515, 4520, 4525, 4530, 4535,
+                4540, 4545, 4550, 4555, 4560, 4565, 4570, 4574, 4578, 4582, 4586, 4593, 4597, 4601, 4605, 4610,
+                4615, 4620, 4625, 4630, 4635, 4640, 4644, 4649, 4654, 4659, 4664, 4669, 4674, 4679, 4684, 4689,
+                4694, 4699, 4704, 4709, 4714, 4719, 4724, 4729, 4734, 4739, 4744, 4748, 4752, 4757, 4762, 4767,
+                4772, 4777, 4782, 4787, 4792, 4797, 4802, 4807, 4812, 4817, 4822, 4826, 4830, 4835, 4840, 4845,
+                4850, 4855, 4860, 4865, 4870, 4875, 4880, 4885, 4892, 4899, 4906, 4913, 4918, 4923, 4928, 4933,
+                4938, 4943, 4948, 4953, 4958, 4963, 4968, 4973, 4978, 4983, 4988, 4993, 4998, 5003, 5008, 5013,
+                5018, 5023, 5028, 5033, 5038, 5043, 5048, 5053, 5058, 5062, 5067, 5072, 5077, 5082, 5087, 5092,
+                5097, 5102, 5107, 5112, 5117, 5122, 5127, 5132, 5137, 5142, 5147, 5152, 5157, 5162, 5167, 5172,
+                5177, 5182, 5187, 5192, 5197, 5202, 5207, 5212, 5219, 5224, 5229, 5234, 5239, 5244, 5249, 5254,
+                5259, 5263, 5268, 5273, 5278, 5283, 5288, 5293, 5298, 5303, 5308, 5313, 5318, 5323, 5328, 5333,
+                5338, 5343, 5348, 5353, 5358, 5363, 5368, 5373, 5378, 5383, 5388, 5393, 5398, 5403, 5408, 5413,
+                5418, 5423, 5428, 5433, 5438, 5443, 5448, 5453, 5458, 5463, 5468, 5473, 5478, 5483, 5488, 5493,
+                5500, 5505, 5510, 5515, 5520, 5525, 5530, 5535, 5540, 5545, 5550, 5555, 5560, 5567, 5574, 5579,
+                5584, 5589, 5594, 5599, 5604, 5609, 5614, 5619, 5624, 5629, 5634, 5639, 5644, 5649, 5654, 5659,
+                5664, 5669, 5674, 5679, 5684, 5689, 5694, 5701, 5706, 5711, 5716, 5721, 5726, 5731, 5736, 5741,
+                5746, 5751, 5755, 5759, 5764, 5769, 5773, 5778, 5783, 5788, 5793, 5798, 5802, 5807, 5811, 5816,
+                5820, 5824, 5829, 5834, 5839, 5844, 5849, 5854, 5859, 5864, 5869, 5874, 5879, 5884, 5889, 5893,
+                5897, 5902, 5907, 5912, 5917, 5921, 5926, 5931, 5936, 5941, 5946, 5951, 5956, 5961, 5966, 5973,
+                5978, 5982, 5987, 5992, 5997, 6002, 6007, 6012, 6017, 6022, 6026, 6030, 6037, 6044, 6051, 6058,
+                6065, 6072, 6079, 6086, 6093, 6100, 6107, 6114, 6121, 6128, 6133, 6138, 6143, 6148, 6153, 6158,
+                6163, 6168, 6172, 6177, 6181, 6185, 6189, 6193, 6197, 6201, 6205, 6210, 6215, 6219, 6223, 6227,
+                6231, 6235, 6239, 6243, 6247, 6251, 6255, 6259, 6263, 6267, 6272, 6277, 6282, 6289, 6293, 6297,
+                6301, 6308, 6312, 6316, 6321, 6325, 6330, 6334, 6338, 6342, 6346, 6351, 6356, 6361, 6366, 6371,
+                6376, 6383, 6387, 6391, 6395, 6402, 6409, 6413, 6417, 6421, 6425, 6432, 6437, 6442, 6449, 6453,
+                6458, 6463, 6468, 6472, 6476, 6483, 6490, 6494, 6498, 6502, 6506, 6513, 6520, 6527, 6534, 6540,
+                6546, 6553, 6561, 6566, 6574, 6582, 6590, 6598, 6606, 6614, 6622, 6630, 6638, 6646, 6651, 6656,
+                6661, 6666, 6671, 6676, 6684, 6689, 6697, 6702, 6707, 6712, 6719, 6724, 6731, 6736, 6741, 6749,
+                6754, 6762, 6767, 6772, 6777, 6782, 6790, 6798, 6803, 6808, 6813, 6818, 6823, 6828, 6833, 6838,
+                6843, 6848, 6855, 6862, 6867, 6872, 6877, 6882, 6886, 6890, 6894, 6898, 6905, 6912, 6916, 6920,
+                6927, 6934, 6939, 6944, 6949, 6954, 6959, 6964, 6969, 6974, 6979, 6984, 6989, 6994, 6999, 7004,
+                7009, 7024, 7033, 7042, 7051, 7060, 7069, 7078, 7087, 7096, 7105, 7114, 7123, 7132, 7141, 7150,
+                7159, 7168, 7177, 7186, 7195, 7204, 7213, 7222, 7231, 7240, 7249, 7258, 7267, 7276, 7285, 7294,
+                7303, 7312, 7321, 7330, 7339, 7348, 7357, 7366, 7375, 7384, 7393, 7402, 7411, 7420, 7429, 7438,
+                7447, 7456, 7465, 7474, 7483, 7492, 7501, 7510, 7519, 7528, 7537, 7546, 7555, 7564, 7573, 7582,
+                7591, 7600, 7609, 7618, 7627, 7636, 7645, 7654, 7663, 7672, 7681, 7690, 7699, 7708, 7717, 7726,
+                7735, 7744, 7753, 7762, 7771, 7780, 7789, 7798, 7807, 7816, 7825, 7834, 7843, 7852, 7861, 7870,
+                7879, 7888, 7897, 7906, 7915, 7924, 7933, 7942, 7951, 7960, 7969, 7978, 7987, 7996, 8005, 8014,
+                8023, 8032, 8041, 8050, 8059, 8068, 8077, 8086, 8095, 8104, 8113, 8122, 8131, 8140, 8149, 8158,
+                8167, 8176, 8185, 8194, 8203, 8212, 8221, 8230, 8239, 8248, 8257, 8266, 8275, 8284, 8293, 8302,
+                8311, 8320, 8329, 8338, 8347, 8356, 8365, 8374, 8383, 8392, 8401, 8410, 8419, 8428, 8437, 8446,
+                8455, 8464, 8473, 8482, 8491, 8500, 8509, 8518, 8527, 8536, 8545, 8554, 8563, 8572, 8581, 8590,
+                8599, 8608, 8617, 8626, 8635, 8644, 8653, 8662, 8671, 8680, 8689, 8698, 8707, 8716, 8725, 8734,
+                8743, 8752, 8761, 8770, 8779, 8788, 8797, 8806, 8815, 8824, 8833, 8842, 8851, 8860, 8869, 8878,
+                8887, 8896, 8905, 8914, 8923, 8932, 8941, 8950, 8959, 8968, 8977, 8986, 8995, 9004, 9013, 9022,
+                9031, 9040, 9049, 9058, 9067, 9076, 9085, 9094, 9103, 9112, 9121, 9130, 9139, 9148, 9157, 9166,
+                9175, 9184, 9193, 9202, 9211, 9220, 9229, 9238,
+            };
+            static constexpr std::uint8_t lengths[count] = {
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 6, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 3, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3,
+                4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 13, 4, 4, 4, 13,
+                4, 13, 4, 13, 4, 13, 4, 13, 4, 13, 4, 13, 4, 13, 4, 13,
+                13, 13, 11, 11, 11, 11, 13, 13, 11, 11, 11, 11, 11, 11, 11, 11,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 13, 13, 11, 11, 11, 11,
+                4, 13, 4, 16, 4, 13, 4, 13, 4, 4, 4, 13, 4, 4, 4, 4,
+                4, 4, 4, 4, 13, 4, 13, 4, 13, 4, 13, 4, 4, 4, 4, 13,
+                4, 4, 3, 4, 4, 16, 4, 13, 4, 13, 4, 13, 3, 15, 4, 16,
+                4, 13, 4, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 4, 4,
+                4, 4, 4, 4, 27, 27, 4, 20, 20, 18, 25, 25, 25, 18, 18, 25,
+                25, 25, 18, 18, 25, 25, 25, 11, 18, 11, 18, 18, 11, 18, 11, 18,
+                18, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                3, 4, 4, 3, 4, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 6,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4,
+                3, 3, 4, 4, 4, 3, 4, 4, 6, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                6, 4, 4, 3, 4, 4, 4, 6, 3, 3, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 6, 3, 3, 3, 4, 4,
+                4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4,
+                3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 3, 3, 4, 4, 3, 4, 4, 4, 4, 4, 3, 4, 3, 4, 3,
+                3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3,
+                4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 4,
+                3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 4, 4, 4, 4, 4, 4,
+                4, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 6, 3, 3, 3,
+                6, 3, 3, 4, 3, 4, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+                6, 3, 3, 3, 6, 6, 3, 3, 3, 3, 6, 4, 4, 6, 3, 4,
+                4, 4, 3, 3, 6, 6, 3, 3, 3, 3, 6, 6, 6, 6, 5, 5,
+                6, 7, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 4, 4, 4,
+                4, 4, 4, 7, 4, 7, 4, 4, 4, 6, 4, 6, 4, 4, 7, 4,
+                7, 4, 4, 4, 4, 7, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 6, 6, 4, 4, 4, 4, 3, 3, 3, 3, 6, 6, 3, 3, 6,
+                6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                14, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8,
+            };
+
+            // All names, each followed by a null character
+            static constexpr char names[] =
+                "grinning\0"
+                "smiley\0"
+                "smile\0"
+                "grin\0"
+                "laughing\0"
+                "sweat_smile\0"
+                "rofl\0"
+                "joy\0"
+                "slightly_smiling_face\0"
+                "upside_down_face\0"
+                "wink\0"
+                "blush\0"
+                "innocent\0"
+                "heart_eyes\0"
+                "kissing_heart\0"
+                "kissing\0"
+                "relaxed\0"
+                "kissing_closed_eyes\0"
+                "kissing_smiling_eyes\0"
+                "yum\0"
+                "stuck_out_tongue\0"
+                "stuck_out_tongue_winking_eye\0"
+                "stuck_out_tongue_closed_eyes\0"
+                "money_mouth_face\0"
+                "hugs\0"
+                "thinking\0"
+                "zipper_mouth_face\0"
+                "neutral_face\0"
+                "expressionless\0"
+                "no_mouth\0"
+                "smirk\0"
+                "unamused\0"
+                "roll_eyes\0"
+                "grimacing\0"
+                "lying_face\0"
+                "relieved\0"
+                "pensive\0"
+                "sleepy\0"
+                "drooling_face\0"
+                "sleeping\0"
+                "mask\0"
+                "face_with_thermometer\0"
+                "face_with_head_bandage\0"
+                "nauseated_face\0"
+                "sneezing_face\0"
+                "dizzy_face\0"
+                "cowboy_hat_face\0"
+                "sunglasses\0"
+                "nerd_face\0"
+                "confused\0"
+                "worried\0"
+                "slightly_frowning_face\0"
+                "frowning_face\0"
+                "open_mouth\0"
+                "hushed\0"
+                "astonished\0"
+                "flushed\0"
+                "frowning\0"
+                "anguished\0"
+                "fearful\0"
+                "cold_sweat\0"
+                "disappointed_relieved\0"
+                "cry\0"
+                "sob\0"
+                "scream\0"
+                "confounded\0"
+                "persevere\0"
+                "disappointed\0"
+                "sweat\0"
+                "weary\0"
+                "tired_face\0"
+                "triumph\0"
+                "rage\0"
+                "angry\0"
+                "smiling_imp\0"
+                "imp\0"
+                "skull\0"
+                "skull_and_crossbones\0"
+                "poop\0"
+                "clown_face\0"
+                "japanese_ogre\0"
+                "japanese_goblin\0"
+                "ghost\0"
+                "alien\0"
+                "space_invader\0"
+                "robot\0"
+                "smiley_cat\0"
+                "smile_cat\0"
+                "joy_cat\0"
+                "heart_eyes_cat\0"
+                "smirk_cat\0"
+                "kissing_cat\0"
+                "scream_cat\0"
+                "crying_cat_face\0"
+                "pouting_cat\0"
+                "see_no_evil\0"
+                "hear_no_evil\0"
+                "speak_no_evil\0"
+                "love_letter\0"
+                "cupid\0"
+                "gift_heart\0"
+                "sparkling_heart\0"
+                "heartpulse\0"
+                "heartbeat\0"
+                "revolving_hearts\0"
+                "two_hearts\0"
+                "heart_decoration\0"
+                "heavy_heart_exclamation\0"
+                "broken_heart\0"
+                "heart\0"
+                "yellow_heart\0"
+                "green_heart\0"
+                "blue_heart\0"
+                "purple_heart\0"
+                "black_heart\0"
+                "kiss\0"
+                "one_hundred\0"
+                "anger\0"
+                "boom\0"
+                "dizzy\0"
+                "sweat_drops\0"
+                "dash\0"
+                "hole\0"
+                "speech_balloon\0"
+                "left_speech_bubble\0"
+                "right_anger_bubble\0"
+                "thought_balloon\0"
+                "zzz\0"
+                "wave\0"
+                "raised_back_of_hand\0"
+                "raised_hand_with_fingers_splayed\0"
+                "raised_hand\0"
+                "vulcan_salute\0"
+                "ok_hand\0"
+                "v\0"
+                "crossed_fingers\0"
+                "metal\0"
+                "call_me_hand\0"
+                "point_left\0"
+                "point_right\0"
+                "point_up_2\0"
+                "fu\0"
+                "point_down\0"
+                "point_up\0"
+                "plus_one\0"
+                "minus_one\0"
+                "fist\0"
+                "facepunch\0"
+                "fist_left\0"
+                "fist_right\0"
+                "clap\0"
+                "raised_hands\0"
+                "open_hands\0"
+                "handshake\0"
+                "pray\0"
+                "writing_hand\0"
+                "nail_care\0"
+                "selfie\0"
+                "muscle\0"
+                "ear\0"
+                "nose\0"
+                "eyes\0"
+                "eye\0"
+                "tongue\0"
+                "lips\0"
+                "baby\0"
+                "boy\0"
+                "girl\0"
+                "blonde_man\0"
+                "man\0"
+                "woman\0"
+                "blonde_woman\0"
+                "older_man\0"
+                "older_woman\0"
+                "frowning_woman\0"
+                "frowning_man\0"
+                "pouting_woman\0"
+                "pouting_man\0"
+                "no_good_woman\0"
+                "no_good_man\0"
+                "ok_woman\0"
+                "ok_man\0"
+                "tipping_hand_woman\0"
+                "tipping_hand_man\0"
+                "raising_hand_woman\0"
+                "raising_hand_man\0"
+                "bowing_man\0"
+                "bowing_woman\0"
+                "man_facepalming\0"
+                "woman_facepalming\0"
+                "woman_shrugging\0"
+                "man_shrugging\0"
+                "man_health_worker\0"
+                "woman_health_worker\0"
+                "man_student\0"
+                "woman_student\0"
+                "man_teacher\0"
+                "woman_teacher\0"
+                "man_judge\0"
+                "woman_judge\0"
+                "man_farmer\0"
+                "woman_farmer\0"
+                "man_cook\0"
+                "woman_cook\0"
+                "man_mechanic\0"
+                "woman_mechanic\0"
+                "man_factory_worker\0"
+                "woman_factory_worker\0"
+                "man_office_worker\0"
+                "woman_office_worker\0"
+                "man_scientist\0"
+                "woman_scientist\0"
+                "man_technologist\0"
+                "woman_technologist\0"
+                "man_singer\0"
+                "woman_singer\0"
+                "man_artist\0"
+                "woman_artist\0"
+                "man_pilot\0"
+                "woman_pilot\0"
+                "man_astronaut\0"
+                "woman_astronaut\0"
+                "man_firefighter\0"
+                "woman_firefighter\0"
+                "policeman\0"
+                "policewoman\0"
+                "male_detective\0"
+                "female_detective\0"
+                "guardsman\0"
+                "guardswoman\0"
+                "construction_worker_man\0"
+                "construction_worker_woman\0"
+                "prince\0"
+                "princess\0"
+                "man_with_turban\0"
+                "woman_with_turban\0"
+                "man_with_gua_pi_mao\0"
+                "man_in_tuxedo\0"
+                "bride_with_veil\0"
+                "pregnant_woman\0"
+                "angel\0"
+                "santa\0"
+                "mrs_claus\0"
+                "massage_woman\0"
+                "massage_man\0"
+                "haircut_woman\0"
+                "haircut_man\0"
+                "walking_man\0"
+                "walking_woman\0"
+                "running_man\0"
+                "running_woman\0"
+                "dancer\0"
+                "man_dancing\0"
+                "business_suit_levitating\0"
+                "dancing_women\0"
+                "dancing_men\0"
+                "person_fencing\0"
+                "horse_racing\0"
+                "skier\0"
+                "snowboarder\0"
+                "golfing_man\0"
+                "golfing_woman\0"
+                "surfing_man\0"
+                "surfing_woman\0"
+                "rowing_man\0"
+                "rowing_woman\0"
+                "swimming_man\0"
+                "swimming_woman\0"
+                "basketball_man\0"
+                "basketball_woman\0"
+                "weight_lifting_man\0"
+                "weight_lifting_woman\0"
+                "biking_man\0"
+                "biking_woman\0"
+                "mountain_biking_man\0"
+                "mountain_biking_woman\0"
+                "man_cartwheeling\0"
+                "woman_cartwheeling\0"
+                "men_wrestling\0"
+                "women_wrestling\0"
+                "man_playing_water_polo\0"
+                "woman_playing_water_polo\0"
+                "man_playing_handball\0"
+                "woman_playing_handball\0"
+                "man_juggling\0"
+                "woman_juggling\0"
+                "bath\0"
+                "sleeping_bed\0"
+                "two_women_holding_hands\0"
+                "couple\0"
+                "two_men_holding_hands\0"
+                "couplekiss_man_woman\0"
+                "couplekiss_man_man\0"
+                "couplekiss_woman_woman\0"
+                "couple_with_heart_woman_man\0"
+                "couple_with_heart_man_man\0"
+                "couple_with_heart_woman_woman\0"
+                "family_man_woman_girl\0"
+                "family_man_woman_girl_boy\0"
+                "family_man_woman_boy_boy\0"
+                "family_man_woman_girl_girl\0"
+                "family_man_man_boy\0"
+                "family_man_man_girl\0"
+                "family_man_man_girl_boy\0"
+                "family_man_man_boy_boy\0"
+                "family_man_man_girl_girl\0"
+                "family_woman_woman_boy\0"
+                "family_woman_woman_girl\0"
+                "family_woman_woman_girl_boy\0"
+                "family_woman_woman_boy_boy\0"
+                "family_woman_woman_girl_girl\0"
+                "family_man_boy\0"
+                "family_man_boy_boy\0"
+                "family_man_girl\0"
+                "family_man_girl_boy\0"
+                "family_man_girl_girl\0"
+                "family_woman_boy\0"
+                "family_woman_boy_boy\0"
+                "family_woman_girl\0"
+                "family_woman_girl_boy\0"
+                "family_woman_girl_girl\0"
+                "speaking_head\0"
+                "bust_in_silhouette\0"
+                "busts_in_silhouette\0"
+                "family_man_woman_boy\0"
+                "footprints\0"
+                "monkey_face\0"
+                "monkey\0"
+                "gorilla\0"
+                "dog\0"
+                "dog2\0"
+                "poodle\0"
+                "wolf\0"
+                "fox_face\0"
+                "cat\0"
+                "cat2\0"
+                "lion\0"
+                "tiger\0"
+                "tiger2\0"
+                "leopard\0"
+                "horse\0"
+                "racehorse\0"
+                "unicorn\0"
+                "deer\0"
+                "cow\0"
+                "ox\0"
+                "water_buffalo\0"
+                "cow2\0"
+                "pig\0"
+                "pig2\0"
+                "boar\0"
+                "pig_nose\0"
+                "ram\0"
+                "sheep\0"
+                "goat\0"
+                "dromedary_camel\0"
+                "camel\0"
+                "elephant\0"
+                "rhinoceros\0"
+                "mouse\0"
+                "mouse2\0"
+                "rat\0"
+                "hamster\0"
+                "rabbit\0"
+                "rabbit2\0"
+                "chipmunk\0"
+                "bat\0"
+                "bear\0"
+                "koala\0"
+                "panda_face\0"
+                "paw_prints\0"
+                "turkey\0"
+                "chicken\0"
+                "rooster\0"
+                "hatching_chick\0"
+                "baby_chick\0"
+                "hatched_chick\0"
+                "bird\0"
+                "penguin\0"
+                "dove\0"
+                "eagle\0"
+                "duck\0"
+                "owl\0"
+                "frog\0"
+                "crocodile\0"
+                "turtle\0"
+                "lizard\0"
+                "snake\0"
+                "dragon_face\0"
+                "dragon\0"
+                "whale\0"
+                "whale2\0"
+                "dolphin\0"
+                "fish\0"
+                "tropical_fish\0"
+                "blowfish\0"
+                "shark\0"
+                "octopus\0"
+                "shell\0"
+                "snail\0"
+                "butterfly\0"
+                "bug\0"
+                "ant\0"
+                "honeybee\0"
+                "beetle\0"
+                "spider\0"
+                "spider_web\0"
+                "scorpion\0"
+                "bouquet\0"
+                "cherry_blossom\0"
+                "white_flower\0"
+                "rosette\0"
+                "rose\0"
+                "wilted_flower\0"
+                "hibiscus\0"
+                "sunflower\0"
+                "blossom\0"
+                "tulip\0"
+                "seedling\0"
+                "evergreen_tree\0"
+                "deciduous_tree\0"
+                "palm_tree\0"
+                "cactus\0"
+                "ear_of_rice\0"
+                "herb\0"
+                "shamrock\0"
+                "four_leaf_clover\0"
+                "maple_leaf\0"
+                "fallen_leaf\0"
+                "leaves\0"
+                "mushroom\0"
+                "grapes\0"
+                "melon\0"
+                "watermelon\0"
+                "tangerine\0"
+                "lemon\0"
+                "banana\0"
+                "pineapple\0"
+                "apple\0"
+                "green_apple\0"
+                "pear\0"
+                "peach\0"
+                "cherries\0"
+                "strawberry\0"
+                "kiwi_fruit\0"
+                "tomato\0"
+                "avocado\0"
+                "eggplant\0"
+                "potato\0"
+                "carrot\0"
+                "corn\0"
+                "hot_pepper\0"
+                "cucumber\0"
+                "peanuts\0"
+                "chestnut\0"
+                "bread\0"
+                "croissant\0"
+                "baguette_bread\0"
+                "pancakes\0"
+                "cheese\0"
+                "meat_on_bone\0"
+                "poultry_leg\0"
+                "bacon\0"
+                "hamburger\0"
+                "fries\0"
+                "pizza\0"
+                "hotdog\0"
+                "taco\0"
+                "burrito\0"
+                "stuffed_flatbread\0"
+                "egg\0"
+                "fried_egg\0"
+                "shallow_pan_of_food\0"
+                "stew\0"
+                "green_salad\0"
+                "popcorn\0"
+                "bento\0"
+                "rice_cracker\0"
+                "rice_ball\0"
+                "rice\0"
+                "curry\0"
+                "ramen\0"
+                "spaghetti\0"
+                "sweet_potato\0"
+                "oden\0"
+                "sushi\0"
+                "fried_shrimp\0"
+                "fish_cake\0"
+                "dango\0"
+                "crab\0"
+                "shrimp\0"
+                "squid\0"
+                "icecream\0"
+                "shaved_ice\0"
+                "ice_cream\0"
+                "doughnut\0"
+                "cookie\0"
+                "birthday\0"
+                "cake\0"
+                "chocolate_bar\0"
+                "candy\0"
+                "lollipop\0"
+                "custard\0"
+                "honey_pot\0"
+                "baby_bottle\0"
+                "milk_glass\0"
+                "coffee\0"
+                "tea\0"
+                "sake\0"
+                "champagne\0"
+                "wine_glass\0"
+                "cocktail\0"
+                "tropical_drink\0"
+                "beer\0"
+                "beers\0"
+                "clinking_glasses\0"
+                "tumbler_glass\0"
+                "plate_with_cutlery\0"
+                "fork_and_knife\0"
+                "spoon\0"
+                "hocho\0"
+                "amphora\0"
+                "earth_africa\0"
+                "earth_americas\0"
+                "earth_asia\0"
+                "globe_with_meridians\0"
+                "world_map\0"
+                "japan\0"
+                "mountain_snow\0"
+                "mountain\0"
+                "volcano\0"
+                "mount_fuji\0"
+                "camping\0"
+                "beach_umbrella\0"
+                "desert\0"
+                "desert_island\0"
+                "national_park\0"
+                "stadium\0"
+                "classical_building\0"
+                "building_construction\0"
+                "houses\0"
+                "derelict_house\0"
+                "house\0"
+                "house_with_garden\0"
+                "office\0"
+                "post_office\0"
+                "european_post_office\0"
+                "hospital\0"
+                "bank\0"
+                "hotel\0"
+                "love_hotel\0"
+                "convenience_store\0"
+                "school\0"
+                "department_store\0"
+                "factory\0"
+                "japanese_castle\0"
+                "european_castle\0"
+                "wedding\0"
+                "tokyo_tower\0"
+                "statue_of_liberty\0"
+                "church\0"
+                "mosque\0"
+                "synagogue\0"
+                "shinto_shrine\0"
+                "kaaba\0"
+                "fountain\0"
+                "tent\0"
+                "foggy\0"
+                "night_with_stars\0"
+                "cityscape\0"
+                "sunrise_over_mountains\0"
+                "sunrise\0"
+                "city_sunset\0"
+                "city_sunrise\0"
+                "bridge_at_night\0"
+                "hotsprings\0"
+                "carousel_horse\0"
+                "ferris_wheel\0"
+                "roller_coaster\0"
+                "barber\0"
+                "circus_tent\0"
+                "steam_locomotive\0"
+                "railway_car\0"
+                "bullettrain_side\0"
+                "bullettrain_front\0"
+                "train2\0"
+                "metro\0"
+                "light_rail\0"
+                "station\0"
+                "tram\0"
+                "monorail\0"
+                "mountain_railway\0"
+                "train\0"
+                "bus\0"
+                "oncoming_bus\0"
+                "trolleybus\0"
+                "minibus\0"
+                "ambulance\0"
+                "fire_engine\0"
+                "police_car\0"
+                "oncoming_police_car\0"
+                "taxi\0"
+                "oncoming_taxi\0"
+                "red_car\0"
+                "oncoming_automobile\0"
+                "blue_car\0"
+                "truck\0"
+                "articulated_lorry\0"
+                "tractor\0"
+                "racing_car\0"
+                "motorcycle\0"
+                "motor_scooter\0"
+                "bike\0"
+                "kick_scooter\0"
+                "busstop\0"
+                "motorway\0"
+                "railway_track\0"
+                "oil_drum\0"
+                "fuelpump\0"
+                "rotating_light\0"
+                "traffic_light\0"
+                "vertical_traffic_light\0"
+                "stop_sign\0"
+                "construction\0"
+                "anchor\0"
+                "sailboat\0"
+                "canoe\0"
+                "speedboat\0"
+                "passenger_ship\0"
+                "ferry\0"
+                "motor_boat\0"
+                "ship\0"
+                "airplane\0"
+                "small_airplane\0"
+                "flight_departure\0"
+                "flight_arrival\0"
+                "seat\0"
+                "helicopter\0"
+                "suspension_railway\0"
+                "mountain_cableway\0"
+                "aerial_tramway\0"
+                "artificial_satellite\0"
+                "rocket\0"
+                "bellhop_bell\0"
+                "hourglass\0"
+                "hourglass_flowing_sand\0"
+                "watch\0"
+                "alarm_clock\0"
+                "stopwatch\0"
+                "timer_clock\0"
+                "mantelpiece_clock\0"
+                "clock12\0"
+                "clock1230\0"
+                "clock1\0"
+                "clock130\0"
+                "clock2\0"
+                "clock230\0"
+                "clock3\0"
+                "clock330\0"
+                "clock4\0"
+                "clock430\0"
+                "clock5\0"
+                "clock530\0"
+                "clock6\0"
+                "clock630\0"
+                "clock7\0"
+                "clock730\0"
+                "clock8\0"
+                "clock830\0"
+                "clock9\0"
+                "clock930\0"
+                "clock10\0"
+                "clock1030\0"
+                "clock11\0"
+                "clock1130\0"
+                "new_moon\0"
+                "waxing_crescent_moon\0"
+                "first_quarter_moon\0"
+                "waxing_gibbous_moon\0"
+                "full_moon\0"
+                "waning_gibbous_moon\0"
+                "last_quarter_moon\0"
+                "waning_crescent_moon\0"
+                "crescent_moon\0"
+                "new_moon_with_face\0"
+                "first_quarter_moon_with_face\0"
+                "last_quarter_moon_with_face\0"
+                "thermometer\0"
+                "sunny\0"
+                "full_moon_with_face\0"
+                "sun_with_face\0"
+                "star\0"
+                "star2\0"
+                "stars\0"
+                "milky_way\0"
+                "cloud\0"
+                "partly_sunny\0"
+                "cloud_with_lightning_and_rain\0"
+                "sun_behind_small_cloud\0"
+                "sun_behind_large_cloud\0"
+                "sun_behind_rain_cloud\0"
+                "cloud_with_rain\0"
+                "cloud_with_snow\0"
+                "cloud_with_lightning\0"
+                "tornado\0"
+                "fog\0"
+                "wind_face\0"
+                "cyclone\0"
+                "rainbow\0"
+                "closed_umbrella\0"
+                "open_umbrella\0"
+                "umbrella\0"
+                "parasol_on_ground\0"
+                "zap\0"
+                "snowflake\0"
+                "snowman_with_snow\0"
+                "snowman\0"
+                "comet\0"
+                "fire\0"
+                "droplet\0"
+                "ocean\0"
+                "jack_o_lantern\0"
+                "christmas_tree\0"
+                "fireworks\0"
+                "sparkler\0"
+                "sparkles\0"
+                "balloon\0"
+                "tada\0"
+                "confetti_ball\0"
+                "tanabata_tree\0"
+                "bamboo\0"
+                "dolls\0"
+                "flags\0"
+                "wind_chime\0"
+                "rice_scene\0"
+                "ribbon\0"
+                "gift\0"
+                "reminder_ribbon\0"
+                "tickets\0"
+                "ticket\0"
+                "medal_military\0"
+                "trophy\0"
+                "medal_sports\0"
+                "first_place_medal\0"
+                "second_place_medal\0"
+                "third_place_medal\0"
+                "soccer\0"
+                "baseball\0"
+                "basketball\0"
+                "volleyball\0"
+                "football\0"
+                "rugby_football\0"
+                "tennis\0"
+                "bowling\0"
+                "cricket\0"
+                "field_hockey\0"
+                "ice_hockey\0"
+                "ping_pong\0"
+                "badminton\0"
+                "boxing_glove\0"
+                "martial_arts_uniform\0"
+                "goal_net\0"
+                "golf\0"
+                "ice_skate\0"
+                "fishing_pole_and_fish\0"
+                "running_shirt_with_sash\0"
+                "ski\0"
+                "dart\0"
+                "gun\0"
+                "eight_ball\0"
+                "crystal_ball\0"
+                "video_game\0"
+                "joystick\0"
+                "slot_machine\0"
+                "game_die\0"
+                "spades\0"
+                "hearts\0"
+                "diamonds\0"
+                "clubs\0"
+                "black_joker\0"
+                "mahjong\0"
+                "flower_playing_cards\0"
+                "performing_arts\0"
+                "framed_picture\0"
+                "art\0"
+                "eyeglasses\0"
+                "dark_sunglasses\0"
+                "necktie\0"
+                "tshirt\0"
+                "jeans\0"
+                "dress\0"
+                "kimono\0"
+                "bikini\0"
+                "womans_clothes\0"
+                "purse\0"
+                "handbag\0"
+                "pouch\0"
+                "shopping\0"
+                "school_satchel\0"
+                "mans_shoe\0"
+                "athletic_shoe\0"
+                "high_heel\0"
+                "sandal\0"
+                "boot\0"
+                "crown\0"
+                "womans_hat\0"
+                "tophat\0"
+                "mortar_board\0"
+                "rescue_worker_helmet\0"
+                "prayer_beads\0"
+                "lipstick\0"
+                "ring\0"
+                "gem\0"
+                "mute\0"
+                "speaker\0"
+                "sound\0"
+                "loud_sound\0"
+                "loudspeaker\0"
+                "mega\0"
+                "postal_horn\0"
+                "bell\0"
+                "no_bell\0"
+                "musical_score\0"
+                "musical_note\0"
+                "notes\0"
+                "studio_microphone\0"
+                "level_slider\0"
+                "control_knobs\0"
+                "microphone\0"
+                "headphones\0"
+                "radio\0"
+                "saxophone\0"
+                "guitar\0"
+                "musical_keyboard\0"
+                "trumpet\0"
+                "violin\0"
+                "drum\0"
+                "iphone\0"
+                "calling\0"
+                "phone\0"
+                "telephone_receiver\0"
+                "pager\0"
+                "fax\0"
+                "battery\0"
+                "electric_plug\0"
+                "computer\0"
+                "desktop_computer\0"
+                "printer\0"
+                "keyboard\0"
+                "computer_mouse\0"
+                "trackball\0"
+                "minidisc\0"
+                "floppy_disk\0"
+                "cd\0"
+                "dvd\0"
+                "movie_camera\0"
+                "film_strip\0"
+                "film_projector\0"
+                "clapper\0"
+                "tv\0"
+                "camera\0"
+                "camera_flash\0"
+                "video_camera\0"
+                "vhs\0"
+                "mag\0"
+                "mag_right\0"
+                "candle\0"
+                "bulb\0"
+                "flashlight\0"
+                "izakaya_lantern\0"
+                "notebook_with_decorative_cover\0"
+                "closed_book\0"
+                "open_book\0"
+                "green_book\0"
+                "blue_book\0"
+                "orange_book\0"
+                "books\0"
+                "notebook\0"
+                "ledger\0"
+                "page_with_curl\0"
+                "scroll\0"
+                "page_facing_up\0"
+                "newspaper\0"
+                "newspaper_roll\0"
+                "bookmark_tabs\0"
+                "bookmark\0"
+                "label\0"
+                "moneybag\0"
+                "yen\0"
+                "dollar\0"
+                "euro\0"
+                "pound\0"
+                "money_with_wings\0"
+                "credit_card\0"
+                "chart\0"
+                "email\0"
+                "e_mail\0"
+                "incoming_envelope\0"
+                "envelope_with_arrow\0"
+                "outbox_tray\0"
+                "inbox_tray\0"
+                "package\0"
+                "mailbox\0"
+                "mailbox_closed\0"
+                "mailbox_with_mail\0"
+                "mailbox_with_no_mail\0"
+                "postbox\0"
+                "ballot_box\0"
+                "pencil2\0"
+                "black_nib\0"
+                "fountain_pen\0"
+                "pen\0"
+                "paintbrush\0"
+                "crayon\0"
+                "memo\0"
+                "briefcase\0"
+                "file_folder\0"
+                "open_file_folder\0"
+                "card_index_dividers\0"
+                "date\0"
+                "calendar\0"
+                "spiral_notepad\0"
+                "spiral_calendar\0"
+                "card_index\0"
+                "chart_with_upwards_trend\0"
+                "chart_with_downwards_trend\0"
+                "bar_chart\0"
+                "clipboard\0"
+                "pushpin\0"
+                "round_pushpin\0"
+                "paperclip\0"
+                "paperclips\0"
+                "straight_ruler\0"
+                "triangular_ruler\0"
+                "scissors\0"
+                "card_file_box\0"
+                "file_cabinet\0"
+                "wastebasket\0"
+                "lock\0"
+                "unlock\0"
+                "lock_with_ink_pen\0"
+                "closed_lock_with_key\0"
+                "key\0"
+                "old_key\0"
+                "hammer\0"
+                "pick\0"
+                "hammer_and_pick\0"
+                "hammer_and_wrench\0"
+                "dagger\0"
+                "crossed_swords\0"
+                "bomb\0"
+                "bow_and_arrow\0"
+                "shield\0"
+                "wrench\0"
+                "nut_and_bolt\0"
+                "gear\0"
+                "clamp\0"
+                "balance_scale\0"
+                "link\0"
+                "chains\0"
+                "alembic\0"
+                "microscope\0"
+                "telescope\0"
+                "satellite\0"
+                "syringe\0"
+                "pill\0"
+                "door\0"
+                "bed\0"
+                "couch_and_lamp\0"
+                "toilet\0"
+                "shower\0"
+                "bathtub\0"
+                "shopping_cart\0"
+                "smoking\0"
+                "coffin\0"
+                "funeral_urn\0"
+                "moyai\0"
+                "atm\0"
+                "put_litter_in_its_place\0"
+                "potable_water\0"
+                "wheelchair\0"
+                "mens\0"
+                "womens\0"
+                "restroom\0"
+                "baby_symbol\0"
+                "wc\0"
+                "passport_control\0"
+                "customs\0"
+                "baggage_claim\0"
+                "left_luggage\0"
+                "warning\0"
+                "children_crossing\0"
+                "no_entry\0"
+                "no_entry_sign\0"
+                "no_bicycles\0"
+                "no_smoking\0"
+                "do_not_litter\0"
+                "non_potable_water\0"
+                "no_pedestrians\0"
+                "no_mobile_phones\0"
+                "underage\0"
+                "radioactive\0"
+                "biohazard\0"
+                "arrow_up\0"
+                "arrow_upper_right\0"
+                "arrow_right\0"
+                "arrow_lower_right\0"
+                "arrow_down\0"
+                "arrow_lower_left\0"
+                "arrow_left\0"
+                "arrow_upper_left\0"
+                "arrow_up_down\0"
+                "left_right_arrow\0"
+                "leftwards_arrow_with_hook\0"
+                "arrow_right_hook\0"
+                "arrow_heading_up\0"
+                "arrow_heading_down\0"
+                "arrows_clockwise\0"
+                "arrows_counterclockwise\0"
+                "back\0"
+                "end\0"
+                "on\0"
+                "soon\0"
+                "top\0"
+                "place_of_worship\0"
+                "atom_symbol\0"
+                "om\0"
+                "star_of_david\0"
+                "wheel_of_dharma\0"
+                "yin_yang\0"
+                "latin_cross\0"
+                "orthodox_cross\0"
+                "star_and_crescent\0"
+                "peace_symbol\0"
+                "menorah\0"
+                "six_pointed_star\0"
+                "aries\0"
+                "taurus\0"
+                "gemini\0"
+                "cancer\0"
+                "leo\0"
+                "virgo\0"
+                "libra\0"
+                "scorpius\0"
+                "sagittarius\0"
+                "capricorn\0"
+                "aquarius\0"
+                "pisces\0"
+                "ophiuchus\0"
+                "twisted_rightwards_arrows\0"
+                "repeat\0"
+                "repeat_one\0"
+                "arrow_forward\0"
+                "fast_forward\0"
+                "next_track_button\0"
+                "play_or_pause_button\0"
+                "arrow_backward\0"
+                "rewind\0"
+                "previous_track_button\0"
+                "arrow_up_small\0"
+                "arrow_double_up\0"
+                "arrow_down_small\0"
+                "arrow_double_down\0"
+                "pause_button\0"
+                "stop_button\0"
+                "record_button\0"
+                "cinema\0"
+                "low_brightness\0"
+                "high_brightness\0"
+                "signal_strength\0"
+                "vibration_mode\0"
+                "mobile_phone_off\0"
+                "heavy_multiplication_x\0"
+                "heavy_plus_sign\0"
+                "heavy_minus_sign\0"
+                "heavy_division_sign\0"
+                "bangbang\0"
+                "interrobang\0"
+                "question\0"
+                "grey_question\0"
+                "grey_exclamation\0"
+                "exclamation\0"
+                "wavy_dash\0"
+                "currency_exchange\0"
+                "heavy_dollar_sign\0"
+                "recycle\0"
+                "fleur_de_lis\0"
+                "trident\0"
+                "name_badge\0"
+                "beginner\0"
+                "o\0"
+                "white_check_mark\0"
+                "ballot_box_with_check\0"
+                "heavy_check_mark\0"
+                "x\0"
+                "negative_squared_cross_mark\0"
+                "curly_loop\0"
+                "loop\0"
+                "part_alternation_mark\0"
+                "eight_spoked_asterisk\0"
+                "eight_pointed_black_star\0"
+                "sparkle\0"
+                "copyright\0"
+                "registered\0"
+                "tm\0"
+                "hash\0"
+                "asterisk\0"
+                "zero\0"
+                "one\0"
+                "two\0"
+                "three\0"
+                "four\0"
+                "five\0"
+                "six\0"
+                "seven\0"
+                "eight\0"
+                "nine\0"
+                "keycap_ten\0"
+                "capital_abcd\0"
+                "abcd\0"
+                "one_two_three_four\0"
+                "symbols\0"
+                "abc\0"
+                "a\0"
+                "ab\0"
+                "b\0"
+                "cl\0"
+                "cool\0"
+                "free\0"
+                "information_source\0"
+                "id\0"
+                "m\0"
+                "new_\0"
+                "ng\0"
+                "o2\0"
+                "ok\0"
+                "parking\0"
+                "sos\0"
+                "up\0"
+                "vs\0"
+                "koko\0"
+                "sa\0"
+                "u6708\0"
+                "u6709\0"
+                "u6307\0"
+                "ideograph_advantage\0"
+                "u5272\0"
+                "u7121\0"
+                "u7981\0"
+                "accept\0"
+                "u7533\0"
+                "u5408\0"
+                "u7a7a\0"
+                "congratulations\0"
+                "secret\0"
+                "u55b6\0"
+                "u6e80\0"
+                "red_circle\0"
+                "large_blue_circle\0"
+                "black_circle\0"
+                "white_circle\0"
+                "black_large_square\0"
+                "white_large_square\0"
+                "black_medium_square\0"
+                "white_medium_square\0"
+                "black_medium_small_square\0"
+                "white_medium_small_square\0"
+                "black_small_square\0"
+                "white_small_square\0"
+                "large_orange_diamond\0"
+                "large_blue_diamond\0"
+                "small_orange_diamond\0"
+                "small_blue_diamond\0"
+                "small_red_triangle\0"
+                "small_red_triangle_down\0"
+                "diamond_shape_with_a_dot_inside\0"
+                "radio_button\0"
+                "white_square_button\0"
+                "black_square_button\0"
+                "checkered_flag\0"
+                "triangular_flag_on_post\0"
+                "crossed_flags\0"
+                "black_flag\0"
+                "white_flag\0"
+                "rainbow_flag\0"
+                "andorra\0"
+                "united_arab_emirates\0"
+                "afghanistan\0"
+                "antigua_barbuda\0"
+                "anguilla\0"
+                "albania\0"
+                "armenia\0"
+                "angola\0"
+                "antarctica\0"
+                "argentina\0"
+                "american_samoa\0"
+                "austria\0"
+                "australia\0"
+                "aruba\0"
+                "aland_islands\0"
+                "azerbaijan\0"
+                "bosnia_herzegovina\0"
+                "barbados\0"
+                "bangladesh\0"
+                "belgium\0"
+                "burkina_faso\0"
+                "bulgaria\0"
+                "bahrain\0"
+                "burundi\0"
+                "benin\0"
+                "st_barthelemy\0"
+                "bermuda\0"
+                "brunei\0"
+                "bolivia\0"
+                "caribbean_netherlands\0"
+                "brazil\0"
+                "bahamas\0"
+                "bhutan\0"
+                "botswana\0"
+                "belarus\0"
+                "belize\0"
+                "canada\0"
+                "cocos_islands\0"
+                "congo_kinshasa\0"
+                "central_african_republic\0"
+                "congo_brazzaville\0"
+                "switzerland\0"
+                "cote_divoire\0"
+                "cook_islands\0"
+                "chile\0"
+                "cameroon\0"
+                "cn\0"
+                "colombia\0"
+                "costa_rica\0"
+                "cuba\0"
+                "cape_verde\0"
+                "curacao\0"
+                "christmas_island\0"
+                "cyprus\0"
+                "czech_republic\0"
+                "de\0"
+                "djibouti\0"
+                "denmark\0"
+                "dominica\0"
+                "dominican_republic\0"
+                "algeria\0"
+                "ecuador\0"
+                "estonia\0"
+                "egypt\0"
+                "western_sahara\0"
+                "eritrea\0"
+                "es\0"
+                "ethiopia\0"
+                "eu\0"
+                "finland\0"
+                "fiji\0"
+                "falkland_islands\0"
+                "micronesia\0"
+                "faroe_islands\0"
+                "fr\0"
+                "gabon\0"
+                "uk\0"
+                "grenada\0"
+                "georgia\0"
+                "french_guiana\0"
+                "guernsey\0"
+                "ghana\0"
+                "gibraltar\0"
+                "greenland\0"
+                "gambia\0"
+                "guinea\0"
+                "guadeloupe\0"
+                "equatorial_guinea\0"
+                "greece\0"
+                "south_georgia_south_sandwich_islands\0"
+                "guatemala\0"
+                "guam\0"
+                "guinea_bissau\0"
+                "guyana\0"
+                "hong_kong\0"
+                "honduras\0"
+                "croatia\0"
+                "haiti\0"
+                "hungary\0"
+                "canary_islands\0"
+                "indonesia\0"
+                "ireland\0"
+                "israel\0"
+                "isle_of_man\0"
+                "india\0"
+                "british_indian_ocean_territory\0"
+                "iraq\0"
+                "iran\0"
+                "iceland\0"
+                "it\0"
+                "jersey\0"
+                "jamaica\0"
+                "jordan\0"
+                "jp\0"
+                "kenya\0"
+                "kyrgyzstan\0"
+                "cambodia\0"
+                "kiribati\0"
+                "comoros\0"
+                "st_kitts_nevis\0"
+                "north_korea\0"
+                "kr\0"
+                "kuwait\0"
+                "cayman_islands\0"
+                "kazakhstan\0"
+                "laos\0"
+                "lebanon\0"
+                "st_lucia\0"
+                "liechtenstein\0"
+                "sri_lanka\0"
+                "liberia\0"
+                "lesotho\0"
+                "lithuania\0"
+                "luxembourg\0"
+                "latvia\0"
+                "libya\0"
+                "morocco\0"
+                "monaco\0"
+                "moldova\0"
+                "montenegro\0"
+                "madagascar\0"
+                "marshall_islands\0"
+                "macedonia\0"
+                "mali\0"
+                "myanmar\0"
+                "mongolia\0"
+                "macau\0"
+                "northern_mariana_islands\0"
+                "martinique\0"
+                "mauritania\0"
+                "montserrat\0"
+                "malta\0"
+                "mauritius\0"
+                "maldives\0"
+                "malawi\0"
+                "mexico\0"
+                "malaysia\0"
+                "mozambique\0"
+                "namibia\0"
+                "new_caledonia\0"
+                "niger\0"
+                "norfolk_island\0"
+                "nigeria\0"
+                "nicaragua\0"
+                "netherlands\0"
+                "norway\0"
+                "nepal\0"
+                "nauru\0"
+                "niue\0"
+                "new_zealand\0"
+                "oman\0"
+                "panama\0"
+                "peru\0"
+                "french_polynesia\0"
+                "papua_new_guinea\0"
+                "philippines\0"
+                "pakistan\0"
+                "poland\0"
+                "st_pierre_miquelon\0"
+                "pitcairn_islands\0"
+                "puerto_rico\0"
+                "palestinian_territories\0"
+                "portugal\0"
+                "palau\0"
+                "paraguay\0"
+                "qatar\0"
+                "reunion\0"
+                "romania\0"
+                "serbia\0"
+                "ru\0"
+                "rwanda\0"
+                "saudi_arabia\0"
+                "solomon_islands\0"
+                "seychelles\0"
+                "sudan\0"
+                "sweden\0"
+                "singapore\0"
+                "st_helena\0"
+                "slovenia\0"
+                "slovakia\0"
+                "sierra_leone\0"
+                "san_marino\0"
+                "senegal\0"
+                "somalia\0"
+                "suriname\0"
+                "south_sudan\0"
+                "sao_tome_principe\0"
+                "el_salvador\0"
+                "sint_maarten\0"
+                "syria\0"
+                "swaziland\0"
+                "turks_caicos_islands\0"
+                "chad\0"
+                "french_southern_territories\0"
+                "togo\0"
+                "thailand\0"
+                "tajikistan\0"
+                "tokelau\0"
+                "timor_leste\0"
+                "turkmenistan\0"
+                "tunisia\0"
+                "tonga\0"
+                "tr\0"
+                "trinidad_tobago\0"
+                "tuvalu\0"
+                "taiwan\0"
+                "tanzania\0"
+                "ukraine\0"
+                "uganda\0"
+                "us\0"
+                "uruguay\0"
+                "uzbekistan\0"
+                "vatican_city\0"
+                "st_vincent_grenadines\0"
+                "venezuela\0"
+                "british_virgin_islands\0"
+                "us_virgin_islands\0"
+                "vietnam\0"
+                "vanuatu\0"
+                "wallis_futuna\0"
+                "samoa\0"
+                "kosovo\0"
+                "yemen\0"
+                "mayotte\0"
+                "south_africa\0"
+                "zambia\0"
+                "zimbabwe\0";
+            static constexpr std::uint16_t nameOffsets[count] = {
+                0, 9, 16, 22, 27, 36, 48, 53, 57, 79, 96, 101, 107, 116, 127, 141,
+                149, 157, 177, 198, 202, 219, 248, 277, 294, 299, 308, 326, 339, 354, 363, 369,
+                378, 388, 398, 409, 418, 426, 433, 447, 456, 461, 483, 506, 521, 535, 546, 562,
+                573, 583, 592, 600, 623, 637, 648, 655, 666, 674, 683, 693, 701, 712, 734, 738,
+                742, 749, 760, 770, 783, 789, 795, 806, 814, 819, 825, 837, 841, 847, 868, 873,
+                884, 898, 914, 920, 926, 940, 946, 957, 967, 975, 990, 1000, 1012, 1023, 1039, 1051,
+                1063, 1076, 1090, 1102, 1108, 1119, 1135, 1146, 1156, 1173, 1184, 1201, 1225, 1238, 1244, 1257,
+                1269, 1280, 1293, 1305, 1310, 1322, 1328, 1333, 1339, 1351, 1356, 1361, 1376, 1395, 1414, 1430,
+                1434, 1439, 1459, 1492, 1504, 1518, 1526, 1528, 1544, 1550, 1563, 1574, 1586, 1597, 1600, 1611,
+                1620, 1629, 1639, 1644, 1654, 1664, 1675, 1680, 1693, 1704, 1714, 1719, 1732, 1742, 1749, 1756,
+                1760, 1765, 1770, 1774, 1781, 1786, 1791, 1795, 1800, 1811, 1815, 1821, 1834, 1844, 1856, 1871,
+                1884, 1898, 1910, 1924, 1936, 1945, 1952, 1971, 1988, 2007, 2024, 2035, 2048, 2064, 2082, 2098,
+                2112, 2130, 2150, 2162, 2176, 2188, 2202, 2212, 2224, 2235, 2248, 2257, 2268, 2281, 2296, 2315,
+                2336, 2354, 2374, 2388, 2404, 2421, 2440, 2451, 2464, 2475, 2488, 2498, 2510, 2524, 2540, 2556,
+                2574, 2584, 2596, 2611, 2628, 2638, 2650, 2674, 2700, 2707, 2716, 2732, 2750, 2770, 2784, 2800,
+                2815, 2821, 2827, 2837, 2851, 2863, 2877, 2889, 2901, 2915, 2927, 2941, 2948, 2960, 2985, 2999,
+                3011, 3026, 3039, 3045, 3057, 3069, 3083, 3095, 3109, 3120, 3133, 3146, 3161, 3176, 3193, 3212,
+                3233, 3244, 3257, 3277, 3299, 3316, 3335, 3349, 3365, 3388, 3413, 3434, 3457, 3470, 3485, 3490,
+                3503, 3527, 3534, 3556, 3577, 3596, 3619, 3647, 3673, 3703, 3725, 3751, 3776, 3803, 3822, 3842,
+                3866, 3889, 3914, 3937, 3961, 3989, 4016, 4045, 4060, 4079, 4095, 4115, 4136, 4153, 4174, 4192,
+                4214, 4237, 4251, 4270, 4290, 4311, 4322, 4334, 4341, 4349, 4353, 4358, 4365, 4370, 4379, 4383,
+                4388, 4393, 4399, 4406, 4414, 4420, 4430, 4438, 4443, 4447, 4450, 4464, 4469, 4473, 4478, 4483,
+                4492, 4496, 4502, 4507, 4523, 4529, 4538, 4549, 4555, 4562, 4566, 4574, 4581, 4589, 4598, 4602,
+                4607, 4613, 4624, 4635, 4642, 4650, 4658, 4673, 4684, 4698, 4703, 4711, 4716, 4722, 4727, 4731,
+                4736, 4746, 4753, 4760, 4766, 4778, 4785, 4791, 4798, 4806, 4811, 4825, 4834, 4840, 4848, 4854,
+                4860, 4870, 4874, 4878, 4887, 4894, 4901, 4912, 4921, 4929, 4944, 4957, 4965, 4970, 4984, 4993,
+                5003, 5011, 5017, 5026, 5041, 5056, 5066, 5073, 5085, 5090, 5099, 5116, 5127, 5139, 5146, 5155,
+                5162, 5168, 5179, 5189, 5195, 5202, 5212, 5218, 5230, 5235, 5241, 5250, 5261, 5272, 5279, 5287,
+                5296, 5303, 5310, 5315, 5326, 5335, 5343, 5352, 5358, 5368, 5383, 5392, 5399, 5412, 5424, 5430,
+                5440, 5446, 5452, 5459, 5464, 5472, 5490, 5494, 5504, 5524, 5529, 5541, 5549, 5555, 5568, 5578,
+                5583, 5589, 5595, 5605, 5618, 5623, 5629, 5642, 5652, 5658, 5663, 5670, 5676, 5685, 5696, 5706,
+                5715, 5722, 5731, 5736, 5750, 5756, 5765, 5773, 5783, 5795, 5806, 5813, 5817, 5822, 5832, 5843,
+                5852, 5867, 5872, 5878, 5895, 5909, 5928, 5943, 5949, 5955, 5963, 5976, 5991, 6002, 6023, 6033,
+                6039, 6053, 6062, 6070, 6081, 6089, 6104, 6111, 6125, 6139, 6147, 6166, 6188, 6195, 6210, 6216,
+                6234, 6241, 6253, 6274, 6283, 6288, 6294, 6305, 6323, 6330, 6347, 6355, 6371, 6387, 6395, 6407,
+                6425, 6432, 6439, 6449, 6463, 6469, 6478, 6483, 6489, 6506, 6516, 6539, 6547, 6559, 6572, 6588,
+                6599, 6614, 6627, 6642, 6649, 6661, 6678, 6690, 6707, 6725, 6732, 6738, 6749, 6757, 6762, 6771,
+                6788, 6794, 6798, 6811, 6822, 6830, 6840, 6852, 6863, 6883, 6888, 6902, 6910, 6930, 6939, 6945,
+                6963, 6971, 6982, 6993, 7007, 7012, 7025, 7033, 7042, 7056, 7065, 7074, 7089, 7103, 7126, 7136,
+                7149, 7156, 7165, 7171, 7181, 7196, 7202, 7213, 7218, 7227, 7242, 7259, 7274, 7279, 7290, 7309,
+                7327, 7342, 7363, 7370, 7383, 7393, 7416, 7422, 7434, 7444, 7456, 7474, 7482, 7492, 7499, 7508,
+                7515, 7524, 7531, 7540, 7547, 7556, 7563, 7572, 7579, 7588, 7595, 7604, 7611, 7620, 7627, 7636,
+                7644, 7654, 7662, 7672, 7681, 7702, 7721, 7741, 7751, 7771, 7789, 7810, 7824, 7843, 7872, 7900,
+                7912, 7918, 7938, 7952, 7957, 7963, 7969, 7979, 7985, 7998, 8028, 8051, 8074, 8096, 8112, 8128,
+                8149, 8157, 8161, 8171, 8179, 8187, 8203, 8217, 8226, 8244, 8248, 8258, 8276, 8284, 8290, 8295,
+                8303, 8309, 8324, 8339, 8349, 8358, 8367, 8375, 8380, 8394, 8408, 8415, 8421, 8427, 8438, 8449,
+                8456, 8461, 8477, 8485, 8492, 8507, 8514, 8527, 8545, 8564, 8582, 8589, 8598, 8609, 8620, 8629,
+                8644, 8651, 8659, 8667, 8680, 8691, 8701, 8711, 8724, 8745, 8754, 8759, 8769, 8791, 8815, 8819,
+                8824, 8828, 8839, 8852, 8863, 8872, 8885, 8894, 8901, 8908, 8917, 8923, 8935, 8943, 8964, 8980,
+                8995, 8999, 9010, 9026, 9034, 9041, 9047, 9053, 9060, 9067, 9082, 9088, 9096, 9102, 9111, 9126,
+                9136, 9150, 9160, 9167, 9172, 9178, 9189, 9196, 9209, 9230, 9243, 9252, 9257, 9261, 9266, 9274,
+                9280, 9291, 9303, 9308, 9320, 9325, 9333, 9347, 9360, 9366, 9384, 9397, 9411, 9422, 9433, 9439,
+                9449, 9456, 9473, 9481, 9488, 9493, 9500, 9508, 9514, 9533, 9539, 9543, 9551, 9565, 9574, 9591,
+                9599, 9608, 9623, 9633, 9642, 9654, 9657, 9661, 9674, 9685, 9700, 9708, 9711, 9718, 9731, 9744,
+                9748, 9752, 9762, 9769, 9774, 9785, 9801, 9832, 9844, 9854, 9865, 9875, 9887, 9893, 9902, 9909,
+                9924, 9931, 9946, 9956, 9971, 9985, 9994, 10000, 10009, 10013, 10020, 10025, 10031, 10048, 10060, 10066,
+                10072, 10079, 10097, 10117, 10129, 10140, 10148, 10156, 10171, 10189, 10210, 10218, 10229, 10237, 10247, 10260,
+                10264, 10275, 10282, 10287, 10297, 10309, 10326, 10346, 10351, 10360, 10375, 10391, 10402, 10427, 10454, 10464,
+                10474, 10482, 10496, 10506, 10517, 10532, 10549, 10558, 10572, 10585, 10597, 10602, 10609, 10627, 10648, 10652,
+                10660, 10667, 10672, 10688, 10706, 10713, 10728, 10733, 10747, 10754, 10761, 10774, 10779, 10785, 10799, 10804,
+                10811, 10819, 10830, 10840, 10850, 10858, 10863, 10868, 10872, 10887, 10894, 10901, 10909, 10923, 10931, 10938,
+                10950, 10956, 10960, 10984, 10998, 11009, 11014, 11021, 11030, 11042, 11045, 11062, 11070, 11084, 11097, 11105,
+                11123, 11132, 11146, 11158, 11169, 11183, 11201, 11216, 11233, 11242, 11254, 11264, 11273, 11291, 11303, 11321,
+                11332, 11349, 11360, 11377, 11391, 11408, 11434, 11451, 11468, 11487, 11504, 11528, 11533, 11537, 11540, 11545,
+                11549, 11566, 11578, 11581, 11595, 11611, 11620, 11632, 11647, 11665, 11678, 11686, 11703, 11709, 11716, 11723,
+                11730, 11734, 11740, 11746, 11755, 11767, 11777, 11786, 11793, 11803, 11829, 11836, 11847, 11861, 11874, 11892,
+                11913, 11928, 11935, 11957, 11972, 11988, 12005, 12023, 12036, 12048, 12062, 12069, 12084, 12100, 12116, 12131,
+                12148, 12171, 12187, 12204, 12224, 12233, 12245, 12254, 12268, 12285, 12297, 12307, 12325, 12343, 12351, 12364,
+                12372, 12383, 12392, 12394, 12411, 12433, 12450, 12452, 12480, 12491, 12496, 12518, 12540, 12565, 12573, 12583,
+                12594, 12597, 12602, 12611, 12616, 12620, 12624, 12630, 12635, 12640, 12644, 12650, 12656, 12661, 12672, 12685,
+                12690, 12709, 12717, 12721, 12723, 12726, 12728, 12731, 12736, 12741, 12760, 12763, 12765, 12770, 12773, 12776,
+                12779, 12787, 12791, 12794, 12797, 12802, 12805, 12811, 12817, 12823, 12843, 12849, 12855, 12861, 12868, 12874,
+                12880, 12886, 12902, 12909, 12915, 12921, 12932, 12950, 12963, 12976, 12995, 13014, 13034, 13054, 13080, 13106,
+                13125, 13144, 13165, 13184, 13205, 13224, 13243, 13267, 13299, 13312, 13332, 13352, 13367, 13391, 13405, 13416,
+                13427, 13440, 13448, 13469, 13481, 13497, 13506, 13514, 13522, 13529, 13540, 13550, 13565, 13573, 13583, 13589,
+                13603, 13614, 13633, 13642, 13653, 13661, 13674, 13683, 13691, 13699, 13705, 13719, 13727, 13734, 13742, 13764,
+                13771, 13779, 13786, 13795, 13803, 13810, 13817, 13831, 13846, 13871, 13889, 13901, 13914, 13927, 13933, 13942,
+                13945, 13954, 13965, 13970, 13981, 13989, 14006, 14013, 14028, 14031, 14040, 14048, 14057, 14076, 14084, 14092,
+                14100, 14106, 14121, 14129, 14132, 14141, 14144, 14152, 14157, 14174, 14185, 14199, 14202, 14208, 14211, 14219,
+                14227, 14241, 14250, 14256, 14266, 14276, 14283, 14290, 14301, 14319, 14326, 14363, 14373, 14378, 14392, 14399,
+                14409, 14418, 14426, 14432, 14440, 14455, 14465, 14473, 14480, 14492, 14498, 14529, 14534, 14539, 14547, 14550,
+                14557, 14565, 14572, 14575, 14581, 14592, 14601, 14610, 14618, 14633, 14645, 14648, 14655, 14670, 14681, 14686,
+                14694, 14703, 14717, 14727, 14735, 14743, 14753, 14764, 14771, 14777, 14785, 14792, 14800, 14811, 14822, 14839,
+                14849, 14854, 14862, 14871, 14877, 14902, 14913, 14924, 14935, 14941, 14951, 14960, 14967, 14974, 14983, 14994,
+                15002, 15016, 15022, 15037, 15045, 15055, 15067, 15074, 15080, 15086, 15091, 15103, 15108, 15115, 15120, 15137,
+                15154, 15166, 15175, 15182, 15201, 15218, 15230, 15254, 15263, 15269, 15278, 15284, 15292, 15300, 15307, 15310,
+                15317, 15330, 15346, 15357, 15363, 15370, 15380, 15390, 15399, 15408, 15421, 15432, 15440, 15448, 15457, 15469,
+                15487, 15499, 15512, 15518, 15528, 15549, 15554, 15582, 15587, 15596, 15607, 15615, 15627, 15640, 15648, 15654,
+                15657, 15673, 15680, 15687, 15696, 15704, 15711, 15714, 15722, 15733, 15746, 15768, 15778, 15801, 15819, 15827,
+                15835, 15849, 15855, 15862, 15868, 15876, 15889, 15896,
+            };
+            static constexpr std::uint8_t nameLengths[count] = {
+                8, 6, 5, 4, 8, 11, 4, 3, 21, 16, 4, 5, 8, 10, 13, 7,
+                7, 19, 20, 3, 16, 28, 28, 16, 4, 8, 17, 12, 14, 8, 5, 8,
+                9, 9, 10, 8, 7, 6, 13, 8, 4, 21, 22, 14, 13, 10, 15, 10,
+                9, 8, 7, 22, 13, 10, 6, 10, 7, 8, 9, 7, 10, 21, 3, 3,
+                6, 10, 9, 12, 5, 5, 10, 7, 4, 5, 11, 3, 5, 20, 4, 10,
+                13, 15, 5, 5, 13, 5, 10, 9, 7, 14, 9, 11, 10, 15, 11, 11,
+                12, 13, 11, 5, 10, 15, 10, 9, 16, 10, 16, 23, 12, 5, 12, 11,
+                10, 12, 11, 4, 11, 5, 4, 5, 11, 4, 4, 14, 18, 18, 15, 3,
+                4, 19, 32, 11, 13, 7, 1, 15, 5, 12, 10, 11, 10, 2, 10, 8,
+                8, 9, 4, 9, 9, 10, 4, 12, 10, 9, 4, 12, 9, 6, 6, 3,
+                4, 4, 3, 6, 4, 4, 3, 4, 10, 3, 5, 12, 9, 11, 14, 12,
+                13, 11, 13, 11, 8, 6, 18, 16, 18, 16, 10, 12, 15, 17, 15, 13,
+                17, 19, 11, 13, 11, 13, 9, 11, 10, 12, 8, 10, 12, 14, 18, 20,
+                17, 19, 13, 15, 16, 18, 10, 12, 10, 12, 9, 11, 13, 15, 15, 17,
+                9, 11, 14, 16, 9, 11, 23, 25, 6, 8, 15, 17, 19, 13, 15, 14,
+                5, 5, 9, 13, 11, 13, 11, 11, 13, 11, 13, 6, 11, 24, 13, 11,
+                14, 12, 5, 11, 11, 13, 11, 13, 10, 12, 12, 14, 14, 16, 18, 20,
+                10, 12, 19, 21, 16, 18, 13, 15, 22, 24, 20, 22, 12, 14, 4, 12,
+                23, 6, 21, 20, 18, 22, 27, 25, 29, 21, 25, 24, 26, 18, 19, 23,
+                22, 24, 22, 23, 27, 26, 28, 14, 18, 15, 19, 20, 16, 20, 17, 21,
+                22, 13, 18, 19, 20, 10, 11, 6, 7, 3, 4, 6, 4, 8, 3, 4,
+                4, 5, 6, 7, 5, 9, 7, 4, 3, 2, 13, 4, 3, 4, 4, 8,
+                3, 5, 4, 15, 5, 8, 10, 5, 6, 3, 7, 6, 7, 8, 3, 4,
+                5, 10, 10, 6, 7, 7, 14, 10, 13, 4, 7, 4, 5, 4, 3, 4,
+                9, 6, 6, 5, 11, 6, 5, 6, 7, 4, 13, 8, 5, 7, 5, 5,
+                9, 3, 3, 8, 6, 6, 10, 8, 7, 14, 12, 7, 4, 13, 8, 9,
+                7, 5, 8, 14, 14, 9, 6, 11, 4, 8, 16, 10, 11, 6, 8, 6,
+                5, 10, 9, 5, 6, 9, 5, 11, 4, 5, 8, 10, 10, 6, 7, 8,
+                6, 6, 4, 10, 8, 7, 8, 5, 9, 14, 8, 6, 12, 11, 5, 9,
+                5, 5, 6, 4, 7, 17, 3, 9, 19, 4, 11, 7, 5, 12, 9, 4,
+                5, 5, 9, 12, 4, 5, 12, 9, 5, 4, 6, 5, 8, 10, 9, 8,
+                6, 8, 4, 13, 5, 8, 7, 9, 11, 10, 6, 3, 4, 9, 10, 8,
+                14, 4, 5, 16, 13, 18, 14, 5, 5, 7, 12, 14, 10, 20, 9, 5,
+                13, 8, 7, 10, 7, 14, 6, 13, 13, 7, 18, 21, 6, 14, 5, 17,
+                6, 11, 20, 8, 4, 5, 10, 17, 6, 16, 7, 15, 15, 7, 11, 17,
+                6, 6, 9, 13, 5, 8, 4, 5, 16, 9, 22, 7, 11, 12, 15, 10,
+                14, 12, 14, 6, 11, 16, 11, 16, 17, 6, 5, 10, 7, 4, 8, 16,
+                5, 3, 12, 10, 7, 9, 11, 10, 19, 4, 13, 7, 19, 8, 5, 17,
+                7, 10, 10, 13, 4, 12, 7, 8, 13, 8, 8, 14, 13, 22, 9, 12,
+                6, 8, 5, 9, 14, 5, 10, 4, 8, 14, 16, 14, 4, 10, 18, 17,
+                14, 20, 6, 12, 9, 22, 5, 11, 9, 11, 17, 7, 9, 6, 8, 6,
+                8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 7,
+                9, 7, 9, 8, 20, 18, 19, 9, 19, 17, 20, 13, 18, 28, 27, 11,
+                5, 19, 13, 4, 5, 5, 9, 5, 12, 29, 22, 22, 21, 15, 15, 20,
+                7, 3, 9, 7, 7, 15, 13, 8, 17, 3, 9, 17, 7, 5, 4, 7,
+                5, 14, 14, 9, 8, 8, 7, 4, 13, 13, 6, 5, 5, 10, 10, 6,
+                4, 15, 7, 6, 14, 6, 12, 17, 18, 17, 6, 8, 10, 10, 8, 14,
+                6, 7, 7, 12, 10, 9, 9, 12, 20, 8, 4, 9, 21, 23, 3, 4,
+                3, 10, 12, 10, 8, 12, 8, 6, 6, 8, 5, 11, 7, 20, 15, 14,
+                3, 10, 15, 7, 6, 5, 5, 6, 6, 14, 5, 7, 5, 8, 14, 9,
+                13, 9, 6, 4, 5, 10, 6, 12, 20, 12, 8, 4, 3, 4, 7, 5,
+                10, 11, 4, 11, 4, 7, 13, 12, 5, 17, 12, 13, 10, 10, 5, 9,
+                6, 16, 7, 6, 4, 6, 7, 5, 18, 5, 3, 7, 13, 8, 16, 7,
+                8, 14, 9, 8, 11, 2, 3, 12, 10, 14, 7, 2, 6, 12, 12, 3,
+                3, 9, 6, 4, 10, 15, 30, 11, 9, 10, 9, 11, 5, 8, 6, 14,
+                6, 14, 9, 14, 13, 8, 5, 8, 3, 6, 4, 5, 16, 11, 5, 5,
+                6, 17, 19, 11, 10, 7, 7, 14, 17, 20, 7, 10, 7, 9, 12, 3,
+                10, 6, 4, 9, 11, 16, 19, 4, 8, 14, 15, 10, 24, 26, 9, 9,
+                7, 13, 9, 10, 14, 16, 8, 13, 12, 11, 4, 6, 17, 20, 3, 7,
+                6, 4, 15, 17, 6, 14, 4, 13, 6, 6, 12, 4, 5, 13, 4, 6,
+                7, 10, 9, 9, 7, 4, 4, 3, 14, 6, 6, 7, 13, 7, 6, 11,
+                5, 3, 23, 13, 10, 4, 6, 8, 11, 2, 16, 7, 13, 12, 7, 17,
+                8, 13, 11, 10, 13, 17, 14, 16, 8, 11, 9, 8, 17, 11, 17, 10,
+                16, 10, 16, 13, 16, 25, 16, 16, 18, 16, 23, 4, 3, 2, 4, 3,
+                16, 11, 2, 13, 15, 8, 11, 14, 17, 12, 7, 16, 5, 6, 6, 6,
+                3, 5, 5, 8, 11, 9, 8, 6, 9, 25, 6, 10, 13, 12, 17, 20,
+                14, 6, 21, 14, 15, 16, 17, 12, 11, 13, 6, 14, 15, 15, 14, 16,
+                22, 15, 16, 19, 8, 11, 8, 13, 16, 11, 9, 17, 17, 7, 12, 7,
+                10, 8, 1, 16, 21, 16, 1, 27, 10, 4, 21, 21, 24, 7, 9, 10,
+                2, 4, 8, 4, 3, 3, 5, 4, 4, 3, 5, 5, 4, 10, 12, 4,
+                18, 7, 3, 1, 2, 1, 2, 4, 4, 18, 2, 1, 4, 2, 2, 2,
+                7, 3, 2, 2, 4, 2, 5, 5, 5, 19, 5, 5, 5, 6, 5, 5,
+                5, 15, 6, 5, 5, 10, 17, 12, 12, 18, 18, 19, 19, 25, 25, 18,
+                18, 20, 18, 20, 18, 18, 23, 31, 12, 19, 19, 14, 23, 13, 10, 10,
+                12, 7, 20, 11, 15, 8, 7, 7, 6, 10, 9, 14, 7, 9, 5, 13,
+                10, 18, 8, 10, 7, 12, 8, 7, 7, 5, 13, 7, 6, 7, 21, 6,
+                7, 6, 8, 7, 6, 6, 13, 14, 24, 17, 11, 12, 12, 5, 8, 2,
+                8, 10, 4, 10, 7, 16, 6, 14, 2, 8, 7, 8, 18, 7, 7, 7,
+                5, 14, 7, 2, 8, 2, 7, 4, 16, 10, 13, 2, 5, 2, 7, 7,
+                13, 8, 5, 9, 9, 6, 6, 10, 17, 6, 36, 9, 4, 13, 6, 9,
+                8, 7, 5, 7, 14, 9, 7, 6, 11, 5, 30, 4, 4, 7, 2, 6,
+                7, 6, 2, 5, 10, 8, 8, 7, 14, 11, 2, 6, 14, 10, 4, 7,
+                8, 13, 9, 7, 7, 9, 10, 6, 5, 7, 6, 7, 10, 10, 16, 9,
+                4, 7, 8, 5, 24, 10, 10, 10, 5, 9, 8, 6, 6, 8, 10, 7,
+                13, 5, 14, 7, 9, 11, 6, 5, 5, 4, 11, 4, 6, 4, 16, 16,
+                11, 8, 6, 18, 16, 11, 23, 8, 5, 8, 5, 7, 7, 6, 2, 6,
+                12, 15, 10, 5, 6, 9, 9, 8, 8, 12, 10, 7, 7, 8, 11, 17,
+                11, 12, 5, 9, 20, 4, 27, 4, 8, 10, 7, 11, 12, 7, 5, 2,
+                15, 6, 6, 8, 7, 6, 2, 7, 10, 12, 21, 9, 22, 17, 7, 7,
+                13, 5, 6, 5, 7, 12, 6, 8,
+            };
+            static constexpr std::size_t longestName = 36;
+
+            // The ASCII replacements, each followed by a null character
+            static constexpr char text[] =
+                ":grinning:\0"
+                ":smiley:\0"
+                ":smile:\0"
+                ":grin:\0"
+                ":laughing:\0"
+                ":sweat_smile:\0"
+                ":rofl:\0"
+                ":joy:\0"
+                ":slightly_smiling_face:\0"
+                ":upside_down_face:\0"
+                ":wink:\0"
+                ":blush:\0"
+                ":innocent:\0"
+                ":heart_eyes:\0"
+                ":kissing_heart:\0"
+                ":kissing:\0"
+                ":relaxed:\0"
+                ":kissing_closed_eyes:\0"
+                ":kissing_smiling_eyes:\0"
+                ":yum:\0"
+                ":stuck_out_tongue:\0"
+                ":stuck_out_tongue_winking_eye:\0"
+                ":stuck_out_tongue_closed_eyes:\0"
+                ":money_mouth_face:\0"
+                ":hugs:\0"
+                "[hmm]\0"
+                ":zipper_mouth_face:\0"
+                ":neutral_face:\0"
+                ":expressionless:\0"
+                ":no_mouth:\0"
+                ":smirk:\0"
+                ":unamused:\0"
+                ":roll_eyes:\0"
+                ":grimacing:\0"
+                ":lying_face:\0"
+                ":relieved:\0"
+                ":pensive:\0"
+                ":sleepy:\0"
+                ":drooling_face:\0"
+                ":sleeping:\0"
+                ":mask:\0"
+                ":face_with_thermometer:\0"
+                ":face_with_head_bandage:\0"
+                ":nauseated_face:\0"
+                ":sneezing_face:\0"
+                ":dizzy_face:\0"
+                ":cowboy_hat_face:\0"
+                ":sunglasses:\0"
+                ":nerd_face:\0"
+                ":confused:\0"
+                ":worried:\0"
+                ":slightly_frowning_face:\0"
+                ":frowning_face:\0"
+                ":open_mouth:\0"
+                ":hushed:\0"
+                ":astonished:\0"
+                ":flushed:\0"
+                ":frowning:\0"
+                ":anguished:\0"
+                ":fearful:\0"
+                ":cold_sweat:\0"
+                ":disappointed_relieved:\0"
+                ":cry:\0"
+                ":sob:\0"
+                ":scream:\0"
+                ":confounded:\0"
+                ":persevere:\0"
+                ":disappointed:\0"
+                ":sweat:\0"
+                ":weary:\0"
+                ":tired_face:\0"
+                ":triumph:\0"
+                ":rage:\0"
+                ":angry:\0"
+                ":smiling_imp:\0"
+                ":imp:\0"
+                "[dead]\0"
+                ":skull_and_crossbones:\0"
+                ":poop:\0"
+                ":clown_face:\0"
+                ":japanese_ogre:\0"
+                ":japanese_goblin:\0"
+                ":ghost:\0"
+                "[?]\0"
+                ":space_invader:\0"
+                ":robot:\0"
+                ":smiley_cat:\0"
+                ":smile_cat:\0"
+                ":joy_cat:\0"
+                ":heart_eyes_cat:\0"
+                ":smirk_cat:\0"
+                ":kissing_cat:\0"
+                ":scream_cat:\0"
+                ":crying_cat_face:\0"
+                ":pouting_cat:\0"
+                ":see_no_evil:\0"
+                ":hear_no_evil:\0"
+                ":speak_no_evil:\0"
+                ":love_letter:\0"
+                ":cupid:\0"
+                ":gift_heart:\0"
+                ":sparkling_heart:\0"
+                ":heartpulse:\0"
+                ":heartbeat:\0"
+                ":revolving_hearts:\0"
+                ":two_hearts:\0"
+                ":heart_decoration:\0"
+                ":heavy_heart_exclamation:\0"
+                ":broken_heart:\0"
+                "<3\0"
+                ":yellow_heart:\0"
+                ":green_heart:\0"
+                ":blue_heart:\0"
+                ":purple_heart:\0"
+                ":black_heart:\0"
+                ":kiss:\0"
+                "100\0"
+                ":anger:\0"
+                "[!!]\0"
+                ":dizzy:\0"
+                ":sweat_drops:\0"
+                ":dash:\0"
+                ":hole:\0"
+                ":speech_balloon:\0"
+                ":left_speech_bubble:\0"
+                ":right_anger_bubble:\0"
+                ":thought_balloon:\0"
+                ":zzz:\0"
+                "[hi]\0"
+                ":raised_back_of_hand:\0"
+                ":raised_hand_with_fingers_splayed:\0"
+                ":raised_hand:\0"
+                ":vulcan_salute:\0"
+                ":ok_hand:\0"
+                ":v:\0"
+                ":crossed_fingers:\0"
+                ":metal:\0"
+                ":call_me_hand:\0"
+                ":point_left:\0"
+                ":point_right:\0"
+                ":point_up_2:\0"
+                ":fu:\0"
+                ":point_down:\0"
+                ":point_up:\0"
+                ":plus_one:\0"
+                ":minus_one:\0"
+                ":fist:\0"
+                ":facepunch:\0"
+                ":fist_left:\0"
+                ":fist_right:\0"
+                "[yay]\0"
+                ":raised_hands:\0"
+                ":open_hands:\0"
+                ":handshake:\0"
+                ":pray:\0"
+                ":writing_hand:\0"
+                ":nail_care:\0"
+                ":selfie:\0"
+                ":muscle:\0"
+                ":ear:\0"
+                ":nose:\0"
+                "[look]\0"
+                ":eye:\0"
+                ":tongue:\0"
+                ":lips:\0"
+                ":baby:\0"
+                ":boy:\0"
+                ":girl:\0"
+                ":blonde_man:\0"
+                ":man:\0"
+                ":woman:\0"
+                ":blonde_woman:\0"
+                ":older_man:\0"
+                ":older_woman:\0"
+                ":frowning_woman:\0"
+                ":frowning_man:\0"
+                ":pouting_woman:\0"
+                ":pouting_man:\0"
+                ":no_good_woman:\0"
+                ":no_good_man:\0"
+                ":ok_woman:\0"
+                ":ok_man:\0"
+                ":tipping_hand_woman:\0"
+                ":tipping_hand_man:\0"
+                ":raising_hand_woman:\0"
+                ":raising_hand_man:\0"
+                ":bowing_man:\0"
+                ":bowing_woman:\0"
+                ":man_facepalming:\0"
+                ":woman_facepalming:\0"
+                ":woman_shrugging:\0"
+                ":man_shrugging:\0"
+                ":man_health_worker:\0"
+                ":woman_health_worker:\0"
+                ":man_student:\0"
+                ":woman_student:\0"
+                ":man_teacher:\0"
+                ":woman_teacher:\0"
+                ":man_judge:\0"
+                ":woman_judge:\0"
+                ":man_farmer:\0"
+                ":woman_farmer:\0"
+                ":man_cook:\0"
+                ":woman_cook:\0"
+                ":man_mechanic:\0"
+                ":woman_mechanic:\0"
+                ":man_factory_worker:\0"
+                ":woman_factory_worker:\0"
+                ":man_office_worker:\0"
+                ":woman_office_worker:\0"
+                ":man_scientist:\0"
+                ":woman_scientist:\0"
+                ":man_technologist:\0"
+                ":woman_technologist:\0"
+                ":man_singer:\0"
+                ":woman_singer:\0"
+                ":man_artist:\0"
+                ":woman_artist:\0"
+                ":man_pilot:\0"
+                ":woman_pilot:\0"
+                ":man_astronaut:\0"
+                ":woman_astronaut:\0"
+                ":man_firefighter:\0"
+                ":woman_firefighter:\0"
+                ":policeman:\0"
+                ":policewoman:\0"
+                ":male_detective:\0"
+                ":female_detective:\0"
+                ":guardsman:\0"
+                ":guardswoman:\0"
+                ":construction_worker_man:\0"
+                ":construction_worker_woman:\0"
+                ":prince:\0"
+                ":princess:\0"
+                ":man_with_turban:\0"
+                ":woman_with_turban:\0"
+                ":man_with_gua_pi_mao:\0"
+                ":man_in_tuxedo:\0"
+                ":bride_with_veil:\0"
+                ":pregnant_woman:\0"
+                ":angel:\0"
+                ":santa:\0"
+                ":mrs_claus:\0"
+                ":massage_woman:\0"
+                ":massage_man:\0"
+                ":haircut_woman:\0"
+                ":haircut_man:\0"
+                ":walking_man:\0"
+                ":walking_woman:\0"
+                ":running_man:\0"
+                ":running_woman:\0"
+                ":dancer:\0"
+                ":man_dancing:\0"
+                ":business_suit_levitating:\0"
+                ":dancing_women:\0"
+                ":dancing_men:\0"
+                ":person_fencing:\0"
+                ":horse_racing:\0"
+                ":skier:\0"
+                ":snowboarder:\0"
+                ":golfing_man:\0"
+                ":golfing_woman:\0"
+                ":surfing_man:\0"
+                ":surfing_woman:\0"
+                ":rowing_man:\0"
+                ":rowing_woman:\0"
+                ":swimming_man:\0"
+                ":swimming_woman:\0"
+                ":basketball_man:\0"
+                ":basketball_woman:\0"
+                ":weight_lifting_man:\0"
+                ":weight_lifting_woman:\0"
+                ":biking_man:\0"
+                ":biking_woman:\0"
+                ":mountain_biking_man:\0"
+                ":mountain_biking_woman:\0"
+                ":man_cartwheeling:\0"
+                ":woman_cartwheeling:\0"
+                ":men_wrestling:\0"
+                ":women_wrestling:\0"
+                ":man_playing_water_polo:\0"
+                ":woman_playing_water_polo:\0"
+                ":man_playing_handball:\0"
+                ":woman_playing_handball:\0"
+                ":man_juggling:\0"
+                ":woman_juggling:\0"
+                ":bath:\0"
+                ":sleeping_bed:\0"
+                ":two_women_holding_hands:\0"
+                ":couple:\0"
+                ":two_men_holding_hands:\0"
+                ":couplekiss_man_woman:\0"
+                ":couplekiss_man_man:\0"
+                ":couplekiss_woman_woman:\0"
+                ":couple_with_heart_woman_man:\0"
+                ":couple_with_heart_man_man:\0"
+                ":couple_with_heart_woman_woman:\0"
+                ":family_man_woman_girl:\0"
+                ":family_man_woman_girl_boy:\0"
+                ":family_man_woman_boy_boy:\0"
+                ":family_man_woman_girl_girl:\0"
+                ":family_man_man_boy:\0"
+                ":family_man_man_girl:\0"
+                ":family_man_man_girl_boy:\0"
+                ":family_man_man_boy_boy:\0"
+                ":family_man_man_girl_girl:\0"
+                ":family_woman_woman_boy:\0"
+                ":family_woman_woman_girl:\0"
+                ":family_woman_woman_girl_boy:\0"
+                ":family_woman_woman_boy_boy:\0"
+                ":family_woman_woman_girl_girl:\0"
+                ":family_man_boy:\0"
+                ":family_man_boy_boy:\0"
+                ":family_man_girl:\0"
+                ":family_man_girl_boy:\0"
+                ":family_man_girl_girl:\0"
+                ":family_woman_boy:\0"
+                ":family_woman_boy_boy:\0"
+                ":family_woman_girl:\0"
+                ":family_woman_girl_boy:\0"
+                ":family_woman_girl_girl:\0"
+                ":speaking_head:\0"
+                ":bust_in_silhouette:\0"
+                ":busts_in_silhouette:\0"
+                ":family_man_woman_boy:\0"
+                ":footprints:\0"
+                ":monkey_face:\0"
+                ":monkey:\0"
+                ":gorilla:\0"
+                ":dog:\0"
+                ":dog2:\0"
+                ":poodle:\0"
+                ":wolf:\0"
+                ":fox_face:\0"
+                ":cat:\0"
+                ":cat2:\0"
+                ":lion:\0"
+                ":tiger:\0"
+                ":tiger2:\0"
+                ":leopard:\0"
+                ":horse:\0"
+                ":racehorse:\0"
+                ":unicorn:\0"
+                ":deer:\0"
+                ":cow:\0"
+                ":ox:\0"
+                ":water_buffalo:\0"
+                ":cow2:\0"
+                ":pig:\0"
+                ":pig2:\0"
+                ":boar:\0"
+                ":pig_nose:\0"
+                ":ram:\0"
+                ":sheep:\0"
+                ":goat:\0"
+                ":dromedary_camel:\0"
+                ":camel:\0"
+                ":elephant:\0"
+                ":rhinoceros:\0"
+                ":mouse:\0"
+                ":mouse2:\0"
+                ":rat:\0"
+                ":hamster:\0"
+                ":rabbit:\0"
+                ":rabbit2:\0"
+                ":chipmunk:\0"
+                ":bat:\0"
+                ":bear:\0"
+                ":koala:\0"
+                ":panda_face:\0"
+                ":paw_prints:\0"
+                ":turkey:\0"
+                ":chicken:\0"
+                ":rooster:\0"
+                ":hatching_chick:\0"
+                ":baby_chick:\0"
+                ":hatched_chick:\0"
+                ":bird:\0"
+                ":penguin:\0"
+                ":dove:\0"
+                ":eagle:\0"
+                ":duck:\0"
+                ":owl:\0"
+                ":frog:\0"
+                ":crocodile:\0"
+                "[slow]\0"
+                ":lizard:\0"
+                ":snake:\0"
+                ":dragon_face:\0"
+                ":dragon:\0"
+                ":whale:\0"
+                ":whale2:\0"
+                ":dolphin:\0"
+                ":fish:\0"
+                ":tropical_fish:\0"
+                ":blowfish:\0"
+                ":shark:\0"
+                ":octopus:\0"
+                ":shell:\0"
+                "[slow]\0"
+                ":butterfly:\0"
+                "[bug]\0"
+                ":ant:\0"
+                ":honeybee:\0"
+                ":beetle:\0"
+                ":spider:\0"
+                ":spider_web:\0"
+                ":scorpion:\0"
+                ":bouquet:\0"
+                ":cherry_blossom:\0"
+                ":white_flower:\0"
+                ":rosette:\0"
+                ":rose:\0"
+                ":wilted_flower:\0"
+                ":hibiscus:\0"
+                ":sunflower:\0"
+                ":blossom:\0"
+                ":tulip:\0"
+                ":seedling:\0"
+                ":evergreen_tree:\0"
+                ":deciduous_tree:\0"
+                ":palm_tree:\0"
+                ":cactus:\0"
+                ":ear_of_rice:\0"
+                ":herb:\0"
+                ":shamrock:\0"
+                ":four_leaf_clover:\0"
+                ":maple_leaf:\0"
+                ":fallen_leaf:\0"
+                ":leaves:\0"
+                ":mushroom:\0"
+                ":grapes:\0"
+                ":melon:\0"
+                ":watermelon:\0"
+                ":tangerine:\0"
+                ":lemon:\0"
+                ":banana:\0"
+                ":pineapple:\0"
+                ":apple:\0"
+                ":green_apple:\0"
+                ":pear:\0"
+                ":peach:\0"
+                ":cherries:\0"
+                ":strawberry:\0"
+                ":kiwi_fruit:\0"
+                ":tomato:\0"
+                ":avocado:\0"
+                ":eggplant:\0"
+                ":potato:\0"
+                ":carrot:\0"
+                ":corn:\0"
+                ":hot_pepper:\0"
+                ":cucumber:\0"
+                ":peanuts:\0"
+                ":chestnut:\0"
+                ":bread:\0"
+                ":croissant:\0"
+                ":baguette_bread:\0"
+                ":pancakes:\0"
+                ":cheese:\0"
+                ":meat_on_bone:\0"
+                ":poultry_leg:\0"
+                ":bacon:\0"
+                ":hamburger:\0"
+                ":fries:\0"
+                ":pizza:\0"
+                ":hotdog:\0"
+                ":taco:\0"
+                ":burrito:\0"
+                ":stuffed_flatbread:\0"
+                ":egg:\0"
+                ":fried_egg:\0"
+                ":shallow_pan_of_food:\0"
+                ":stew:\0"
+                ":green_salad:\0"
+                ":popcorn:\0"
+                ":bento:\0"
+                ":rice_cracker:\0"
+                ":rice_ball:\0"
+                ":rice:\0"
+                ":curry:\0"
+                ":ramen:\0"
+                ":spaghetti:\0"
+                ":sweet_potato:\0"
+                ":oden:\0"
+                ":sushi:\0"
+                ":fried_shrimp:\0"
+                ":fish_cake:\0"
+                ":dango:\0"
+                ":crab:\0"
+                ":shrimp:\0"
+                ":squid:\0"
+                ":icecream:\0"
+                ":shaved_ice:\0"
+                ":ice_cream:\0"
+                ":doughnut:\0"
+                ":cookie:\0"
+                ":birthday:\0"
+                ":cake:\0"
+                ":chocolate_bar:\0"
+                ":candy:\0"
+                ":lollipop:\0"
+                ":custard:\0"
+                ":honey_pot:\0"
+                ":baby_bottle:\0"
+                ":milk_glass:\0"
+                ":coffee:\0"
+                ":tea:\0"
+                ":sake:\0"
+                ":champagne:\0"
+                ":wine_glass:\0"
+                ":cocktail:\0"
+                ":tropical_drink:\0"
+                ":beer:\0"
+                ":beers:\0"
+                ":clinking_glasses:\0"
+                ":tumbler_glass:\0"
+                ":plate_with_cutlery:\0"
+                ":fork_and_knife:\0"
+                ":spoon:\0"
+                ":hocho:\0"
+                ":amphora:\0"
+                ":earth_africa:\0"
+                ":earth_americas:\0"
+                ":earth_asia:\0"
+                ":globe_with_meridians:\0"
+                ":world_map:\0"
+                ":japan:\0"
+                ":mountain_snow:\0"
+                ":mountain:\0"
+                ":volcano:\0"
+                ":mount_fuji:\0"
+                ":camping:\0"
+                ":beach_umbrella:\0"
+                ":desert:\0"
+                ":desert_island:\0"
+                ":national_park:\0"
+                ":stadium:\0"
+                ":classical_building:\0"
+                ":building_construction:\0"
+                ":houses:\0"
+                ":derelict_house:\0"
+                ":house:\0"
+                ":house_with_garden:\0"
+                ":office:\0"
+                ":post_office:\0"
+                ":european_post_office:\0"
+                ":hospital:\0"
+                ":bank:\0"
+                ":hotel:\0"
+                ":love_hotel:\0"
+                ":convenience_store:\0"
+                ":school:\0"
+                ":department_store:\0"
+                ":factory:\0"
+                ":japanese_castle:\0"
+                ":european_castle:\0"
+                ":wedding:\0"
+                ":tokyo_tower:\0"
+                ":statue_of_liberty:\0"
+                ":church:\0"
+                ":mosque:\0"
+                ":synagogue:\0"
+                ":shinto_shrine:\0"
+                ":kaaba:\0"
+                ":fountain:\0"
+                ":tent:\0"
+                ":foggy:\0"
+                ":night_with_stars:\0"
+                ":cityscape:\0"
+                ":sunrise_over_mountains:\0"
+                ":sunrise:\0"
+                ":city_sunset:\0"
+                ":city_sunrise:\0"
+                ":bridge_at_night:\0"
+                ":hotsprings:\0"
+                ":carousel_horse:\0"
+                ":ferris_wheel:\0"
+                ":roller_coaster:\0"
+                ":barber:\0"
+                ":circus_tent:\0"
+                ":steam_locomotive:\0"
+                ":railway_car:\0"
+                ":bullettrain_side:\0"
+                ":bullettrain_front:\0"
+                ":train2:\0"
+                ":metro:\0"
+                ":light_rail:\0"
+                ":station:\0"
+                ":tram:\0"
+                ":monorail:\0"
+                ":mountain_railway:\0"
+                ":train:\0"
+                ":bus:\0"
+                ":oncoming_bus:\0"
+                ":trolleybus:\0"
+                ":minibus:\0"
+                ":ambulance:\0"
+                ":fire_engine:\0"
+                ":police_car:\0"
+                ":oncoming_police_car:\0"
+                ":taxi:\0"
+                ":oncoming_taxi:\0"
+                ":red_car:\0"
+                ":oncoming_automobile:\0"
+                ":blue_car:\0"
+                "[ship]\0"
+                ":articulated_lorry:\0"
+                ":tractor:\0"
+                ":racing_car:\0"
+                ":motorcycle:\0"
+                ":motor_scooter:\0"
+                ":bike:\0"
+                ":kick_scooter:\0"
+                ":busstop:\0"
+                ":motorway:\0"
+                ":railway_track:\0"
+                ":oil_drum:\0"
+                ":fuelpump:\0"
+                "[!]\0"
+                ":traffic_light:\0"
+                ":vertical_traffic_light:\0"
+                "[stop]\0"
+                "[wip]\0"
+                ":anchor:\0"
+                ":sailboat:\0"
+                ":canoe:\0"
+                ":speedboat:\0"
+                ":passenger_ship:\0"
+                ":ferry:\0"
+                ":motor_boat:\0"
+                ":ship:\0"
+                ":airplane:\0"
+                ":small_airplane:\0"
+                ":flight_departure:\0"
+                ":flight_arrival:\0"
+                ":seat:\0"
+                ":helicopter:\0"
+                ":suspension_railway:\0"
+                ":mountain_cableway:\0"
+                ":aerial_tramway:\0"
+                ":artificial_satellite:\0"
+                ">>\0"
+                ":bellhop_bell:\0"
+                "[wait]\0"
+                "[wait]\0"
+                ":watch:\0"
+                "[time]\0"
+                "[time]\0"
+                "[time]\0"
+                ":mantelpiece_clock:\0"
+                ":clock12:\0"
+                ":clock1230:\0"
+                ":clock1:\0"
+                ":clock130:\0"
+                ":clock2:\0"
+                ":clock230:\0"
+                ":clock3:\0"
+                ":clock330:\0"
+                ":clock4:\0"
+                ":clock430:\0"
+                ":clock5:\0"
+                ":clock530:\0"
+                ":clock6:\0"
+                ":clock630:\0"
+                ":clock7:\0"
+                ":clock730:\0"
+                ":clock8:\0"
+                ":clock830:\0"
+                ":clock9:\0"
+                ":clock930:\0"
+                ":clock10:\0"
+                ":clock1030:\0"
+                ":clock11:\0"
+                ":clock1130:\0"
+                ":new_moon:\0"
+                ":waxing_crescent_moon:\0"
+                ":first_quarter_moon:\0"
+                ":waxing_gibbous_moon:\0"
+                ":full_moon:\0"
+                ":waning_gibbous_moon:\0"
+                ":last_quarter_moon:\0"
+                ":waning_crescent_moon:\0"
+                ":crescent_moon:\0"
+                ":new_moon_with_face:\0"
+                ":first_quarter_moon_with_face:\0"
+                ":last_quarter_moon_with_face:\0"
+                ":thermometer:\0"
+                ":sunny:\0"
+                ":full_moon_with_face:\0"
+                ":sun_with_face:\0"
+                "*\0"
+                "*\0"
+                ":stars:\0"
+                ":milky_way:\0"
+                ":cloud:\0"
+                ":partly_sunny:\0"
+                ":cloud_with_lightning_and_rain:\0"
+                ":sun_behind_small_cloud:\0"
+                ":sun_behind_large_cloud:\0"
+                ":sun_behind_rain_cloud:\0"
+                ":cloud_with_rain:\0"
+                ":cloud_with_snow:\0"
+                ":cloud_with_lightning:\0"
+                ":tornado:\0"
+                ":fog:\0"
+                ":wind_face:\0"
+                ":cyclone:\0"
+                ":rainbow:\0"
+                ":closed_umbrella:\0"
+                ":open_umbrella:\0"
+                ":umbrella:\0"
+                ":parasol_on_ground:\0"
+                "*\0"
+                ":snowflake:\0"
+                ":snowman_with_snow:\0"
+                ":snowman:\0"
+                ":comet:\0"
+                "[!]\0"
+                ":droplet:\0"
+                ":ocean:\0"
+                ":jack_o_lantern:\0"
+                ":christmas_tree:\0"
+                ":fireworks:\0"
+                ":sparkler:\0"
+                "*\0"
+                ":balloon:\0"
+                "[done]\0"
+                ":confetti_ball:\0"
+                ":tanabata_tree:\0"
+                ":bamboo:\0"
+                ":dolls:\0"
+                ":flags:\0"
+                ":wind_chime:\0"
+                ":rice_scene:\0"
+                ":ribbon:\0"
+                ":gift:\0"
+                ":reminder_ribbon:\0"
+                ":tickets:\0"
+                ":ticket:\0"
+                ":medal_military:\0"
+                "[win]\0"
+                ":medal_sports:\0"
+                ":first_place_medal:\0"
+                ":second_place_medal:\0"
+                ":third_place_medal:\0"
+                ":soccer:\0"
+                ":baseball:\0"
+                ":basketball:\0"
+                ":volleyball:\0"
+                ":football:\0"
+                ":rugby_football:\0"
+                ":tennis:\0"
+                ":bowling:\0"
+                ":cricket:\0"
+                ":field_hockey:\0"
+                ":ice_hockey:\0"
+                ":ping_pong:\0"
+                ":badminton:\0"
+                ":boxing_glove:\0"
+                ":martial_arts_uniform:\0"
+                ":goal_net:\0"
+                ":golf:\0"
+                ":ice_skate:\0"
+                ":fishing_pole_and_fish:\0"
+                ":running_shirt_with_sash:\0"
+                ":ski:\0"
+                ":dart:\0"
+                ":gun:\0"
+                ":eight_ball:\0"
+                ":crystal_ball:\0"
+                ":video_game:\0"
+                ":joystick:\0"
+                ":slot_machine:\0"
+                ":game_die:\0"
+                ":spades:\0"
+                ":hearts:\0"
+                ":diamonds:\0"
+                ":clubs:\0"
+                ":black_joker:\0"
+                ":mahjong:\0"
+                ":flower_playing_cards:\0"
+                ":performing_arts:\0"
+                ":framed_picture:\0"
+                ":art:\0"
+                ":eyeglasses:\0"
+                ":dark_sunglasses:\0"
+                ":necktie:\0"
+                ":tshirt:\0"
+                ":jeans:\0"
+                ":dress:\0"
+                ":kimono:\0"
+                ":bikini:\0"
+                ":womans_clothes:\0"
+                ":purse:\0"
+                ":handbag:\0"
+                ":pouch:\0"
+                ":shopping:\0"
+                ":school_satchel:\0"
+                ":mans_shoe:\0"
+                ":athletic_shoe:\0"
+                ":high_heel:\0"
+                ":sandal:\0"
+                ":boot:\0"
+                ":crown:\0"
+                ":womans_hat:\0"
+                ":tophat:\0"
+                ":mortar_board:\0"
+                ":rescue_worker_helmet:\0"
+                ":prayer_beads:\0"
+                ":lipstick:\0"
+                ":ring:\0"
+                ":gem:\0"
+                ":mute:\0"
+                ":speaker:\0"
+                ":sound:\0"
+                ":loud_sound:\0"
+                ":loudspeaker:\0"
+                ":mega:\0"
+                ":postal_horn:\0"
+                "[bell]\0"
+                "[mute]\0"
+                ":musical_score:\0"
+                ":musical_note:\0"
+                ":notes:\0"
+                ":studio_microphone:\0"
+                ":level_slider:\0"
+                ":control_knobs:\0"
+                ":microphone:\0"
+                ":headphones:\0"
+                ":radio:\0"
+                ":saxophone:\0"
+                ":guitar:\0"
+                ":musical_keyboard:\0"
+                ":trumpet:\0"
+                ":violin:\0"
+                ":drum:\0"
+                ":iphone:\0"
+                ":calling:\0"
+                ":phone:\0"
+                ":telephone_receiver:\0"
+                ":pager:\0"
+                ":fax:\0"
+                ":battery:\0"
+                ":electric_plug:\0"
+                "[pc]\0"
+                "[pc]\0"
+                ":printer:\0"
+                ":keyboard:\0"
+                ":computer_mouse:\0"
+                ":trackball:\0"
+                ":minidisc:\0"
+                ":floppy_disk:\0"
+                ":cd:\0"
+                ":dvd:\0"
+                ":movie_camera:\0"
+                ":film_strip:\0"
+                ":film_projector:\0"
+                ":clapper:\0"
+                ":tv:\0"
+                ":camera:\0"
+                ":camera_flash:\0"
+                ":video_camera:\0"
+                ":vhs:\0"
+                "[find]\0"
+                "[find]\0"
+                ":candle:\0"
+                "[idea]\0"
+                ":flashlight:\0"
+                ":izakaya_lantern:\0"
+                ":notebook_with_decorative_cover:\0"
+                ":closed_book:\0"
+                ":open_book:\0"
+                ":green_book:\0"
+                ":blue_book:\0"
+                ":orange_book:\0"
+                ":books:\0"
+                ":notebook:\0"
+                ":ledger:\0"
+                "[file]\0"
+                "[log]\0"
+                "[file]\0"
+                ":newspaper:\0"
+                ":newspaper_roll:\0"
+                ":bookmark_tabs:\0"
+                ":bookmark:\0"
+                ":label:\0"
+                ":moneybag:\0"
+                ":yen:\0"
+                ":dollar:\0"
+                ":euro:\0"
+                ":pound:\0"
+                ":money_with_wings:\0"
+                ":credit_card:\0"
+                ":chart:\0"
+                "[mail]\0"
+                ":e_mail:\0"
+                ":incoming_envelope:\0"
+                ":envelope_with_arrow:\0"
+                "[out]\0"
+                "[in]\0"
+                "[pkg]\0"
+                ":mailbox:\0"
+                ":mailbox_closed:\0"
+                ":mailbox_with_mail:\0"
+                ":mailbox_with_no_mail:\0"
+                ":postbox:\0"
+                ":ballot_box:\0"
+                "[edit]\0"
+                ":black_nib:\0"
+                ":fountain_pen:\0"
+                ":pen:\0"
+                ":paintbrush:\0"
+                ":crayon:\0"
+                "[note]\0"
+                ":briefcase:\0"
+                "[dir]\0"
+                "[dir]\0"
+                ":card_index_dividers:\0"
+                ":date:\0"
+                ":calendar:\0"
+                ":spiral_notepad:\0"
+                ":spiral_calendar:\0"
+                ":card_index:\0"
+                "[up]\0"
+                "[down]\0"
+                "[stats]\0"
+                "[list]\0"
+                ":pushpin:\0"
+                ":round_pushpin:\0"
+                ":paperclip:\0"
+                ":paperclips:\0"
+                ":straight_ruler:\0"
+                ":triangular_ruler:\0"
+                ":scissors:\0"
+                ":card_file_box:\0"
+                ":file_cabinet:\0"
+                ":wastebasket:\0"
+                "[lock]\0"
+                ":unlock:\0"
+                ":lock_with_ink_pen:\0"
+                ":closed_lock_with_key:\0"
+                "[key]\0"
+                ":old_key:\0"
+                "[build]\0"
+                ":pick:\0"
+                ":hammer_and_pick:\0"
+                "[build]\0"
+                ":dagger:\0"
+                ":crossed_swords:\0"
+                ":bomb:\0"
+                ":bow_and_arrow:\0"
+                ":shield:\0"
+                "[fix]\0"
+                ":nut_and_bolt:\0"
+                "[cfg]\0"
+                ":clamp:\0"
+                ":balance_scale:\0"
+                "[link]\0"
+                ":chains:\0"
+                ":alembic:\0"
+                ":microscope:\0"
+                ":telescope:\0"
+                ":satellite:\0"
+                ":syringe:\0"
+                ":pill:\0"
+                ":door:\0"
+                ":bed:\0"
+                ":couch_and_lamp:\0"
+                ":toilet:\0"
+                ":shower:\0"
+                ":bathtub:\0"
+                ":shopping_cart:\0"
+                ":smoking:\0"
+                ":coffin:\0"
+                ":funeral_urn:\0"
+                ":moyai:\0"
+                ":atm:\0"
+                ":put_litter_in_its_place:\0"
+                ":potable_water:\0"
+                ":wheelchair:\0"
+                ":mens:\0"
+                ":womens:\0"
+                ":restroom:\0"
+                ":baby_symbol:\0"
+                ":wc:\0"
+                ":passport_control:\0"
+                ":customs:\0"
+                ":baggage_claim:\0"
+                ":left_luggage:\0"
+                "[!]\0"
+                ":children_crossing:\0"
+                "[-]\0"
+                "[-]\0"
+                ":no_bicycles:\0"
+                ":no_smoking:\0"
+                ":do_not_litter:\0"
+                ":non_potable_water:\0"
+                ":no_pedestrians:\0"
+                ":no_mobile_phones:\0"
+                ":underage:\0"
+                ":radioactive:\0"
+                ":biohazard:\0"
+                "^\0"
+                ":arrow_upper_right:\0"
+                "->\0"
+                ":arrow_lower_right:\0"
+                "v\0"
+                ":arrow_lower_left:\0"
+                "<-\0"
+                ":arrow_upper_left:\0"
+                ":arrow_up_down:\0"
+                ":left_right_arrow:\0"
+                ":leftwards_arrow_with_hook:\0"
+                ":arrow_right_hook:\0"
+                ":arrow_heading_up:\0"
+                ":arrow_heading_down:\0"
+                "[sync]\0"
+                "[sync]\0"
+                "[back]\0"
+                "[end]\0"
+                "[on]\0"
+                "[soon]\0"
+                "[top]\0"
+                ":place_of_worship:\0"
+                ":atom_symbol:\0"
+                ":om:\0"
+                ":star_of_david:\0"
+                ":wheel_of_dharma:\0"
+                ":yin_yang:\0"
+                ":latin_cross:\0"
+                ":orthodox_cross:\0"
+                ":star_and_crescent:\0"
+                ":peace_symbol:\0"
+                ":menorah:\0"
+                ":six_pointed_star:\0"
+                ":aries:\0"
+                ":taurus:\0"
+                ":gemini:\0"
+                ":cancer:\0"
+                ":leo:\0"
+                ":virgo:\0"
+                ":libra:\0"
+                ":scorpius:\0"
+                ":sagittarius:\0"
+                ":capricorn:\0"
+                ":aquarius:\0"
+                ":pisces:\0"
+                ":ophiuchus:\0"
+                ":twisted_rightwards_arrows:\0"
+                "[again]\0"
+                ":repeat_one:\0"
+                ">\0"
+                ":fast_forward:\0"
+                ":next_track_button:\0"
+                ":play_or_pause_button:\0"
+                "<\0"
+                ":rewind:\0"
+                ":previous_track_button:\0"
+                "^\0"
+                ":arrow_double_up:\0"
+                "v\0"
+                ":arrow_double_down:\0"
+                ":pause_button:\0"
+                "[stop]\0"
+                ":record_button:\0"
+                ":cinema:\0"
+                ":low_brightness:\0"
+                ":high_brightness:\0"
+                ":signal_strength:\0"
+                ":vibration_mode:\0"
+                ":mobile_phone_off:\0"
+                "x\0"
+                "+\0"
+                "-\0"
+                "/\0"
+                "!!\0"
+                "?!\0"
+                "?\0"
+                "?\0"
+                "!\0"
+                "!\0"
+                ":wavy_dash:\0"
+                ":currency_exchange:\0"
+                "$\0"
+                "[reuse]\0"
+                ":fleur_de_lis:\0"
+                ":trident:\0"
+                ":name_badge:\0"
+                ":beginner:\0"
+                "O\0"
+                "[ok]\0"
+                "[x]\0"
+                "[ok]\0"
+                "[x]\0"
+                ":negative_squared_cross_mark:\0"
+                ":curly_loop:\0"
+                ":loop:\0"
+                ":part_alternation_mark:\0"
+                ":eight_spoked_asterisk:\0"
+                ":eight_pointed_black_star:\0"
+                "*\0"
+                ":copyright:\0"
+                ":registered:\0"
+                ":tm:\0"
+                "#\0"
+                ":asterisk:\0"
+                ":zero:\0"
+                ":one:\0"
+                ":two:\0"
+                ":three:\0"
+                ":four:\0"
+                ":five:\0"
+                ":six:\0"
+                ":seven:\0"
+                ":eight:\0"
+                ":nine:\0"
+                ":keycap_ten:\0"
+                ":capital_abcd:\0"
+                ":abcd:\0"
+                ":one_two_three_four:\0"
+                ":symbols:\0"
+                ":abc:\0"
+                ":a:\0"
+                ":ab:\0"
+                ":b:\0"
+                ":cl:\0"
+                "[cool]\0"
+                "[free]\0"
+                "[i]\0"
+                ":id:\0"
+                ":m:\0"
+                "[new]\0"
+                ":ng:\0"
+                ":o2:\0"
+                "[ok]\0"
+                ":parking:\0"
+                "[sos]\0"
+                ":up:\0"
+                ":vs:\0"
+                ":koko:\0"
+                ":sa:\0"
+                ":u6708:\0"
+                ":u6709:\0"
+                ":u6307:\0"
+                ":ideograph_advantage:\0"
+                ":u5272:\0"
+                ":u7121:\0"
+                ":u7981:\0"
+                ":accept:\0"
+                ":u7533:\0"
+                ":u5408:\0"
+                ":u7a7a:\0"
+                ":congratulations:\0"
+                ":secret:\0"
+                ":u55b6:\0"
+                ":u6e80:\0"
+                "(o)\0"
+                "(o)\0"
+                "(*)\0"
+                "(\0"
+                ":black_large_square:\0"
+                ":white_large_square:\0"
+                ":black_medium_square:\0"
+                ":white_medium_square:\0"
+                ":black_medium_small_square:\0"
+                ":white_medium_small_square:\0"
+                ":black_small_square:\0"
+                ":white_small_square:\0"
+                ":large_orange_diamond:\0"
+                ":large_blue_diamond:\0"
+                ":small_orange_diamond:\0"
+                ":small_blue_diamond:\0"
+                ":small_red_triangle:\0"
+                ":small_red_triangle_down:\0"
+                ":diamond_shape_with_a_dot_inside:\0"
+                ":radio_button:\0"
+                ":white_square_button:\0"
+                ":black_square_button:\0"
+                ":checkered_flag:\0"
+                ":triangular_flag_on_post:\0"
+                ":crossed_flags:\0"
+                ":black_flag:\0"
+                ":white_flag:\0"
+                ":rainbow_flag:\0"
+                ":andorra:\0"
+                ":united_arab_emirates:\0"
+                ":afghanistan:\0"
+                ":antigua_barbuda:\0"
+                ":anguilla:\0"
+                ":albania:\0"
+                ":armenia:\0"
+                ":angola:\0"
+                ":antarctica:\0"
+                ":argentina:\0"
+                ":american_samoa:\0"
+                ":austria:\0"
+                ":australia:\0"
+                ":aruba:\0"
+                ":aland_islands:\0"
+                ":azerbaijan:\0"
+                ":bosnia_herzegovina:\0"
+                ":barbados:\0"
+                ":bangladesh:\0"
+                ":belgium:\0"
+                ":burkina_faso:\0"
+                ":bulgaria:\0"
+                ":bahrain:\0"
+                ":burundi:\0"
+                ":benin:\0"
+                ":st_barthelemy:\0"
+                ":bermuda:\0"
+                ":brunei:\0"
+                ":bolivia:\0"
+                ":caribbean_netherlands:\0"
+                ":brazil:\0"
+                ":bahamas:\0"
+                ":bhutan:\0"
+                ":botswana:\0"
+                ":belarus:\0"
+                ":belize:\0"
+                ":canada:\0"
+                ":cocos_islands:\0"
+                ":congo_kinshasa:\0"
+                ":central_african_republic:\0"
+                ":congo_brazzaville:\0"
+                ":switzerland:\0"
+                ":cote_divoire:\0"
+                ":cook_islands:\0"
+                ":chile:\0"
+                ":cameroon:\0"
+                ":cn:\0"
+                ":colombia:\0"
+                ":costa_rica:\0"
+                ":cuba:\0"
+                ":cape_verde:\0"
+                ":curacao:\0"
+                ":christmas_island:\0"
+                ":cyprus:\0"
+                ":czech_republic:\0"
+                ":de:\0"
+                ":djibouti:\0"
+                ":denmark:\0"
+                ":dominica:\0"
+                ":dominican_republic:\0"
+                ":algeria:\0"
+                ":ecuador:\0"
+                ":estonia:\0"
+                ":egypt:\0"
+                ":western_sahara:\0"
+                ":eritrea:\0"
+                ":es:\0"
+                ":ethiopia:\0"
+                ":eu:\0"
+                ":finland:\0"
+                ":fiji:\0"
+                ":falkland_islands:\0"
+                ":micronesia:\0"
+                ":faroe_islands:\0"
+                ":fr:\0"
+                ":gabon:\0"
+                ":uk:\0"
+                ":grenada:\0"
+                ":georgia:\0"
+                ":french_guiana:\0"
+                ":guernsey:\0"
+                ":ghana:\0"
+                ":gibraltar:\0"
+                ":greenland:\0"
+                ":gambia:\0"
+                ":guinea:\0"
+                ":guadeloupe:\0"
+                ":equatorial_guinea:\0"
+                ":greece:\0"
+                ":south_georgia_south_sandwich_islands:\0"
+                ":guatemala:\0"
+                ":guam:\0"
+                ":guinea_bissau:\0"
+                ":guyana:\0"
+                ":hong_kong:\0"
+                ":honduras:\0"
+                ":croatia:\0"
+                ":haiti:\0"
+                ":hungary:\0"
+                ":canary_islands:\0"
+                ":indonesia:\0"
+                ":ireland:\0"
+                ":israel:\0"
+                ":isle_of_man:\0"
+                ":india:\0"
+                ":british_indian_ocean_territory:\0"
+                ":iraq:\0"
+                ":iran:\0"
+                ":iceland:\0"
+                ":it:\0"
+                ":jersey:\0"
+                ":jamaica:\0"
+                ":jordan:\0"
+                ":jp:\0"
+                ":kenya:\0"
+                ":kyrgyzstan:\0"
+                ":cambodia:\0"
+                ":kiribati:\0"
+                ":comoros:\0"
+                ":st_kitts_nevis:\0"
+                ":north_korea:\0"
+                ":kr:\0"
+                ":kuwait:\0"
+                ":cayman_islands:\0"
+                ":kazakhstan:\0"
+                ":laos:\0"
+                ":lebanon:\0"
+                ":st_lucia:\0"
+                ":liechtenstein:\0"
+                ":sri_lanka:\0"
+                ":liberia:\0"
+                ":lesotho:\0"
+                ":lithuania:\0"
+                ":luxembourg:\0"
+                ":latvia:\0"
+                ":libya:\0"
+                ":morocco:\0"
+                ":monaco:\0"
+                ":moldova:\0"
+                ":montenegro:\0"
+                ":madagascar:\0"
+                ":marshall_islands:\0"
+                ":macedonia:\0"
+                ":mali:\0"
+                ":myanmar:\0"
+                ":mongolia:\0"
+                ":macau:\0"
+                ":northern_mariana_islands:\0"
+                ":martinique:\0"
+                ":mauritania:\0"
+                ":montserrat:\0"
+                ":malta:\0"
+                ":mauritius:\0"
+                ":maldives:\0"
+                ":malawi:\0"
+                ":mexico:\0"
+                ":malaysia:\0"
+                ":mozambique:\0"
+                ":namibia:\0"
+                ":new_caledonia:\0"
+                ":niger:\0"
+                ":norfolk_island:\0"
+                ":nigeria:\0"
+                ":nicaragua:\0"
+                ":netherlands:\0"
+                ":norway:\0"
+                ":nepal:\0"
+                ":nauru:\0"
+                ":niue:\0"
+                ":new_zealand:\0"
+                ":oman:\0"
+                ":panama:\0"
+                ":peru:\0"
+                ":french_polynesia:\0"
+                ":papua_new_guinea:\0"
+                ":philippines:\0"
+                ":pakistan:\0"
+                ":poland:\0"
+                ":st_pierre_miquelon:\0"
+                ":pitcairn_islands:\0"
+                ":puerto_rico:\0"
+                ":palestinian_territories:\0"
+                ":portugal:\0"
+                ":palau:\0"
+                ":paraguay:\0"
+                ":qatar:\0"
+                ":reunion:\0"
+                ":romania:\0"
+                ":serbia:\0"
+                ":ru:\0"
+                ":rwanda:\0"
+                ":saudi_arabia:\0"
+                ":solomon_islands:\0"
+                ":seychelles:\0"
+                ":sudan:\0"
+                ":sweden:\0"
+                ":singapore:\0"
+                ":st_helena:\0"
+                ":slovenia:\0"
+                ":slovakia:\0"
+                ":sierra_leone:\0"
+                ":san_marino:\0"
+                ":senegal:\0"
+                ":somalia:\0"
+                ":suriname:\0"
+                ":south_sudan:\0"
+                ":sao_tome_principe:\0"
+                ":el_salvador:\0"
+                ":sint_maarten:\0"
+                ":syria:\0"
+                ":swaziland:\0"
+                ":turks_caicos_islands:\0"
+                ":chad:\0"
+                ":french_southern_territories:\0"
+                ":togo:\0"
+                ":thailand:\0"
+                ":tajikistan:\0"
+                ":tokelau:\0"
+                ":timor_leste:\0"
+                ":turkmenistan:\0"
+                ":tunisia:\0"
+                ":tonga:\0"
+                ":tr:\0"
+                ":trinidad_tobago:\0"
+                ":tuvalu:\0"
+                ":taiwan:\0"
+                ":tanzania:\0"
+                ":ukraine:\0"
+                ":uganda:\0"
+                ":us:\0"
+                ":uruguay:\0"
+                ":uzbekistan:\0"
+                ":vatican_city:\0"
+                ":st_vincent_grenadines:\0"
+                ":venezuela:\0"
+                ":british_virgin_islands:\0"
+                ":us_virgin_islands:\0"
+                ":vietnam:\0"
+                ":vanuatu:\0"
+                ":wallis_futuna:\0"
+                ":samoa:\0"
+                ":kosovo:\0"
+                ":yemen:\0"
+                ":mayotte:\0"
+                ":south_africa:\0"
+                ":zambia:\0"
+                ":zimbabwe:\0";
+            static constexpr std::uint16_t textOffsets[count] = {
+                0, 11, 20, 28, 35, 46, 60, 67, 73, 97, 116, 123, 131, 142, 155, 171,
+                181, 191, 213, 236, 242, 261, 292, 323, 342, 349, 355, 375, 390, 407, 418, 426,
+                437, 449, 461, 474, 485, 495, 504, 520, 531, 538, 562, 587, 604, 620, 633, 651,
+                664, 676, 687, 697, 722, 738, 751, 760, 773, 783, 794, 806, 816, 829, 853, 859,
+                865, 874, 887, 899, 914, 922, 930, 943, 953, 960, 968, 982, 988, 995, 1018, 1025,
+                1038, 1054, 1072, 1080, 1084, 1100, 1108, 1121, 1133, 1143, 1160, 1172, 1186, 1199, 1217, 1231,
+                1245, 1260, 1276, 1290, 1298, 1311, 1329, 1342, 1354, 1373, 1386, 1405, 1431, 1446, 1449, 1464,
+                1478, 1491, 1506, 1520, 1527, 1531, 1539, 1544, 1552, 1566, 1573, 1580, 1597, 1618, 1639, 1657,
+                1663, 1668, 1690, 1725, 1739, 1755, 1765, 1769, 1787, 1795, 1810, 1823, 1837, 1850, 1855, 1868,
+                1879, 1890, 1902, 1909, 1921, 1933, 1946, 1952, 1967, 1980, 1992, 1999, 2014, 2026, 2035, 2044,
+                2050, 2057, 2064, 2070, 2079, 2086, 2093, 2099, 2106, 2119, 2125, 2133, 2148, 2160, 2174, 2191,
+                2206, 2222, 2236, 2252, 2266, 2277, 2286, 2307, 2326, 2347, 2366, 2379, 2394, 2412, 2432, 2450,
+                2466, 2486, 2508, 2522, 2538, 2552, 2568, 2580, 2594, 2607, 2622, 2633, 2646, 2661, 2678, 2699,
+                2722, 2742, 2764, 2780, 2798, 2817, 2838, 2851, 2866, 2879, 2894, 2906, 2920, 2936, 2954, 2972,
+                2992, 3004, 3018, 3035, 3054, 3066, 3080, 3106, 3134, 3143, 3154, 3172, 3192, 3214, 3230, 3248,
+                3265, 3273, 3281, 3293, 3309, 3323, 3339, 3353, 3367, 3383, 3397, 3413, 3422, 3436, 3463, 3479,
+                3493, 3510, 3525, 3533, 3547, 3561, 3577, 3591, 3607, 3620, 3635, 3650, 3667, 3684, 3703, 3724,
+                3747, 3760, 3775, 3797, 3821, 3840, 3861, 3877, 3895, 3920, 3947, 3970, 3995, 4010, 4027, 4034,
+                4049, 4075, 4084, 4108, 4131, 4152, 4177, 4207, 4235, 4267, 4291, 4319, 4346, 4375, 4396, 4418,
+                4444, 4469, 4496, 4521, 4547, 4577, 4606, 4637, 4654, 4675, 4693, 4715, 4738, 4757, 4780, 4800,
+                4824, 4849, 4865, 4886, 4908, 4931, 4944, 4958, 4967, 4977, 4983, 4990, 4999, 5006, 5017, 5023,
+                5030, 5037, 5045, 5054, 5064, 5072, 5084, 5094, 5101, 5107, 5112, 5128, 5135, 5141, 5148, 5155,
+                5166, 5172, 5180, 5187, 5205, 5213, 5224, 5237, 5245, 5254, 5260, 5270, 5279, 5289, 5300, 5306,
+                5313, 5321, 5334, 5347, 5356, 5366, 5376, 5393, 5406, 5422, 5429, 5439, 5446, 5454, 5461, 5467,
+                5474, 5486, 5493, 5502, 5510, 5524, 5533, 5541, 5550, 5560, 5567, 5583, 5594, 5602, 5612, 5620,
+                5627, 5639, 5645, 5651, 5662, 5671, 5680, 5693, 5704, 5714, 5731, 5746, 5756, 5763, 5779, 5790,
+                5802, 5812, 5820, 5831, 5848, 5865, 5877, 5886, 5900, 5907, 5918, 5937, 5950, 5964, 5973, 5984,
+                5993, 6001, 6014, 6026, 6034, 6043, 6055, 6063, 6077, 6084, 6092, 6103, 6116, 6129, 6138, 6148,
+                6159, 6168, 6177, 6184, 6197, 6208, 6218, 6229, 6237, 6249, 6266, 6277, 6286, 6301, 6315, 6323,
+                6335, 6343, 6351, 6360, 6367, 6377, 6397, 6403, 6415, 6437, 6444, 6458, 6468, 6476, 6491, 6503,
+                6510, 6518, 6526, 6538, 6553, 6560, 6568, 6583, 6595, 6603, 6610, 6619, 6627, 6638, 6651, 6663,
+                6674, 6683, 6694, 6701, 6717, 6725, 6736, 6746, 6758, 6772, 6785, 6794, 6800, 6807, 6819, 6832,
+                6843, 6860, 6867, 6875, 6894, 6910, 6931, 6948, 6956, 6964, 6974, 6989, 7006, 7019, 7042, 7054,
+                7062, 7078, 7089, 7099, 7112, 7122, 7139, 7148, 7164, 7180, 7190, 7211, 7235, 7244, 7261, 7269,
+                7289, 7298, 7312, 7335, 7346, 7353, 7361, 7374, 7394, 7403, 7422, 7432, 7450, 7468, 7478, 7492,
+                7512, 7521, 7530, 7542, 7558, 7566, 7577, 7584, 7592, 7611, 7623, 7648, 7658, 7672, 7687, 7705,
+                7718, 7735, 7750, 7767, 7776, 7790, 7809, 7823, 7842, 7862, 7871, 7879, 7892, 7902, 7909, 7920,
+                7939, 7947, 7953, 7968, 7981, 7991, 8003, 8017, 8030, 8052, 8059, 8075, 8085, 8107, 8118, 8125,
+                8145, 8155, 8168, 8181, 8197, 8204, 8219, 8229, 8240, 8256, 8267, 8278, 8282, 8298, 8323, 8330,
+                8336, 8345, 8356, 8364, 8376, 8393, 8401, 8414, 8421, 8432, 8449, 8468, 8485, 8492, 8505, 8526,
+                8546, 8563, 8586, 8589, 8604, 8611, 8618, 8626, 8633, 8640, 8647, 8667, 8677, 8689, 8698, 8709,
+                8718, 8729, 8738, 8749, 8758, 8769, 8778, 8789, 8798, 8809, 8818, 8829, 8838, 8849, 8858, 8869,
+                8879, 8891, 8901, 8913, 8924, 8947, 8968, 8990, 9002, 9024, 9044, 9067, 9083, 9104, 9135, 9165,
+                9179, 9187, 9209, 9225, 9227, 9229, 9237, 9249, 9257, 9272, 9304, 9329, 9354, 9378, 9396, 9414,
+                9437, 9447, 9453, 9465, 9475, 9485, 9503, 9519, 9530, 9550, 9552, 9564, 9584, 9594, 9602, 9606,
+                9616, 9624, 9641, 9658, 9670, 9681, 9683, 9693, 9700, 9716, 9732, 9741, 9749, 9757, 9770, 9783,
+                9792, 9799, 9817, 9827, 9836, 9853, 9859, 9874, 9894, 9915, 9935, 9944, 9955, 9968, 9981, 9992,
+                10009, 10018, 10028, 10038, 10053, 10066, 10078, 10090, 10105, 10128, 10139, 10146, 10158, 10182, 10208, 10214,
+                10221, 10227, 10240, 10255, 10268, 10279, 10294, 10305, 10314, 10323, 10334, 10342, 10356, 10366, 10389, 10407,
+                10424, 10430, 10443, 10461, 10471, 10480, 10488, 10496, 10505, 10514, 10531, 10539, 10549, 10557, 10568, 10585,
+                10597, 10613, 10625, 10634, 10641, 10649, 10662, 10671, 10686, 10709, 10724, 10735, 10742, 10748, 10755, 10765,
+                10773, 10786, 10800, 10807, 10821, 10828, 10835, 10851, 10866, 10874, 10894, 10909, 10925, 10938, 10951, 10959,
+                10971, 10980, 10999, 11009, 11018, 11025, 11034, 11044, 11052, 11073, 11081, 11087, 11097, 11113, 11118, 11123,
+                11133, 11144, 11161, 11173, 11184, 11198, 11203, 11209, 11224, 11237, 11254, 11264, 11269, 11278, 11293, 11308,
+                11314, 11321, 11328, 11337, 11344, 11357, 11375, 11408, 11422, 11434, 11447, 11459, 11473, 11481, 11492, 11501,
+                11508, 11514, 11521, 11533, 11550, 11566, 11577, 11585, 11596, 11602, 11611, 11618, 11626, 11645, 11659, 11667,
+                11674, 11683, 11703, 11725, 11731, 11736, 11742, 11752, 11769, 11789, 11812, 11822, 11835, 11842, 11854, 11869,
+                11875, 11888, 11897, 11904, 11916, 11922, 11928, 11950, 11957, 11968, 11985, 12003, 12016, 12021, 12028, 12036,
+                12043, 12053, 12069, 12081, 12094, 12111, 12130, 12141, 12157, 12172, 12186, 12193, 12202, 12222, 12245, 12251,
+                12261, 12269, 12276, 12294, 12302, 12311, 12328, 12335, 12351, 12360, 12366, 12381, 12387, 12395, 12411, 12418,
+                12427, 12437, 12450, 12462, 12474, 12484, 12491, 12498, 12504, 12521, 12530, 12539, 12549, 12565, 12575, 12584,
+                12598, 12606, 12612, 12638, 12654, 12667, 12674, 12683, 12694, 12708, 12713, 12732, 12742, 12758, 12773, 12777,
+                12797, 12801, 12805, 12819, 12832, 12848, 12868, 12885, 12904, 12915, 12929, 12941, 12943, 12963, 12966, 12986,
+                12988, 13007, 13010, 13029, 13045, 13064, 13092, 13111, 13130, 13151, 13158, 13165, 13172, 13178, 13183, 13190,
+                13196, 13215, 13229, 13234, 13250, 13268, 13279, 13293, 13310, 13330, 13345, 13355, 13374, 13382, 13391, 13400,
+                13409, 13415, 13423, 13431, 13442, 13456, 13468, 13479, 13488, 13500, 13528, 13536, 13549, 13551, 13566, 13586,
+                13609, 13611, 13620, 13644, 13646, 13664, 13666, 13686, 13701, 13708, 13724, 13733, 13750, 13768, 13786, 13803,
+                13822, 13824, 13826, 13828, 13830, 13833, 13836, 13838, 13840, 13842, 13844, 13856, 13876, 13878, 13886, 13901,
+                13911, 13924, 13935, 13937, 13942, 13946, 13951, 13955, 13985, 13998, 14005, 14029, 14053, 14080, 14082, 14094,
+                14107, 14112, 14114, 14125, 14132, 14138, 14144, 14152, 14159, 14166, 14172, 14180, 14188, 14195, 14208, 14223,
+                14230, 14251, 14261, 14267, 14271, 14276, 14280, 14285, 14292, 14299, 14303, 14308, 14312, 14318, 14323, 14328,
+                14333, 14343, 14349, 14354, 14359, 14366, 14371, 14379, 14387, 14395, 14417, 14425, 14433, 14441, 14450, 14458,
+                14466, 14474, 14492, 14501, 14509, 14517, 14521, 14525, 14529, 14531, 14552, 14573, 14595, 14617, 14645, 14673,
+                14694, 14715, 14738, 14759, 14782, 14803, 14824, 14850, 14884, 14899, 14921, 14943, 14960, 14986, 15002, 15015,
+                15028, 15043, 15053, 15076, 15090, 15108, 15119, 15129, 15139, 15148, 15161, 15173, 15190, 15200, 15212, 15220,
+                15236, 15249, 15270, 15281, 15294, 15304, 15319, 15330, 15340, 15350, 15358, 15374, 15384, 15393, 15403, 15427,
+                15436, 15446, 15455, 15466, 15476, 15485, 15494, 15510, 15527, 15554, 15574, 15588, 15603, 15618, 15626, 15637,
+                15642, 15653, 15666, 15673, 15686, 15696, 15715, 15724, 15741, 15746, 15757, 15767, 15778, 15799, 15809, 15819,
+                15829, 15837, 15854, 15864, 15869, 15880, 15885, 15895, 15902, 15921, 15934, 15950, 15955, 15963, 15968, 15978,
+                15988, 16004, 16015, 16023, 16035, 16047, 16056, 16065, 16078, 16098, 16107, 16146, 16158, 16165, 16181, 16190,
+                16202, 16213, 16223, 16231, 16241, 16258, 16270, 16280, 16289, 16303, 16311, 16344, 16351, 16358, 16368, 16373,
+                16382, 16392, 16401, 16406, 16414, 16427, 16438, 16449, 16459, 16476, 16490, 16495, 16504, 16521, 16534, 16541,
+                16551, 16562, 16578, 16590, 16600, 16610, 16622, 16635, 16644, 16652, 16662, 16671, 16681, 16694, 16707, 16726,
+                16738, 16745, 16755, 16766, 16774, 16801, 16814, 16827, 16840, 16848, 16860, 16871, 16880, 16889, 16900, 16913,
+                16923, 16939, 16947, 16964, 16974, 16986, 17000, 17009, 17017, 17025, 17032, 17046, 17053, 17062, 17069, 17088,
+                17107, 17121, 17132, 17141, 17162, 17181, 17195, 17221, 17232, 17240, 17251, 17259, 17269, 17279, 17288, 17293,
+                17302, 17317, 17335, 17348, 17356, 17365, 17377, 17389, 17400, 17411, 17426, 17439, 17449, 17459, 17470, 17484,
+                17504, 17518, 17533, 17541, 17553, 17576, 17583, 17613, 17620, 17631, 17644, 17654, 17668, 17683, 17693, 17701,
+                17706, 17724, 17733, 17742, 17753, 17763, 17772, 17777, 17787, 17800, 17815, 17839, 17851, 17876, 17896, 17906,
+                17916, 17932, 17940, 17949, 17957, 17967, 17982, 17991,
+            };
+            static constexpr std::uint8_t textLengths[count] = {
+                10, 8, 7, 6, 10, 13, 6, 5, 23, 18, 6, 7, 10, 12, 15, 9,
+                9, 21, 22, 5, 18, 30, 30, 18, 6, 5, 19, 14, 16, 10, 7, 10,
+                11, 11, 12, 10, 9, 8, 15, 10, 6, 23, 24, 16, 15, 12, 17, 12,
+                11, 10, 9, 24, 15, 12, 8, 12, 9, 10, 11, 9, 12, 23, 5, 5,
+                8, 12, 11, 14, 7, 7, 12, 9, 6, 7, 13, 5, 6, 22, 6, 12,
+                15, 17, 7, 3, 15, 7, 12, 11, 9, 16, 11, 13, 12, 17, 13, 13,
+                14, 15, 13, 7, 12, 17, 12, 11, 18, 12, 18, 25, 14, 2, 14, 13,
+                12, 14, 13, 6, 3, 7, 4, 7, 13, 6, 6, 16, 20, 20, 17, 5,
+                4, 21, 34, 13, 15, 9, 3, 17, 7, 14, 12, 13, 12, 4, 12, 10,
+                10, 11, 6, 11, 11, 12, 5, 14, 12, 11, 6, 14, 11, 8, 8, 5,
+                6, 6, 5, 8, 6, 6, 5, 6, 12, 5, 7, 14, 11, 13, 16, 14,
+                15, 13, 15, 13, 10, 8, 20, 18, 20, 18, 12, 14, 17, 19, 17, 15,
+                19, 21, 13, 15, 13, 15, 11, 13, 12, 14, 10, 12, 14, 16, 20, 22,
+                19, 21, 15, 17, 18, 20, 12, 14, 12, 14, 11, 13, 15, 17, 17, 19,
+                11, 13, 16, 18, 11, 13, 25, 27, 8, 10, 17, 19, 21, 15, 17, 16,
+                7, 7, 11, 15, 13, 15, 13, 13, 15, 13, 15, 8, 13, 26, 15, 13,
+                16, 14, 7, 13, 13, 15, 13, 15, 12, 14, 14, 16, 16, 18, 20, 22,
+                12, 14, 21, 23, 18, 20, 15, 17, 24, 26, 22, 24, 14, 16, 6, 14,
+                25, 8, 23, 22, 20, 24, 29, 27, 31, 23, 27, 26, 28, 20, 21, 25,
+                24, 26, 24, 25, 29, 28, 30, 16, 20, 17, 21, 22, 18, 22, 19, 23,
+                24, 15, 20, 21, 22, 12, 13, 8, 9, 5, 6, 8, 6, 10, 5, 6,
+                6, 7, 8, 9, 7, 11, 9, 6, 5, 4, 15, 6, 5, 6, 6, 10,
+                5, 7, 6, 17, 7, 10, 12, 7, 8, 5, 9, 8, 9, 10, 5, 6,
+                7, 12, 12, 8, 9, 9, 16, 12, 15, 6, 9, 6, 7, 6, 5, 6,
+                11, 6, 8, 7, 13, 8, 7, 8, 9, 6, 15, 10, 7, 9, 7, 6,
+                11, 5, 5, 10, 8, 8, 12, 10, 9, 16, 14, 9, 6, 15, 10, 11,
+                9, 7, 10, 16, 16, 11, 8, 13, 6, 10, 18, 12, 13, 8, 10, 8,
+                7, 12, 11, 7, 8, 11, 7, 13, 6, 7, 10, 12, 12, 8, 9, 10,
+                8, 8, 6, 12, 10, 9, 10, 7, 11, 16, 10, 8, 14, 13, 7, 11,
+                7, 7, 8, 6, 9, 19, 5, 11, 21, 6, 13, 9, 7, 14, 11, 6,
+                7, 7, 11, 14, 6, 7, 14, 11, 7, 6, 8, 7, 10, 12, 11, 10,
+                8, 10, 6, 15, 7, 10, 9, 11, 13, 12, 8, 5, 6, 11, 12, 10,
+                16, 6, 7, 18, 15, 20, 16, 7, 7, 9, 14, 16, 12, 22, 11, 7,
+                15, 10, 9, 12, 9, 16, 8, 15, 15, 9, 20, 23, 8, 16, 7, 19,
+                8, 13, 22, 10, 6, 7, 12, 19, 8, 18, 9, 17, 17, 9, 13, 19,
+                8, 8, 11, 15, 7, 10, 6, 7, 18, 11, 24, 9, 13, 14, 17, 12,
+                16, 14, 16, 8, 13, 18, 13, 18, 19, 8, 7, 12, 9, 6, 10, 18,
+                7, 5, 14, 12, 9, 11, 13, 12, 21, 6, 15, 9, 21, 10, 6, 19,
+                9, 12, 12, 15, 6, 14, 9, 10, 15, 10, 10, 3, 15, 24, 6, 5,
+                8, 10, 7, 11, 16, 7, 12, 6, 10, 16, 18, 16, 6, 12, 20, 19,
+                16, 22, 2, 14, 6, 6, 7, 6, 6, 6, 19, 9, 11, 8, 10, 8,
+                10, 8, 10, 8, 10, 8, 10, 8, 10, 8, 10, 8, 10, 8, 10, 9,
+                11, 9, 11, 10, 22, 20, 21, 11, 21, 19, 22, 15, 20, 30, 29, 13,
+                7, 21, 15, 1, 1, 7, 11, 7, 14, 31, 24, 24, 23, 17, 17, 22,
+                9, 5, 11, 9, 9, 17, 15, 10, 19, 1, 11, 19, 9, 7, 3, 9,
+                7, 16, 16, 11, 10, 1, 9, 6, 15, 15, 8, 7, 7, 12, 12, 8,
+                6, 17, 9, 8, 16, 5, 14, 19, 20, 19, 8, 10, 12, 12, 10, 16,
+                8, 9, 9, 14, 12, 11, 11, 14, 22, 10, 6, 11, 23, 25, 5, 6,
+                5, 12, 14, 12, 10, 14, 10, 8, 8, 10, 7, 13, 9, 22, 17, 16,
+                5, 12, 17, 9, 8, 7, 7, 8, 8, 16, 7, 9, 7, 10, 16, 11,
+                15, 11, 8, 6, 7, 12, 8, 14, 22, 14, 10, 6, 5, 6, 9, 7,
+                12, 13, 6, 13, 6, 6, 15, 14, 7, 19, 14, 15, 12, 12, 7, 11,
+                8, 18, 9, 8, 6, 8, 9, 7, 20, 7, 5, 9, 15, 4, 4, 9,
+                10, 16, 11, 10, 13, 4, 5, 14, 12, 16, 9, 4, 8, 14, 14, 5,
+                6, 6, 8, 6, 12, 17, 32, 13, 11, 12, 11, 13, 7, 10, 8, 6,
+                5, 6, 11, 16, 15, 10, 7, 10, 5, 8, 6, 7, 18, 13, 7, 6,
+                8, 19, 21, 5, 4, 5, 9, 16, 19, 22, 9, 12, 6, 11, 14, 5,
+                12, 8, 6, 11, 5, 5, 21, 6, 10, 16, 17, 12, 4, 6, 7, 6,
+                9, 15, 11, 12, 16, 18, 10, 15, 14, 13, 6, 8, 19, 22, 5, 9,
+                7, 6, 17, 7, 8, 16, 6, 15, 8, 5, 14, 5, 7, 15, 6, 8,
+                9, 12, 11, 11, 9, 6, 6, 5, 16, 8, 8, 9, 15, 9, 8, 13,
+                7, 5, 25, 15, 12, 6, 8, 10, 13, 4, 18, 9, 15, 14, 3, 19,
+                3, 3, 13, 12, 15, 19, 16, 18, 10, 13, 11, 1, 19, 2, 19, 1,
+                18, 2, 18, 15, 18, 27, 18, 18, 20, 6, 6, 6, 5, 4, 6, 5,
+                18, 13, 4, 15, 17, 10, 13, 16, 19, 14, 9, 18, 7, 8, 8, 8,
+                5, 7, 7, 10, 13, 11, 10, 8, 11, 27, 7, 12, 1, 14, 19, 22,
+                1, 8, 23, 1, 17, 1, 19, 14, 6, 15, 8, 16, 17, 17, 16, 18,
+                1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 11, 19, 1, 7, 14, 9,
+                12, 10, 1, 4, 3, 4, 3, 29, 12, 6, 23, 23, 26, 1, 11, 12,
+                4, 1, 10, 6, 5, 5, 7, 6, 6, 5, 7, 7, 6, 12, 14, 6,
+                20, 9, 5, 3, 4, 3, 4, 6, 6, 3, 4, 3, 5, 4, 4, 4,
+                9, 5, 4, 4, 6, 4, 7, 7, 7, 21, 7, 7, 7, 8, 7, 7,
+                7, 17, 8, 7, 7, 3, 3, 3, 1, 20, 20, 21, 21, 27, 27, 20,
+                20, 22, 20, 22, 20, 20, 25, 33, 14, 21, 21, 16, 25, 15, 12, 12,
+                14, 9, 22, 13, 17, 10, 9, 9, 8, 12, 11, 16, 9, 11, 7, 15,
+                12, 20, 10, 12, 9, 14, 10, 9, 9, 7, 15, 9, 8, 9, 23, 8,
+                9, 8, 10, 9, 8, 8, 15, 16, 26, 19, 13, 14, 14, 7, 10, 4,
+                10, 12, 6, 12, 9, 18, 8, 16, 4, 10, 9, 10, 20, 9, 9, 9,
+                7, 16, 9, 4, 10, 4, 9, 6, 18, 12, 15, 4, 7, 4, 9, 9,
+                15, 10, 7, 11, 11, 8, 8, 12, 19, 8, 38, 11, 6, 15, 8, 11,
+                10, 9, 7, 9, 16, 11, 9, 8, 13, 7, 32, 6, 6, 9, 4, 8,
+                9, 8, 4, 7, 12, 10, 10, 9, 16, 13, 4, 8, 16, 12, 6, 9,
+                10, 15, 11, 9, 9, 11, 12, 8, 7, 9, 8, 9, 12, 12, 18, 11,
+                6, 9, 10, 7, 26, 12, 12, 12, 7, 11, 10, 8, 8, 10, 12, 9,
+                15, 7, 16, 9, 11, 13, 8, 7, 7, 6, 13, 6, 8, 6, 18, 18,
+                13, 10, 8, 20, 18, 13, 25, 10, 7, 10, 7, 9, 9, 8, 4, 8,
+                14, 17, 12, 7, 8, 11, 11, 10, 10, 14, 12, 9, 9, 10, 13, 19,
+                13, 14, 7, 11, 22, 6, 29, 6, 10, 12, 9, 13, 14, 9, 7, 4,
+                17, 8, 8, 10, 9, 8, 4, 9, 12, 14, 23, 11, 24, 19, 9, 9,
+                15, 7, 8, 7, 9, 14, 8, 10,
+            };
+
+            // Canary::Emoji::Group, the version in tenths (E13.1 is 131) and the width in columns
+            static constexpr std::uint8_t group[count] = {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+                8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9,
+            };
+            static constexpr std::uint8_t version[count] = {
+                10, 6, 6, 6, 6, 6, 30, 6, 10, 10, 6, 6, 10, 6, 6, 10,
+                6, 6, 10, 6, 10, 6, 6, 10, 10, 10, 10, 7, 10, 10, 6, 6,
+                10, 10, 30, 6, 6, 6, 30, 10, 6, 10, 10, 30, 30, 6, 30, 10,
+                10, 10, 10, 10, 7, 10, 10, 6, 6, 10, 10, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 10, 6, 6, 10, 6, 30,
+                6, 6, 6, 6, 6, 10, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 10, 6, 6, 6, 6,
+                6, 6, 30, 6, 6, 6, 6, 6, 6, 6, 7, 6, 20, 7, 10, 6,
+                6, 30, 7, 6, 10, 6, 6, 30, 10, 30, 6, 6, 6, 10, 6, 6,
+                6, 6, 6, 6, 30, 30, 6, 6, 6, 30, 6, 7, 6, 30, 6, 6,
+                6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 6, 40, 6, 6, 6, 40,
+                6, 40, 6, 40, 6, 40, 6, 40, 6, 40, 6, 40, 30, 40, 30, 40,
+                40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+                40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+                6, 40, 7, 40, 6, 40, 6, 40, 30, 6, 6, 40, 6, 30, 6, 30,
+                6, 6, 30, 6, 40, 6, 40, 6, 40, 6, 40, 6, 30, 7, 6, 40,
+                30, 10, 7, 6, 7, 40, 6, 40, 10, 40, 6, 40, 7, 40, 7, 40,
+                10, 40, 10, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 6, 10,
+                10, 6, 10, 6, 20, 20, 6, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+                40, 7, 6, 10, 6, 6, 6, 6, 30, 6, 7, 6, 6, 30, 6, 7,
+                10, 6, 10, 10, 6, 6, 10, 30, 6, 10, 10, 10, 6, 10, 6, 6,
+                10, 6, 10, 10, 6, 6, 30, 6, 10, 10, 6, 6, 10, 7, 30, 6,
+                6, 6, 6, 10, 6, 10, 6, 6, 6, 6, 6, 7, 30, 30, 30, 6,
+                10, 6, 30, 6, 6, 10, 6, 10, 6, 6, 6, 6, 30, 6, 6, 6,
+                30, 6, 6, 6, 6, 7, 7, 10, 6, 6, 6, 7, 6, 30, 6, 6,
+                6, 6, 6, 10, 10, 6, 6, 6, 6, 10, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 10, 6, 6, 6, 6, 10, 6, 6, 6, 30, 6, 30, 6,
+                30, 30, 6, 7, 30, 30, 6, 6, 30, 30, 30, 10, 6, 6, 30, 6,
+                6, 6, 10, 10, 10, 30, 30, 6, 30, 6, 30, 10, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 10, 30, 30, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 10, 30, 6, 6, 6, 10, 6, 6,
+                6, 6, 6, 30, 30, 7, 6, 30, 6, 10, 7, 7, 6, 10, 7, 6,
+                7, 7, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6,
+                6, 6, 10, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 10, 10, 7, 10, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 10, 6, 6, 6, 10, 6, 10, 6, 10, 10, 10,
+                10, 6, 7, 10, 10, 6, 6, 6, 7, 6, 10, 6, 7, 6, 6, 10,
+                10, 7, 7, 30, 6, 30, 6, 7, 7, 7, 6, 6, 6, 10, 30, 6,
+                6, 6, 30, 6, 7, 7, 7, 6, 6, 7, 10, 10, 6, 10, 10, 10,
+                10, 7, 6, 7, 6, 6, 6, 6, 10, 10, 7, 6, 7, 6, 7, 6,
+                7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+                7, 6, 7, 6, 10, 6, 6, 6, 10, 10, 10, 6, 10, 6, 7, 7,
+                6, 10, 10, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 6, 6, 6, 7, 6, 7, 6, 6, 7, 6, 10, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 7, 7, 6, 7, 6, 10, 30, 30, 30, 6, 6, 6, 10, 6, 10,
+                6, 6, 10, 10, 10, 10, 10, 30, 30, 30, 6, 7, 6, 6, 6, 6,
+                6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+                6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 7, 10, 6, 6, 6, 10, 7, 10,
+                6, 6, 6, 10, 6, 10, 6, 6, 6, 7, 7, 7, 6, 6, 6, 6,
+                6, 6, 6, 6, 30, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7,
+                10, 7, 7, 6, 6, 6, 6, 6, 7, 7, 6, 6, 6, 10, 6, 6,
+                6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 7, 6, 6, 7, 6, 6, 6, 10, 10, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 6, 7, 6, 6, 7, 7,
+                7, 7, 6, 6, 6, 6, 7, 6, 6, 7, 7, 6, 6, 6, 6, 6,
+                6, 6, 6, 7, 6, 6, 6, 7, 7, 7, 6, 6, 6, 6, 6, 7,
+                6, 7, 10, 7, 7, 10, 6, 10, 7, 6, 6, 10, 7, 10, 6, 7,
+                10, 10, 10, 6, 6, 6, 6, 7, 7, 6, 10, 10, 30, 6, 10, 10,
+                6, 6, 10, 10, 6, 6, 6, 6, 6, 6, 10, 10, 10, 10, 6, 10,
+                6, 6, 10, 6, 10, 10, 10, 10, 6, 10, 10, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 10, 6, 6, 6, 6, 6,
+                10, 10, 7, 7, 7, 7, 7, 10, 7, 10, 10, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 10, 10, 10, 6, 6, 7, 10,
+                6, 6, 7, 6, 6, 6, 6, 7, 7, 7, 6, 10, 10, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 10, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 10, 6, 6, 6, 6, 6, 6,
+                6, 6, 20, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 10, 7,
+                40, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 6,
+                20, 20, 20, 20, 20, 20, 20, 20, 6, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 6, 20, 20, 20, 20, 20, 20, 20, 6, 20, 6, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 6, 20,
+                20, 20, 6, 20, 20, 20, 20, 20, 20, 20, 6, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 6, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 6, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 20, 20, 20, 20, 20, 20, 20,
+            };
+            static constexpr std::uint8_t width[count] = {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 1, 2, 2,
+                2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2,
+                2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2,
+                2, 2, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2,
+                1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 1, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 1, 1, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 1, 1, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2,
+                2, 1, 2, 1, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 2, 2, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2,
+                2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+                2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1,
+                1, 1, 1, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2,
+                2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 1, 1,
+                1, 1, 2, 2, 2, 2, 1, 2, 2, 1, 1, 2, 2, 2, 2, 2,
+                2, 2, 2, 1, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 1,
+                2, 1, 1, 1, 1, 1, 2, 2, 1, 2, 2, 1, 1, 1, 2, 1,
+                1, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 1, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1,
+                2, 2, 1, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2,
+            };
+
+            // Indexes: where every group starts, with the end as the last
+            // element, and all emojis by version and by width, narrow first
+            static constexpr std::uint16_t groupStart[groups + 1] = {
+                0, 128, 326, 326, 431, 522, 721, 785, 977, 1179, 1432,
+            };
+            static constexpr std::uint16_t byVersion[count] = {
+                1, 2, 3, 4, 5, 7, 10, 11, 13, 14, 16, 17, 19, 21, 22, 30,
+                31, 35, 36, 37, 40, 45, 55, 56, 59, 60, 61, 62, 63, 64, 65, 66,
+                67, 68, 69, 70, 71, 72, 73, 75, 76, 78, 80, 81, 82, 83, 84, 86,
+                87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+                103, 104, 105, 106, 108, 109, 110, 111, 112, 113, 115, 116, 117, 118, 119, 120,
+                121, 123, 127, 128, 131, 133, 134, 138, 139, 140, 142, 143, 144, 145, 146, 147,
+                150, 151, 152, 154, 156, 158, 159, 160, 161, 163, 164, 165, 166, 167, 168, 169,
+                170, 172, 173, 174, 176, 178, 180, 182, 184, 186, 224, 228, 230, 233, 234, 236,
+                238, 240, 241, 243, 245, 247, 249, 251, 254, 259, 262, 266, 286, 289, 291, 294,
+                322, 324, 325, 326, 327, 329, 331, 332, 334, 337, 340, 341, 344, 348, 350, 351,
+                353, 356, 357, 359, 362, 363, 367, 368, 369, 370, 372, 374, 375, 376, 377, 378,
+                383, 385, 387, 388, 390, 392, 393, 394, 395, 397, 398, 399, 401, 402, 403, 404,
+                408, 409, 410, 412, 414, 415, 416, 417, 418, 421, 422, 423, 424, 426, 427, 428,
+                429, 430, 431, 432, 433, 434, 436, 437, 438, 439, 441, 442, 443, 445, 447, 450,
+                454, 455, 460, 461, 463, 464, 465, 471, 473, 476, 477, 478, 479, 480, 481, 482,
+                483, 484, 485, 486, 487, 488, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+                502, 503, 506, 507, 508, 510, 511, 512, 513, 514, 518, 520, 524, 527, 530, 531,
+                542, 543, 544, 545, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558,
+                559, 560, 565, 566, 567, 568, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+                580, 582, 583, 584, 586, 588, 593, 597, 598, 599, 601, 603, 605, 606, 612, 614,
+                618, 619, 620, 623, 624, 625, 627, 631, 632, 636, 642, 644, 645, 646, 647, 651,
+                653, 655, 657, 659, 661, 663, 665, 667, 669, 671, 673, 675, 677, 678, 679, 683,
+                685, 688, 691, 692, 693, 694, 695, 696, 707, 708, 709, 711, 713, 714, 716, 718,
+                719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
+                735, 736, 739, 741, 746, 747, 748, 750, 752, 753, 762, 764, 765, 766, 767, 768,
+                769, 770, 771, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 784, 785, 787,
+                788, 789, 790, 791, 792, 793, 794, 795, 796, 798, 799, 800, 801, 802, 803, 804,
+                805, 806, 807, 810, 811, 812, 816, 817, 818, 820, 822, 823, 824, 828, 829, 830,
+                831, 832, 833, 834, 835, 837, 838, 839, 840, 841, 842, 843, 844, 845, 851, 852,
+                853, 854, 855, 858, 859, 860, 862, 863, 864, 865, 867, 868, 869, 870, 871, 872,
+                873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 884, 885, 887, 888, 889, 892,
+                893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 906, 908, 909, 914, 915,
+                916, 917, 919, 920, 923, 924, 925, 926, 927, 928, 929, 930, 932, 933, 934, 938,
+                939, 940, 941, 942, 944, 950, 953, 954, 958, 963, 964, 965, 966, 969, 973, 976,
+                977, 980, 981, 982, 983, 984, 985, 990, 992, 993, 995, 1000, 1003, 1004, 1005, 1006,
+                1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1019, 1020, 1021, 1022, 1023,
+                1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1052, 1053,
+                1056, 1057, 1059, 1060, 1061, 1062, 1066, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
+                1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
+                1095, 1096, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1107, 1108, 1109, 1110, 1111, 1112,
+                1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128,
+                1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
+                1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160,
+                1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
+                1177, 1178, 1179, 1180, 1181, 1231, 1240, 1251, 1259, 1261, 1294, 1298, 1306, 1374, 1414, 27,
+                52, 122, 125, 130, 155, 162, 226, 253, 258, 260, 268, 270, 321, 330, 335, 365,
+                379, 405, 406, 411, 451, 517, 522, 523, 526, 528, 529, 532, 533, 534, 535, 536,
+                537, 538, 539, 540, 541, 563, 569, 594, 600, 604, 609, 610, 615, 616, 617, 628,
+                629, 630, 633, 641, 643, 650, 652, 654, 656, 658, 660, 662, 664, 666, 668, 670,
+                672, 674, 686, 687, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 710, 712,
+                715, 737, 738, 740, 763, 772, 783, 786, 797, 808, 814, 825, 826, 827, 846, 847,
+                849, 850, 856, 857, 866, 883, 886, 904, 905, 907, 910, 911, 912, 913, 918, 921,
+                922, 931, 935, 936, 937, 943, 945, 947, 948, 952, 956, 959, 967, 968, 1026, 1027,
+                1028, 1029, 1030, 1032, 1054, 1058, 1063, 1064, 1065, 1183, 0, 8, 9, 12, 15, 18,
+                20, 23, 24, 25, 26, 28, 29, 32, 33, 39, 41, 42, 47, 48, 49, 50,
+                51, 53, 54, 57, 58, 74, 77, 85, 107, 126, 132, 136, 141, 257, 264, 272,
+                274, 287, 288, 290, 323, 336, 338, 339, 342, 345, 346, 347, 349, 352, 354, 355,
+                360, 361, 364, 371, 373, 384, 389, 391, 407, 419, 420, 425, 435, 440, 459, 466,
+                467, 468, 475, 489, 504, 509, 521, 525, 546, 561, 562, 564, 581, 585, 587, 589,
+                590, 591, 592, 595, 596, 602, 607, 608, 621, 634, 635, 637, 638, 639, 640, 648,
+                649, 676, 680, 681, 682, 684, 689, 690, 717, 742, 749, 751, 754, 755, 756, 757,
+                758, 809, 813, 815, 819, 821, 848, 861, 890, 891, 946, 949, 951, 955, 957, 960,
+                961, 962, 970, 971, 974, 975, 978, 979, 986, 987, 988, 989, 991, 994, 996, 997,
+                998, 999, 1001, 1002, 1018, 1024, 1025, 1031, 1033, 1034, 1049, 1050, 1051, 1055, 1067, 1068,
+                1086, 1097, 1182, 124, 292, 293, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304,
+                305, 306, 307, 308, 309, 310, 1106, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
+                1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209,
+                1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
+                1226, 1227, 1228, 1229, 1230, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1241, 1242, 1243,
+                1244, 1245, 1246, 1247, 1248, 1249, 1250, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1260, 1262,
+                1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278,
+                1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1295,
+                1296, 1297, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1307, 1308, 1309, 1310, 1311, 1312, 1313,
+                1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329,
+                1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345,
+                1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361,
+                1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1375, 1376, 1377, 1378,
+                1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
+                1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410,
+                1411, 1412, 1413, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427,
+                1428, 1429, 1430, 1431, 6, 34, 38, 43, 44, 46, 79, 114, 129, 135, 137, 148,
+                149, 153, 157, 188, 190, 232, 237, 239, 242, 252, 256, 328, 333, 343, 358, 366,
+                380, 381, 382, 386, 396, 400, 413, 444, 446, 448, 449, 452, 453, 456, 457, 458,
+                462, 469, 470, 472, 474, 490, 491, 505, 515, 516, 519, 611, 613, 622, 626, 743,
+                744, 745, 759, 760, 761, 836, 972, 171, 175, 177, 179, 181, 183, 185, 187, 189,
+                191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+                207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+                223, 225, 227, 229, 231, 235, 244, 246, 248, 250, 255, 261, 263, 265, 267, 269,
+                271, 273, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 311, 312, 313,
+                314, 315, 316, 317, 318, 319, 320, 1184,
+            };
+            static constexpr std::uint16_t byWidth[count] = {
+                52, 77, 107, 122, 124, 125, 130, 134, 143, 155, 162, 226, 253, 258, 260, 268,
+                270, 321, 365, 379, 405, 406, 411, 425, 451, 517, 526, 528, 529, 532, 533, 534,
+                535, 536, 537, 538, 539, 540, 541, 563, 569, 609, 610, 615, 616, 617, 628, 629,
+                630, 633, 641, 643, 648, 649, 650, 687, 697, 698, 699, 700, 701, 702, 703, 704,
+                705, 706, 710, 712, 715, 717, 737, 738, 740, 763, 772, 783, 786, 797, 808, 825,
+                826, 827, 846, 847, 848, 849, 850, 856, 857, 866, 883, 886, 907, 910, 911, 912,
+                913, 918, 921, 922, 931, 935, 936, 937, 943, 945, 946, 947, 948, 949, 952, 955,
+                956, 957, 959, 960, 967, 968, 974, 975, 1001, 1002, 1025, 1026, 1027, 1028, 1029, 1030,
+                1031, 1032, 1033, 1054, 1055, 1058, 1063, 1064, 1065, 1086, 1106, 1183, 0, 1, 2, 3,
+                4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+                20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+                36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+                53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68,
+                69, 70, 71, 72, 73, 74, 75, 76, 78, 79, 80, 81, 82, 83, 84, 85,
+                86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+                102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+                119, 120, 121, 123, 126, 127, 128, 129, 131, 132, 133, 135, 136, 137, 138, 139,
+                140, 141, 142, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 156, 157,
+                158, 159, 160, 161, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+                175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+                191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+                207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+                223, 224, 225, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+                240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 254, 255, 256,
+                257, 259, 261, 262, 263, 264, 265, 266, 267, 269, 271, 272, 273, 274, 275, 276,
+                277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+                293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+                309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 322, 323, 324, 325,
+                326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341,
+                342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357,
+                358, 359, 360, 361, 362, 363, 364, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+                375, 376, 377, 378, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391,
+                392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 407, 408, 409,
+                410, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 426, 427,
+                428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
+                444, 445, 446, 447, 448, 449, 450, 452, 453, 454, 455, 456, 457, 458, 459, 460,
+                461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476,
+                477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
+                493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508,
+                509, 510, 511, 512, 513, 514, 515, 516, 518, 519, 520, 521, 522, 523, 524, 525,
+                527, 530, 531, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+                555, 556, 557, 558, 559, 560, 561, 562, 564, 565, 566, 567, 568, 570, 571, 572,
+                573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588,
+                589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604,
+                605, 606, 607, 608, 611, 612, 613, 614, 618, 619, 620, 621, 622, 623, 624, 625,
+                626, 627, 631, 632, 634, 635, 636, 637, 638, 639, 640, 642, 644, 645, 646, 647,
+                651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666,
+                667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682,
+                683, 684, 685, 686, 688, 689, 690, 691, 692, 693, 694, 695, 696, 707, 708, 709,
+                711, 713, 714, 716, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729,
+                730, 731, 732, 733, 734, 735, 736, 739, 741, 742, 743, 744, 745, 746, 747, 748,
+                749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 764, 765,
+                766, 767, 768, 769, 770, 771, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782,
+                784, 785, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 798, 799, 800, 801,
+                802, 803, 804, 805, 806, 807, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818,
+                819, 820, 821, 822, 823, 824, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837,
+                838, 839, 840, 841, 842, 843, 844, 845, 851, 852, 853, 854, 855, 858, 859, 860,
+                861, 862, 863, 864, 865, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877,
+                878, 879, 880, 881, 882, 884, 885, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+                896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 908, 909, 914, 915, 916,
+                917, 919, 920, 923, 924, 925, 926, 927, 928, 929, 930, 932, 933, 934, 938, 939,
+                940, 941, 942, 944, 950, 951, 953, 954, 958, 961, 962, 963, 964, 965, 966, 969,
+                970, 971, 972, 973, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987,
+                988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1003, 1004, 1005,
+                1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021,
+                1022, 1023, 1024, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046,
+                1047, 1048, 1049, 1050, 1051, 1052, 1053, 1056, 1057, 1059, 1060, 1061, 1062, 1066, 1067, 1068,
+                1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084,
+                1085, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101,
+                1102, 1103, 1104, 1105, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118,
+                1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
+                1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150,
+                1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166,
+                1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182,
+                1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199,
+                1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+                1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+                1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247,
+                1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+                1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+                1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+                1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+                1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+                1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+                1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+                1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+                1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+                1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
+                1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423,
+                1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431,
+            };
+            static constexpr std::size_t narrow = 140;
+
+            // The perfect hash from names to emojis
+            static constexpr std::size_t buckets = 358;
+            static constexpr std::uint16_t pilots[buckets] = {
+                16, 158, 32, 2, 0, 7, 1, 0, 9, 71, 54, 1, 14, 5, 1, 122,
+                3, 105, 150, 169, 3, 255, 1, 5, 0, 499, 3, 3, 15, 1, 40, 11,
+                59, 112, 97, 0, 18, 0, 21, 140, 370, 0, 60, 12, 1, 61, 59, 2,
+                55, 13, 21, 10, 22, 24, 202, 4, 235, 166, 116, 4, 235, 9, 3, 10,
+                18, 20, 152, 3, 0, 48, 293, 236, 94, 8, 16, 0, 0, 12, 4, 40,
+                42, 0, 179, 138, 0, 93, 5, 8, 12, 55, 0, 47, 7, 27, 107, 126,
+                20, 0, 171, 0, 1, 1, 22, 108, 5, 20, 183, 0, 25, 5, 37, 192,
+                37, 2, 72, 4, 266, 6, 6, 215, 48, 7, 2, 0, 3, 1533, 57, 0,
+                18, 24, 743, 65, 14, 13, 50, 24, 127, 21, 15, 43, 9, 138, 7, 2,
+                395, 50, 6, 207, 28, 4, 1, 10, 135, 16, 0, 181, 25, 489, 9, 1,
+                18, 115, 5, 4, 45, 83, 1, 9, 117, 0, 1331, 6, 146, 208, 2, 2,
+                1, 48, 15, 10, 14, 0, 5, 0, 8, 38, 79, 68, 0, 1, 10, 455,
+                380, 11, 202, 6, 3, 170, 62, 52, 69, 85, 34, 524, 15, 162, 99, 12,
+                48, 380, 86, 35, 909, 8, 55, 32, 424, 42, 338, 503, 3, 101, 15, 369,
+                0, 59, 90, 21, 0, 59, 228, 20, 154, 0, 485, 0, 101, 3, 41, 50,
+                16, 65, 2, 0, 107, 771, 4, 7, 190, 0, 483, 0, 132, 2, 1, 235,
+                5, 97, 321, 510, 303, 836, 5, 2, 28, 29, 0, 626, 48, 383, 776, 63,
+                16, 926, 122, 1, 5, 2, 104, 91, 1221, 6, 390, 201, 0, 176, 0, 451,
+                9, 148, 52, 393, 68, 15, 171, 21, 754, 11, 415, 5, 146, 71, 215, 222,
+                681, 5, 2169, 49, 8, 250, 251, 1257, 347, 155, 475, 108, 144, 958, 669, 2956,
+                264, 1168, 214, 231, 90, 626, 5, 148, 2, 13, 11, 954, 43, 93, 30, 1,
+                812, 462, 210, 235, 82, 64, 84, 2, 2, 309, 785, 1091, 3, 15, 149, 2,
+                4, 395, 1355, 80, 24, 33,
+            };
+            static constexpr std::uint16_t slots[count] = {
+                832, 1375, 1105, 1372, 221, 1404, 188, 1344, 139, 1187, 1311, 924, 1320, 1333, 252, 156,
+                921, 352, 1185, 624, 1242, 190, 694, 132, 620, 1408, 274, 183, 736, 409, 413, 1303,
+                871, 453, 321, 215, 1062, 609, 29, 16, 683, 1192, 327, 258, 654, 1269, 728, 1427,
+                835, 1370, 433, 702, 818, 1398, 805, 120, 1027, 232, 935, 1166, 816, 1057, 1195, 219,
+                916, 1095, 336, 1334, 1198, 480, 640, 678, 27, 210, 759, 1302, 1106, 1407, 780, 1199,
+                1147, 746, 1381, 1346, 367, 1046, 971, 601, 1406, 259, 389, 1352, 659, 375, 237, 564,
+                1300, 887, 674, 1163, 430, 142, 1221, 1348, 127, 528, 548, 39, 607, 1364, 729, 1060,
+                224, 405, 893, 649, 300, 63, 59, 228, 1184, 667, 368, 1292, 1054, 326, 449, 1338,
+                194, 315, 164, 1129, 420, 1229, 1299, 989, 1357, 158, 1132, 959, 605, 543, 445, 1125,
+                748, 829, 421, 293, 802, 481, 584, 177, 1120, 83, 436, 58, 1113, 767, 1401, 479,
+                753, 297, 1003, 447, 632, 1424, 248, 1277, 1390, 1026, 35, 344, 362, 995, 800, 872,
+                892, 841, 520, 768, 1102, 1043, 1208, 675, 1066, 724, 1055, 595, 742, 779, 291, 639,
+                261, 342, 1205, 1308, 531, 1305, 442, 403, 3, 1211, 1118, 476, 915, 398, 87, 1420,
+                46, 1256, 451, 1114, 150, 441, 308, 616, 588, 1075, 359, 99, 651, 162, 44, 1087,
+                238, 123, 189, 1224, 387, 459, 1266, 250, 427, 519, 463, 862, 1251, 130, 1423, 809,
+                197, 717, 954, 467, 865, 688, 1236, 895, 101, 1351, 88, 1158, 1282, 1157, 622, 551,
+                1290, 784, 739, 1176, 268, 718, 1296, 987, 888, 406, 505, 377, 1034, 873, 79, 1289,
+                1340, 952, 247, 225, 392, 393, 242, 347, 610, 425, 211, 692, 706, 7, 36, 979,
+                994, 894, 1247, 339, 542, 1052, 1082, 653, 695, 1330, 497, 446, 1154, 1124, 791, 575,
+                10, 465, 410, 1405, 636, 176, 877, 686, 507, 936, 114, 56, 665, 856, 982, 975,
+                496, 1064, 938, 385, 956, 1099, 1178, 1152, 867, 980, 45, 526, 1387, 769, 42, 423,
+                941, 166, 1190, 619, 1315, 193, 302, 482, 178, 222, 843, 1068, 666, 233, 890, 1076,
+                838, 559, 1214, 1071, 1335, 1, 618, 48, 1059, 1358, 317, 487, 1131, 679, 1280, 725,
+                985, 241, 876, 608, 417, 870, 402, 758, 471, 503, 40, 1382, 997, 337, 1228, 983,
+                165, 1130, 637, 419, 64, 1356, 1182, 670, 1061, 1337, 115, 521, 137, 485, 1101, 376,
+                1151, 1067, 1331, 1325, 973, 1015, 1084, 572, 1217, 1252, 991, 369, 961, 14, 701, 565,
+                945, 1110, 955, 153, 813, 38, 180, 1197, 612, 1098, 353, 977, 199, 1376, 823, 988,
+                819, 757, 1284, 594, 1029, 508, 1371, 960, 527, 1025, 466, 456, 448, 1293, 1202, 1007,
+                217, 195, 1210, 1223, 8, 911, 1040, 1119, 1231, 491, 552, 49, 226, 159, 855, 771,
+                946, 356, 1041, 752, 1091, 381, 917, 1146, 1200, 455, 161, 273, 1092, 1388, 1329, 340,
+                52, 244, 1096, 1362, 567, 511, 404, 668, 680, 506, 909, 613, 1260, 1353, 208, 262,
+                254, 885, 371, 186, 1056, 1016, 704, 648, 571, 444, 1206, 628, 900, 1122, 831, 1317,
+                370, 821, 621, 750, 1081, 1347, 996, 1138, 826, 1173, 170, 185, 149, 490, 472, 15,
+                492, 596, 287, 489, 181, 1369, 1023, 672, 880, 852, 329, 530, 71, 951, 1350, 331,
+                1216, 220, 384, 903, 705, 126, 218, 546, 33, 1172, 478, 1111, 685, 168, 116, 770,
+                944, 730, 81, 266, 554, 630, 699, 18, 1018, 1037, 1014, 122, 655, 4, 949, 698,
+                464, 380, 400, 12, 468, 1412, 73, 53, 905, 65, 1144, 1285, 590, 866, 708, 555,
+                1189, 603, 499, 859, 55, 289, 1304, 121, 785, 299, 397, 1267, 452, 943, 1070, 732,
+                786, 47, 1218, 1396, 1116, 179, 298, 154, 1191, 1135, 346, 1367, 1149, 815, 309, 1271,
+                763, 1063, 539, 664, 808, 360, 714, 569, 458, 691, 17, 483, 1239, 109, 889, 1150,
+                11, 696, 1021, 1339, 711, 787, 1107, 54, 690, 313, 635, 828, 563, 28, 414, 318,
+                372, 645, 67, 765, 899, 1179, 934, 524, 450, 257, 733, 898, 561, 1415, 498, 540,
+                1000, 82, 773, 104, 1313, 851, 1395, 57, 240, 112, 234, 1104, 462, 424, 408, 806,
+                198, 1258, 131, 354, 807, 957, 761, 86, 412, 1225, 1048, 66, 1143, 710, 574, 661,
+                884, 118, 547, 1183, 303, 1319, 515, 523, 681, 203, 910, 207, 738, 801, 913, 1112,
+                1017, 1416, 1380, 1169, 560, 804, 253, 37, 1272, 96, 106, 152, 1262, 358, 323, 682,
+                279, 749, 1234, 940, 1233, 1086, 627, 1418, 993, 129, 576, 1421, 1249, 700, 431, 1134,
+                140, 246, 984, 845, 1314, 145, 147, 1121, 1343, 249, 1083, 501, 504, 1274, 1326, 278,
+                296, 201, 1240, 19, 737, 1414, 428, 597, 98, 1374, 1088, 772, 912, 1033, 24, 50,
+                1073, 1005, 440, 734, 1160, 1250, 764, 1232, 897, 20, 868, 230, 891, 557, 415, 1011,
+                108, 1142, 146, 1248, 366, 788, 1222, 842, 577, 1141, 918, 235, 599, 516, 1128, 589,
+                881, 192, 265, 144, 1117, 697, 782, 92, 1391, 1137, 270, 345, 847, 223, 231, 1012,
+                797, 89, 281, 611, 825, 383, 858, 1286, 512, 68, 533, 1366, 1385, 878, 263, 1031,
+                968, 182, 962, 715, 304, 1148, 1127, 1368, 1431, 136, 310, 534, 1009, 78, 650, 113,
+                811, 373, 236, 1006, 1301, 966, 267, 792, 904, 587, 689, 460, 1167, 1047, 1089, 568,
+                9, 658, 775, 454, 1140, 334, 102, 22, 922, 1394, 978, 671, 716, 509, 214, 535,
+                1032, 1265, 143, 638, 1283, 1245, 341, 1213, 1281, 382, 712, 1324, 1238, 1093, 1323, 652,
+                1001, 439, 810, 1392, 830, 276, 844, 1409, 614, 754, 1318, 633, 288, 634, 322, 1227,
+                669, 644, 1411, 1273, 1276, 1278, 1389, 141, 1145, 305, 1363, 967, 94, 1174, 100, 125,
+                525, 202, 570, 925, 1402, 474, 1103, 204, 32, 60, 731, 437, 160, 693, 502, 1264,
+                974, 929, 351, 292, 1379, 1230, 484, 1115, 1186, 647, 1036, 365, 2, 747, 721, 324,
+                251, 1383, 163, 723, 1425, 566, 350, 1235, 760, 239, 1074, 1413, 124, 320, 756, 229,
+                522, 777, 301, 167, 316, 820, 928, 307, 1360, 1077, 1332, 735, 606, 209, 172, 84,
+                1237, 586, 128, 1194, 1072, 1399, 513, 1268, 591, 500, 762, 623, 1090, 963, 933, 1410,
+                673, 61, 255, 965, 75, 325, 550, 626, 438, 1085, 283, 1261, 1201, 854, 1042, 727,
+                1153, 793, 212, 0, 30, 1220, 643, 1275, 151, 1287, 1306, 1354, 864, 1312, 1035, 290,
+                1400, 1058, 1203, 95, 1295, 1328, 435, 1175, 275, 90, 330, 107, 1419, 783, 117, 774,
+                1024, 886, 328, 1327, 1168, 1164, 999, 720, 173, 294, 461, 585, 80, 617, 1038, 396,
+                942, 1207, 1309, 744, 882, 545, 284, 998, 789, 1080, 1050, 1355, 1365, 992, 93, 751,
+                906, 494, 1417, 1215, 707, 422, 1386, 822, 13, 958, 1065, 355, 155, 947, 817, 849,
+                6, 213, 1310, 378, 840, 169, 1246, 97, 896, 418, 593, 256, 937, 1430, 495, 902,
+                812, 1361, 1053, 953, 416, 1429, 277, 486, 677, 709, 901, 227, 69, 743, 1244, 85,
+                719, 171, 834, 592, 391, 1136, 245, 1049, 401, 457, 357, 1193, 703, 282, 1384, 1307,
+                374, 1045, 538, 907, 839, 379, 191, 1165, 286, 62, 1342, 1373, 1322, 1196, 863, 23,
+                1422, 776, 875, 1291, 1039, 600, 269, 1297, 206, 926, 986, 794, 964, 1341, 583, 932,
+                343, 272, 434, 848, 562, 1257, 280, 726, 411, 76, 931, 660, 1288, 1243, 174, 148,
+                205, 5, 196, 657, 857, 314, 187, 399, 395, 532, 1349, 755, 31, 1094, 541, 1002,
+                407, 544, 846, 582, 536, 21, 861, 1010, 514, 874, 919, 488, 271, 260, 70, 1078,
+                1161, 1159, 394, 799, 184, 1108, 475, 930, 558, 646, 306, 1177, 216, 110, 814, 134,
+                335, 103, 1181, 1212, 285, 517, 1004, 923, 722, 824, 34, 781, 1226, 1019, 990, 1426,
+                1170, 1204, 388, 1044, 1219, 1171, 656, 529, 443, 798, 1030, 1253, 1254, 883, 604, 853,
+                914, 51, 580, 1378, 1294, 429, 598, 1241, 72, 948, 629, 713, 556, 386, 295, 243,
+                578, 469, 1336, 41, 549, 573, 950, 426, 77, 1109, 390, 1008, 836, 969, 1188, 1155,
+                1270, 981, 91, 1051, 119, 111, 879, 837, 625, 43, 470, 663, 1097, 976, 1028, 473,
+                1069, 311, 1393, 1321, 493, 920, 1316, 537, 1263, 687, 1139, 553, 1020, 642, 74, 939,
+                1428, 1279, 349, 1209, 581, 1298, 200, 1345, 1403, 1180, 518, 796, 1156, 1359, 741, 338,
+                684, 1013, 850, 795, 790, 631, 26, 602, 105, 745, 135, 803, 615, 25, 1162, 1100,
+                827, 766, 972, 833, 477, 361, 332, 1126, 1255, 133, 970, 333, 676, 927, 138, 740,
+                157, 363, 662, 1079, 1022, 312, 641, 1397, 432, 1133, 510, 364, 579, 348, 908, 778,
+                1377, 1259, 264, 860, 175, 319, 869, 1123,
+            };
+
+            // The trie from bytes to emojis, the root is node 0
+            static constexpr std::size_t longestEmoji = 27;
+            static constexpr std::uint16_t reverseRoot[256] = {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+                3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            };
+            static constexpr ReverseNode reverseNodes[2317] = {
+                { 0x0000000000000000ull, 1, 0, 0x00 },
+                { 0x0000800000000000ull, 17, 0, 0xC0 },
+                { 0x0000000400000000ull, 18, 0, 0xC0 },
+                { 0x0000800000000000ull, 19, 0, 0xC0 },
+                { 0x0000800000000000ull, 20, 0, 0xC0 },
+                { 0x0000800000000000ull, 21, 0, 0xC0 },
+                { 0x0000800000000000ull, 22, 0, 0xC0 },
+                { 0x0000800000000000ull, 23, 0, 0xC0 },
+                { 0x0000800000000000ull, 24, 0, 0xC0 },
+                { 0x0000800000000000ull, 25, 0, 0xC0 },
+                { 0x0000800000000000ull, 26, 0, 0xC0 },
+                { 0x0000800000000000ull, 27, 0, 0xC0 },
+                { 0x0000800000000000ull, 28, 0, 0xC0 },
+                { 0x0000420000000000ull, 29, 0, 0x80 },
+                { 0x000030107FC89053ull, 31, 0, 0x80 },
+                { 0x0000000000000401ull, 50, 0, 0x80 },
+                { 0x0000000080000000ull, 52, 0, 0x80 },
+                { 0x0100000000000000ull, 53, 0, 0x80 },
+                { 0x0000000000000008ull, 54, 0, 0x80 },
+                { 0x0100000000000000ull, 55, 0, 0x80 },
+                { 0x0100000000000000ull, 56, 0, 0x80 },
+                { 0x0100000000000000ull, 57, 0, 0x80 },
+                { 0x0100000000000000ull, 58, 0, 0x80 },
+                { 0x0100000000000000ull, 59, 0, 0x80 },
+                { 0x0100000000000000ull, 60, 0, 0x80 },
+                { 0x0100000000000000ull, 61, 0, 0x80 },
+                { 0x0100000000000000ull, 62, 0, 0x80 },
+                { 0x0100000000000000ull, 63, 0, 0x80 },
+                { 0x0100000000000000ull, 64, 0, 0x80 },
+                { 0x0000800000000000ull, 65, 1103, 0xC0 },
+                { 0x0000800000000000ull, 66, 1104, 0xC0 },
+                { 0x1000000000000000ull, 67, 0, 0x80 },
+                { 0x0000000000000200ull, 68, 0, 0x80 },
+                { 0x0200000400000000ull, 69, 0, 0x80 },
+                { 0x0000060003F00000ull, 71, 0, 0x80 },
+                { 0x000001000C000000ull, 79, 0, 0x80 },
+                { 0x070FFE0000000000ull, 82, 0, 0x80 },
+                { 0x0000000000000004ull, 96, 0, 0x80 },
+                { 0x00400C0000000000ull, 97, 0, 0x80 },
+                { 0x7800000000000001ull, 100, 0, 0x80 },
+                { 0x0700C44D2132401Full, 105, 0, 0x80 },
+                { 0x88000169000FFF00ull, 126, 0, 0x80 },
+                { 0x60030C031ADC0000ull, 145, 0, 0x80 },
+                { 0x27BF0600001AC130ull, 161, 0, 0x80 },
+                { 0x001801022054BF24ull, 182, 0, 0x80 },
+                { 0x0000001800B85090ull, 199, 0, 0x80 },
+                { 0x8001000200E00000ull, 209, 0, 0x80 },
+                { 0x0030000000000000ull, 215, 0, 0x80 },
+                { 0x00000000180000E0ull, 217, 0, 0x80 },
+                { 0x0000000000210000ull, 222, 0, 0x80 },
+                { 0x2001000000000000ull, 224, 0, 0x80 },
+                { 0x0000000002800000ull, 226, 0, 0x80 },
+                { 0x000000F00FFFF3E9ull, 228, 0, 0x80 },
+                { 0x0000000000008000ull, 255, 0, 0x80 },
+                { 0x0000000800000000ull, 256, 0, 0x80 },
+                { 0x0000000000008000ull, 257, 0, 0x80 },
+                { 0x0000000000008000ull, 258, 0, 0x80 },
+                { 0x0000000000008000ull, 259, 0, 0x80 },
+                { 0x0000000000008000ull, 260, 0, 0x80 },
+                { 0x0000000000008000ull, 261, 0, 0x80 },
+                { 0x0000000000008000ull, 262, 0, 0x80 },
+                { 0x0000000000008000ull, 263, 0, 0x80 },
+                { 0x0000000000008000ull, 264, 0, 0x80 },
+                { 0x0000000000008000ull, 265, 0, 0x80 },
+                { 0x0000000000008000ull, 266, 0, 0x80 },
+                { 0x0100000000000000ull, 267, 0, 0x80 },
+                { 0x0100000000000000ull, 268, 0, 0x80 },
+                { 0x0000800000000000ull, 269, 1077, 0xC0 },
+                { 0x0000800000000000ull, 270, 1078, 0xC0 },
+                { 0x0000800000000000ull, 271, 1105, 0xC0 },
+                { 0x0000800000000000ull, 272, 1130, 0xC0 },
+                { 0x0000800000000000ull, 273, 1013, 0xC0 },
+                { 0x0000800000000000ull, 274, 1012, 0xC0 },
+                { 0x0000800000000000ull, 275, 1011, 0xC0 },
+                { 0x0000800000000000ull, 276, 1005, 0xC0 },
+                { 0x0000800000000000ull, 277, 1007, 0xC0 },
+                { 0x0000800000000000ull, 278, 1009, 0xC0 },
+                { 0x0000800000000000ull, 279, 1014, 0xC0 },
+                { 0x0000800000000000ull, 280, 1015, 0xC0 },
+                { 0x0000000000000000ull, 0, 647, 0x00 },
+                { 0x0000000000000000ull, 0, 645, 0x00 },
+                { 0x0000000000000000ull, 0, 849, 0x00 },
+                { 0x0000000000000000ull, 0, 1054, 0x00 },
+                { 0x0000000000000000ull, 0, 1058, 0x00 },
+                { 0x0000000000000000ull, 0, 1061, 0x00 },
+                { 0x0000000000000000ull, 0, 1063, 0x00 },
+                { 0x0000000000000000ull, 0, 1055, 0x00 },
+                { 0x0000000000000000ull, 0, 1059, 0x00 },
+                { 0x0000000000000000ull, 0, 1056, 0x00 },
+                { 0x0000000000000000ull, 0, 648, 0x00 },
+                { 0x0000000000000000ull, 0, 649, 0x00 },
+                { 0x0000000000000000ull, 0, 650, 0x00 },
+                { 0x0000000000000000ull, 0, 646, 0x00 },
+                { 0x0000000000000000ull, 0, 1064, 0x00 },
+                { 0x0000000000000000ull, 0, 1065, 0x00 },
+                { 0x0000000000000000ull, 0, 1066, 0x00 },
+                { 0x0000800000000000ull, 281, 1132, 0xC0 },
+                { 0x0000800000000000ull, 282, 1168, 0xC0 },
+                { 0x0000800000000000ull, 283, 1169, 0xC0 },
+                { 0x0000800000000000ull, 284, 1053, 0xC0 },
+                { 0x0000800000000000ull, 285, 1057, 0xC0 },
+                { 0x0000800000000000ull, 286, 1165, 0xC0 },
+                { 0x0000800000000000ull, 287, 1164, 0xC0 },
+                { 0x0000000000000000ull, 0, 1167, 0x00 },
+                { 0x0000000000000000ull, 0, 1166, 0x00 },
+                { 0x0000800000000000ull, 288, 689, 0xC0 },
+                { 0x0000800000000000ull, 289, 696, 0xC0 },
+                { 0x0000000000000000ull, 0, 711, 0x00 },
+                { 0x0000000000000000ull, 0, 716, 0x00 },
+                { 0x0000000000000000ull, 0, 718, 0x00 },
+                { 0x0000800000000000ull, 290, 840, 0xC0 },
+                { 0x0000800000000000ull, 291, 1093, 0xC0 },
+                { 0x0000000000000000ull, 0, 712, 0x00 },
+                { 0x0000000000000000ull, 0, 507, 0x00 },
+                { 0x0000000000000000ull, 0, 426, 0x00 },
+                { 0x0000000000000000ull, 0, 144, 0x00 },
+                { 0x0000000000000000ull, 0, 78, 0x00 },
+                { 0x0000000000000000ull, 0, 1002, 0x00 },
+                { 0x0000000000000000ull, 0, 1003, 0x00 },
+                { 0x0000000000000000ull, 0, 1032, 0x00 },
+                { 0x0000000000000000ull, 0, 1033, 0x00 },
+                { 0x0000000000000000ull, 0, 1034, 0x00 },
+                { 0x0000000000000000ull, 0, 1030, 0x00 },
+                { 0x0000000000000000ull, 0, 1029, 0x00 },
+                { 0x0000000000000000ull, 0, 53, 0x00 },
+                { 0x0000800000000000ull, 292, 17, 0xC0 },
+                { 0x0000000000000000ull, 0, 1037, 0x00 },
+                { 0x0000000000000000ull, 0, 1038, 0x00 },
+                { 0x0000000000000000ull, 0, 1039, 0x00 },
+                { 0x0000000000000000ull, 0, 1040, 0x00 },
+                { 0x0000000000000000ull, 0, 1041, 0x00 },
+                { 0x0000000000000000ull, 0, 1042, 0x00 },
+                { 0x0000000000000000ull, 0, 1043, 0x00 },
+                { 0x0000000000000000ull, 0, 1044, 0x00 },
+                { 0x0000000000000000ull, 0, 1045, 0x00 },
+                { 0x0000000000000000ull, 0, 1046, 0x00 },
+                { 0x0000000000000000ull, 0, 1047, 0x00 },
+                { 0x0000000000000000ull, 0, 1048, 0x00 },
+                { 0x0000800000000000ull, 293, 776, 0xC0 },
+                { 0x0000800000000000ull, 294, 779, 0xC0 },
+                { 0x0000800000000000ull, 295, 777, 0xC0 },
+                { 0x0000800000000000ull, 296, 778, 0xC0 },
+                { 0x0000800000000000ull, 297, 576, 0xC0 },
+                { 0x0000800000000000ull, 298, 1086, 0xC0 },
+                { 0x0000000000000000ull, 0, 981, 0x00 },
+                { 0x0000000000000000ull, 0, 947, 0x00 },
+                { 0x0000000000000000ull, 0, 625, 0x00 },
+                { 0x0000000000000000ull, 0, 950, 0x00 },
+                { 0x0000000000000000ull, 0, 958, 0x00 },
+                { 0x0000000000000000ull, 0, 961, 0x00 },
+                { 0x0000000000000000ull, 0, 956, 0x00 },
+                { 0x0000000000000000ull, 0, 1026, 0x00 },
+                { 0x0000000000000000ull, 0, 1087, 0x00 },
+                { 0x0000800000000000ull, 299, 991, 0xC0 },
+                { 0x0000000000000000ull, 0, 714, 0x00 },
+                { 0x0000000000000000ull, 0, 1161, 0x00 },
+                { 0x0000000000000000ull, 0, 1160, 0x00 },
+                { 0x0000000000000000ull, 0, 975, 0x00 },
+                { 0x0000000000000000ull, 0, 976, 0x00 },
+                { 0x0000000000000000ull, 0, 747, 0x00 },
+                { 0x0000000000000000ull, 0, 748, 0x00 },
+                { 0x0000000000000000ull, 0, 717, 0x00 },
+                { 0x0000000000000000ull, 0, 697, 0x00 },
+                { 0x0000000000000000ull, 0, 698, 0x00 },
+                { 0x0000000000000000ull, 0, 1049, 0x00 },
+                { 0x0000000000000000ull, 0, 946, 0x00 },
+                { 0x0000000000000000ull, 0, 809, 0x00 },
+                { 0x0000000000000000ull, 0, 960, 0x00 },
+                { 0x0000000000000000ull, 0, 993, 0x00 },
+                { 0x0000000000000000ull, 0, 564, 0x00 },
+                { 0x0000000000000000ull, 0, 561, 0x00 },
+                { 0x0000000000000000ull, 0, 530, 0x00 },
+                { 0x0000000000000000ull, 0, 713, 0x00 },
+                { 0x0000000000000000ull, 0, 566, 0x00 },
+                { 0x0000000000000000ull, 0, 763, 0x00 },
+                { 0x0000000000000000ull, 0, 630, 0x00 },
+                { 0x0000000000000000ull, 0, 626, 0x00 },
+                { 0x0000000000000000ull, 0, 259, 0x00 },
+                { 0x0000000000000000ull, 0, 764, 0x00 },
+                { 0x0000800000000000ull, 300, 269, 0xC0 },
+                { 0x0000000000000000ull, 0, 567, 0x00 },
+                { 0x0000000000000000ull, 0, 619, 0x00 },
+                { 0x0000800000000000ull, 301, 935, 0xC0 },
+                { 0x0000000000000000ull, 0, 1092, 0x00 },
+                { 0x0000800000000000ull, 302, 633, 0xC0 },
+                { 0x0000800000000000ull, 303, 896, 0xC0 },
+                { 0x0000000000000000ull, 0, 147, 0x00 },
+                { 0x0000000000000000ull, 0, 132, 0x00 },
+                { 0x0000000000000000ull, 0, 135, 0x00 },
+                { 0x0000000000000000ull, 0, 156, 0x00 },
+                { 0x0000800000000000ull, 304, 909, 0xC0 },
+                { 0x0000800000000000ull, 305, 910, 0xC0 },
+                { 0x0000800000000000ull, 306, 1094, 0xC0 },
+                { 0x0000800000000000ull, 307, 1073, 0xC0 },
+                { 0x0000000000000000ull, 0, 1031, 0x00 },
+                { 0x0000000000000000ull, 0, 1028, 0x00 },
+                { 0x0000000000000000ull, 0, 726, 0x00 },
+                { 0x0000800000000000ull, 308, 1100, 0xC0 },
+                { 0x0000800000000000ull, 309, 1101, 0xC0 },
+                { 0x0000800000000000ull, 310, 715, 0xC0 },
+                { 0x0000800000000000ull, 311, 1102, 0xC0 },
+                { 0x0000000000000000ull, 0, 1095, 0x00 },
+                { 0x0000000000000000ull, 0, 1096, 0x00 },
+                { 0x0000000000000000ull, 0, 1079, 0x00 },
+                { 0x0000000000000000ull, 0, 1080, 0x00 },
+                { 0x0000000000000000ull, 0, 1081, 0x00 },
+                { 0x0000000000000000ull, 0, 1082, 0x00 },
+                { 0x0000000000000000ull, 0, 108, 0x00 },
+                { 0x0000800000000000ull, 312, 110, 0xC0 },
+                { 0x0000000000000000ull, 0, 1074, 0x00 },
+                { 0x0000000000000000ull, 0, 1075, 0x00 },
+                { 0x0000000000000000ull, 0, 1076, 0x00 },
+                { 0x0000800000000000ull, 313, 1006, 0xC0 },
+                { 0x0000000000000000ull, 0, 1097, 0x00 },
+                { 0x0000000000000000ull, 0, 1098, 0x00 },
+                { 0x0000800000000000ull, 314, 1016, 0xC0 },
+                { 0x0000800000000000ull, 315, 1017, 0xC0 },
+                { 0x0000800000000000ull, 316, 1010, 0xC0 },
+                { 0x0000800000000000ull, 317, 1004, 0xC0 },
+                { 0x0000800000000000ull, 318, 1008, 0xC0 },
+                { 0x0000000000000000ull, 0, 1162, 0x00 },
+                { 0x0000000000000000ull, 0, 1163, 0x00 },
+                { 0x0000000000000000ull, 0, 692, 0x00 },
+                { 0x0000000000000000ull, 0, 1091, 0x00 },
+                { 0x0000800000000000ull, 319, 1083, 0xC0 },
+                { 0x0000800000000000ull, 320, 1099, 0xC0 },
+                { 0x0000800000000000ull, 321, 1154, 0xC0 },
+                { 0x0000800000000000ull, 322, 1155, 0xC0 },
+                { 0x0000000000000010ull, 323, 0, 0x80 },
+                { 0x0000000000008000ull, 324, 0, 0x80 },
+                { 0xC003000000000000ull, 325, 0, 0x80 },
+                { 0x0000000007FE4000ull, 329, 0, 0x80 },
+                { 0xFFFFFFC000000000ull, 340, 0, 0x80 },
+                { 0x07FC800004000006ull, 366, 0, 0x80 },
+                { 0x0000000000030000ull, 379, 0, 0x80 },
+                { 0xFFFFFFF3FFFFFFFFull, 381, 0, 0x80 },
+                { 0xFFFFFFFFFFFFFFFFull, 443, 0, 0x80 },
+                { 0xFFFFFFFFCECFFFFFull, 507, 0, 0x80 },
+                { 0x07B9FFFFFFFFFFFFull, 566, 0, 0x80 },
+                { 0xFFFFFFFFFFFFFFFFull, 622, 0, 0x80 },
+                { 0xFFFFFFFFFFFFFFFFull, 686, 0, 0x80 },
+                { 0xFFFFFFFFFFFFFFFFull, 750, 0, 0x80 },
+                { 0xBFFFFFFFFFFFFFFFull, 814, 0, 0x80 },
+                { 0x3FFFFFFFFFFFFFFFull, 877, 0, 0x80 },
+                { 0x07F980FFFFFF7E00ull, 939, 0, 0x80 },
+                { 0x1006013000613C80ull, 979, 0, 0x80 },
+                { 0xFC08810A700E001Cull, 993, 0, 0x80 },
+                { 0xFFFFFFFFFFFFFFFFull, 1013, 0, 0x80 },
+                { 0x000000000000FFFFull, 1077, 0, 0x80 },
+                { 0xFFFFFFFFFFFFFFFFull, 1093, 0, 0x80 },
+                { 0x00791A3F0007F83Full, 1157, 0, 0x80 },
+                { 0x77F900FF7FFF0000ull, 1185, 0, 0x80 },
+                { 0x000000007FFF0FBFull, 1220, 0, 0x80 },
+                { 0x000000000003FFFFull, 1246, 0, 0x80 },
+                { 0x0000000000000001ull, 1264, 0, 0x80 },
+                { 0x0000000400000000ull, 1265, 0, 0xC0 },
+                { 0x0000000000000000ull, 0, 1107, 0x00 },
+                { 0x0000000400000000ull, 1266, 0, 0xC0 },
+                { 0x0000000400000000ull, 1267, 0, 0xC0 },
+                { 0x0000000400000000ull, 1268, 0, 0xC0 },
+                { 0x0000000400000000ull, 1269, 0, 0xC0 },
+                { 0x0000000400000000ull, 1270, 0, 0xC0 },
+                { 0x0000000400000000ull, 1271, 0, 0xC0 },
+                { 0x0000000400000000ull, 1272, 0, 0xC0 },
+                { 0x0000000400000000ull, 1273, 0, 0xC0 },
+                { 0x0000000400000000ull, 1274, 0, 0xC0 },
+                { 0x0000000400000000ull, 1275, 0, 0xC0 },
+                { 0x0000000000008000ull, 1276, 0, 0x80 },
+                { 0x0000000000008000ull, 1277, 0, 0x80 },
+                { 0x0100000000000000ull, 1278, 0, 0x80 },
+                { 0x0100000000000000ull, 1279, 0, 0x80 },
+                { 0x0100000000000000ull, 1280, 0, 0x80 },
+                { 0x0100000000000000ull, 1281, 0, 0x80 },
+                { 0x0100000000000000ull, 1282, 0, 0x80 },
+                { 0x0100000000000000ull, 1283, 0, 0x80 },
+                { 0x0100000000000000ull, 1284, 0, 0x80 },
+                { 0x0100000000000000ull, 1285, 0, 0x80 },
+                { 0x0100000000000000ull, 1286, 0, 0x80 },
+                { 0x0100000000000000ull, 1287, 0, 0x80 },
+                { 0x0100000000000000ull, 1288, 0, 0x80 },
+                { 0x0100000000000000ull, 1289, 0, 0x80 },
+                { 0x0100000000000000ull, 1290, 0, 0x80 },
+                { 0x0100000000000000ull, 1291, 0, 0x80 },
+                { 0x0100000000000000ull, 1292, 0, 0x80 },
+                { 0x0100000000000000ull, 1293, 0, 0x80 },
+                { 0x0100000000000000ull, 1294, 0, 0x80 },
+                { 0x0100000000000000ull, 1295, 0, 0x80 },
+                { 0x0100000000000000ull, 1296, 0, 0x80 },
+                { 0x0100000000000000ull, 1297, 0, 0x80 },
+                { 0x0100000000000000ull, 1298, 0, 0x80 },
+                { 0x0100000000000000ull, 1299, 0, 0x80 },
+                { 0x0100000000000000ull, 1300, 0, 0x80 },
+                { 0x0100000000000000ull, 1301, 0, 0x80 },
+                { 0x0100000000000000ull, 1302, 0, 0x80 },
+                { 0x0100000000000000ull, 1303, 0, 0x80 },
+                { 0x0100000000000000ull, 1304, 0, 0x80 },
+                { 0x0100000000000000ull, 1305, 0, 0x80 },
+                { 0x0100000000000000ull, 1306, 0, 0x80 },
+                { 0x0100000000000000ull, 1307, 0, 0x80 },
+                { 0x0100000000000000ull, 1308, 0, 0x80 },
+                { 0x0100000000000000ull, 1309, 0, 0x80 },
+                { 0x0100000000000000ull, 1310, 0, 0x80 },
+                { 0x0100000000000000ull, 1311, 0, 0x80 },
+                { 0x0100000000000000ull, 1312, 0, 0x80 },
+                { 0x0100000000000000ull, 1313, 0, 0x80 },
+                { 0x0100000000000000ull, 1314, 0, 0x80 },
+                { 0x0100000000000000ull, 1315, 0, 0x80 },
+                { 0x0100000000000000ull, 1316, 0, 0x80 },
+                { 0x0100000000000000ull, 1317, 0, 0x80 },
+                { 0x0100000000000000ull, 1318, 0, 0x80 },
+                { 0x0100000000000000ull, 1319, 0, 0x80 },
+                { 0x0100000000000000ull, 1320, 0, 0x80 },
+                { 0x0100000000000000ull, 1321, 0, 0x80 },
+                { 0x0100000000000000ull, 1322, 0, 0x80 },
+                { 0x0100000000000000ull, 1323, 0, 0x80 },
+                { 0x0100000000000000ull, 1324, 0, 0x80 },
+                { 0x0100000000000000ull, 1325, 0, 0x80 },
+                { 0x0100000000000000ull, 1326, 0, 0x80 },
+                { 0x0100000000000000ull, 1327, 0, 0x80 },
+                { 0x0100000000000000ull, 1328, 0, 0x80 },
+                { 0x0100000000000000ull, 1329, 0, 0x80 },
+                { 0x0100000000000000ull, 1330, 0, 0x80 },
+                { 0x0100000000000000ull, 1331, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 781, 0x00 },
+                { 0x0000000000000000ull, 0, 780, 0x00 },
+                { 0x0000800000000000ull, 1332, 1124, 0xC0 },
+                { 0x0000800000000000ull, 1333, 1126, 0xC0 },
+                { 0x0000800000000000ull, 1334, 1135, 0xC0 },
+                { 0x0000800000000000ull, 1335, 1137, 0xC0 },
+                { 0x0000000000000000ull, 0, 1125, 0x00 },
+                { 0x0000000000000000ull, 0, 1127, 0x00 },
+                { 0x0000000000000000ull, 0, 1128, 0x00 },
+                { 0x0000000000000000ull, 0, 1129, 0x00 },
+                { 0x0000000000000000ull, 0, 1131, 0x00 },
+                { 0x0000000000000000ull, 0, 1133, 0x00 },
+                { 0x0000000000000000ull, 0, 1134, 0x00 },
+                { 0x0000000000000000ull, 0, 1136, 0x00 },
+                { 0x0000000000000000ull, 0, 1138, 0x00 },
+                { 0x0000000000000000ull, 0, 1139, 0x00 },
+                { 0x0000000000000000ull, 0, 1140, 0x00 },
+                { 0x0001000000000000ull, 1336, 0, 0xC0 },
+                { 0x0001000000000000ull, 1337, 0, 0xC0 },
+                { 0x0001000000000000ull, 1338, 0, 0xC0 },
+                { 0x0001000000000000ull, 1339, 0, 0xC0 },
+                { 0x0001000000000000ull, 1340, 0, 0xC0 },
+                { 0x0001000000000000ull, 1341, 0, 0xC0 },
+                { 0x0001000000000000ull, 1342, 0, 0xC0 },
+                { 0x0001000000000000ull, 1343, 0, 0xC0 },
+                { 0x0001000000000000ull, 1344, 0, 0xC0 },
+                { 0x0001000000000000ull, 1345, 0, 0xC0 },
+                { 0x0001000000000000ull, 1346, 0, 0xC0 },
+                { 0x0001000000000000ull, 1347, 0, 0xC0 },
+                { 0x0001000000000000ull, 1348, 0, 0xC0 },
+                { 0x0001000000000000ull, 1349, 0, 0xC0 },
+                { 0x0001000000000000ull, 1350, 0, 0xC0 },
+                { 0x0001000000000000ull, 1351, 0, 0xC0 },
+                { 0x0001000000000000ull, 1352, 0, 0xC0 },
+                { 0x0001000000000000ull, 1353, 0, 0xC0 },
+                { 0x0001000000000000ull, 1354, 0, 0xC0 },
+                { 0x0001000000000000ull, 1355, 0, 0xC0 },
+                { 0x0001000000000000ull, 1356, 0, 0xC0 },
+                { 0x0001000000000000ull, 1357, 0, 0xC0 },
+                { 0x0001000000000000ull, 1358, 0, 0xC0 },
+                { 0x0001000000000000ull, 1359, 0, 0xC0 },
+                { 0x0001000000000000ull, 1360, 0, 0xC0 },
+                { 0x0001000000000000ull, 1361, 0, 0xC0 },
+                { 0x0000000000000000ull, 0, 1141, 0x00 },
+                { 0x0000800000000000ull, 1362, 1142, 0xC0 },
+                { 0x0000000000000000ull, 0, 1148, 0x00 },
+                { 0x0000000000000000ull, 0, 1145, 0x00 },
+                { 0x0000000000000000ull, 0, 1149, 0x00 },
+                { 0x0000000000000000ull, 0, 1153, 0x00 },
+                { 0x0000000000000000ull, 0, 1152, 0x00 },
+                { 0x0000000000000000ull, 0, 1157, 0x00 },
+                { 0x0000000000000000ull, 0, 1144, 0x00 },
+                { 0x0000800000000000ull, 1363, 1143, 0xC0 },
+                { 0x0000000000000000ull, 0, 1151, 0x00 },
+                { 0x0000000000000000ull, 0, 1147, 0x00 },
+                { 0x0000000000000000ull, 0, 1156, 0x00 },
+                { 0x0000000000000000ull, 0, 1146, 0x00 },
+                { 0x0000000000000000ull, 0, 1150, 0x00 },
+                { 0x0000000000000000ull, 0, 708, 0x00 },
+                { 0x0000000000000000ull, 0, 568, 0x00 },
+                { 0x0000000000000000ull, 0, 710, 0x00 },
+                { 0x0000000000000000ull, 0, 569, 0x00 },
+                { 0x0000000000000000ull, 0, 571, 0x00 },
+                { 0x0000000000000000ull, 0, 572, 0x00 },
+                { 0x0000000000000000ull, 0, 573, 0x00 },
+                { 0x0000000000000000ull, 0, 574, 0x00 },
+                { 0x0000000000000000ull, 0, 709, 0x00 },
+                { 0x0000000000000000ull, 0, 575, 0x00 },
+                { 0x0000000000000000ull, 0, 721, 0x00 },
+                { 0x0000000000000000ull, 0, 531, 0x00 },
+                { 0x0000000000000000ull, 0, 695, 0x00 },
+                { 0x0000000000000000ull, 0, 523, 0x00 },
+                { 0x0000000000000000ull, 0, 524, 0x00 },
+                { 0x0000000000000000ull, 0, 525, 0x00 },
+                { 0x0000000000000000ull, 0, 526, 0x00 },
+                { 0x0000000000000000ull, 0, 676, 0x00 },
+                { 0x0000000000000000ull, 0, 677, 0x00 },
+                { 0x0000000000000000ull, 0, 678, 0x00 },
+                { 0x0000000000000000ull, 0, 679, 0x00 },
+                { 0x0000000000000000ull, 0, 680, 0x00 },
+                { 0x0000000000000000ull, 0, 681, 0x00 },
+                { 0x0000000000000000ull, 0, 682, 0x00 },
+                { 0x0000000000000000ull, 0, 683, 0x00 },
+                { 0x0000000000000000ull, 0, 684, 0x00 },
+                { 0x0000000000000000ull, 0, 685, 0x00 },
+                { 0x0000000000000000ull, 0, 686, 0x00 },
+                { 0x0000000000000000ull, 0, 687, 0x00 },
+                { 0x0000000000000000ull, 0, 690, 0x00 },
+                { 0x0000000000000000ull, 0, 691, 0x00 },
+                { 0x0000000000000000ull, 0, 693, 0x00 },
+                { 0x0000000000000000ull, 0, 694, 0x00 },
+                { 0x0000000000000000ull, 0, 688, 0x00 },
+                { 0x0000000000000000ull, 0, 699, 0x00 },
+                { 0x0000000000000000ull, 0, 700, 0x00 },
+                { 0x0000000000000000ull, 0, 701, 0x00 },
+                { 0x0000000000000000ull, 0, 702, 0x00 },
+                { 0x0000000000000000ull, 0, 703, 0x00 },
+                { 0x0000000000000000ull, 0, 704, 0x00 },
+                { 0x0000000000000000ull, 0, 705, 0x00 },
+                { 0x0000000000000000ull, 0, 706, 0x00 },
+                { 0x0000000000000000ull, 0, 707, 0x00 },
+                { 0x0000000000000000ull, 0, 467, 0x00 },
+                { 0x0000000000000000ull, 0, 468, 0x00 },
+                { 0x0000000000000000ull, 0, 469, 0x00 },
+                { 0x0000000000000000ull, 0, 455, 0x00 },
+                { 0x0000000000000000ull, 0, 419, 0x00 },
+                { 0x0000000000000000ull, 0, 420, 0x00 },
+                { 0x0000000000000000ull, 0, 421, 0x00 },
+                { 0x0000000000000000ull, 0, 422, 0x00 },
+                { 0x0000000000000000ull, 0, 423, 0x00 },
+                { 0x0000000000000000ull, 0, 452, 0x00 },
+                { 0x0000000000000000ull, 0, 418, 0x00 },
+                { 0x0000000000000000ull, 0, 410, 0x00 },
+                { 0x0000000000000000ull, 0, 413, 0x00 },
+                { 0x0000000000000000ull, 0, 415, 0x00 },
+                { 0x0000000000000000ull, 0, 416, 0x00 },
+                { 0x0000000000000000ull, 0, 417, 0x00 },
+                { 0x0000000000000000ull, 0, 451, 0x00 },
+                { 0x0000000000000000ull, 0, 424, 0x00 },
+                { 0x0000000000000000ull, 0, 425, 0x00 },
+                { 0x0000000000000000ull, 0, 427, 0x00 },
+                { 0x0000000000000000ull, 0, 428, 0x00 },
+                { 0x0000000000000000ull, 0, 429, 0x00 },
+                { 0x0000000000000000ull, 0, 430, 0x00 },
+                { 0x0000000000000000ull, 0, 431, 0x00 },
+                { 0x0000000000000000ull, 0, 446, 0x00 },
+                { 0x0000000000000000ull, 0, 448, 0x00 },
+                { 0x0000000000000000ull, 0, 432, 0x00 },
+                { 0x0000000000000000ull, 0, 433, 0x00 },
+                { 0x0000000000000000ull, 0, 434, 0x00 },
+                { 0x0000000000000000ull, 0, 435, 0x00 },
+                { 0x0000000000000000ull, 0, 436, 0x00 },
+                { 0x0000000000000000ull, 0, 437, 0x00 },
+                { 0x0000000000000000ull, 0, 438, 0x00 },
+                { 0x0000000000000000ull, 0, 439, 0x00 },
+                { 0x0000000000000000ull, 0, 440, 0x00 },
+                { 0x0000000000000000ull, 0, 441, 0x00 },
+                { 0x0000000000000000ull, 0, 442, 0x00 },
+                { 0x0000000000000000ull, 0, 443, 0x00 },
+                { 0x0000000000000000ull, 0, 444, 0x00 },
+                { 0x0000000000000000ull, 0, 464, 0x00 },
+                { 0x0000000000000000ull, 0, 466, 0x00 },
+                { 0x0000000000000000ull, 0, 461, 0x00 },
+                { 0x0000000000000000ull, 0, 462, 0x00 },
+                { 0x0000000000000000ull, 0, 478, 0x00 },
+                { 0x0000000000000000ull, 0, 479, 0x00 },
+                { 0x0000000000000000ull, 0, 480, 0x00 },
+                { 0x0000000000000000ull, 0, 481, 0x00 },
+                { 0x0000000000000000ull, 0, 482, 0x00 },
+                { 0x0000000000000000ull, 0, 483, 0x00 },
+                { 0x0000000000000000ull, 0, 456, 0x00 },
+                { 0x0000000000000000ull, 0, 465, 0x00 },
+                { 0x0000000000000000ull, 0, 484, 0x00 },
+                { 0x0000000000000000ull, 0, 489, 0x00 },
+                { 0x0000000000000000ull, 0, 485, 0x00 },
+                { 0x0000000000000000ull, 0, 486, 0x00 },
+                { 0x0000000000000000ull, 0, 487, 0x00 },
+                { 0x0000000000000000ull, 0, 488, 0x00 },
+                { 0x0000000000000000ull, 0, 493, 0x00 },
+                { 0x0000000000000000ull, 0, 494, 0x00 },
+                { 0x0000000000000000ull, 0, 495, 0x00 },
+                { 0x0000000000000000ull, 0, 496, 0x00 },
+                { 0x0000000000000000ull, 0, 497, 0x00 },
+                { 0x0000000000000000ull, 0, 500, 0x00 },
+                { 0x0000000000000000ull, 0, 501, 0x00 },
+                { 0x0000000000000000ull, 0, 502, 0x00 },
+                { 0x0000000000000000ull, 0, 503, 0x00 },
+                { 0x0000000000000000ull, 0, 504, 0x00 },
+                { 0x0000000000000000ull, 0, 499, 0x00 },
+                { 0x0000000000000000ull, 0, 477, 0x00 },
+                { 0x0000000000000000ull, 0, 474, 0x00 },
+                { 0x0000000000000000ull, 0, 472, 0x00 },
+                { 0x0000000000000000ull, 0, 519, 0x00 },
+                { 0x0000000000000000ull, 0, 508, 0x00 },
+                { 0x0000000000000000ull, 0, 509, 0x00 },
+                { 0x0000000000000000ull, 0, 511, 0x00 },
+                { 0x0000000000000000ull, 0, 512, 0x00 },
+                { 0x0000000000000000ull, 0, 513, 0x00 },
+                { 0x0000000000000000ull, 0, 514, 0x00 },
+                { 0x0000000000000000ull, 0, 515, 0x00 },
+                { 0x0000000000000000ull, 0, 505, 0x00 },
+                { 0x0000000000000000ull, 0, 518, 0x00 },
+                { 0x0000000000000000ull, 0, 510, 0x00 },
+                { 0x0000000000000000ull, 0, 476, 0x00 },
+                { 0x0000000000000000ull, 0, 736, 0x00 },
+                { 0x0000000000000000ull, 0, 737, 0x00 },
+                { 0x0000000000000000ull, 0, 498, 0x00 },
+                { 0x0000000000000000ull, 0, 722, 0x00 },
+                { 0x0000000000000000ull, 0, 723, 0x00 },
+                { 0x0000000000000000ull, 0, 242, 0x00 },
+                { 0x0000000000000000ull, 0, 724, 0x00 },
+                { 0x0000000000000000ull, 0, 725, 0x00 },
+                { 0x0000000000000000ull, 0, 727, 0x00 },
+                { 0x0000000000000000ull, 0, 728, 0x00 },
+                { 0x0000000000000000ull, 0, 729, 0x00 },
+                { 0x0000000000000000ull, 0, 730, 0x00 },
+                { 0x0000000000000000ull, 0, 1182, 0x00 },
+                { 0x0000000000000000ull, 0, 731, 0x00 },
+                { 0x0000000000000000ull, 0, 732, 0x00 },
+                { 0x0000000000000000ull, 0, 733, 0x00 },
+                { 0x0000000000000000ull, 0, 734, 0x00 },
+                { 0x0000000000000000ull, 0, 735, 0x00 },
+                { 0x0000000000000000ull, 0, 799, 0x00 },
+                { 0x0000000000000000ull, 0, 808, 0x00 },
+                { 0x0000000000000000ull, 0, 741, 0x00 },
+                { 0x0000000000000000ull, 0, 738, 0x00 },
+                { 0x0000000000000000ull, 0, 826, 0x00 },
+                { 0x0000000000000000ull, 0, 827, 0x00 },
+                { 0x0000000000000000ull, 0, 828, 0x00 },
+                { 0x0000000000000000ull, 0, 857, 0x00 },
+                { 0x0000000000000000ull, 0, 739, 0x00 },
+                { 0x0000000000000000ull, 0, 577, 0x00 },
+                { 0x0000000000000000ull, 0, 578, 0x00 },
+                { 0x0000000000000000ull, 0, 579, 0x00 },
+                { 0x0000000000000000ull, 0, 765, 0x00 },
+                { 0x0000000000000000ull, 0, 829, 0x00 },
+                { 0x0000000000000000ull, 0, 856, 0x00 },
+                { 0x0000000000000000ull, 0, 1067, 0x00 },
+                { 0x0000000000000000ull, 0, 830, 0x00 },
+                { 0x0000000000000000ull, 0, 785, 0x00 },
+                { 0x0000000000000000ull, 0, 807, 0x00 },
+                { 0x0000000000000000ull, 0, 581, 0x00 },
+                { 0x0000000000000000ull, 0, 740, 0x00 },
+                { 0x0000000000000000ull, 0, 859, 0x00 },
+                { 0x0000000000000000ull, 0, 783, 0x00 },
+                { 0x0000000000000000ull, 0, 772, 0x00 },
+                { 0x0000000000000000ull, 0, 768, 0x00 },
+                { 0x0000000000000000ull, 0, 774, 0x00 },
+                { 0x0000000000000000ull, 0, 770, 0x00 },
+                { 0x0000000000000000ull, 0, 775, 0x00 },
+                { 0x0000000000000000ull, 0, 754, 0x00 },
+                { 0x0000000000000000ull, 0, 782, 0x00 },
+                { 0x0000000000000000ull, 0, 824, 0x00 },
+                { 0x0000000000000000ull, 0, 825, 0x00 },
+                { 0x0000000000000000ull, 0, 832, 0x00 },
+                { 0x0000000000000000ull, 0, 833, 0x00 },
+                { 0x0000000000000000ull, 0, 834, 0x00 },
+                { 0x0000000000000000ull, 0, 835, 0x00 },
+                { 0x0000000000000000ull, 0, 836, 0x00 },
+                { 0x0000000000000000ull, 0, 823, 0x00 },
+                { 0x0000000000000000ull, 0, 766, 0x00 },
+                { 0x0000000000000000ull, 0, 753, 0x00 },
+                { 0x0000000000000000ull, 0, 767, 0x00 },
+                { 0x0000000000000000ull, 0, 749, 0x00 },
+                { 0x0000000000000000ull, 0, 1180, 0x00 },
+                { 0x0000000000000000ull, 0, 260, 0x00 },
+                { 0x0000000400000000ull, 1364, 250, 0xC0 },
+                { 0x0000000400000000ull, 1365, 263, 0xC0 },
+                { 0x0000000000000000ull, 0, 743, 0x00 },
+                { 0x0000000000000000ull, 0, 742, 0x00 },
+                { 0x0000000000000000ull, 0, 258, 0x00 },
+                { 0x0000000000000000ull, 0, 751, 0x00 },
+                { 0x0000000000000000ull, 0, 752, 0x00 },
+                { 0x0000000400000000ull, 1366, 267, 0xC0 },
+                { 0x0000800000000000ull, 1367, 271, 0xC0 },
+                { 0x0000800000000000ull, 1368, 261, 0xC0 },
+                { 0x0000000000000000ull, 0, 611, 0x00 },
+                { 0x0000000000000000ull, 0, 610, 0x00 },
+                { 0x0000000000000000ull, 0, 755, 0x00 },
+                { 0x0000000000000000ull, 0, 750, 0x00 },
+                { 0x0000000000000000ull, 0, 756, 0x00 },
+                { 0x0000000000000000ull, 0, 757, 0x00 },
+                { 0x0000000000000000ull, 0, 758, 0x00 },
+                { 0x0000000000000000ull, 0, 529, 0x00 },
+                { 0x0000000000000000ull, 0, 533, 0x00 },
+                { 0x0000000000000000ull, 0, 534, 0x00 },
+                { 0x0000000000000000ull, 0, 540, 0x00 },
+                { 0x0000000000000000ull, 0, 541, 0x00 },
+                { 0x0000000000000000ull, 0, 570, 0x00 },
+                { 0x0000000000000000ull, 0, 542, 0x00 },
+                { 0x0000000000000000ull, 0, 539, 0x00 },
+                { 0x0000000000000000ull, 0, 535, 0x00 },
+                { 0x0000000000000000ull, 0, 536, 0x00 },
+                { 0x0000000000000000ull, 0, 537, 0x00 },
+                { 0x0000000000000000ull, 0, 538, 0x00 },
+                { 0x0000000000000000ull, 0, 543, 0x00 },
+                { 0x0000000000000000ull, 0, 544, 0x00 },
+                { 0x0000000000000000ull, 0, 545, 0x00 },
+                { 0x0000000000000000ull, 0, 546, 0x00 },
+                { 0x0000000000000000ull, 0, 547, 0x00 },
+                { 0x0000000000000000ull, 0, 548, 0x00 },
+                { 0x0000000000000000ull, 0, 549, 0x00 },
+                { 0x0000000000000000ull, 0, 978, 0x00 },
+                { 0x0000000000000000ull, 0, 550, 0x00 },
+                { 0x0000000000000000ull, 0, 551, 0x00 },
+                { 0x0000000000000000ull, 0, 552, 0x00 },
+                { 0x0000000000000000ull, 0, 553, 0x00 },
+                { 0x0000000000000000ull, 0, 554, 0x00 },
+                { 0x0000000000000000ull, 0, 555, 0x00 },
+                { 0x0000000000000000ull, 0, 870, 0x00 },
+                { 0x0000000000000000ull, 0, 556, 0x00 },
+                { 0x0000000000000000ull, 0, 557, 0x00 },
+                { 0x0000800000000000ull, 1369, 1184, 0xC0 },
+                { 0x0000000000000000ull, 0, 1183, 0x00 },
+                { 0x0000000000000000ull, 0, 412, 0x00 },
+                { 0x0000000000000000ull, 0, 887, 0x00 },
+                { 0x0000000000000000ull, 0, 759, 0x00 },
+                { 0x0000000000000000ull, 0, 952, 0x00 },
+                { 0x0000000000000000ull, 0, 522, 0x00 },
+                { 0x0000000000000000ull, 0, 362, 0x00 },
+                { 0x0000000000000000ull, 0, 361, 0x00 },
+                { 0x0000000000000000ull, 0, 346, 0x00 },
+                { 0x0000000000000000ull, 0, 347, 0x00 },
+                { 0x0000000000000000ull, 0, 348, 0x00 },
+                { 0x0000000000000000ull, 0, 339, 0x00 },
+                { 0x0000000000000000ull, 0, 340, 0x00 },
+                { 0x0000000000000000ull, 0, 365, 0x00 },
+                { 0x0000000000000000ull, 0, 336, 0x00 },
+                { 0x0000000000000000ull, 0, 390, 0x00 },
+                { 0x0000000000000000ull, 0, 385, 0x00 },
+                { 0x0000000000000000ull, 0, 392, 0x00 },
+                { 0x0000000000000000ull, 0, 400, 0x00 },
+                { 0x0000000000000000ull, 0, 388, 0x00 },
+                { 0x0000000000000000ull, 0, 342, 0x00 },
+                { 0x0000000000000000ull, 0, 353, 0x00 },
+                { 0x0000000000000000ull, 0, 355, 0x00 },
+                { 0x0000000000000000ull, 0, 354, 0x00 },
+                { 0x0000000000000000ull, 0, 328, 0x00 },
+                { 0x0000000000000000ull, 0, 374, 0x00 },
+                { 0x0000000000000000ull, 0, 373, 0x00 },
+                { 0x0000000000000000ull, 0, 331, 0x00 },
+                { 0x0000000000000000ull, 0, 350, 0x00 },
+                { 0x0000000000000000ull, 0, 351, 0x00 },
+                { 0x0000000000000000ull, 0, 358, 0x00 },
+                { 0x0000000000000000ull, 0, 398, 0x00 },
+                { 0x0000000000000000ull, 0, 399, 0x00 },
+                { 0x0000000000000000ull, 0, 402, 0x00 },
+                { 0x0000000000000000ull, 0, 403, 0x00 },
+                { 0x0000000000000000ull, 0, 404, 0x00 },
+                { 0x0000000000000000ull, 0, 405, 0x00 },
+                { 0x0000000000000000ull, 0, 394, 0x00 },
+                { 0x0000000000000000ull, 0, 395, 0x00 },
+                { 0x0000000000000000ull, 0, 396, 0x00 },
+                { 0x0000000000000000ull, 0, 386, 0x00 },
+                { 0x0000000000000000ull, 0, 375, 0x00 },
+                { 0x0000000000000000ull, 0, 376, 0x00 },
+                { 0x0000000000000000ull, 0, 377, 0x00 },
+                { 0x0000000000000000ull, 0, 378, 0x00 },
+                { 0x0000000000000000ull, 0, 379, 0x00 },
+                { 0x0000000000000000ull, 0, 369, 0x00 },
+                { 0x0000000000000000ull, 0, 332, 0x00 },
+                { 0x0000000000000000ull, 0, 356, 0x00 },
+                { 0x0000000000000000ull, 0, 357, 0x00 },
+                { 0x0000000000000000ull, 0, 393, 0x00 },
+                { 0x0000000000000000ull, 0, 360, 0x00 },
+                { 0x0000000000000000ull, 0, 345, 0x00 },
+                { 0x0000000000000000ull, 0, 338, 0x00 },
+                { 0x0000000000000000ull, 0, 364, 0x00 },
+                { 0x0000000000000000ull, 0, 335, 0x00 },
+                { 0x0000000000000000ull, 0, 389, 0x00 },
+                { 0x0000000000000000ull, 0, 391, 0x00 },
+                { 0x0000000000000000ull, 0, 341, 0x00 },
+                { 0x0000000000000000ull, 0, 327, 0x00 },
+                { 0x0000000000000000ull, 0, 330, 0x00 },
+                { 0x0000000000000000ull, 0, 349, 0x00 },
+                { 0x0000000000000000ull, 0, 384, 0x00 },
+                { 0x0000000000000000ull, 0, 363, 0x00 },
+                { 0x0000000000000000ull, 0, 333, 0x00 },
+                { 0x0000000000000000ull, 0, 368, 0x00 },
+                { 0x0000000000000000ull, 0, 370, 0x00 },
+                { 0x0000000000000000ull, 0, 352, 0x00 },
+                { 0x0000000000000000ull, 0, 371, 0x00 },
+                { 0x0000000000000000ull, 0, 366, 0x00 },
+                { 0x0000000000000000ull, 0, 162, 0x00 },
+                { 0x0000000000000000ull, 0, 163, 0x00 },
+                { 0x0000000000000000ull, 0, 160, 0x00 },
+                { 0x0000000000000000ull, 0, 161, 0x00 },
+                { 0x0000000000000000ull, 0, 165, 0x00 },
+                { 0x0000000000000000ull, 0, 164, 0x00 },
+                { 0x0000000000000000ull, 0, 141, 0x00 },
+                { 0x0000000000000000ull, 0, 143, 0x00 },
+                { 0x0000000000000000ull, 0, 139, 0x00 },
+                { 0x0000000000000000ull, 0, 140, 0x00 },
+                { 0x0000000000000000ull, 0, 148, 0x00 },
+                { 0x0000000000000000ull, 0, 129, 0x00 },
+                { 0x0000000000000000ull, 0, 134, 0x00 },
+                { 0x0000000000000000ull, 0, 145, 0x00 },
+                { 0x0000000000000000ull, 0, 146, 0x00 },
+                { 0x0000000000000000ull, 0, 151, 0x00 },
+                { 0x0000000000000000ull, 0, 153, 0x00 },
+                { 0x0000000000000000ull, 0, 805, 0x00 },
+                { 0x0000000000000000ull, 0, 806, 0x00 },
+                { 0x0000000000000000ull, 0, 786, 0x00 },
+                { 0x0000000000000000ull, 0, 788, 0x00 },
+                { 0x0000000000000000ull, 0, 789, 0x00 },
+                { 0x0000000000000000ull, 0, 790, 0x00 },
+                { 0x0000000000000000ull, 0, 791, 0x00 },
+                { 0x0000000000000000ull, 0, 792, 0x00 },
+                { 0x0000000000000000ull, 0, 793, 0x00 },
+                { 0x0000000000000000ull, 0, 794, 0x00 },
+                { 0x0000000000000000ull, 0, 795, 0x00 },
+                { 0x0000000000000000ull, 0, 796, 0x00 },
+                { 0x0000000000000000ull, 0, 797, 0x00 },
+                { 0x0000000000000000ull, 0, 800, 0x00 },
+                { 0x0000000000000000ull, 0, 801, 0x00 },
+                { 0x0000000000000000ull, 0, 802, 0x00 },
+                { 0x0000000000000000ull, 0, 803, 0x00 },
+                { 0x0000000000000000ull, 0, 804, 0x00 },
+                { 0x0000000000000000ull, 0, 326, 0x00 },
+                { 0x0000000000000000ull, 0, 323, 0x00 },
+                { 0x0000000000000000ull, 0, 324, 0x00 },
+                { 0x0000000000000000ull, 0, 167, 0x00 },
+                { 0x0000000000000000ull, 0, 168, 0x00 },
+                { 0x0000000400000000ull, 1370, 170, 0xC0 },
+                { 0x0000000400000000ull, 1371, 171, 0xC0 },
+                { 0x0000000000000000ull, 0, 325, 0x00 },
+                { 0x0000000000000000ull, 0, 290, 0x00 },
+                { 0x0000000000000000ull, 0, 291, 0x00 },
+                { 0x0000000000000000ull, 0, 289, 0x00 },
+                { 0x0000000400000000ull, 1372, 225, 0xC0 },
+                { 0x0000000400000000ull, 1373, 255, 0xC0 },
+                { 0x0000000000000000ull, 0, 239, 0x00 },
+                { 0x0000000400000000ull, 1374, 169, 0xC0 },
+                { 0x0000000000000000ull, 0, 237, 0x00 },
+                { 0x0000000400000000ull, 1375, 235, 0xC0 },
+                { 0x0000000000000000ull, 0, 173, 0x00 },
+                { 0x0000000000000000ull, 0, 174, 0x00 },
+                { 0x0000000000000000ull, 0, 166, 0x00 },
+                { 0x0000000400000000ull, 1376, 231, 0xC0 },
+                { 0x0000000000000000ull, 0, 234, 0x00 },
+                { 0x0000000000000000ull, 0, 81, 0x00 },
+                { 0x0000000000000000ull, 0, 82, 0x00 },
+                { 0x0000000000000000ull, 0, 83, 0x00 },
+                { 0x0000000000000000ull, 0, 241, 0x00 },
+                { 0x0000000000000000ull, 0, 84, 0x00 },
+                { 0x0000000000000000ull, 0, 85, 0x00 },
+                { 0x0000000000000000ull, 0, 76, 0x00 },
+                { 0x0000000000000000ull, 0, 77, 0x00 },
+                { 0x0000000400000000ull, 1377, 183, 0xC0 },
+                { 0x0000000400000000ull, 1378, 229, 0xC0 },
+                { 0x0000000000000000ull, 0, 252, 0x00 },
+                { 0x0000000000000000ull, 0, 811, 0x00 },
+                { 0x0000000000000000ull, 0, 157, 0x00 },
+                { 0x0000000400000000ull, 1379, 244, 0xC0 },
+                { 0x0000000400000000ull, 1380, 246, 0xC0 },
+                { 0x0000000000000000ull, 0, 580, 0x00 },
+                { 0x0000000000000000ull, 0, 965, 0x00 },
+                { 0x0000000000000000ull, 0, 966, 0x00 },
+                { 0x0000000000000000ull, 0, 116, 0x00 },
+                { 0x0000000000000000ull, 0, 99, 0x00 },
+                { 0x0000000000000000ull, 0, 812, 0x00 },
+                { 0x0000000000000000ull, 0, 813, 0x00 },
+                { 0x0000000000000000ull, 0, 292, 0x00 },
+                { 0x0000000000000000ull, 0, 409, 0x00 },
+                { 0x0000000000000000ull, 0, 295, 0x00 },
+                { 0x0000000000000000ull, 0, 558, 0x00 },
+                { 0x0000000000000000ull, 0, 104, 0x00 },
+                { 0x0000000000000000ull, 0, 109, 0x00 },
+                { 0x0000000000000000ull, 0, 106, 0x00 },
+                { 0x0000000000000000ull, 0, 102, 0x00 },
+                { 0x0000000000000000ull, 0, 103, 0x00 },
+                { 0x0000000000000000ull, 0, 100, 0x00 },
+                { 0x0000000000000000ull, 0, 113, 0x00 },
+                { 0x0000000000000000ull, 0, 112, 0x00 },
+                { 0x0000000000000000ull, 0, 111, 0x00 },
+                { 0x0000000000000000ull, 0, 114, 0x00 },
+                { 0x0000000000000000ull, 0, 101, 0x00 },
+                { 0x0000000000000000ull, 0, 105, 0x00 },
+                { 0x0000000000000000ull, 0, 107, 0x00 },
+                { 0x0000000000000000ull, 0, 1176, 0x00 },
+                { 0x0000000000000000ull, 0, 868, 0x00 },
+                { 0x0000000000000000ull, 0, 118, 0x00 },
+                { 0x0000000000000000ull, 0, 951, 0x00 },
+                { 0x0000000000000000ull, 0, 128, 0x00 },
+                { 0x0000000000000000ull, 0, 119, 0x00 },
+                { 0x0000000000000000ull, 0, 121, 0x00 },
+                { 0x0000000000000000ull, 0, 720, 0x00 },
+                { 0x0000000000000000ull, 0, 122, 0x00 },
+                { 0x0000000000000000ull, 0, 79, 0x00 },
+                { 0x0000000000000000ull, 0, 159, 0x00 },
+                { 0x0000000000000000ull, 0, 120, 0x00 },
+                { 0x0000000000000000ull, 0, 124, 0x00 },
+                { 0x0000000000000000ull, 0, 127, 0x00 },
+                { 0x0000000000000000ull, 0, 411, 0x00 },
+                { 0x0000000000000000ull, 0, 117, 0x00 },
+                { 0x0000000000000000ull, 0, 888, 0x00 },
+                { 0x0000000000000000ull, 0, 1084, 0x00 },
+                { 0x0000000000000000ull, 0, 1085, 0x00 },
+                { 0x0000000000000000ull, 0, 894, 0x00 },
+                { 0x0000000000000000ull, 0, 889, 0x00 },
+                { 0x0000000000000000ull, 0, 890, 0x00 },
+                { 0x0000000000000000ull, 0, 891, 0x00 },
+                { 0x0000000000000000ull, 0, 892, 0x00 },
+                { 0x0000000000000000ull, 0, 893, 0x00 },
+                { 0x0000000000000000ull, 0, 895, 0x00 },
+                { 0x0000000000000000ull, 0, 637, 0x00 },
+                { 0x0000000000000000ull, 0, 846, 0x00 },
+                { 0x0000000000000000ull, 0, 916, 0x00 },
+                { 0x0000000000000000ull, 0, 852, 0x00 },
+                { 0x0000000000000000ull, 0, 853, 0x00 },
+                { 0x0000000000000000ull, 0, 854, 0x00 },
+                { 0x0000000000000000ull, 0, 855, 0x00 },
+                { 0x0000000000000000ull, 0, 917, 0x00 },
+                { 0x0000000000000000ull, 0, 918, 0x00 },
+                { 0x0000000000000000ull, 0, 880, 0x00 },
+                { 0x0000000000000000ull, 0, 882, 0x00 },
+                { 0x0000000000000000ull, 0, 920, 0x00 },
+                { 0x0000000000000000ull, 0, 921, 0x00 },
+                { 0x0000000000000000ull, 0, 924, 0x00 },
+                { 0x0000000000000000ull, 0, 925, 0x00 },
+                { 0x0000000000000000ull, 0, 926, 0x00 },
+                { 0x0000000000000000ull, 0, 927, 0x00 },
+                { 0x0000000000000000ull, 0, 928, 0x00 },
+                { 0x0000000000000000ull, 0, 929, 0x00 },
+                { 0x0000000000000000ull, 0, 930, 0x00 },
+                { 0x0000000000000000ull, 0, 931, 0x00 },
+                { 0x0000000000000000ull, 0, 933, 0x00 },
+                { 0x0000000000000000ull, 0, 934, 0x00 },
+                { 0x0000000000000000ull, 0, 885, 0x00 },
+                { 0x0000000000000000ull, 0, 879, 0x00 },
+                { 0x0000000000000000ull, 0, 878, 0x00 },
+                { 0x0000000000000000ull, 0, 871, 0x00 },
+                { 0x0000000000000000ull, 0, 872, 0x00 },
+                { 0x0000000000000000ull, 0, 873, 0x00 },
+                { 0x0000000000000000ull, 0, 874, 0x00 },
+                { 0x0000000000000000ull, 0, 875, 0x00 },
+                { 0x0000000000000000ull, 0, 876, 0x00 },
+                { 0x0000000000000000ull, 0, 877, 0x00 },
+                { 0x0000000000000000ull, 0, 1089, 0x00 },
+                { 0x0000000000000000ull, 0, 881, 0x00 },
+                { 0x0000000000000000ull, 0, 915, 0x00 },
+                { 0x0000000000000000ull, 0, 841, 0x00 },
+                { 0x0000000000000000ull, 0, 842, 0x00 },
+                { 0x0000000000000000ull, 0, 843, 0x00 },
+                { 0x0000000000000000ull, 0, 964, 0x00 },
+                { 0x0000000000000000ull, 0, 818, 0x00 },
+                { 0x0000000000000000ull, 0, 819, 0x00 },
+                { 0x0000000000000000ull, 0, 900, 0x00 },
+                { 0x0000000000000000ull, 0, 901, 0x00 },
+                { 0x0000000000000000ull, 0, 902, 0x00 },
+                { 0x0000000000000000ull, 0, 897, 0x00 },
+                { 0x0000000000000000ull, 0, 898, 0x00 },
+                { 0x0000000000000000ull, 0, 899, 0x00 },
+                { 0x0000000000000000ull, 0, 904, 0x00 },
+                { 0x0000000000000000ull, 0, 903, 0x00 },
+                { 0x0000000000000000ull, 0, 905, 0x00 },
+                { 0x0000000000000000ull, 0, 906, 0x00 },
+                { 0x0000000000000000ull, 0, 907, 0x00 },
+                { 0x0000000000000000ull, 0, 820, 0x00 },
+                { 0x0000000000000000ull, 0, 883, 0x00 },
+                { 0x0000000000000000ull, 0, 838, 0x00 },
+                { 0x0000000000000000ull, 0, 839, 0x00 },
+                { 0x0000000000000000ull, 0, 1071, 0x00 },
+                { 0x0000000000000000ull, 0, 1072, 0x00 },
+                { 0x0000000000000000ull, 0, 1000, 0x00 },
+                { 0x0000000000000000ull, 0, 1070, 0x00 },
+                { 0x0000000000000000ull, 0, 861, 0x00 },
+                { 0x0000000000000000ull, 0, 862, 0x00 },
+                { 0x0000000000000000ull, 0, 863, 0x00 },
+                { 0x0000000000000000ull, 0, 860, 0x00 },
+                { 0x0000000000000000ull, 0, 831, 0x00 },
+                { 0x0000000000000000ull, 0, 864, 0x00 },
+                { 0x0000000000000000ull, 0, 858, 0x00 },
+                { 0x0000000000000000ull, 0, 810, 0x00 },
+                { 0x0000000000000000ull, 0, 1050, 0x00 },
+                { 0x0000000000000000ull, 0, 1051, 0x00 },
+                { 0x0000000000000000ull, 0, 1052, 0x00 },
+                { 0x0000000000000000ull, 0, 1018, 0x00 },
+                { 0x0000000000000000ull, 0, 1019, 0x00 },
+                { 0x0000000000000000ull, 0, 1068, 0x00 },
+                { 0x0000000000000000ull, 0, 1069, 0x00 },
+                { 0x0000000000000000ull, 0, 814, 0x00 },
+                { 0x0000000000000000ull, 0, 815, 0x00 },
+                { 0x0000000000000000ull, 0, 816, 0x00 },
+                { 0x0000000000000000ull, 0, 817, 0x00 },
+                { 0x0000000000000000ull, 0, 844, 0x00 },
+                { 0x0000000000000000ull, 0, 845, 0x00 },
+                { 0x0000000000000000ull, 0, 865, 0x00 },
+                { 0x0000000000000000ull, 0, 866, 0x00 },
+                { 0x0000000000000000ull, 0, 941, 0x00 },
+                { 0x0000000000000000ull, 0, 942, 0x00 },
+                { 0x0000000000000000ull, 0, 943, 0x00 },
+                { 0x0000000000000000ull, 0, 939, 0x00 },
+                { 0x0000000000000000ull, 0, 940, 0x00 },
+                { 0x0000000000000000ull, 0, 821, 0x00 },
+                { 0x0000000000000000ull, 0, 822, 0x00 },
+                { 0x0000000000000000ull, 0, 886, 0x00 },
+                { 0x0000000000000000ull, 0, 959, 0x00 },
+                { 0x0000000000000000ull, 0, 1177, 0x00 },
+                { 0x0000000000000000ull, 0, 1020, 0x00 },
+                { 0x0000000000000000ull, 0, 1021, 0x00 },
+                { 0x0000000000000000ull, 0, 1022, 0x00 },
+                { 0x0000000000000000ull, 0, 1023, 0x00 },
+                { 0x0000000000000000ull, 0, 1024, 0x00 },
+                { 0x0000000000000000ull, 0, 1001, 0x00 },
+                { 0x0000000000000000ull, 0, 1118, 0x00 },
+                { 0x0000000000000000ull, 0, 1119, 0x00 },
+                { 0x0000000000000000ull, 0, 1120, 0x00 },
+                { 0x0000000000000000ull, 0, 1121, 0x00 },
+                { 0x0000000000000000ull, 0, 1122, 0x00 },
+                { 0x0000000000000000ull, 0, 1123, 0x00 },
+                { 0x0000000000000000ull, 0, 719, 0x00 },
+                { 0x0000000000000000ull, 0, 869, 0x00 },
+                { 0x0000000000000000ull, 0, 954, 0x00 },
+                { 0x0000000000000000ull, 0, 945, 0x00 },
+                { 0x0000000000000000ull, 0, 955, 0x00 },
+                { 0x0000000000000000ull, 0, 521, 0x00 },
+                { 0x0000000000000000ull, 0, 769, 0x00 },
+                { 0x0000000000000000ull, 0, 962, 0x00 },
+                { 0x0000000000000000ull, 0, 963, 0x00 },
+                { 0x0000000000000000ull, 0, 771, 0x00 },
+                { 0x0000000000000000ull, 0, 1036, 0x00 },
+                { 0x0000000000000000ull, 0, 1090, 0x00 },
+                { 0x0000000000000000ull, 0, 1088, 0x00 },
+                { 0x0000000000000000ull, 0, 1179, 0x00 },
+                { 0x0000000000000000ull, 0, 1178, 0x00 },
+                { 0x0000000000000000ull, 0, 1158, 0x00 },
+                { 0x0000000000000000ull, 0, 1159, 0x00 },
+                { 0x0000000000000000ull, 0, 1170, 0x00 },
+                { 0x0000000000000000ull, 0, 1171, 0x00 },
+                { 0x0000000000000000ull, 0, 1172, 0x00 },
+                { 0x0000000000000000ull, 0, 1173, 0x00 },
+                { 0x0000000000000000ull, 0, 1174, 0x00 },
+                { 0x0000000000000000ull, 0, 1175, 0x00 },
+                { 0x0000000000000000ull, 0, 1060, 0x00 },
+                { 0x0000000000000000ull, 0, 1062, 0x00 },
+                { 0x0000000000000000ull, 0, 1027, 0x00 },
+                { 0x0000000000000000ull, 0, 380, 0x00 },
+                { 0x0000000000000000ull, 0, 565, 0x00 },
+                { 0x0000000000000000ull, 0, 562, 0x00 },
+                { 0x0000000000000000ull, 0, 563, 0x00 },
+                { 0x0000000000000000ull, 0, 1035, 0x00 },
+                { 0x0000000000000000ull, 0, 654, 0x00 },
+                { 0x0000000000000000ull, 0, 656, 0x00 },
+                { 0x0000000000000000ull, 0, 658, 0x00 },
+                { 0x0000000000000000ull, 0, 660, 0x00 },
+                { 0x0000000000000000ull, 0, 662, 0x00 },
+                { 0x0000000000000000ull, 0, 664, 0x00 },
+                { 0x0000000000000000ull, 0, 666, 0x00 },
+                { 0x0000000000000000ull, 0, 668, 0x00 },
+                { 0x0000000000000000ull, 0, 670, 0x00 },
+                { 0x0000000000000000ull, 0, 672, 0x00 },
+                { 0x0000000000000000ull, 0, 674, 0x00 },
+                { 0x0000000000000000ull, 0, 652, 0x00 },
+                { 0x0000000000000000ull, 0, 655, 0x00 },
+                { 0x0000000000000000ull, 0, 657, 0x00 },
+                { 0x0000000000000000ull, 0, 659, 0x00 },
+                { 0x0000000000000000ull, 0, 661, 0x00 },
+                { 0x0000000000000000ull, 0, 663, 0x00 },
+                { 0x0000000000000000ull, 0, 665, 0x00 },
+                { 0x0000000000000000ull, 0, 667, 0x00 },
+                { 0x0000000000000000ull, 0, 669, 0x00 },
+                { 0x0000000000000000ull, 0, 671, 0x00 },
+                { 0x0000000000000000ull, 0, 673, 0x00 },
+                { 0x0000000000000000ull, 0, 675, 0x00 },
+                { 0x0000000000000000ull, 0, 653, 0x00 },
+                { 0x0000000000000000ull, 0, 867, 0x00 },
+                { 0x0000000000000000ull, 0, 651, 0x00 },
+                { 0x0000000000000000ull, 0, 123, 0x00 },
+                { 0x0000000000000000ull, 0, 254, 0x00 },
+                { 0x0000800000000000ull, 1381, 227, 0xC0 },
+                { 0x0000000000000000ull, 0, 787, 0x00 },
+                { 0x0000000000000000ull, 0, 406, 0x00 },
+                { 0x0000000000000000ull, 0, 407, 0x00 },
+                { 0x0000000000000000ull, 0, 773, 0x00 },
+                { 0x0000000000000000ull, 0, 253, 0x00 },
+                { 0x0000000000000000ull, 0, 932, 0x00 },
+                { 0x0000000000000000ull, 0, 912, 0x00 },
+                { 0x0000000000000000ull, 0, 911, 0x00 },
+                { 0x0000000000000000ull, 0, 913, 0x00 },
+                { 0x0000000000000000ull, 0, 914, 0x00 },
+                { 0x0000000000000000ull, 0, 131, 0x00 },
+                { 0x0000000000000000ull, 0, 142, 0x00 },
+                { 0x0000000000000000ull, 0, 133, 0x00 },
+                { 0x0000000000000000ull, 0, 115, 0x00 },
+                { 0x0000000000000000ull, 0, 847, 0x00 },
+                { 0x0000000000000000ull, 0, 848, 0x00 },
+                { 0x0000000000000000ull, 0, 850, 0x00 },
+                { 0x0000000000000000ull, 0, 851, 0x00 },
+                { 0x0000000000000000ull, 0, 784, 0x00 },
+                { 0x0000000000000000ull, 0, 919, 0x00 },
+                { 0x0000000000000000ull, 0, 936, 0x00 },
+                { 0x0000000000000000ull, 0, 937, 0x00 },
+                { 0x0000000000000000ull, 0, 938, 0x00 },
+                { 0x0000000000000000ull, 0, 922, 0x00 },
+                { 0x0000000000000000ull, 0, 923, 0x00 },
+                { 0x0000000000000000ull, 0, 957, 0x00 },
+                { 0x0000000000000000ull, 0, 944, 0x00 },
+                { 0x0000000000000000ull, 0, 884, 0x00 },
+                { 0x0000000000000000ull, 0, 949, 0x00 },
+                { 0x0000000000000000ull, 0, 322, 0x00 },
+                { 0x0000000000000000ull, 0, 125, 0x00 },
+                { 0x0000000000000000ull, 0, 126, 0x00 },
+                { 0x0000000000000000ull, 0, 908, 0x00 },
+                { 0x0000000000000000ull, 0, 527, 0x00 },
+                { 0x0000000000000000ull, 0, 532, 0x00 },
+                { 0x0000000000000000ull, 0, 559, 0x00 },
+                { 0x0000000000000000ull, 0, 560, 0x00 },
+                { 0x0000000000000000ull, 0, 528, 0x00 },
+                { 0x0000000000000000ull, 0, 977, 0x00 },
+                { 0x0000000000000000ull, 0, 1, 0x00 },
+                { 0x0000000000000000ull, 0, 4, 0x00 },
+                { 0x0000000000000000ull, 0, 8, 0x00 },
+                { 0x0000000000000000ull, 0, 2, 0x00 },
+                { 0x0000000000000000ull, 0, 3, 0x00 },
+                { 0x0000000000000000ull, 0, 6, 0x00 },
+                { 0x0000000000000000ull, 0, 5, 0x00 },
+                { 0x0000000000000000ull, 0, 13, 0x00 },
+                { 0x0000000000000000ull, 0, 75, 0x00 },
+                { 0x0000000000000000ull, 0, 11, 0x00 },
+                { 0x0000000000000000ull, 0, 12, 0x00 },
+                { 0x0000000000000000ull, 0, 20, 0x00 },
+                { 0x0000000000000000ull, 0, 36, 0x00 },
+                { 0x0000000000000000ull, 0, 14, 0x00 },
+                { 0x0000000000000000ull, 0, 48, 0x00 },
+                { 0x0000000000000000ull, 0, 31, 0x00 },
+                { 0x0000000000000000ull, 0, 28, 0x00 },
+                { 0x0000000000000000ull, 0, 29, 0x00 },
+                { 0x0000000000000000ull, 0, 32, 0x00 },
+                { 0x0000000000000000ull, 0, 69, 0x00 },
+                { 0x0000000000000000ull, 0, 37, 0x00 },
+                { 0x0000000000000000ull, 0, 50, 0x00 },
+                { 0x0000000000000000ull, 0, 66, 0x00 },
+                { 0x0000000000000000ull, 0, 16, 0x00 },
+                { 0x0000000000000000ull, 0, 15, 0x00 },
+                { 0x0000000000000000ull, 0, 19, 0x00 },
+                { 0x0000000000000000ull, 0, 18, 0x00 },
+                { 0x0000000000000000ull, 0, 21, 0x00 },
+                { 0x0000000000000000ull, 0, 22, 0x00 },
+                { 0x0000000000000000ull, 0, 23, 0x00 },
+                { 0x0000000000000000ull, 0, 68, 0x00 },
+                { 0x0000000000000000ull, 0, 51, 0x00 },
+                { 0x0000000000000000ull, 0, 74, 0x00 },
+                { 0x0000000000000000ull, 0, 73, 0x00 },
+                { 0x0000000000000000ull, 0, 63, 0x00 },
+                { 0x0000000000000000ull, 0, 67, 0x00 },
+                { 0x0000000000000000ull, 0, 72, 0x00 },
+                { 0x0000000000000000ull, 0, 62, 0x00 },
+                { 0x0000000000000000ull, 0, 58, 0x00 },
+                { 0x0000000000000000ull, 0, 59, 0x00 },
+                { 0x0000000000000000ull, 0, 60, 0x00 },
+                { 0x0000000000000000ull, 0, 70, 0x00 },
+                { 0x0000000000000000ull, 0, 38, 0x00 },
+                { 0x0000000000000000ull, 0, 71, 0x00 },
+                { 0x0000000000000000ull, 0, 34, 0x00 },
+                { 0x0000000000000000ull, 0, 64, 0x00 },
+                { 0x0000000000000000ull, 0, 54, 0x00 },
+                { 0x0000000000000000ull, 0, 55, 0x00 },
+                { 0x0000000000000000ull, 0, 61, 0x00 },
+                { 0x0000000000000000ull, 0, 65, 0x00 },
+                { 0x0000000000000000ull, 0, 56, 0x00 },
+                { 0x0000000000000000ull, 0, 57, 0x00 },
+                { 0x0000000000000000ull, 0, 40, 0x00 },
+                { 0x0000000000000000ull, 0, 46, 0x00 },
+                { 0x0000000000000000ull, 0, 30, 0x00 },
+                { 0x0000000000000000ull, 0, 41, 0x00 },
+                { 0x0000000000000000ull, 0, 88, 0x00 },
+                { 0x0000000000000000ull, 0, 89, 0x00 },
+                { 0x0000000000000000ull, 0, 87, 0x00 },
+                { 0x0000000000000000ull, 0, 90, 0x00 },
+                { 0x0000000000000000ull, 0, 91, 0x00 },
+                { 0x0000000000000000ull, 0, 92, 0x00 },
+                { 0x0000000000000000ull, 0, 95, 0x00 },
+                { 0x0000000000000000ull, 0, 94, 0x00 },
+                { 0x0000000000000000ull, 0, 93, 0x00 },
+                { 0x0000000000000000ull, 0, 52, 0x00 },
+                { 0x0000000000000000ull, 0, 9, 0x00 },
+                { 0x0000000000000000ull, 0, 10, 0x00 },
+                { 0x0000000000000000ull, 0, 33, 0x00 },
+                { 0x0000000400000000ull, 1382, 179, 0xC0 },
+                { 0x0000000400000000ull, 1383, 181, 0xC0 },
+                { 0x0000000400000000ull, 1384, 187, 0xC0 },
+                { 0x0000000000000000ull, 0, 96, 0x00 },
+                { 0x0000000000000000ull, 0, 97, 0x00 },
+                { 0x0000000000000000ull, 0, 98, 0x00 },
+                { 0x0000000400000000ull, 1385, 185, 0xC0 },
+                { 0x0000000000000000ull, 0, 152, 0x00 },
+                { 0x0000000400000000ull, 1386, 175, 0xC0 },
+                { 0x0000000400000000ull, 1387, 177, 0xC0 },
+                { 0x0000000000000000ull, 0, 155, 0x00 },
+                { 0x0000000000000000ull, 0, 643, 0x00 },
+                { 0x0000000000000000ull, 0, 638, 0x00 },
+                { 0x0000000000000000ull, 0, 582, 0x00 },
+                { 0x0000000000000000ull, 0, 583, 0x00 },
+                { 0x0000000000000000ull, 0, 584, 0x00 },
+                { 0x0000000000000000ull, 0, 585, 0x00 },
+                { 0x0000000000000000ull, 0, 586, 0x00 },
+                { 0x0000000000000000ull, 0, 587, 0x00 },
+                { 0x0000000000000000ull, 0, 588, 0x00 },
+                { 0x0000000000000000ull, 0, 589, 0x00 },
+                { 0x0000000000000000ull, 0, 590, 0x00 },
+                { 0x0000000000000000ull, 0, 593, 0x00 },
+                { 0x0000000000000000ull, 0, 594, 0x00 },
+                { 0x0000000000000000ull, 0, 595, 0x00 },
+                { 0x0000000000000000ull, 0, 596, 0x00 },
+                { 0x0000000000000000ull, 0, 615, 0x00 },
+                { 0x0000000000000000ull, 0, 597, 0x00 },
+                { 0x0000000000000000ull, 0, 598, 0x00 },
+                { 0x0000000000000000ull, 0, 599, 0x00 },
+                { 0x0000000000000000ull, 0, 600, 0x00 },
+                { 0x0000000000000000ull, 0, 601, 0x00 },
+                { 0x0000000000000000ull, 0, 602, 0x00 },
+                { 0x0000000000000000ull, 0, 603, 0x00 },
+                { 0x0000000000000000ull, 0, 604, 0x00 },
+                { 0x0000000000000000ull, 0, 605, 0x00 },
+                { 0x0000000000000000ull, 0, 606, 0x00 },
+                { 0x0000000000000000ull, 0, 607, 0x00 },
+                { 0x0000000000000000ull, 0, 608, 0x00 },
+                { 0x0000000000000000ull, 0, 609, 0x00 },
+                { 0x0000000000000000ull, 0, 591, 0x00 },
+                { 0x0000000000000000ull, 0, 592, 0x00 },
+                { 0x0000000000000000ull, 0, 639, 0x00 },
+                { 0x0000000000000000ull, 0, 640, 0x00 },
+                { 0x0000000000000000ull, 0, 641, 0x00 },
+                { 0x0000000000000000ull, 0, 632, 0x00 },
+                { 0x0000000400000000ull, 1388, 265, 0xC0 },
+                { 0x0000000000000000ull, 0, 628, 0x00 },
+                { 0x0000000000000000ull, 0, 621, 0x00 },
+                { 0x0000000000000000ull, 0, 622, 0x00 },
+                { 0x0000000000000000ull, 0, 624, 0x00 },
+                { 0x0000000000000000ull, 0, 620, 0x00 },
+                { 0x0000000000000000ull, 0, 1181, 0x00 },
+                { 0x0000000000000000ull, 0, 967, 0x00 },
+                { 0x0000000000000000ull, 0, 994, 0x00 },
+                { 0x0000000000000000ull, 0, 974, 0x00 },
+                { 0x0000000000000000ull, 0, 996, 0x00 },
+                { 0x0000000000000000ull, 0, 979, 0x00 },
+                { 0x0000000000000000ull, 0, 997, 0x00 },
+                { 0x0000000000000000ull, 0, 980, 0x00 },
+                { 0x0000000000000000ull, 0, 998, 0x00 },
+                { 0x0000000000000000ull, 0, 613, 0x00 },
+                { 0x0000000000000000ull, 0, 995, 0x00 },
+                { 0x0000000400000000ull, 1389, 273, 0xC0 },
+                { 0x0000000400000000ull, 1390, 275, 0xC0 },
+                { 0x0000000400000000ull, 1391, 248, 0xC0 },
+                { 0x0000000000000000ull, 0, 999, 0x00 },
+                { 0x0000000000000000ull, 0, 992, 0x00 },
+                { 0x0000000000000000ull, 0, 982, 0x00 },
+                { 0x0000000000000000ull, 0, 983, 0x00 },
+                { 0x0000000000000000ull, 0, 984, 0x00 },
+                { 0x0000000000000000ull, 0, 985, 0x00 },
+                { 0x0000000000000000ull, 0, 970, 0x00 },
+                { 0x0000000000000000ull, 0, 986, 0x00 },
+                { 0x0000000000000000ull, 0, 971, 0x00 },
+                { 0x0000000000000000ull, 0, 287, 0x00 },
+                { 0x0000000000000000ull, 0, 972, 0x00 },
+                { 0x0000000000000000ull, 0, 987, 0x00 },
+                { 0x0000000000000000ull, 0, 988, 0x00 },
+                { 0x0000000000000000ull, 0, 989, 0x00 },
+                { 0x0000000000000000ull, 0, 990, 0x00 },
+                { 0x0000000000000000ull, 0, 969, 0x00 },
+                { 0x0000000000000000ull, 0, 288, 0x00 },
+                { 0x0000000000000000ull, 0, 798, 0x00 },
+                { 0x0000000000000000ull, 0, 644, 0x00 },
+                { 0x0000000000000000ull, 0, 968, 0x00 },
+                { 0x0000000000000000ull, 0, 1025, 0x00 },
+                { 0x0000000000000000ull, 0, 623, 0x00 },
+                { 0x0000000000000000ull, 0, 973, 0x00 },
+                { 0x0000000000000000ull, 0, 948, 0x00 },
+                { 0x0000000000000000ull, 0, 953, 0x00 },
+                { 0x0000000000000000ull, 0, 618, 0x00 },
+                { 0x0000000000000000ull, 0, 616, 0x00 },
+                { 0x0000000000000000ull, 0, 617, 0x00 },
+                { 0x0000000000000000ull, 0, 631, 0x00 },
+                { 0x0000000000000000ull, 0, 634, 0x00 },
+                { 0x0000000000000000ull, 0, 635, 0x00 },
+                { 0x0000000000000000ull, 0, 636, 0x00 },
+                { 0x0000000000000000ull, 0, 642, 0x00 },
+                { 0x0000000000000000ull, 0, 629, 0x00 },
+                { 0x0000000000000000ull, 0, 614, 0x00 },
+                { 0x0000000000000000ull, 0, 612, 0x00 },
+                { 0x0000000000000000ull, 0, 627, 0x00 },
+                { 0x0000000000000000ull, 0, 27, 0x00 },
+                { 0x0000000000000000ull, 0, 24, 0x00 },
+                { 0x0000000000000000ull, 0, 42, 0x00 },
+                { 0x0000000000000000ull, 0, 49, 0x00 },
+                { 0x0000000000000000ull, 0, 26, 0x00 },
+                { 0x0000000000000000ull, 0, 43, 0x00 },
+                { 0x0000000000000000ull, 0, 86, 0x00 },
+                { 0x0000000000000000ull, 0, 25, 0x00 },
+                { 0x0000000000000000ull, 0, 137, 0x00 },
+                { 0x0000000000000000ull, 0, 138, 0x00 },
+                { 0x0000000000000000ull, 0, 130, 0x00 },
+                { 0x0000000000000000ull, 0, 149, 0x00 },
+                { 0x0000000000000000ull, 0, 150, 0x00 },
+                { 0x0000000000000000ull, 0, 154, 0x00 },
+                { 0x0000000000000000ull, 0, 136, 0x00 },
+                { 0x0000000000000000ull, 0, 47, 0x00 },
+                { 0x0000000000000000ull, 0, 80, 0x00 },
+                { 0x0000000000000000ull, 0, 44, 0x00 },
+                { 0x0000000000000000ull, 0, 7, 0x00 },
+                { 0x0000000000000000ull, 0, 39, 0x00 },
+                { 0x0000000000000000ull, 0, 35, 0x00 },
+                { 0x0000000400000000ull, 1392, 189, 0xC0 },
+                { 0x0000000000000000ull, 0, 45, 0x00 },
+                { 0x0000000000000000ull, 0, 240, 0x00 },
+                { 0x0000000000000000ull, 0, 158, 0x00 },
+                { 0x0000000000000000ull, 0, 233, 0x00 },
+                { 0x0000000000000000ull, 0, 238, 0x00 },
+                { 0x0000000000000000ull, 0, 243, 0x00 },
+                { 0x0000000400000000ull, 1393, 191, 0xC0 },
+                { 0x0000000400000000ull, 1394, 0, 0xC0 },
+                { 0x0000000400000000ull, 1395, 0, 0xC0 },
+                { 0x0000000000000000ull, 0, 257, 0x00 },
+                { 0x0000000400000000ull, 1396, 0, 0xC0 },
+                { 0x0000000400000000ull, 1397, 0, 0xC0 },
+                { 0x0000000400000000ull, 1398, 0, 0xC0 },
+                { 0x0000000000000000ull, 0, 414, 0x00 },
+                { 0x0000000000000000ull, 0, 837, 0x00 },
+                { 0x0000000000000000ull, 0, 516, 0x00 },
+                { 0x0000000000000000ull, 0, 517, 0x00 },
+                { 0x0000000000000000ull, 0, 520, 0x00 },
+                { 0x0000000000000000ull, 0, 762, 0x00 },
+                { 0x0000000000000000ull, 0, 744, 0x00 },
+                { 0x0000000000000000ull, 0, 745, 0x00 },
+                { 0x0000000000000000ull, 0, 746, 0x00 },
+                { 0x0000000000000000ull, 0, 760, 0x00 },
+                { 0x0000000000000000ull, 0, 761, 0x00 },
+                { 0x0000000000000000ull, 0, 457, 0x00 },
+                { 0x0000000000000000ull, 0, 447, 0x00 },
+                { 0x0000000000000000ull, 0, 453, 0x00 },
+                { 0x0000000000000000ull, 0, 463, 0x00 },
+                { 0x0000000000000000ull, 0, 449, 0x00 },
+                { 0x0000000000000000ull, 0, 450, 0x00 },
+                { 0x0000000000000000ull, 0, 458, 0x00 },
+                { 0x0000000000000000ull, 0, 475, 0x00 },
+                { 0x0000000000000000ull, 0, 473, 0x00 },
+                { 0x0000000000000000ull, 0, 470, 0x00 },
+                { 0x0000000000000000ull, 0, 471, 0x00 },
+                { 0x0000000000000000ull, 0, 506, 0x00 },
+                { 0x0000000000000000ull, 0, 454, 0x00 },
+                { 0x0000000000000000ull, 0, 445, 0x00 },
+                { 0x0000000000000000ull, 0, 459, 0x00 },
+                { 0x0000000000000000ull, 0, 490, 0x00 },
+                { 0x0000000000000000ull, 0, 337, 0x00 },
+                { 0x0000000000000000ull, 0, 408, 0x00 },
+                { 0x0000000000000000ull, 0, 372, 0x00 },
+                { 0x0000000000000000ull, 0, 343, 0x00 },
+                { 0x0000000000000000ull, 0, 381, 0x00 },
+                { 0x0000000000000000ull, 0, 382, 0x00 },
+                { 0x0000000000000000ull, 0, 367, 0x00 },
+                { 0x0000000000000000ull, 0, 397, 0x00 },
+                { 0x0000000000000000ull, 0, 383, 0x00 },
+                { 0x0000000000000000ull, 0, 334, 0x00 },
+                { 0x0000000000000000ull, 0, 401, 0x00 },
+                { 0x0000000000000000ull, 0, 344, 0x00 },
+                { 0x0000000000000000ull, 0, 329, 0x00 },
+                { 0x0000000000000000ull, 0, 387, 0x00 },
+                { 0x0000000000000000ull, 0, 359, 0x00 },
+                { 0x0000000000000000ull, 0, 491, 0x00 },
+                { 0x0000000000000000ull, 0, 492, 0x00 },
+                { 0x0000000000000000ull, 0, 460, 0x00 },
+                { 0x0000000000000008ull, 1399, 0, 0x80 },
+                { 0x0000000000000008ull, 1400, 0, 0x80 },
+                { 0x0000000000000008ull, 1401, 0, 0x80 },
+                { 0x0000000000000008ull, 1402, 0, 0x80 },
+                { 0x0000000000000008ull, 1403, 0, 0x80 },
+                { 0x0000000000000008ull, 1404, 0, 0x80 },
+                { 0x0000000000000008ull, 1405, 0, 0x80 },
+                { 0x0000000000000008ull, 1406, 0, 0x80 },
+                { 0x0000000000000008ull, 1407, 0, 0x80 },
+                { 0x0000000000000008ull, 1408, 0, 0x80 },
+                { 0x0000000000000008ull, 1409, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 1103, 0x00 },
+                { 0x0000000000000000ull, 0, 1104, 0x00 },
+                { 0x0000000000008000ull, 1410, 0, 0x80 },
+                { 0x0000000000008000ull, 1411, 0, 0x80 },
+                { 0x0000000000008000ull, 1412, 0, 0x80 },
+                { 0x0000000000008000ull, 1413, 0, 0x80 },
+                { 0x0000000000008000ull, 1414, 0, 0x80 },
+                { 0x0000000000008000ull, 1415, 0, 0x80 },
+                { 0x0000000000008000ull, 1416, 0, 0x80 },
+                { 0x0000000000008000ull, 1417, 0, 0x80 },
+                { 0x0000000000008000ull, 1418, 0, 0x80 },
+                { 0x0000000000008000ull, 1419, 0, 0x80 },
+                { 0x0000000000008000ull, 1420, 0, 0x80 },
+                { 0x0000000000008000ull, 1421, 0, 0x80 },
+                { 0x0000000000008000ull, 1422, 0, 0x80 },
+                { 0x0000000000008000ull, 1423, 0, 0x80 },
+                { 0x0000000000008000ull, 1424, 0, 0x80 },
+                { 0x0000000000008000ull, 1425, 0, 0x80 },
+                { 0x0000000000008000ull, 1426, 0, 0x80 },
+                { 0x0000000000008000ull, 1427, 0, 0x80 },
+                { 0x0000000000008000ull, 1428, 0, 0x80 },
+                { 0x0000000000008000ull, 1429, 0, 0x80 },
+                { 0x0000000000008000ull, 1430, 0, 0x80 },
+                { 0x0000000000008000ull, 1431, 0, 0x80 },
+                { 0x0000000000008000ull, 1432, 0, 0x80 },
+                { 0x0000000000008000ull, 1433, 0, 0x80 },
+                { 0x0000000000008000ull, 1434, 0, 0x80 },
+                { 0x0000000000008000ull, 1435, 0, 0x80 },
+                { 0x0000000000008000ull, 1436, 0, 0x80 },
+                { 0x0000000000008000ull, 1437, 0, 0x80 },
+                { 0x0000000000008000ull, 1438, 0, 0x80 },
+                { 0x0000000000008000ull, 1439, 0, 0x80 },
+                { 0x0000000000008000ull, 1440, 0, 0x80 },
+                { 0x0000000000008000ull, 1441, 0, 0x80 },
+                { 0x0000000000008000ull, 1442, 0, 0x80 },
+                { 0x0000000000008000ull, 1443, 0, 0x80 },
+                { 0x0000000000008000ull, 1444, 0, 0x80 },
+                { 0x0000000000008000ull, 1445, 0, 0x80 },
+                { 0x0000000000008000ull, 1446, 0, 0x80 },
+                { 0x0000000000008000ull, 1447, 0, 0x80 },
+                { 0x0000000000008000ull, 1448, 0, 0x80 },
+                { 0x0000000000008000ull, 1449, 0, 0x80 },
+                { 0x0000000000008000ull, 1450, 0, 0x80 },
+                { 0x0000000000008000ull, 1451, 0, 0x80 },
+                { 0x0000000000008000ull, 1452, 0, 0x80 },
+                { 0x0000000000008000ull, 1453, 0, 0x80 },
+                { 0x0000000000008000ull, 1454, 0, 0x80 },
+                { 0x0000000000008000ull, 1455, 0, 0x80 },
+                { 0x0000000000008000ull, 1456, 0, 0x80 },
+                { 0x0000000000008000ull, 1457, 0, 0x80 },
+                { 0x0000000000008000ull, 1458, 0, 0x80 },
+                { 0x0000000000008000ull, 1459, 0, 0x80 },
+                { 0x0000000000008000ull, 1460, 0, 0x80 },
+                { 0x0000000000008000ull, 1461, 0, 0x80 },
+                { 0x0000000000008000ull, 1462, 0, 0x80 },
+                { 0x0000000000008000ull, 1463, 0, 0x80 },
+                { 0x0100000000000000ull, 1464, 0, 0x80 },
+                { 0x0100000000000000ull, 1465, 0, 0x80 },
+                { 0x0100000000000000ull, 1466, 0, 0x80 },
+                { 0x0100000000000000ull, 1467, 0, 0x80 },
+                { 0x0000000080000000ull, 1468, 0, 0x80 },
+                { 0x0000000080000000ull, 1469, 0, 0x80 },
+                { 0x0000000080000000ull, 1470, 0, 0x80 },
+                { 0x0000000080000000ull, 1471, 0, 0x80 },
+                { 0x0000000080000000ull, 1472, 0, 0x80 },
+                { 0x0000000080000000ull, 1473, 0, 0x80 },
+                { 0x0000000080000000ull, 1474, 0, 0x80 },
+                { 0x0000000080000000ull, 1475, 0, 0x80 },
+                { 0x0000000080000000ull, 1476, 0, 0x80 },
+                { 0x0000000080000000ull, 1477, 0, 0x80 },
+                { 0x0000000080000000ull, 1478, 0, 0x80 },
+                { 0x0000000080000000ull, 1479, 0, 0x80 },
+                { 0x0000000080000000ull, 1480, 0, 0x80 },
+                { 0x0000000080000000ull, 1481, 0, 0x80 },
+                { 0x0000000080000000ull, 1482, 0, 0x80 },
+                { 0x0000000080000000ull, 1483, 0, 0x80 },
+                { 0x0000000080000000ull, 1484, 0, 0x80 },
+                { 0x0000000080000000ull, 1485, 0, 0x80 },
+                { 0x0000000080000000ull, 1486, 0, 0x80 },
+                { 0x0000000080000000ull, 1487, 0, 0x80 },
+                { 0x0000000080000000ull, 1488, 0, 0x80 },
+                { 0x0000000080000000ull, 1489, 0, 0x80 },
+                { 0x0000000080000000ull, 1490, 0, 0x80 },
+                { 0x0000000080000000ull, 1491, 0, 0x80 },
+                { 0x0000000080000000ull, 1492, 0, 0x80 },
+                { 0x0000000080000000ull, 1493, 0, 0x80 },
+                { 0x0100000000000000ull, 1494, 0, 0x80 },
+                { 0x0100000000000000ull, 1495, 0, 0x80 },
+                { 0x0000000000000001ull, 1496, 0, 0x80 },
+                { 0x0000000000000001ull, 1497, 0, 0x80 },
+                { 0x0000000000000001ull, 1498, 0, 0x80 },
+                { 0x0100000000000000ull, 1499, 0, 0x80 },
+                { 0x0100000000000000ull, 1500, 0, 0x80 },
+                { 0x0100000000000000ull, 1501, 0, 0x80 },
+                { 0x0000000000000001ull, 1502, 0, 0x80 },
+                { 0x0000000000000001ull, 1503, 0, 0x80 },
+                { 0x0000000000000001ull, 1504, 0, 0x80 },
+                { 0x0000000000000001ull, 1505, 0, 0x80 },
+                { 0x0000000000000001ull, 1506, 0, 0x80 },
+                { 0x0000000000000001ull, 1507, 0, 0x80 },
+                { 0x0000000000000001ull, 1508, 0, 0x80 },
+                { 0x0000000000000001ull, 1509, 0, 0x80 },
+                { 0x0000000000000001ull, 1510, 0, 0x80 },
+                { 0x0000000000000001ull, 1511, 0, 0x80 },
+                { 0x0000000000000001ull, 1512, 0, 0x80 },
+                { 0x0100000000000000ull, 1513, 0, 0x80 },
+                { 0x0000000000000001ull, 1514, 0, 0x80 },
+                { 0x0000000000000001ull, 1515, 0, 0x80 },
+                { 0x0000000000000001ull, 1516, 0, 0x80 },
+                { 0x0000000000000001ull, 1517, 0, 0x80 },
+                { 0x0000000000000001ull, 1518, 0, 0x80 },
+                { 0x0000000000000001ull, 1519, 0, 0x80 },
+                { 0x0000000000000001ull, 1520, 0, 0x80 },
+                { 0x0000000000000001ull, 1521, 0, 0x80 },
+                { 0x0000000000000001ull, 1522, 0, 0x80 },
+                { 0x0000000000000001ull, 1523, 0, 0x80 },
+                { 0x0000000000000001ull, 1524, 0, 0x80 },
+                { 0x0000000000000001ull, 1525, 0, 0x80 },
+                { 0x0000000000000001ull, 1526, 0, 0x80 },
+                { 0x0000000000000001ull, 1527, 0, 0x80 },
+                { 0x0000000000000001ull, 1528, 0, 0x80 },
+                { 0x0000000000000001ull, 1529, 0, 0x80 },
+                { 0x0000000000000001ull, 1530, 0, 0x80 },
+                { 0x0000000800000000ull, 1531, 0, 0x80 },
+                { 0x0000000800000000ull, 1532, 0, 0x80 },
+                { 0x0000000800000000ull, 1533, 0, 0x80 },
+                { 0x0000000800000000ull, 1534, 0, 0x80 },
+                { 0x0000000800000000ull, 1535, 0, 0x80 },
+                { 0x0000000800000000ull, 1536, 0, 0x80 },
+                { 0x0000000800000000ull, 1537, 0, 0x80 },
+                { 0x0000000800000000ull, 1538, 0, 0x80 },
+                { 0x0000000800000000ull, 1539, 0, 0x80 },
+                { 0x0000000800000000ull, 1540, 0, 0x80 },
+                { 0x0000000800000000ull, 1541, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 1077, 0x00 },
+                { 0x0000000000000000ull, 0, 1078, 0x00 },
+                { 0x0000000000000000ull, 0, 1105, 0x00 },
+                { 0x0000000000000000ull, 0, 1130, 0x00 },
+                { 0x0000000000000000ull, 0, 1013, 0x00 },
+                { 0x0000000000000000ull, 0, 1012, 0x00 },
+                { 0x0000000000000000ull, 0, 1011, 0x00 },
+                { 0x0000000000000000ull, 0, 1005, 0x00 },
+                { 0x0000000000000000ull, 0, 1007, 0x00 },
+                { 0x0000000000000000ull, 0, 1009, 0x00 },
+                { 0x0000000000000000ull, 0, 1014, 0x00 },
+                { 0x0000000000000000ull, 0, 1015, 0x00 },
+                { 0x0000000000000000ull, 0, 1132, 0x00 },
+                { 0x0000000000000000ull, 0, 1168, 0x00 },
+                { 0x0000000000000000ull, 0, 1169, 0x00 },
+                { 0x0000000000000000ull, 0, 1053, 0x00 },
+                { 0x0000000000000000ull, 0, 1057, 0x00 },
+                { 0x0000000000000000ull, 0, 1165, 0x00 },
+                { 0x0000000000000000ull, 0, 1164, 0x00 },
+                { 0x0000000000000000ull, 0, 689, 0x00 },
+                { 0x0000000000000000ull, 0, 696, 0x00 },
+                { 0x0000000000000000ull, 0, 840, 0x00 },
+                { 0x0000000000000000ull, 0, 1093, 0x00 },
+                { 0x0000000000000000ull, 0, 17, 0x00 },
+                { 0x0000000000000000ull, 0, 776, 0x00 },
+                { 0x0000000000000000ull, 0, 779, 0x00 },
+                { 0x0000000000000000ull, 0, 777, 0x00 },
+                { 0x0000000000000000ull, 0, 778, 0x00 },
+                { 0x0000000000000000ull, 0, 576, 0x00 },
+                { 0x0000000000000000ull, 0, 1086, 0x00 },
+                { 0x0000000000000000ull, 0, 991, 0x00 },
+                { 0x0000000400000000ull, 1542, 0, 0xC0 },
+                { 0x0000000000000000ull, 0, 935, 0x00 },
+                { 0x0000000000000000ull, 0, 633, 0x00 },
+                { 0x0000000000000000ull, 0, 896, 0x00 },
+                { 0x0000000000000000ull, 0, 909, 0x00 },
+                { 0x0000000000000000ull, 0, 910, 0x00 },
+                { 0x0000000000000000ull, 0, 1094, 0x00 },
+                { 0x0000000000000000ull, 0, 1073, 0x00 },
+                { 0x0000000000000000ull, 0, 1100, 0x00 },
+                { 0x0000000000000000ull, 0, 1101, 0x00 },
+                { 0x0000000000000000ull, 0, 715, 0x00 },
+                { 0x0000000000000000ull, 0, 1102, 0x00 },
+                { 0x0000000000000000ull, 0, 110, 0x00 },
+                { 0x0000000000000000ull, 0, 1006, 0x00 },
+                { 0x0000000000000000ull, 0, 1016, 0x00 },
+                { 0x0000000000000000ull, 0, 1017, 0x00 },
+                { 0x0000000000000000ull, 0, 1010, 0x00 },
+                { 0x0000000000000000ull, 0, 1004, 0x00 },
+                { 0x0000000000000000ull, 0, 1008, 0x00 },
+                { 0x0000000000000000ull, 0, 1083, 0x00 },
+                { 0x0000000000000000ull, 0, 1099, 0x00 },
+                { 0x0000000000000000ull, 0, 1154, 0x00 },
+                { 0x0000000000000000ull, 0, 1155, 0x00 },
+                { 0x0000000000008000ull, 1543, 0, 0x80 },
+                { 0x0000000000008000ull, 1544, 0, 0x80 },
+                { 0x0000000000008000ull, 1545, 0, 0x80 },
+                { 0x0000000000008000ull, 1546, 0, 0x80 },
+                { 0x0000000000000080ull, 1547, 0, 0x80 },
+                { 0x0000000000000080ull, 1548, 0, 0x80 },
+                { 0x0000000000000080ull, 1549, 0, 0x80 },
+                { 0x0000000000000080ull, 1550, 0, 0x80 },
+                { 0x0000000000000080ull, 1551, 0, 0x80 },
+                { 0x0000000000000080ull, 1552, 0, 0x80 },
+                { 0x0000000000000080ull, 1553, 0, 0x80 },
+                { 0x0000000000000080ull, 1554, 0, 0x80 },
+                { 0x0000000000000080ull, 1555, 0, 0x80 },
+                { 0x0000000000000080ull, 1556, 0, 0x80 },
+                { 0x0000000000000080ull, 1557, 0, 0x80 },
+                { 0x0000000000000080ull, 1558, 0, 0x80 },
+                { 0x0000000000000080ull, 1559, 0, 0x80 },
+                { 0x0000000000000080ull, 1560, 0, 0x80 },
+                { 0x0000000000000080ull, 1561, 0, 0x80 },
+                { 0x0000000000000080ull, 1562, 0, 0x80 },
+                { 0x0000000000000080ull, 1563, 0, 0x80 },
+                { 0x0000000000000080ull, 1564, 0, 0x80 },
+                { 0x0000000000000080ull, 1565, 0, 0x80 },
+                { 0x0000000000000080ull, 1566, 0, 0x80 },
+                { 0x0000000000000080ull, 1567, 0, 0x80 },
+                { 0x0000000000000080ull, 1568, 0, 0x80 },
+                { 0x0000000000000080ull, 1569, 0, 0x80 },
+                { 0x0000000000000080ull, 1570, 0, 0x80 },
+                { 0x0000000000000080ull, 1571, 0, 0x80 },
+                { 0x0000000000000080ull, 1572, 0, 0x80 },
+                { 0x0000000000008000ull, 1573, 0, 0x80 },
+                { 0x0000000000008000ull, 1574, 0, 0x80 },
+                { 0x0000000000002000ull, 1575, 0, 0x80 },
+                { 0x0000000000002000ull, 1576, 0, 0x80 },
+                { 0x0000000000002000ull, 1577, 0, 0x80 },
+                { 0x0000000000008000ull, 1578, 0, 0x80 },
+                { 0x0000000000008000ull, 1579, 0, 0x80 },
+                { 0x0000000000008000ull, 1580, 0, 0x80 },
+                { 0x0000000000002000ull, 1581, 0, 0x80 },
+                { 0x0000000000002000ull, 1582, 0, 0x80 },
+                { 0x0000000000002000ull, 1583, 0, 0x80 },
+                { 0x0000000000002000ull, 1584, 0, 0x80 },
+                { 0x0000000000002000ull, 1585, 0, 0x80 },
+                { 0x0000000000002000ull, 1586, 0, 0x80 },
+                { 0x0000000000002000ull, 1587, 0, 0x80 },
+                { 0x0000000000002000ull, 1588, 0, 0x80 },
+                { 0x0000000000002000ull, 1589, 0, 0x80 },
+                { 0x0000000000002000ull, 1590, 0, 0x80 },
+                { 0x0000000000002000ull, 1591, 0, 0x80 },
+                { 0x0000000000008000ull, 1592, 0, 0x80 },
+                { 0x0000000000002000ull, 1593, 0, 0x80 },
+                { 0x0000000000002000ull, 1594, 0, 0x80 },
+                { 0x0000000000002000ull, 1595, 0, 0x80 },
+                { 0x0000000000002000ull, 1596, 0, 0x80 },
+                { 0x0000000000002000ull, 1597, 0, 0x80 },
+                { 0x0000000000002000ull, 1598, 0, 0x80 },
+                { 0x0000000000002000ull, 1599, 0, 0x80 },
+                { 0x0000000000002000ull, 1600, 0, 0x80 },
+                { 0x0000000000002000ull, 1601, 0, 0x80 },
+                { 0x0000000000002000ull, 1602, 0, 0x80 },
+                { 0x0000000000002000ull, 1603, 0, 0x80 },
+                { 0x0000000000002000ull, 1604, 0, 0x80 },
+                { 0x0000000000002000ull, 1605, 0, 0x80 },
+                { 0x0000000000002000ull, 1606, 0, 0x80 },
+                { 0x0000000000002000ull, 1607, 0, 0x80 },
+                { 0x0000000000002000ull, 1608, 0, 0x80 },
+                { 0x0000000000002000ull, 1609, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 1106, 0x00 },
+                { 0x0000000000000000ull, 0, 1108, 0x00 },
+                { 0x0000000000000000ull, 0, 1109, 0x00 },
+                { 0x0000000000000000ull, 0, 1110, 0x00 },
+                { 0x0000000000000000ull, 0, 1111, 0x00 },
+                { 0x0000000000000000ull, 0, 1112, 0x00 },
+                { 0x0000000000000000ull, 0, 1113, 0x00 },
+                { 0x0000000000000000ull, 0, 1114, 0x00 },
+                { 0x0000000000000000ull, 0, 1115, 0x00 },
+                { 0x0000000000000000ull, 0, 1116, 0x00 },
+                { 0x0000000000000000ull, 0, 1117, 0x00 },
+                { 0x0000000000000001ull, 1610, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 1124, 0x00 },
+                { 0x0000000000000000ull, 0, 1126, 0x00 },
+                { 0x0000000000000000ull, 0, 1135, 0x00 },
+                { 0x0000000000000000ull, 0, 1137, 0x00 },
+                { 0xB7D65E0000000000ull, 1611, 0, 0x80 },
+                { 0xD3DEFEC000000000ull, 1627, 0, 0x80 },
+                { 0xFC9F7B4000000000ull, 1647, 0, 0x80 },
+                { 0x8015840000000000ull, 1666, 0, 0x80 },
+                { 0x0780350000000000ull, 1672, 0, 0x80 },
+                { 0x0095C00000000000ull, 1680, 0, 0x80 },
+                { 0x57EE7EC000000000ull, 1686, 0, 0x80 },
+                { 0x0689000000000000ull, 1705, 0, 0x80 },
+                { 0x03DE070000000000ull, 1710, 0, 0x80 },
+                { 0x0034040000000000ull, 1721, 0, 0x80 },
+                { 0xD0AC740000000000ull, 1725, 0, 0x80 },
+                { 0x4F8141C000000000ull, 1736, 0, 0x80 },
+                { 0xFFFF374000000000ull, 1747, 0, 0x80 },
+                { 0x84B25D4000000000ull, 1769, 0, 0x80 },
+                { 0x0004000000000000ull, 1781, 0, 0x80 },
+                { 0x538F3C4000000000ull, 1782, 0, 0x80 },
+                { 0x0000004000000000ull, 1796, 0, 0x80 },
+                { 0x1510040000000000ull, 1797, 0, 0x80 },
+                { 0xEB9F77C000000000ull, 1802, 0, 0x80 },
+                { 0x9A9FBB0000000000ull, 1822, 0, 0x80 },
+                { 0xC100104000000000ull, 1838, 0, 0x80 },
+                { 0x0408554000000000ull, 1843, 0, 0x80 },
+                { 0x0100080000000000ull, 1850, 0, 0x80 },
+                { 0x0001000000000000ull, 1852, 0, 0x80 },
+                { 0x0200040000000000ull, 1853, 0, 0x80 },
+                { 0x1004004000000000ull, 1855, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 1142, 0x00 },
+                { 0x0000000000000000ull, 0, 1143, 0x00 },
+                { 0x0000000400000000ull, 1858, 0, 0xC0 },
+                { 0x0000000400000000ull, 1859, 0, 0xC0 },
+                { 0x0000000400000000ull, 1860, 0, 0xC0 },
+                { 0x0000000400000000ull, 1861, 0, 0xC0 },
+                { 0x0000000400000000ull, 1862, 0, 0xC0 },
+                { 0x0000000400000000ull, 1863, 0, 0xC0 },
+                { 0x0001000400000000ull, 1864, 0, 0xC0 },
+                { 0x0001000400000000ull, 1866, 0, 0xC0 },
+                { 0x0000000400000000ull, 1868, 0, 0xC0 },
+                { 0x0000000400000000ull, 1869, 0, 0xC0 },
+                { 0x0000000400000000ull, 1870, 0, 0xC0 },
+                { 0x0000000400000000ull, 1871, 0, 0xC0 },
+                { 0x0000000400000000ull, 1872, 0, 0xC0 },
+                { 0x0000000400000000ull, 1873, 0, 0xC0 },
+                { 0x0000000400000000ull, 1874, 0, 0xC0 },
+                { 0x0000000400000000ull, 1875, 0, 0xC0 },
+                { 0x0000000400000000ull, 1876, 0, 0xC0 },
+                { 0x0000000400000000ull, 1877, 0, 0xC0 },
+                { 0x0000000400000000ull, 1878, 0, 0xC0 },
+                { 0x0000000400000000ull, 1879, 0, 0xC0 },
+                { 0x0000000400000000ull, 1880, 0, 0xC0 },
+                { 0x0000000400000000ull, 1881, 0, 0xC0 },
+                { 0x0000000400000000ull, 1882, 0, 0xC0 },
+                { 0x0000000400000000ull, 1883, 0, 0xC0 },
+                { 0x0000000400000000ull, 1884, 0, 0xC0 },
+                { 0x0000000400000000ull, 1885, 0, 0xC0 },
+                { 0x0000000400000000ull, 1886, 0, 0xC0 },
+                { 0x0000000400000000ull, 1887, 0, 0xC0 },
+                { 0x0000000400000000ull, 1888, 0, 0xC0 },
+                { 0x0000000400000000ull, 1889, 0, 0xC0 },
+                { 0x0000000400000000ull, 1890, 0, 0xC0 },
+                { 0x0000000400000000ull, 1891, 0, 0xC0 },
+                { 0x0000000400000000ull, 1892, 0, 0xC0 },
+                { 0x0000000400000000ull, 1893, 0, 0xC0 },
+                { 0x0000000400000000ull, 1894, 0, 0xC0 },
+                { 0x0000000000002000ull, 1895, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 1186, 0x00 },
+                { 0x0000000000000000ull, 0, 1187, 0x00 },
+                { 0x0000000000000000ull, 0, 1188, 0x00 },
+                { 0x0000000000000000ull, 0, 1189, 0x00 },
+                { 0x0000000000000000ull, 0, 1190, 0x00 },
+                { 0x0000000000000000ull, 0, 1191, 0x00 },
+                { 0x0000000000000000ull, 0, 1192, 0x00 },
+                { 0x0000000000000000ull, 0, 1193, 0x00 },
+                { 0x0000000000000000ull, 0, 1194, 0x00 },
+                { 0x0000000000000000ull, 0, 1195, 0x00 },
+                { 0x0000000000000000ull, 0, 1196, 0x00 },
+                { 0x0000000000000000ull, 0, 1197, 0x00 },
+                { 0x0000000000000000ull, 0, 1198, 0x00 },
+                { 0x0000000000000000ull, 0, 1199, 0x00 },
+                { 0x0000000000000000ull, 0, 1200, 0x00 },
+                { 0x0000000000000000ull, 0, 1201, 0x00 },
+                { 0x0000000000000000ull, 0, 1202, 0x00 },
+                { 0x0000000000000000ull, 0, 1203, 0x00 },
+                { 0x0000000000000000ull, 0, 1204, 0x00 },
+                { 0x0000000000000000ull, 0, 1205, 0x00 },
+                { 0x0000000000000000ull, 0, 1206, 0x00 },
+                { 0x0000000000000000ull, 0, 1207, 0x00 },
+                { 0x0000000000000000ull, 0, 1208, 0x00 },
+                { 0x0000000000000000ull, 0, 1209, 0x00 },
+                { 0x0000000000000000ull, 0, 1210, 0x00 },
+                { 0x0000000000000000ull, 0, 1211, 0x00 },
+                { 0x0000000000000000ull, 0, 1212, 0x00 },
+                { 0x0000000000000000ull, 0, 1213, 0x00 },
+                { 0x0000000000000000ull, 0, 1214, 0x00 },
+                { 0x0000000000000000ull, 0, 1215, 0x00 },
+                { 0x0000000000000000ull, 0, 1216, 0x00 },
+                { 0x0000000000000000ull, 0, 1217, 0x00 },
+                { 0x0000000000000000ull, 0, 1218, 0x00 },
+                { 0x0000000000000000ull, 0, 1219, 0x00 },
+                { 0x0000000000000000ull, 0, 1220, 0x00 },
+                { 0x0000000000000000ull, 0, 1221, 0x00 },
+                { 0x0000000000000000ull, 0, 1222, 0x00 },
+                { 0x0000000000000000ull, 0, 1223, 0x00 },
+                { 0x0000000000000000ull, 0, 1224, 0x00 },
+                { 0x0000000000000000ull, 0, 1225, 0x00 },
+                { 0x0000000000000000ull, 0, 1226, 0x00 },
+                { 0x0000000000000000ull, 0, 1227, 0x00 },
+                { 0x0000000000000000ull, 0, 1228, 0x00 },
+                { 0x0000000000000000ull, 0, 1229, 0x00 },
+                { 0x0000000000000000ull, 0, 1230, 0x00 },
+                { 0x0000000000000000ull, 0, 1231, 0x00 },
+                { 0x0000000000000000ull, 0, 1232, 0x00 },
+                { 0x0000000000000000ull, 0, 1233, 0x00 },
+                { 0x0000000000000000ull, 0, 1234, 0x00 },
+                { 0x0000000000000000ull, 0, 1235, 0x00 },
+                { 0x0000000000000000ull, 0, 1236, 0x00 },
+                { 0x0000000000000000ull, 0, 1237, 0x00 },
+                { 0x0000000000000000ull, 0, 1238, 0x00 },
+                { 0x0000000000000000ull, 0, 1239, 0x00 },
+                { 0x0000000000000000ull, 0, 1240, 0x00 },
+                { 0x0000000000000000ull, 0, 1241, 0x00 },
+                { 0x0000000000000000ull, 0, 1242, 0x00 },
+                { 0x0000000000000000ull, 0, 1243, 0x00 },
+                { 0x0000000000000000ull, 0, 1244, 0x00 },
+                { 0x0000000000000000ull, 0, 1245, 0x00 },
+                { 0x0000000000000000ull, 0, 1246, 0x00 },
+                { 0x0000000000000000ull, 0, 1247, 0x00 },
+                { 0x0000000000000000ull, 0, 1248, 0x00 },
+                { 0x0000000000000000ull, 0, 1249, 0x00 },
+                { 0x0000000000000000ull, 0, 1250, 0x00 },
+                { 0x0000000000000000ull, 0, 1251, 0x00 },
+                { 0x0000000000000000ull, 0, 1252, 0x00 },
+                { 0x0000000000000000ull, 0, 1253, 0x00 },
+                { 0x0000000000000000ull, 0, 1254, 0x00 },
+                { 0x0000000000000000ull, 0, 1255, 0x00 },
+                { 0x0000000000000000ull, 0, 1256, 0x00 },
+                { 0x0000000000000000ull, 0, 1257, 0x00 },
+                { 0x0000000000000000ull, 0, 1258, 0x00 },
+                { 0x0000000000000000ull, 0, 1259, 0x00 },
+                { 0x0000000000000000ull, 0, 1260, 0x00 },
+                { 0x0000000000000000ull, 0, 1261, 0x00 },
+                { 0x0000000000000000ull, 0, 1262, 0x00 },
+                { 0x0000000000000000ull, 0, 1263, 0x00 },
+                { 0x0000000000000000ull, 0, 1264, 0x00 },
+                { 0x0000000000000000ull, 0, 1265, 0x00 },
+                { 0x0000000000000000ull, 0, 1266, 0x00 },
+                { 0x0000000000000000ull, 0, 1267, 0x00 },
+                { 0x0000000000000000ull, 0, 1268, 0x00 },
+                { 0x0000000000000000ull, 0, 1269, 0x00 },
+                { 0x0000000000000000ull, 0, 1270, 0x00 },
+                { 0x0000000000000000ull, 0, 1271, 0x00 },
+                { 0x0000000000000000ull, 0, 1272, 0x00 },
+                { 0x0000000000000000ull, 0, 1273, 0x00 },
+                { 0x0000000000000000ull, 0, 1274, 0x00 },
+                { 0x0000000000000000ull, 0, 1275, 0x00 },
+                { 0x0000000000000000ull, 0, 1276, 0x00 },
+                { 0x0000000000000000ull, 0, 1277, 0x00 },
+                { 0x0000000000000000ull, 0, 1278, 0x00 },
+                { 0x0000000000000000ull, 0, 1279, 0x00 },
+                { 0x0000000000000000ull, 0, 1280, 0x00 },
+                { 0x0000000000000000ull, 0, 1281, 0x00 },
+                { 0x0000000000000000ull, 0, 1282, 0x00 },
+                { 0x0000000000000000ull, 0, 1283, 0x00 },
+                { 0x0000000000000000ull, 0, 1284, 0x00 },
+                { 0x0000000000000000ull, 0, 1285, 0x00 },
+                { 0x0000000000000000ull, 0, 1286, 0x00 },
+                { 0x0000000000000000ull, 0, 1287, 0x00 },
+                { 0x0000000000000000ull, 0, 1288, 0x00 },
+                { 0x0000000000000000ull, 0, 1289, 0x00 },
+                { 0x0000000000000000ull, 0, 1290, 0x00 },
+                { 0x0000000000000000ull, 0, 1291, 0x00 },
+                { 0x0000000000000000ull, 0, 1292, 0x00 },
+                { 0x0000000000000000ull, 0, 1293, 0x00 },
+                { 0x0000000000000000ull, 0, 1294, 0x00 },
+                { 0x0000000000000000ull, 0, 1295, 0x00 },
+                { 0x0000000000000000ull, 0, 1296, 0x00 },
+                { 0x0000000000000000ull, 0, 1297, 0x00 },
+                { 0x0000000000000000ull, 0, 1298, 0x00 },
+                { 0x0000000000000000ull, 0, 1299, 0x00 },
+                { 0x0000000000000000ull, 0, 1300, 0x00 },
+                { 0x0000000000000000ull, 0, 1301, 0x00 },
+                { 0x0000000000000000ull, 0, 1302, 0x00 },
+                { 0x0000000000000000ull, 0, 1303, 0x00 },
+                { 0x0000000000000000ull, 0, 1304, 0x00 },
+                { 0x0000000000000000ull, 0, 1305, 0x00 },
+                { 0x0000000000000000ull, 0, 1306, 0x00 },
+                { 0x0000000000000000ull, 0, 1307, 0x00 },
+                { 0x0000000000000000ull, 0, 1308, 0x00 },
+                { 0x0000000000000000ull, 0, 1309, 0x00 },
+                { 0x0000000000000000ull, 0, 1310, 0x00 },
+                { 0x0000000000000000ull, 0, 1311, 0x00 },
+                { 0x0000000000000000ull, 0, 1312, 0x00 },
+                { 0x0000000000000000ull, 0, 1313, 0x00 },
+                { 0x0000000000000000ull, 0, 1314, 0x00 },
+                { 0x0000000000000000ull, 0, 1315, 0x00 },
+                { 0x0000000000000000ull, 0, 1316, 0x00 },
+                { 0x0000000000000000ull, 0, 1317, 0x00 },
+                { 0x0000000000000000ull, 0, 1318, 0x00 },
+                { 0x0000000000000000ull, 0, 1319, 0x00 },
+                { 0x0000000000000000ull, 0, 1320, 0x00 },
+                { 0x0000000000000000ull, 0, 1321, 0x00 },
+                { 0x0000000000000000ull, 0, 1322, 0x00 },
+                { 0x0000000000000000ull, 0, 1323, 0x00 },
+                { 0x0000000000000000ull, 0, 1324, 0x00 },
+                { 0x0000000000000000ull, 0, 1325, 0x00 },
+                { 0x0000000000000000ull, 0, 1326, 0x00 },
+                { 0x0000000000000000ull, 0, 1327, 0x00 },
+                { 0x0000000000000000ull, 0, 1328, 0x00 },
+                { 0x0000000000000000ull, 0, 1329, 0x00 },
+                { 0x0000000000000000ull, 0, 1330, 0x00 },
+                { 0x0000000000000000ull, 0, 1331, 0x00 },
+                { 0x0000000000000000ull, 0, 1332, 0x00 },
+                { 0x0000000000000000ull, 0, 1333, 0x00 },
+                { 0x0000000000000000ull, 0, 1334, 0x00 },
+                { 0x0000000000000000ull, 0, 1335, 0x00 },
+                { 0x0000000000000000ull, 0, 1336, 0x00 },
+                { 0x0000000000000000ull, 0, 1337, 0x00 },
+                { 0x0000000000000000ull, 0, 1338, 0x00 },
+                { 0x0000000000000000ull, 0, 1339, 0x00 },
+                { 0x0000000000000000ull, 0, 1340, 0x00 },
+                { 0x0000000000000000ull, 0, 1341, 0x00 },
+                { 0x0000000000000000ull, 0, 1342, 0x00 },
+                { 0x0000000000000000ull, 0, 1343, 0x00 },
+                { 0x0000000000000000ull, 0, 1344, 0x00 },
+                { 0x0000000000000000ull, 0, 1345, 0x00 },
+                { 0x0000000000000000ull, 0, 1346, 0x00 },
+                { 0x0000000000000000ull, 0, 1347, 0x00 },
+                { 0x0000000000000000ull, 0, 1348, 0x00 },
+                { 0x0000000000000000ull, 0, 1349, 0x00 },
+                { 0x0000000000000000ull, 0, 1350, 0x00 },
+                { 0x0000000000000000ull, 0, 1351, 0x00 },
+                { 0x0000000000000000ull, 0, 1352, 0x00 },
+                { 0x0000000000000000ull, 0, 1353, 0x00 },
+                { 0x0000000000000000ull, 0, 1354, 0x00 },
+                { 0x0000000000000000ull, 0, 1355, 0x00 },
+                { 0x0000000000000000ull, 0, 1356, 0x00 },
+                { 0x0000000000000000ull, 0, 1357, 0x00 },
+                { 0x0000000000000000ull, 0, 1358, 0x00 },
+                { 0x0000000000000000ull, 0, 1359, 0x00 },
+                { 0x0000000000000000ull, 0, 1360, 0x00 },
+                { 0x0000000000000000ull, 0, 1361, 0x00 },
+                { 0x0000000000000000ull, 0, 1362, 0x00 },
+                { 0x0000000000000000ull, 0, 1363, 0x00 },
+                { 0x0000000000000000ull, 0, 1364, 0x00 },
+                { 0x0000000000000000ull, 0, 1365, 0x00 },
+                { 0x0000000000000000ull, 0, 1366, 0x00 },
+                { 0x0000000000000000ull, 0, 1367, 0x00 },
+                { 0x0000000000000000ull, 0, 1368, 0x00 },
+                { 0x0000000000000000ull, 0, 1369, 0x00 },
+                { 0x0000000000000000ull, 0, 1370, 0x00 },
+                { 0x0000000000000000ull, 0, 1371, 0x00 },
+                { 0x0000000000000000ull, 0, 1372, 0x00 },
+                { 0x0000000000000000ull, 0, 1373, 0x00 },
+                { 0x0000000000000000ull, 0, 1374, 0x00 },
+                { 0x0000000000000000ull, 0, 1375, 0x00 },
+                { 0x0000000000000000ull, 0, 1376, 0x00 },
+                { 0x0000000000000000ull, 0, 1377, 0x00 },
+                { 0x0000000000000000ull, 0, 1378, 0x00 },
+                { 0x0000000000000000ull, 0, 1379, 0x00 },
+                { 0x0000000000000000ull, 0, 1380, 0x00 },
+                { 0x0000000000000000ull, 0, 1381, 0x00 },
+                { 0x0000000000000000ull, 0, 1382, 0x00 },
+                { 0x0000000000000000ull, 0, 1383, 0x00 },
+                { 0x0000000000000000ull, 0, 1384, 0x00 },
+                { 0x0000000000000000ull, 0, 1385, 0x00 },
+                { 0x0000000000000000ull, 0, 1386, 0x00 },
+                { 0x0000000000000000ull, 0, 1387, 0x00 },
+                { 0x0000000000000000ull, 0, 1388, 0x00 },
+                { 0x0000000000000000ull, 0, 1389, 0x00 },
+                { 0x0000000000000000ull, 0, 1390, 0x00 },
+                { 0x0000000000000000ull, 0, 1391, 0x00 },
+                { 0x0000000000000000ull, 0, 1392, 0x00 },
+                { 0x0000000000000000ull, 0, 1393, 0x00 },
+                { 0x0000000000000000ull, 0, 1394, 0x00 },
+                { 0x0000000000000000ull, 0, 1395, 0x00 },
+                { 0x0000000000000000ull, 0, 1396, 0x00 },
+                { 0x0000000000000000ull, 0, 1397, 0x00 },
+                { 0x0000000000000000ull, 0, 1398, 0x00 },
+                { 0x0000000000000000ull, 0, 1399, 0x00 },
+                { 0x0000000000000000ull, 0, 1400, 0x00 },
+                { 0x0000000000000000ull, 0, 1401, 0x00 },
+                { 0x0000000000000000ull, 0, 1402, 0x00 },
+                { 0x0000000000000000ull, 0, 1403, 0x00 },
+                { 0x0000000000000000ull, 0, 1404, 0x00 },
+                { 0x0000000000000000ull, 0, 1405, 0x00 },
+                { 0x0000000000000000ull, 0, 1406, 0x00 },
+                { 0x0000000000000000ull, 0, 1407, 0x00 },
+                { 0x0000000000000000ull, 0, 1408, 0x00 },
+                { 0x0000000000000000ull, 0, 1409, 0x00 },
+                { 0x0000000000000000ull, 0, 1410, 0x00 },
+                { 0x0000000000000000ull, 0, 1411, 0x00 },
+                { 0x0000000000000000ull, 0, 1412, 0x00 },
+                { 0x0000000000000000ull, 0, 1413, 0x00 },
+                { 0x0000000000000000ull, 0, 1414, 0x00 },
+                { 0x0000000000000000ull, 0, 1415, 0x00 },
+                { 0x0000000000000000ull, 0, 1416, 0x00 },
+                { 0x0000000000000000ull, 0, 1417, 0x00 },
+                { 0x0000000000000000ull, 0, 1418, 0x00 },
+                { 0x0000000000000000ull, 0, 1419, 0x00 },
+                { 0x0000000000000000ull, 0, 1420, 0x00 },
+                { 0x0000000000000000ull, 0, 1421, 0x00 },
+                { 0x0000000000000000ull, 0, 1422, 0x00 },
+                { 0x0000000000000000ull, 0, 1423, 0x00 },
+                { 0x0000000000000000ull, 0, 1424, 0x00 },
+                { 0x0000000000000000ull, 0, 1425, 0x00 },
+                { 0x0000000000000000ull, 0, 1426, 0x00 },
+                { 0x0000000000000000ull, 0, 1427, 0x00 },
+                { 0x0000000000000000ull, 0, 1428, 0x00 },
+                { 0x0000000000000000ull, 0, 1429, 0x00 },
+                { 0x0000000000000000ull, 0, 1430, 0x00 },
+                { 0x0000000000000000ull, 0, 1431, 0x00 },
+                { 0x0000000000000000ull, 0, 1432, 0x00 },
+                { 0x0000000002000000ull, 1896, 0, 0x80 },
+                { 0x0000000002000000ull, 1897, 0, 0x80 },
+                { 0x0000000002000000ull, 1898, 0, 0x80 },
+                { 0x0000000000000001ull, 1899, 0, 0x80 },
+                { 0x0000000000000001ull, 1900, 0, 0x80 },
+                { 0x0000000000000001ull, 1901, 0, 0x80 },
+                { 0x0000000034000000ull, 1902, 0, 0x80 },
+                { 0x0000000080000000ull, 1905, 0, 0x80 },
+                { 0x0000000034000000ull, 1906, 0, 0x80 },
+                { 0x0000000080000000ull, 1909, 0, 0x80 },
+                { 0x0000000002000000ull, 1910, 0, 0x80 },
+                { 0x0000000002000000ull, 1911, 0, 0x80 },
+                { 0x0000000002000000ull, 1912, 0, 0x80 },
+                { 0x0000000002000000ull, 1913, 0, 0x80 },
+                { 0x0000000002000000ull, 1914, 0, 0x80 },
+                { 0x0000000002000000ull, 1915, 0, 0x80 },
+                { 0x0000000002000000ull, 1916, 0, 0x80 },
+                { 0x0000000002000000ull, 1917, 0, 0x80 },
+                { 0x0000000002000000ull, 1918, 0, 0x80 },
+                { 0x0000000000000001ull, 1919, 0, 0x80 },
+                { 0x0000000002000000ull, 1920, 0, 0x80 },
+                { 0x0000000002000000ull, 1921, 0, 0x80 },
+                { 0x0000000002000000ull, 1922, 0, 0x80 },
+                { 0x0000000002000000ull, 1923, 0, 0x80 },
+                { 0x0000000002000000ull, 1924, 0, 0x80 },
+                { 0x0000000002000000ull, 1925, 0, 0x80 },
+                { 0x0000000002000000ull, 1926, 0, 0x80 },
+                { 0x0000000002000000ull, 1927, 0, 0x80 },
+                { 0x0000000002000000ull, 1928, 0, 0x80 },
+                { 0x0000000002000000ull, 1929, 0, 0x80 },
+                { 0x0000000002000000ull, 1930, 0, 0x80 },
+                { 0x0000000002000000ull, 1931, 0, 0x80 },
+                { 0x0000000002000000ull, 1932, 0, 0x80 },
+                { 0x0000000002000000ull, 1933, 0, 0x80 },
+                { 0x0000000002000000ull, 1934, 0, 0x80 },
+                { 0x0000000002000000ull, 1935, 0, 0x80 },
+                { 0x0000000002000000ull, 1936, 0, 0x80 },
+                { 0x0000000400000000ull, 1937, 0, 0xC0 },
+                { 0x0000000000000001ull, 1938, 0, 0x80 },
+                { 0x0000000000000001ull, 1939, 0, 0x80 },
+                { 0x0000000000000001ull, 1940, 0, 0x80 },
+                { 0x0000000000002000ull, 1941, 0, 0x80 },
+                { 0x0000000000002000ull, 1942, 0, 0x80 },
+                { 0x0000000000002000ull, 1943, 0, 0x80 },
+                { 0x0000000000600000ull, 1944, 0, 0x80 },
+                { 0x0000000000000100ull, 1946, 0, 0x80 },
+                { 0x0000001000000000ull, 1947, 0, 0x80 },
+                { 0x000000000416F000ull, 1948, 0, 0x80 },
+                { 0x0000000000600000ull, 1956, 0, 0x80 },
+                { 0x0000000000000100ull, 1958, 0, 0x80 },
+                { 0x0000001000000000ull, 1959, 0, 0x80 },
+                { 0x000000000416F000ull, 1960, 0, 0x80 },
+                { 0x0000000000000001ull, 1968, 0, 0x80 },
+                { 0x0000000000000004ull, 1969, 0, 0x80 },
+                { 0x0000000000000001ull, 1970, 0, 0x80 },
+                { 0x0000000000000001ull, 1971, 0, 0x80 },
+                { 0x0000000000000001ull, 1972, 0, 0x80 },
+                { 0x0000000000000004ull, 1973, 0, 0x80 },
+                { 0x0000000000000001ull, 1974, 0, 0x80 },
+                { 0x0000000000000004ull, 1975, 0, 0x80 },
+                { 0x0000000000000004ull, 1976, 0, 0x80 },
+                { 0x0000000000002000ull, 1977, 0, 0x80 },
+                { 0x0000000000000004ull, 1978, 0, 0x80 },
+                { 0x0000000000000004ull, 1979, 0, 0x80 },
+                { 0x0000000000000001ull, 1980, 0, 0x80 },
+                { 0x0000000000000004ull, 1981, 0, 0x80 },
+                { 0x0000000000000004ull, 1982, 0, 0x80 },
+                { 0x0000000000000004ull, 1983, 0, 0x80 },
+                { 0x0000000000000001ull, 1984, 0, 0x80 },
+                { 0x0000000000000001ull, 1985, 0, 0x80 },
+                { 0x0000000000000001ull, 1986, 0, 0x80 },
+                { 0x0000000000000001ull, 1987, 0, 0x80 },
+                { 0x0000000000000001ull, 1988, 0, 0x80 },
+                { 0x0000000000000004ull, 1989, 0, 0x80 },
+                { 0x0000000000000005ull, 1990, 0, 0x80 },
+                { 0x0000000000000005ull, 1992, 0, 0x80 },
+                { 0x0000000000000005ull, 1994, 0, 0x80 },
+                { 0x0000000000000005ull, 1996, 0, 0x80 },
+                { 0x0000000000000005ull, 1998, 0, 0x80 },
+                { 0x0000000002000000ull, 2000, 0, 0x80 },
+                { 0x0000800000000000ull, 2001, 251, 0xC0 },
+                { 0x0000800000000000ull, 2002, 264, 0xC0 },
+                { 0x0000800000000000ull, 2003, 268, 0xC0 },
+                { 0x0000000400000000ull, 2004, 0, 0xC0 },
+                { 0x0000000400000000ull, 2005, 0, 0xC0 },
+                { 0x0001000000000000ull, 2006, 0, 0xC0 },
+                { 0x0000800000000000ull, 2007, 193, 0xC0 },
+                { 0x0000800000000000ull, 2008, 199, 0xC0 },
+                { 0x0000800000000000ull, 2009, 219, 0xC0 },
+                { 0x0000800000000000ull, 2010, 0, 0xC0 },
+                { 0x4000000000000000ull, 2011, 0, 0x80 },
+                { 0x0008000000000000ull, 2012, 0, 0x80 },
+                { 0x0000011000080000ull, 2013, 0, 0x80 },
+                { 0x0000280000000000ull, 2016, 0, 0x80 },
+                { 0x000003C000000000ull, 2018, 0, 0x80 },
+                { 0x1800000000000000ull, 2022, 0, 0x80 },
+                { 0x0000108000000000ull, 2024, 0, 0x80 },
+                { 0x0000000000040001ull, 2026, 0, 0x80 },
+                { 0x0000800000000000ull, 2028, 194, 0xC0 },
+                { 0x0000800000000000ull, 2029, 200, 0xC0 },
+                { 0x0000800000000000ull, 2030, 220, 0xC0 },
+                { 0x0000800000000000ull, 2031, 0, 0xC0 },
+                { 0x4000000000000000ull, 2032, 0, 0x80 },
+                { 0x0008000000000000ull, 2033, 0, 0x80 },
+                { 0x0000011000080000ull, 2034, 0, 0x80 },
+                { 0x0000280000000000ull, 2037, 0, 0x80 },
+                { 0x000002C000000000ull, 2039, 0, 0x80 },
+                { 0x1800000000000000ull, 2042, 0, 0x80 },
+                { 0x0000108000000000ull, 2044, 0, 0x80 },
+                { 0x0000000000040001ull, 2046, 0, 0x80 },
+                { 0x0000800000000000ull, 2048, 226, 0xC0 },
+                { 0x0000800000000000ull, 2049, 256, 0xC0 },
+                { 0x0000800000000000ull, 2050, 172, 0xC0 },
+                { 0x0000800000000000ull, 2051, 236, 0xC0 },
+                { 0x0000800000000000ull, 2052, 232, 0xC0 },
+                { 0x0000800000000000ull, 2053, 184, 0xC0 },
+                { 0x0000800000000000ull, 2054, 230, 0xC0 },
+                { 0x0000800000000000ull, 2055, 245, 0xC0 },
+                { 0x0000800000000000ull, 2056, 247, 0xC0 },
+                { 0x0000000400000000ull, 2057, 0, 0xC0 },
+                { 0x0000800000000000ull, 2058, 180, 0xC0 },
+                { 0x0000800000000000ull, 2059, 182, 0xC0 },
+                { 0x0000800000000000ull, 2060, 188, 0xC0 },
+                { 0x0000800000000000ull, 2061, 186, 0xC0 },
+                { 0x0000800000000000ull, 2062, 176, 0xC0 },
+                { 0x0000800000000000ull, 2063, 178, 0xC0 },
+                { 0x0000800000000000ull, 2064, 266, 0xC0 },
+                { 0x0000800000000000ull, 2065, 274, 0xC0 },
+                { 0x0000800000000000ull, 2066, 276, 0xC0 },
+                { 0x0000800000000000ull, 2067, 249, 0xC0 },
+                { 0x0000800000000000ull, 2068, 190, 0xC0 },
+                { 0x0000800000000000ull, 2069, 192, 0xC0 },
+                { 0x0000800000000000ull, 2070, 278, 0xC0 },
+                { 0x0000800000000000ull, 2071, 277, 0xC0 },
+                { 0x0000800000000000ull, 2072, 286, 0xC0 },
+                { 0x0000800000000000ull, 2073, 285, 0xC0 },
+                { 0x0000800000000000ull, 2074, 280, 0xC0 },
+                { 0x0000800000000000ull, 2075, 279, 0xC0 },
+                { 0x0000800000000000ull, 2076, 282, 0xC0 },
+                { 0x0000800000000000ull, 2077, 281, 0xC0 },
+                { 0x0000800000000000ull, 2078, 284, 0xC0 },
+                { 0x0000800000000000ull, 2079, 283, 0xC0 },
+                { 0x0000000000000001ull, 2080, 0, 0x80 },
+                { 0x0100000000000000ull, 2081, 0, 0x80 },
+                { 0x0100000000000000ull, 2082, 0, 0x80 },
+                { 0x0100000000000000ull, 2083, 0, 0x80 },
+                { 0x0000000002000000ull, 2084, 0, 0x80 },
+                { 0x0000000002000000ull, 2085, 0, 0x80 },
+                { 0x0000000080000000ull, 2086, 0, 0x80 },
+                { 0x0100000000000000ull, 2087, 0, 0x80 },
+                { 0x0100000000000000ull, 2088, 0, 0x80 },
+                { 0x0100000000000000ull, 2089, 0, 0x80 },
+                { 0x0100000000000000ull, 2090, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 201, 0x00 },
+                { 0x0000000000000000ull, 0, 203, 0x00 },
+                { 0x0000000000000000ull, 0, 195, 0x00 },
+                { 0x0000000000000000ull, 0, 215, 0x00 },
+                { 0x0000000000000000ull, 0, 217, 0x00 },
+                { 0x0000000000000000ull, 0, 197, 0x00 },
+                { 0x0000000000000000ull, 0, 207, 0x00 },
+                { 0x0000000400000000ull, 2091, 312, 0xC0 },
+                { 0x0000000400000000ull, 2092, 314, 0xC0 },
+                { 0x0000000400000000ull, 2093, 0, 0xC0 },
+                { 0x0000000400000000ull, 2094, 0, 0xC0 },
+                { 0x0000000000000000ull, 0, 213, 0x00 },
+                { 0x0000000000000000ull, 0, 209, 0x00 },
+                { 0x0000000000000000ull, 0, 205, 0x00 },
+                { 0x0000000000000000ull, 0, 211, 0x00 },
+                { 0x0000000000000000ull, 0, 221, 0x00 },
+                { 0x0000000000000000ull, 0, 223, 0x00 },
+                { 0x0100000000000000ull, 2095, 0, 0x80 },
+                { 0x0100000000000000ull, 2096, 0, 0x80 },
+                { 0x0100000000000000ull, 2097, 0, 0x80 },
+                { 0x0100000000000000ull, 2098, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 202, 0x00 },
+                { 0x0000000000000000ull, 0, 204, 0x00 },
+                { 0x0000000000000000ull, 0, 196, 0x00 },
+                { 0x0000000000000000ull, 0, 216, 0x00 },
+                { 0x0000000000000000ull, 0, 218, 0x00 },
+                { 0x0000000000000000ull, 0, 198, 0x00 },
+                { 0x0000000000000000ull, 0, 208, 0x00 },
+                { 0x0000000400000000ull, 2099, 317, 0xC0 },
+                { 0x0000000400000000ull, 2100, 319, 0xC0 },
+                { 0x0000000400000000ull, 2101, 0, 0xC0 },
+                { 0x0000000000000000ull, 0, 214, 0x00 },
+                { 0x0000000000000000ull, 0, 210, 0x00 },
+                { 0x0000000000000000ull, 0, 206, 0x00 },
+                { 0x0000000000000000ull, 0, 212, 0x00 },
+                { 0x0000000000000000ull, 0, 222, 0x00 },
+                { 0x0000000000000000ull, 0, 224, 0x00 },
+                { 0x0100000000000000ull, 2102, 0, 0x80 },
+                { 0x0100000000000000ull, 2103, 0, 0x80 },
+                { 0x0100000000000000ull, 2104, 0, 0x80 },
+                { 0x0100000000000000ull, 2105, 0, 0x80 },
+                { 0x0100000000000000ull, 2106, 0, 0x80 },
+                { 0x0100000000000000ull, 2107, 0, 0x80 },
+                { 0x0100000000000000ull, 2108, 0, 0x80 },
+                { 0x0100000000000000ull, 2109, 0, 0x80 },
+                { 0x0100000000000000ull, 2110, 0, 0x80 },
+                { 0x0000000002000000ull, 2111, 0, 0x80 },
+                { 0x0100000000000000ull, 2112, 0, 0x80 },
+                { 0x0100000000000000ull, 2113, 0, 0x80 },
+                { 0x0100000000000000ull, 2114, 0, 0x80 },
+                { 0x0100000000000000ull, 2115, 0, 0x80 },
+                { 0x0100000000000000ull, 2116, 0, 0x80 },
+                { 0x0100000000000000ull, 2117, 0, 0x80 },
+                { 0x0100000000000000ull, 2118, 0, 0x80 },
+                { 0x0100000000000000ull, 2119, 0, 0x80 },
+                { 0x0100000000000000ull, 2120, 0, 0x80 },
+                { 0x0100000000000000ull, 2121, 0, 0x80 },
+                { 0x0100000000000000ull, 2122, 0, 0x80 },
+                { 0x0100000000000000ull, 2123, 0, 0x80 },
+                { 0x0100000000000000ull, 2124, 0, 0x80 },
+                { 0x0100000000000000ull, 2125, 0, 0x80 },
+                { 0x0100000000000000ull, 2126, 0, 0x80 },
+                { 0x0100000000000000ull, 2127, 0, 0x80 },
+                { 0x0100000000000000ull, 2128, 0, 0x80 },
+                { 0x0100000000000000ull, 2129, 0, 0x80 },
+                { 0x0100000000000000ull, 2130, 0, 0x80 },
+                { 0x0100000000000000ull, 2131, 0, 0x80 },
+                { 0x0100000000000000ull, 2132, 0, 0x80 },
+                { 0x0100000000000000ull, 2133, 0, 0x80 },
+                { 0x0000800000000000ull, 2134, 270, 0xC0 },
+                { 0x0000000000008000ull, 2135, 0, 0x80 },
+                { 0x0000000000008000ull, 2136, 0, 0x80 },
+                { 0x0000000000008000ull, 2137, 0, 0x80 },
+                { 0x0000000000000001ull, 2138, 0, 0x80 },
+                { 0x0000000000000001ull, 2139, 0, 0x80 },
+                { 0x0000000000001000ull, 2140, 0, 0x80 },
+                { 0x0000000000008000ull, 2141, 0, 0x80 },
+                { 0x0000000000008000ull, 2142, 0, 0x80 },
+                { 0x0000000000008000ull, 2143, 0, 0x80 },
+                { 0x0000000000008000ull, 2144, 0, 0x80 },
+                { 0x0000000000000001ull, 2145, 0, 0x80 },
+                { 0x0000000000000001ull, 2146, 0, 0x80 },
+                { 0x0000000000000001ull, 2147, 0, 0x80 },
+                { 0x0000000000000001ull, 2148, 0, 0x80 },
+                { 0x0000000000008000ull, 2149, 0, 0x80 },
+                { 0x0000000000008000ull, 2150, 0, 0x80 },
+                { 0x0000000000008000ull, 2151, 0, 0x80 },
+                { 0x0000000000008000ull, 2152, 0, 0x80 },
+                { 0x0000000000000001ull, 2153, 0, 0x80 },
+                { 0x0000000000000001ull, 2154, 0, 0x80 },
+                { 0x0000000000000001ull, 2155, 0, 0x80 },
+                { 0x0000000000008000ull, 2156, 0, 0x80 },
+                { 0x0000000000008000ull, 2157, 0, 0x80 },
+                { 0x0000000000008000ull, 2158, 0, 0x80 },
+                { 0x0000000000008000ull, 2159, 0, 0x80 },
+                { 0x0000000000008000ull, 2160, 0, 0x80 },
+                { 0x0000000000008000ull, 2161, 0, 0x80 },
+                { 0x0000000000008000ull, 2162, 0, 0x80 },
+                { 0x0000000000008000ull, 2163, 0, 0x80 },
+                { 0x0000000000008000ull, 2164, 0, 0x80 },
+                { 0x0000000000000001ull, 2165, 0, 0x80 },
+                { 0x0000000000008000ull, 2166, 0, 0x80 },
+                { 0x0000000000008000ull, 2167, 0, 0x80 },
+                { 0x0000000000008000ull, 2168, 0, 0x80 },
+                { 0x0000000000008000ull, 2169, 0, 0x80 },
+                { 0x0000000000008000ull, 2170, 0, 0x80 },
+                { 0x0000000000008000ull, 2171, 0, 0x80 },
+                { 0x0000000000008000ull, 2172, 0, 0x80 },
+                { 0x0000000000008000ull, 2173, 0, 0x80 },
+                { 0x0000000000008000ull, 2174, 0, 0x80 },
+                { 0x0000000000008000ull, 2175, 0, 0x80 },
+                { 0x0000000000008000ull, 2176, 0, 0x80 },
+                { 0x0000000000008000ull, 2177, 0, 0x80 },
+                { 0x0000000000008000ull, 2178, 0, 0x80 },
+                { 0x0000000000008000ull, 2179, 0, 0x80 },
+                { 0x0000000000008000ull, 2180, 0, 0x80 },
+                { 0x0000000000008000ull, 2181, 0, 0x80 },
+                { 0x0000000000008000ull, 2182, 0, 0x80 },
+                { 0x0000000000008000ull, 2183, 0, 0x80 },
+                { 0x0000000000008000ull, 2184, 0, 0x80 },
+                { 0x0000000000008000ull, 2185, 0, 0x80 },
+                { 0x0000000000008000ull, 2186, 0, 0x80 },
+                { 0x0000000000008000ull, 2187, 0, 0x80 },
+                { 0x0100000000000000ull, 2188, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 251, 0x00 },
+                { 0x0000000000000000ull, 0, 264, 0x00 },
+                { 0x0000000000000000ull, 0, 268, 0x00 },
+                { 0x0000800000000000ull, 2189, 272, 0xC0 },
+                { 0x0000800000000000ull, 2190, 262, 0xC0 },
+                { 0x0000000000000100ull, 2191, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 193, 0x00 },
+                { 0x0000000000000000ull, 0, 199, 0x00 },
+                { 0x0000000000000000ull, 0, 219, 0x00 },
+                { 0x0000000400000000ull, 2192, 0, 0xC0 },
+                { 0x0000000000002000ull, 2193, 0, 0x80 },
+                { 0x0000000000002000ull, 2194, 0, 0x80 },
+                { 0x0000000000002000ull, 2195, 0, 0x80 },
+                { 0x0000000000002000ull, 2196, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 194, 0x00 },
+                { 0x0000000000000000ull, 0, 200, 0x00 },
+                { 0x0000000000000000ull, 0, 220, 0x00 },
+                { 0x0000000400000000ull, 2197, 0, 0xC0 },
+                { 0x0000000000002000ull, 2198, 0, 0x80 },
+                { 0x0000000000002000ull, 2199, 0, 0x80 },
+                { 0x0000000000002000ull, 2200, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 226, 0x00 },
+                { 0x0000000000000000ull, 0, 256, 0x00 },
+                { 0x0000000000000000ull, 0, 172, 0x00 },
+                { 0x0000000000000000ull, 0, 236, 0x00 },
+                { 0x0000000000000000ull, 0, 232, 0x00 },
+                { 0x0000000000000000ull, 0, 184, 0x00 },
+                { 0x0000000000000000ull, 0, 230, 0x00 },
+                { 0x0000000000000000ull, 0, 245, 0x00 },
+                { 0x0000000000000000ull, 0, 247, 0x00 },
+                { 0x0000800000000000ull, 2201, 228, 0xC0 },
+                { 0x0000000000000000ull, 0, 180, 0x00 },
+                { 0x0000000000000000ull, 0, 182, 0x00 },
+                { 0x0000000000000000ull, 0, 188, 0x00 },
+                { 0x0000000000000000ull, 0, 186, 0x00 },
+                { 0x0000000000000000ull, 0, 176, 0x00 },
+                { 0x0000000000000000ull, 0, 178, 0x00 },
+                { 0x0000000000000000ull, 0, 266, 0x00 },
+                { 0x0000000000000000ull, 0, 274, 0x00 },
+                { 0x0000000000000000ull, 0, 276, 0x00 },
+                { 0x0000000000000000ull, 0, 249, 0x00 },
+                { 0x0000000000000000ull, 0, 190, 0x00 },
+                { 0x0000000000000000ull, 0, 192, 0x00 },
+                { 0x0000000000000000ull, 0, 278, 0x00 },
+                { 0x0000000000000000ull, 0, 277, 0x00 },
+                { 0x0000000000000000ull, 0, 286, 0x00 },
+                { 0x0000000000000000ull, 0, 285, 0x00 },
+                { 0x0000000000000000ull, 0, 280, 0x00 },
+                { 0x0000000000000000ull, 0, 279, 0x00 },
+                { 0x0000000000000000ull, 0, 282, 0x00 },
+                { 0x0000000000000000ull, 0, 281, 0x00 },
+                { 0x0000000000000000ull, 0, 284, 0x00 },
+                { 0x0000000000000000ull, 0, 283, 0x00 },
+                { 0x0000000000008000ull, 2202, 0, 0x80 },
+                { 0x0100000000000000ull, 2203, 0, 0x80 },
+                { 0x0100000000000000ull, 2204, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 1185, 0x00 },
+                { 0x0000000000000001ull, 2205, 0, 0x80 },
+                { 0x0001000000000000ull, 2206, 0, 0xC0 },
+                { 0x0001000000000000ull, 2207, 0, 0xC0 },
+                { 0x0001000000000000ull, 2208, 0, 0xC0 },
+                { 0x0001000000000000ull, 2209, 0, 0xC0 },
+                { 0x0000000000000001ull, 2210, 0, 0x80 },
+                { 0x0001000000000000ull, 2211, 0, 0xC0 },
+                { 0x0001000000000000ull, 2212, 0, 0xC0 },
+                { 0x0001000000000000ull, 2213, 0, 0xC0 },
+                { 0x0100000000000000ull, 2214, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 270, 0x00 },
+                { 0x0000000000008000ull, 2215, 0, 0x80 },
+                { 0x0000000000008000ull, 2216, 0, 0x80 },
+                { 0x0000000000002000ull, 2217, 0, 0x80 },
+                { 0x0000000080000000ull, 2218, 0, 0x80 },
+                { 0x0000000080000000ull, 2219, 0, 0x80 },
+                { 0x0000000080000000ull, 2220, 0, 0x80 },
+                { 0x0000000080000000ull, 2221, 0, 0x80 },
+                { 0x0000000000002000ull, 2222, 0, 0x80 },
+                { 0x0000000080000000ull, 2223, 0, 0x80 },
+                { 0x0000000080000000ull, 2224, 0, 0x80 },
+                { 0x0000000080000000ull, 2225, 0, 0x80 },
+                { 0x0000000000008000ull, 2226, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 272, 0x00 },
+                { 0x0000000000000000ull, 0, 262, 0x00 },
+                { 0x0001000000000000ull, 2227, 0, 0xC0 },
+                { 0x0000000000020000ull, 2228, 0, 0x80 },
+                { 0x0000000000020000ull, 2229, 0, 0x80 },
+                { 0x0000000000020000ull, 2230, 0, 0x80 },
+                { 0x0000000000020000ull, 2231, 0, 0x80 },
+                { 0x0001000000000000ull, 2232, 0, 0xC0 },
+                { 0x0000000000020000ull, 2233, 0, 0x80 },
+                { 0x0000000000020000ull, 2234, 0, 0x80 },
+                { 0x0000000000020000ull, 2235, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 228, 0x00 },
+                { 0x0000000080000000ull, 2236, 0, 0x80 },
+                { 0x0000004000000000ull, 2237, 0, 0x80 },
+                { 0x000000C000000000ull, 2238, 0, 0x80 },
+                { 0x000000C000000000ull, 2240, 0, 0x80 },
+                { 0x000000C000000000ull, 2242, 0, 0x80 },
+                { 0x0000000080000000ull, 2244, 0, 0x80 },
+                { 0x0000004000000000ull, 2245, 0, 0x80 },
+                { 0x000000C000000000ull, 2246, 0, 0x80 },
+                { 0x000000C000000000ull, 2248, 0, 0x80 },
+                { 0x0000000000060000ull, 2250, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 313, 0x00 },
+                { 0x0000000000000000ull, 0, 315, 0x00 },
+                { 0x0000000000000000ull, 0, 316, 0x00 },
+                { 0x0000000400000000ull, 2252, 302, 0xC0 },
+                { 0x0000000400000000ull, 2253, 303, 0xC0 },
+                { 0x0000000400000000ull, 2254, 0, 0xC0 },
+                { 0x0000000400000000ull, 2255, 298, 0xC0 },
+                { 0x0000000000060000ull, 2256, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 318, 0x00 },
+                { 0x0000000000000000ull, 0, 320, 0x00 },
+                { 0x0000000000000000ull, 0, 321, 0x00 },
+                { 0x0000000400000000ull, 2258, 307, 0xC0 },
+                { 0x0000000400000000ull, 2259, 308, 0xC0 },
+                { 0x0000010000000000ull, 2260, 0, 0x80 },
+                { 0x0000000000000800ull, 2261, 0, 0x80 },
+                { 0x0000000000000001ull, 2262, 0, 0x80 },
+                { 0x0000000000000001ull, 2263, 0, 0x80 },
+                { 0x0000000000000001ull, 2264, 0, 0x80 },
+                { 0x0000000000000001ull, 2265, 0, 0x80 },
+                { 0x0000020000000000ull, 2266, 0, 0x80 },
+                { 0x0000000000000800ull, 2267, 0, 0x80 },
+                { 0x0000000000000001ull, 2268, 0, 0x80 },
+                { 0x0000000000000001ull, 2269, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 296, 0x00 },
+                { 0x0000000400000000ull, 2270, 0, 0xC0 },
+                { 0x0000000000002000ull, 2271, 0, 0x80 },
+                { 0x0000000000002000ull, 2272, 0, 0x80 },
+                { 0x0000000000002000ull, 2273, 0, 0x80 },
+                { 0x0000000000002000ull, 2274, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 297, 0x00 },
+                { 0x0000000400000000ull, 2275, 0, 0xC0 },
+                { 0x0000000000002000ull, 2276, 0, 0x80 },
+                { 0x0000000000002000ull, 2277, 0, 0x80 },
+                { 0x0000000000000001ull, 2278, 0, 0x80 },
+                { 0x0001000000000000ull, 2279, 0, 0xC0 },
+                { 0x0001000000000000ull, 2280, 0, 0xC0 },
+                { 0x0001000000000000ull, 2281, 0, 0xC0 },
+                { 0x0001000000000000ull, 2282, 0, 0xC0 },
+                { 0x0000000000000001ull, 2283, 0, 0x80 },
+                { 0x0001000000000000ull, 2284, 0, 0xC0 },
+                { 0x0001000000000000ull, 2285, 0, 0xC0 },
+                { 0x0000000000002000ull, 2286, 0, 0x80 },
+                { 0x0000000080000000ull, 2287, 0, 0x80 },
+                { 0x0000000080000000ull, 2288, 0, 0x80 },
+                { 0x0000000080000000ull, 2289, 0, 0x80 },
+                { 0x0000000080000000ull, 2290, 0, 0x80 },
+                { 0x0000000000002000ull, 2291, 0, 0x80 },
+                { 0x0000000080000000ull, 2292, 0, 0x80 },
+                { 0x0000000080000000ull, 2293, 0, 0x80 },
+                { 0x0001000000000000ull, 2294, 0, 0xC0 },
+                { 0x0000000000020000ull, 2295, 0, 0x80 },
+                { 0x0000000000020000ull, 2296, 0, 0x80 },
+                { 0x0000000000020000ull, 2297, 0, 0x80 },
+                { 0x0000000000020000ull, 2298, 0, 0x80 },
+                { 0x0001000000000000ull, 2299, 0, 0xC0 },
+                { 0x0000000000020000ull, 2300, 0, 0x80 },
+                { 0x0000000000020000ull, 2301, 0, 0x80 },
+                { 0x0000000080000000ull, 2302, 0, 0x80 },
+                { 0x0000004000000000ull, 2303, 0, 0x80 },
+                { 0x000000C000000000ull, 2304, 0, 0x80 },
+                { 0x0000004000000000ull, 2306, 0, 0x80 },
+                { 0x000000C000000000ull, 2307, 0, 0x80 },
+                { 0x0000000080000000ull, 2309, 0, 0x80 },
+                { 0x0000004000000000ull, 2310, 0, 0x80 },
+                { 0x000000C000000000ull, 2311, 0, 0x80 },
+                { 0x0000000000020000ull, 2313, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 305, 0x00 },
+                { 0x0000000000000000ull, 0, 304, 0x00 },
+                { 0x0000000000000000ull, 0, 306, 0x00 },
+                { 0x0000000000000000ull, 0, 300, 0x00 },
+                { 0x0000000000000000ull, 0, 299, 0x00 },
+                { 0x0000000000000000ull, 0, 301, 0x00 },
+                { 0x0000000000020000ull, 2314, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 310, 0x00 },
+                { 0x0000000000000000ull, 0, 309, 0x00 },
+                { 0x0000000000000000ull, 0, 311, 0x00 },
+                { 0x0000010000000000ull, 2315, 0, 0x80 },
+                { 0x0000020000000000ull, 2316, 0, 0x80 },
+                { 0x0000000000000000ull, 0, 293, 0x00 },
+                { 0x0000000000000000ull, 0, 294, 0x00 },
+            };
+        };
+
+        template<class T> constexpr std::size_t EmojiTables<T>::count;
+        template<class T> constexpr std::size_t EmojiTables<T>::groups;
+        template<class T> constexpr char EmojiTables<T>::bytes[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::offsets[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::lengths[];
+        template<class T> constexpr char EmojiTables<T>::names[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::nameOffsets[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::nameLengths[];
+        template<class T> constexpr std::size_t EmojiTables<T>::longestName;
+        template<class T> constexpr char EmojiTables<T>::text[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::textOffsets[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::textLengths[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::group[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::version[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::width[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::groupStart[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::byVersion[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::byWidth[];
+        template<class T> constexpr std::size_t EmojiTables<T>::narrow;
+        template<class T> constexpr std::size_t EmojiTables<T>::buckets;
+        template<class T> constexpr std::uint16_t EmojiTables<T>::pilots[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::slots[];
+        template<class T> constexpr std::size_t EmojiTables<T>::longestEmoji;
+        template<class T> constexpr std::uint16_t EmojiTables<T>::reverseRoot[];
+        template<class T> constexpr ReverseNode EmojiTables<T>::reverseNodes[];
+
+        using EmojiTable = EmojiTables<>;
+
+    } /* namespace detail */
+
+    namespace Emoji {
+
+        // The table index of every emoji, by the name of its constant
+        enum class Id : std::uint16_t {
+            // Smileys & Emotion
+            grinning,
+            smiley,
+            smile,
+            grin,
+            laughing,
+            sweat_smile,
+            rofl,
+            joy,
+            slightly_smiling_face,
+            upside_down_face,
+            wink,
+            blush,
+            innocent,
+            heart_eyes,
+            kissing_heart,
+            kissing,
+            relaxed,
+            kissing_closed_eyes,
+            kissing_smiling_eyes,
+            yum,
+            stuck_out_tongue,
+            stuck_out_tongue_winking_eye,
+            stuck_out_tongue_closed_eyes,
+            money_mouth_face,
+            hugs,
+            thinking,
+            zipper_mouth_face,
+            neutral_face,
+            expressionless,
+            no_mouth,
+            smirk,
+            unamused,
+            roll_eyes,
+            grimacing,
+            lying_face,
+            relieved,
+            pensive,
+            sleepy,
+            drooling_face,
+            sleeping,
+            mask,
+            face_with_thermometer,
+            face_with_head_bandage,
+            nauseated_face,
+            sneezing_face,
+            dizzy_face,
+            cowboy_hat_face,
+            sunglasses,
+            nerd_face,
+            confused,
+            worried,
+            slightly_frowning_face,
+            frowning_face,
+            open_mouth,
+            hushed,
+            astonished,
+            flushed,
+            frowning,
+            anguished,
+            fearful,
+            cold_sweat,
+            disappointed_relieved,
+            cry,
+            sob,
+            scream,
+            confounded,
+            persevere,
+            disappointed,
+            sweat,
+            weary,
+            tired_face,
+            triumph,
+            rage,
+            angry,
+            smiling_imp,
+            imp,
+            skull,
+            skull_and_crossbones,
+            poop,
+            clown_face,
+            japanese_ogre,
+            japanese_goblin,
+            ghost,
+            alien,
+            space_invader,
+            robot,
+            smiley_cat,
+            smile_cat,
+            joy_cat,
+            heart_eyes_cat,
+            smirk_cat,
+            kissing_cat,
+            scream_cat,
+            crying_cat_face,
+            pouting_cat,
+            see_no_evil,
+            hear_no_evil,
+            speak_no_evil,
+            love_letter,
+            cupid,
+            gift_heart,
+            sparkling_heart,
+            heartpulse,
+            heartbeat,
+            revolving_hearts,
+            two_hearts,
+            heart_decoration,
+            heavy_heart_exclamation,
+            broken_heart,
+            heart,
+            yellow_heart,
+            green_heart,
+            blue_heart,
+            purple_heart,
+            black_heart,
+            kiss,
+            one_hundred,
+            anger,
+            boom,
+            dizzy,
+            sweat_drops,
+            dash,
+            hole,
+            speech_balloon,
+            left_speech_bubble,
+            right_anger_bubble,
+            thought_balloon,
+            zzz,
+
+            // People & Body
+            wave,
+            raised_back_of_hand,
+            raised_hand_with_fingers_splayed,
+            raised_hand,
+            vulcan_salute,
+            ok_hand,
+            v,
+            crossed_fingers,
+            metal,
+            call_me_hand,
+            point_left,
+            point_right,
+            point_up_2,
+            fu,
+            point_down,
+            point_up,
+            plus_one,
+            minus_one,
+            fist,
+            facepunch,
+            fist_left,
+            fist_right,
+            clap,
+            raised_hands,
+            open_hands,
+            handshake,
+            pray,
+            writing_hand,
+            nail_care,
+            selfie,
+            muscle,
+            ear,
+            nose,
+            eyes,
+            eye,
+            tongue,
+            lips,
+            baby,
+            boy,
+            girl,
+            blonde_man,
+            man,
+            woman,
+            blonde_woman,
+            older_man,
+            older_woman,
+            frowning_woman,
+            frowning_man,
+            pouting_woman,
+            pouting_man,
+            no_good_woman,
+            no_good_man,
+            ok_woman,
+            ok_man,
+            tipping_hand_woman,
+            tipping_hand_man,
+            raising_hand_woman,
+            raising_hand_man,
+            bowing_man,
+            bowing_woman,
+            man_facepalming,
+            woman_facepalming,
+            woman_shrugging,
+            man_shrugging,
+            man_health_worker,
+            woman_health_worker,
+            man_student,
+            woman_student,
+            man_teacher,
+            woman_teacher,
+            man_judge,
+            woman_judge,
+            man_farmer,
+            woman_farmer,
+            man_cook,
+            woman_cook,
+            man_mechanic,
+            woman_mechanic,
+            man_factory_worker,
+            woman_factory_worker,
+            man_office_worker,
+            woman_office_worker,
+            man_scientist,
+            woman_scientist,
+            man_technologist,
+            woman_technologist,
+            man_singer,
+            woman_singer,
+            man_artist,
+            woman_artist,
+            man_pilot,
+            woman_pilot,
+            man_astronaut,
+            woman_astronaut,
+            man_firefighter,
+            woman_firefighter,
+            policeman,
+            policewoman,
+            male_detective,
+            female_detective,
+            guardsman,
+            guardswoman,
+            construction_worker_man,
+            construction_worker_woman,
+            prince,
+            princess,
+            man_with_turban,
+            woman_with_turban,
+            man_with_gua_pi_mao,
+            man_in_tuxedo,
+            bride_with_veil,
+            pregnant_woman,
+            angel,
+            santa,
+            mrs_claus,
+            massage_woman,
+            massage_man,
+            haircut_woman,
+            haircut_man,
+            walking_man,
+            walking_woman,
+            running_man,
+            running_woman,
+            dancer,
+            man_dancing,
+            business_suit_levitating,
+            dancing_women,
+            dancing_men,
+            person_fencing,
+            horse_racing,
+            skier,
+            snowboarder,
+            golfing_man,
+            golfing_woman,
+            surfing_man,
+            surfing_woman,
+            rowing_man,
+            rowing_woman,
+            swimming_man,
+            swimming_woman,
+            basketball_man,
+            basketball_woman,
+            weight_lifting_man,
+            weight_lifting_woman,
+            biking_man,
+            biking_woman,
+            mountain_biking_man,
+            mountain_biking_woman,
+            man_cartwheeling,
+            woman_cartwheeling,
+            men_wrestling,
+            women_wrestling,
+            man_playing_water_polo,
+            woman_playing_water_polo,
+            man_playing_handball,
+            woman_playing_handball,
+            man_juggling,
+            woman_juggling,
+            bath,
+            sleeping_bed,
+            two_women_holding_hands,
+            couple,
+            two_men_holding_hands,
+            couplekiss_man_woman,
+            couplekiss_man_man,
+            couplekiss_woman_woman,
+            couple_with_heart_woman_man,
+            couple_with_heart_man_man,
+            couple_with_heart_woman_woman,
+            family_man_woman_girl,
+            family_man_woman_girl_boy,
+            family_man_woman_boy_boy,
+            family_man_woman_girl_girl,
+            family_man_man_boy,
+            family_man_man_girl,
+            family_man_man_girl_boy,
+            family_man_man_boy_boy,
+            family_man_man_girl_girl,
+            family_woman_woman_boy,
+            family_woman_woman_girl,
+            family_woman_woman_girl_boy,
+            family_woman_woman_boy_boy,
+            family_woman_woman_girl_girl,
+            family_man_boy,
+            family_man_boy_boy,
+            family_man_girl,
+            family_man_girl_boy,
+            family_man_girl_girl,
+            family_woman_boy,
+            family_woman_boy_boy,
+            family_woman_girl,
+            family_woman_girl_boy,
+            family_woman_girl_girl,
+            speaking_head,
+            bust_in_silhouette,
+            busts_in_silhouette,
+            family_man_woman_boy,
+            footprints,
+
+            // Animals & Nature
+            monkey_face,
+            monkey,
+            gorilla,
+            dog,
+            dog2,
+            poodle,
+            wolf,
+            fox_face,
+            cat,
+            cat2,
+            lion,
+            tiger,
+            tiger2,
+            leopard,
+            horse,
+            racehorse,
+            unicorn,
+            deer,
+            cow,
+            ox,
+            water_buffalo,
+            cow2,
+            pig,
+            pig2,
+            boar,
+            pig_nose,
+            ram,
+            sheep,
+            goat,
+            dromedary_camel,
+            camel,
+            elephant,
+            rhinoceros,
+            mouse,
+            mouse2,
+            rat,
+            hamster,
+            rabbit,
+            rabbit2,
+            chipmunk,
+            bat,
+            bear,
+            koala,
+            panda_face,
+            paw_prints,
+            turkey,
+            chicken,
+            rooster,
+            hatching_chick,
+            baby_chick,
+            hatched_chick,
+            bird,
+            penguin,
+            dove,
+            eagle,
+            duck,
+            owl,
+            frog,
+            crocodile,
+            turtle,
+            lizard,
+            snake,
+            dragon_face,
+            dragon,
+            whale,
+            whale2,
+            dolphin,
+            fish,
+            tropical_fish,
+            blowfish,
+            shark,
+            octopus,
+            shell,
+            snail,
+            butterfly,
+            bug,
+            ant,
+            honeybee,
+            beetle,
+            spider,
+            spider_web,
+            scorpion,
+            bouquet,
+            cherry_blossom,
+            white_flower,
+            rosette,
+            rose,
+            wilted_flower,
+            hibiscus,
+            sunflower,
+            blossom,
+            tulip,
+            seedling,
+            evergreen_tree,
+            deciduous_tree,
+            palm_tree,
+            cactus,
+            ear_of_rice,
+            herb,
+            shamrock,
+            four_leaf_clover,
+            maple_leaf,
+            fallen_leaf,
+            leaves,
+            mushroom,
+
+            // Food & Drink
+            grapes,
+            melon,
+            watermelon,
+            tangerine,
+            lemon,
+            banana,
+            pineapple,
+            apple,
+            green_apple,
+            pear,
+            peach,
+            cherries,
+            strawberry,
+            kiwi_fruit,
+            tomato,
+            avocado,
+            eggplant,
+            potato,
+            carrot,
+            corn,
+            hot_pepper,
+            cucumber,
+            peanuts,
+            chestnut,
+            bread,
+            croissant,
+            baguette_bread,
+            pancakes,
+            cheese,
+            meat_on_bone,
+            poultry_leg,
+            bacon,
+            hamburger,
+            fries,
+            pizza,
+            hotdog,
+            taco,
+            burrito,
+            stuffed_flatbread,
+            egg,
+            fried_egg,
+            shallow_pan_of_food,
+            stew,
+            green_salad,
+            popcorn,
+            bento,
+            rice_cracker,
+            rice_ball,
+            rice,
+            curry,
+            ramen,
+            spaghetti,
+            sweet_potato,
+            oden,
+            sushi,
+            fried_shrimp,
+            fish_cake,
+            dango,
+            crab,
+            shrimp,
+            squid,
+            icecream,
+            shaved_ice,
+            ice_cream,
+            doughnut,
+            cookie,
+            birthday,
+            cake,
+            chocolate_bar,
+            candy,
+            lollipop,
+            custard,
+            honey_pot,
+            baby_bottle,
+            milk_glass,
+            coffee,
+            tea,
+            sake,
+            champagne,
+            wine_glass,
+            cocktail,
+            tropical_drink,
+            beer,
+            beers,
+            clinking_glasses,
+            tumbler_glass,
+            plate_with_cutlery,
+            fork_and_knife,
+            spoon,
+            hocho,
+            amphora,
+
+            // Travel & Places
+            earth_africa,
+            earth_americas,
+            earth_asia,
+            globe_with_meridians,
+            world_map,
+            japan,
+            mountain_snow,
+            mountain,
+            volcano,
+            mount_fuji,
+            camping,
+            beach_umbrella,
+            desert,
+            desert_island,
+            national_park,
+            stadium,
+            classical_building,
+            building_construction,
+            houses,
+            derelict_house,
+            house,
+            house_with_garden,
+            office,
+            post_office,
+            european_post_office,
+            hospital,
+            bank,
+            hotel,
+            love_hotel,
+            convenience_store,
+            school,
+            department_store,
+            factory,
+            japanese_castle,
+            european_castle,
+            wedding,
+            tokyo_tower,
+            statue_of_liberty,
+            church,
+            mosque,
+            synagogue,
+            shinto_shrine,
+            kaaba,
+            fountain,
+            tent,
+            foggy,
+            night_with_stars,
+            cityscape,
+            sunrise_over_mountains,
+            sunrise,
+            city_sunset,
+            city_sunrise,
+            bridge_at_night,
+            hotsprings,
+            carousel_horse,
+            ferris_wheel,
+            roller_coaster,
+            barber,
+            circus_tent,
+            steam_locomotive,
+            railway_car,
+            bullettrain_side,
+            bullettrain_front,
+            train2,
+            metro,
+            light_rail,
+            station,
+            tram,
+            monorail,
+            mountain_railway,
+            train,
+            bus,
+            oncoming_bus,
+            trolleybus,
+            minibus,
+            ambulance,
+            fire_engine,
+            police_car,
+            oncoming_police_car,
+            taxi,
+            oncoming_taxi,
+            red_car,
+            oncoming_automobile,
+            blue_car,
+            truck,
+            articulated_lorry,
+            tractor,
+            racing_car,
+            motorcycle,
+            motor_scooter,
+            bike,
+            kick_scooter,
+            busstop,
+            motorway,
+            railway_track,
+            oil_drum,
+            fuelpump,
+            rotating_light,
+            traffic_light,
+            vertical_traffic_light,
+            stop_sign,
+            construction,
+            anchor,
+            sailboat,
+            canoe,
+            speedboat,
+            passenger_ship,
+            ferry,
+            motor_boat,
+            ship,
+            airplane,
+            small_airplane,
+            flight_departure,
+            flight_arrival,
+            seat,
+            helicopter,
+            suspension_railway,
+            mountain_cableway,
+            aerial_tramway,
+            artificial_satellite,
+            rocket,
+            bellhop_bell,
+            hourglass,
+            hourglass_flowing_sand,
+            watch,
+            alarm_clock,
+            stopwatch,
+            timer_clock,
+            mantelpiece_clock,
+            clock12,
+            clock1230,
+            clock1,
+            clock130,
+            clock2,
+            clock230,
+            clock3,
+            clock330,
+            clock4,
+            clock430,
+            clock5,
+            clock530,
+            clock6,
+            clock630,
+            clock7,
+            clock730,
+            clock8,
+            clock830,
+            clock9,
+            clock930,
+            clock10,
+            clock1030,
+            clock11,
+            clock1130,
+            new_moon,
+            waxing_crescent_moon,
+            first_quarter_moon,
+            waxing_gibbous_moon,
+            full_moon,
+            waning_gibbous_moon,
+            last_quarter_moon,
+            waning_crescent_moon,
+            crescent_moon,
+            new_moon_with_face,
+            first_quarter_moon_with_face,
+            last_quarter_moon_with_face,
+            thermometer,
+            sunny,
+            full_moon_with_face,
+            sun_with_face,
+            star,
+            star2,
+            stars,
+            milky_way,
+            cloud,
+            partly_sunny,
+            cloud_with_lightning_and_rain,
+            sun_behind_small_cloud,
+            sun_behind_large_cloud,
+            sun_behind_rain_cloud,
+            cloud_with_rain,
+            cloud_with_snow,
+            cloud_with_lightning,
+            tornado,
+            fog,
+            wind_face,
+            cyclone,
+            rainbow,
+            closed_umbrella,
+            open_umbrella,
+            umbrella,
+            parasol_on_ground,
+            zap,
+            snowflake,
+            snowman_with_snow,
+            snowman,
+            comet,
+            fire,
+            droplet,
+            ocean,
+
+            // Activities
+            jack_o_lantern,
+            christmas_tree,
+            fireworks,
+            sparkler,
+            sparkles,
+            balloon,
+            tada,
+            confetti_ball,
+            tanabata_tree,
+            bamboo,
+            dolls,
+            flags,
+            wind_chime,
+            rice_scene,
+            ribbon,
+            gift,
+            reminder_ribbon,
+            tickets,
+            ticket,
+            medal_military,
+            trophy,
+            medal_sports,
+            first_place_medal,
+            second_place_medal,
+            third_place_medal,
+            soccer,
+            baseball,
+            basketball,
+            volleyball,
+            football,
+            rugby_football,
+            tennis,
+            bowling,
+            cricket,
+            field_hockey,
+            ice_hockey,
+            ping_pong,
+            badminton,
+            boxing_glove,
+            martial_arts_uniform,
+            goal_net,
+            golf,
+            ice_skate,
+            fishing_pole_and_fish,
+            running_shirt_with_sash,
+            ski,
+            dart,
+            gun,
+            eight_ball,
+            crystal_ball,
+            video_game,
+            joystick,
+            slot_machine,
+            game_die,
+            spades,
+            hearts,
+            diamonds,
+            clubs,
+            black_joker,
+            mahjong,
+            flower_playing_cards,
+            performing_arts,
+            framed_picture,
+            art,
+
+            // Objects
+            eyeglasses,
+            dark_sunglasses,
+            necktie,
+            tshirt,
+            jeans,
+            dress,
+            kimono,
+            bikini,
+            womans_clothes,
+            purse,
+            handbag,
+            pouch,
+            shopping,
+            school_satchel,
+            mans_shoe,
+            athletic_shoe,
+            high_heel,
+            sandal,
+            boot,
+            crown,
+            womans_hat,
+            tophat,
+            mortar_board,
+            rescue_worker_helmet,
+            prayer_beads,
+            lipstick,
+            ring,
+            gem,
+            mute,
+            speaker,
+            sound,
+            loud_sound,
+            loudspeaker,
+            mega,
+            postal_horn,
+            bell,
+            no_bell,
+            musical_score,
+            musical_note,
+            notes,
+            studio_microphone,
+            level_slider,
+            control_knobs,
+            microphone,
+            headphones,
+            radio,
+            saxophone,
+            guitar,
+            musical_keyboard,
+            trumpet,
+            violin,
+            drum,
+            iphone,
+            calling,
+            phone,
+            telephone_receiver,
+            pager,
+            fax,
+            battery,
+            electric_plug,
+            computer,
+            desktop_computer,
+            printer,
+            keyboard,
+            computer_mouse,
+            trackball,
+            minidisc,
+            floppy_disk,
+            cd,
+            dvd,
+            movie_camera,
+            film_strip,
+            film_projector,
+            clapper,
+            tv,
+            camera,
+            camera_flash,
+            video_camera,
+            vhs,
+            mag,
+            mag_right,
+            candle,
+            bulb,
+            flashlight,
+            izakaya_lantern,
+            notebook_with_decorative_cover,
+            closed_book,
+            open_book,
+            green_book,
+            blue_book,
+            orange_book,
+            books,
+            notebook,
+            ledger,
+            page_with_curl,
+            scroll,
+            page_facing_up,
+            newspaper,
+            newspaper_roll,
+            bookmark_tabs,
+            bookmark,
+            label,
+            moneybag,
+            yen,
+            dollar,
+            euro,
+            pound,
+            money_with_wings,
+            credit_card,
+            chart,
+            email,
+            e_mail,
+            incoming_envelope,
+            envelope_with_arrow,
+            outbox_tray,
+            inbox_tray,
+            package,
+            mailbox,
+            mailbox_closed,
+            mailbox_with_mail,
+            mailbox_with_no_mail,
+            postbox,
+            ballot_box,
+            pencil2,
+            black_nib,
+            fountain_pen,
+            pen,
+            paintbrush,
+            crayon,
+            memo,
+            briefcase,
+            file_folder,
+            open_file_folder,
+            card_index_dividers,
+            date,
+            calendar,
+            spiral_notepad,
+            spiral_calendar,
+            card_index,
+            chart_with_upwards_trend,
+            chart_with_downwards_trend,
+            bar_chart,
+            clipboard,
+            pushpin,
+            round_pushpin,
+            paperclip,
+            paperclips,
+            straight_ruler,
+            triangular_ruler,
+            scissors,
+            card_file_box,
+            file_cabinet,
+            wastebasket,
+            lock,
+            unlock,
+            lock_with_ink_pen,
+            closed_lock_with_key,
+            key,
+            old_key,
+            hammer,
+            pick,
+            hammer_and_pick,
+            hammer_and_wrench,
+            dagger,
+            crossed_swords,
+            bomb,
+            bow_and_arrow,
+            shield,
+            wrench,
+            nut_and_bolt,
+            gear,
+            clamp,
+            balance_scale,
+            link,
+            chains,
+            alembic,
+            microscope,
+            telescope,
+            satellite,
+            syringe,
+            pill,
+            door,
+            bed,
+            couch_and_lamp,
+            toilet,
+            shower,
+            bathtub,
+            shopping_cart,
+            smoking,
+            coffin,
+            funeral_urn,
+            moyai,
+
+            // Symbols
+            atm,
+            put_litter_in_its_place,
+            potable_water,
+            wheelchair,
+            mens,
+            womens,
+            restroom,
+            baby_symbol,
+            wc,
+            passport_control,
+            customs,
+            baggage_claim,
+            left_luggage,
+            warning,
+            children_crossing,
+            no_entry,
+            no_entry_sign,
+            no_bicycles,
+            no_smoking,
+            do_not_litter,
+            non_potable_water,
+            no_pedestrians,
+            no_mobile_phones,
+            underage,
+            radioactive,
+            biohazard,
+            arrow_up,
+            arrow_upper_right,
+            arrow_right,
+            arrow_lower_right,
+            arrow_down,
+            arrow_lower_left,
+            arrow_left,
+            arrow_upper_left,
+            arrow_up_down,
+            left_right_arrow,
+            leftwards_arrow_with_hook,
+            arrow_right_hook,
+            arrow_heading_up,
+            arrow_heading_down,
+            arrows_clockwise,
+            arrows_counterclockwise,
+            back,
+            end,
+            on,
+            soon,
+            top,
+            place_of_worship,
+            atom_symbol,
+            om,
+            star_of_david,
+            wheel_of_dharma,
+            yin_yang,
+            latin_cross,
+            orthodox_cross,
+            star_and_crescent,
+            peace_symbol,
+            menorah,
+            six_pointed_star,
+            aries,
+            taurus,
+            gemini,
+            cancer,
+            leo,
+            virgo,
+            libra,
+            scorpius,
+            sagittarius,
+            capricorn,
+            aquarius,
+            pisces,
+            ophiuchus,
+            twisted_rightwards_arrows,
+            repeat,
+            repeat_one,
+            arrow_forward,
+            fast_forward,
+            next_track_button,
+            play_or_pause_button,
+            arrow_backward,
+            rewind,
+            previous_track_button,
+            arrow_up_small,
+            arrow_double_up,
+            arrow_down_small,
+            arrow_double_down,
+            pause_button,
+            stop_button,
+            record_button,
+            cinema,
+            low_brightness,
+            high_brightness,
+            signal_strength,
+            vibration_mode,
+            mobile_phone_off,
+            heavy_multiplication_x,
+            heavy_plus_sign,
+            heavy_minus_sign,
+            heavy_division_sign,
+            bangbang,
+            interrobang,
+            question,
+            grey_question,
+            grey_exclamation,
+            exclamation,
+            wavy_dash,
+            currency_exchange,
+            heavy_dollar_sign,
+            recycle,
+            fleur_de_lis,
+            trident,
+            name_badge,
+            beginner,
+            o,
+            white_check_mark,
+            ballot_box_with_check,
+            heavy_check_mark,
+            x,
+            negative_squared_cross_mark,
+            curly_loop,
+            loop,
+            part_alternation_mark,
+            eight_spoked_asterisk,
+            eight_pointed_black_star,
+            sparkle,
+            copyright,
+            registered,
+            tm,
+            hash,
+            asterisk,
+            zero,
+            one,
+            two,
+            three,
+            four,
+            five,
+            six,
+            seven,
+            eight,
+            nine,
+            keycap_ten,
+            capital_abcd,
+            abcd,
+            one_two_three_four,
+            symbols,
+            abc,
+            a,
+            ab,
+            b,
+            cl,
+            cool,
+            free,
+            information_source,
+            id,
+            m,
+            new_,
+            ng,
+            o2,
+            ok,
+            parking,
+            sos,
+            up,
+            vs,
+            koko,
+            sa,
+            u6708,
+            u6709,
+            u6307,
+            ideograph_advantage,
+            u5272,
+            u7121,
+            u7981,
+            accept,
+            u7533,
+            u5408,
+            u7a7a,
+            congratulations,
+            secret,
+            u55b6,
+            u6e80,
+            red_circle,
+            large_blue_circle,
+            black_circle,
+            white_circle,
+            black_large_square,
+            white_large_square,
+            black_medium_square,
+            white_medium_square,
+            black_medium_small_square,
+            white_medium_small_square,
+            black_small_square,
+            white_small_square,
+            large_orange_diamond,
+            large_blue_diamond,
+            small_orange_diamond,
+            small_blue_diamond,
+            small_red_triangle,
+            small_red_triangle_down,
+            diamond_shape_with_a_dot_inside,
+            radio_button,
+            white_square_button,
+            black_square_button,
+
+            // Flags
+            checkered_flag,
+            triangular_flag_on_post,
+            crossed_flags,
+            black_flag,
+            white_flag,
+            rainbow_flag,
+            andorra,
+            united_arab_emirates,
+            afghanistan,
+            antigua_barbuda,
+            anguilla,
+            albania,
+            armenia,
+            angola,
+            antarctica,
+            argentina,
+            american_samoa,
+            austria,
+            australia,
+            aruba,
+            aland_islands,
+            azerbaijan,
+            bosnia_herzegovina,
+            barbados,
+            bangladesh,
+            belgium,
+            burkina_faso,
+            bulgaria,
+            bahrain,
+            burundi,
+            benin,
+            st_barthelemy,
+            bermuda,
+            brunei,
+            bolivia,
+            caribbean_netherlands,
+            brazil,
+            bahamas,
+            bhutan,
+            botswana,
+            belarus,
+            belize,
+            canada,
+            cocos_islands,
+            congo_kinshasa,
+            central_african_republic,
+            congo_brazzaville,
+            switzerland,
+            cote_divoire,
+            cook_islands,
+            chile,
+            cameroon,
+            cn,
+            colombia,
+            costa_rica,
+            cuba,
+            cape_verde,
+            curacao,
+            christmas_island,
+            cyprus,
+            czech_republic,
+            de,
+            djibouti,
+            denmark,
+            dominica,
+            dominican_republic,
+            algeria,
+            ecuador,
+            estonia,
+            egypt,
+            western_sahara,
+            eritrea,
+            es,
+            ethiopia,
+            eu,
+            finland,
+            fiji,
+            falkland_islands,
+            micronesia,
+            faroe_islands,
+            fr,
+            gabon,
+            uk,
+            grenada,
+            georgia,
+            french_guiana,
+            guernsey,
+            ghana,
+            gibraltar,
+            greenland,
+            gambia,
+            guinea,
+            guadeloupe,
+            equatorial_guinea,
+            greece,
+            south_georgia_south_sandwich_islands,
+            guatemala,
+            guam,
+            guinea_bissau,
+            guyana,
+            hong_kong,
+            honduras,
+            croatia,
+            haiti,
+            hungary,
+            canary_islands,
+            indonesia,
+            ireland,
+            israel,
+            isle_of_man,
+            india,
+            british_indian_ocean_territory,
+            iraq,
+            iran,
+            iceland,
+            it,
+            jersey,
+            jamaica,
+            jordan,
+            jp,
+            kenya,
+            kyrgyzstan,
+            cambodia,
+            kiribati,
+            comoros,
+            st_kitts_nevis,
+            north_korea,
+            kr,
+            kuwait,
+            cayman_islands,
+            kazakhstan,
+            laos,
+            lebanon,
+            st_lucia,
+            liechtenstein,
+            sri_lanka,
+            liberia,
+            lesotho,
+            lithuania,
+            luxembourg,
+            latvia,
+            libya,
+            morocco,
+            monaco,
+            moldova,
+            montenegro,
+            madagascar,
+            marshall_islands,
+            macedonia,
+            mali,
+            myanmar,
+            mongolia,
+            macau,
+            northern_mariana_islands,
+            martinique,
+            mauritania,
+            montserrat,
+            malta,
+            mauritius,
+            maldives,
+            malawi,
+            mexico,
+            malaysia,
+            mozambique,
+            namibia,
+            new_caledonia,
+            niger,
+            norfolk_island,
+            nigeria,
+            nicaragua,
+            netherlands,
+            norway,
+            nepal,
+            nauru,
+            niue,
+            new_zealand,
+            oman,
+            panama,
+            peru,
+            french_polynesia,
+            papua_new_guinea,
+            philippines,
+            pakistan,
+            poland,
+            st_pierre_miquelon,
+            pitcairn_islands,
+            puerto_rico,
+            palestinian_territories,
+            portugal,
+            palau,
+            paraguay,
+            qatar,
+            reunion,
+            romania,
+            serbia,
+            ru,
+            rwanda,
+            saudi_arabia,
+            solomon_islands,
+            seychelles,
+            sudan,
+            sweden,
+            singapore,
+            st_helena,
+            slovenia,
+            slovakia,
+            sierra_leone,
+            san_marino,
+            senegal,
+            somalia,
+            suriname,
+            south_sudan,
+            sao_tome_principe,
+            el_salvador,
+            sint_maarten,
+            syria,
+            swaziland,
+            turks_caicos_islands,
+            chad,
+            french_southern_territories,
+            togo,
+            thailand,
+            tajikistan,
+            tokelau,
+            timor_leste,
+            turkmenistan,
+            tunisia,
+            tonga,
+            tr,
+            trinidad_tobago,
+            tuvalu,
+            taiwan,
+            tanzania,
+            ukraine,
+            uganda,
+            us,
+            uruguay,
+            uzbekistan,
+            vatican_city,
+            st_vincent_grenadines,
+            venezuela,
+            british_virgin_islands,
+            us_virgin_islands,
+            vietnam,
+            vanuatu,
+            wallis_futuna,
+            samoa,
+            kosovo,
+            yemen,
+            mayotte,
+            south_africa,
+            zambia,
+            zimbabwe,
+        };
+
+    } /* namespace Emoji */
+
+} /* namespace Canary */
@@ -0,0 +1,325 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+
+#include "emoji/common.hpp"
+#include "emoji_data.hpp"
+#include "glyph.hpp"
+
+namespace Canary {
+
+    namespace detail {
+
+        // The first position of byVersion whose version is not below version
+        constexpr std::size_t VersionBound(unsigned version, std::size_t first, std::size_t last) {
+            return first == last
+                ? first
+                : EmojiTable::version[EmojiTable::byVersion[first + (last - first) / 2]] < version
+                    ? VersionBound(version, first + (last - first) / 2 + 1, last)
+                    : VersionBound(version, first, first + (last - first) / 2);
+        }
+
+        // One way to show all emojis: a blob with an offset and a length per emoji
+        struct GlyphSet {
+            const char* bytes;
+            const std::uint16_t* offsets;
+            const std::uint8_t* lengths;
+        };
+
+        /**
+            The glyph sets by Emoji::Mode, a template only to have one
+            definition of them in every program before C++17
+         */
+        template<class = void>
+        struct GlyphSets {
+            static constexpr GlyphSet sets[2] = {
+                { EmojiTable::bytes, EmojiTable::offsets, EmojiTable::lengths },
+                { EmojiTable::text, EmojiTable::textOffsets, EmojiTable::textLengths }
+            };
+        };
+
+        template<class T> constexpr GlyphSet GlyphSets<T>::sets[2];
+
+        inline const GlyphSet& ActiveGlyphs() {
+            return GlyphSets<>::sets[static_cast<std::size_t>(ActiveMode())];
+        }
+
+    } /* namespace detail */
+
+    namespace Emoji {
+
+        /**
+            The groups of the Unicode emoji data, in its order
+         */
+        enum class Group : std::uint8_t {
+            SmileysEmotion,
+            PeopleBody,
+            Component,
+            AnimalsNature,
+            FoodDrink,
+            TravelPlaces,
+            Activities,
+            Objects,
+            Symbols,
+            Flags
+        };
+
+        /**
+            Entry
+
+            One emoji of the table with its metadata. The table holds
+            all emojis of emoji.hpp in the order of the Unicode emoji
+            data, so that every group is contiguous. Names and emojis
+            point into two blobs and are null-terminated; the emojis
+            have no trailing space, unlike the constants.
+         */
+        struct Entry {
+            const char* name;
+            std::size_t nameLength;
+
+            // The UTF-8 bytes
+            const char* emoji;
+            std::size_t length;
+
+            Group group;
+
+            // The Unicode emoji version that introduced it, in tenths: E13.1 is 131
+            unsigned version;
+
+            // Columns on a terminal: 2 for emoji presentation, 1 for
+            // emojis without a variation selector that default to text
+            unsigned width;
+        };
+
+        // The number of emojis in the table
+        constexpr std::size_t Count() {
+            return detail::EmojiTable::count;
+        }
+
+        /**
+            The emoji at an index of the table
+
+            Example:
+
+                for (std::size_t i = 0; i < Canary::Emoji::Count(); ++i) {
+                    std::cout << Canary::Emoji::At(i).emoji << " " << Canary::Emoji::At(i).name << "\n";
+                }
+         */
+        constexpr Entry At(std::size_t index) {
+            return Entry{
+                detail::EmojiTable::names + detail::EmojiTable::nameOffsets[index],
+                detail::EmojiTable::nameLengths[index],
+                detail::EmojiTable::bytes + detail::EmojiTable::offsets[index],
+                detail::EmojiTable::lengths[index],
+                static_cast<Group>(detail::EmojiTable::group[index]),
+                detail::EmojiTable::version[index],
+                detail::EmojiTable::width[index]
+            };
+        }
+
+        /**
+            Slice
+
+            A run of table positions, in table order or through one of
+            the index arrays, that iterates as entries. Slices are views
+            over the constexpr tables: they neither allocate nor filter.
+         */
+        class Slice {
+        public:
+            class Iterator {
+            public:
+                constexpr Iterator(const std::uint16_t* order, std::size_t position)
+                    : order(order), position(position) {}
+
+                constexpr Entry operator*() const {
+                    return At(order ? order[position] : position);
+                }
+
+                Iterator& operator++() {
+                    ++position;
+                    return *this;
+                }
+
+                constexpr bool operator==(const Iterator& other) const {
+                    return position == other.position;
+                }
+
+                constexpr bool operator!=(const Iterator& other) const {
+                    return position != other.position;
+                }
+
+            private:
+                const std::uint16_t* order;
+                std::size_t position;
+            };
+
+            // order is nullptr for a slice of the table itself
+            constexpr Slice(const std::uint16_t* order, std::size_t first, std::size_t last)
+                : order(order), first(first), last(last) {}
+
+            constexpr Iterator begin() const {
+                return Iterator(order, first);
+            }
+
+            constexpr Iterator end() const {
+                return Iterator(order, last);
+            }
+
+            constexpr std::size_t size() const {
+                return last - first;
+            }
+
+            constexpr bool empty() const {
+                return first == last;
+            }
+
+            // The table index of the i-th emoji of the slice
+            constexpr std::size_t Index(std::size_t i) const {
+                return order ? order[first + i] : first + i;
+            }
+
+            constexpr Entry operator[](std::size_t i) const {
+                return At(Index(i));
+            }
+
+        private:
+            const std::uint16_t* order;
+            std::size_t first;
+            std::size_t last;
+        };
+
+        // Every emoji of the table
+        constexpr Slice All() {
+            return Slice(nullptr, 0, detail::EmojiTable::count);
+        }
+
+        /**
+            The emojis of a group, which is a contiguous part of the table
+
+            Example:
+
+                for (const Canary::Emoji::Entry& flag : Canary::Emoji::InGroup(Canary::Emoji::Group::Flags)) {
+                    std::cout << flag.emoji << " ";
+                }
+         */
+        constexpr Slice InGroup(Group group) {
+            return Slice(nullptr,
+                detail::EmojiTable::groupStart[static_cast<std::size_t>(group)],
+                detail::EmojiTable::groupStart[static_cast<std::size_t>(group) + 1]);
+        }
+
+        /**
+            The emojis of a width, 1 or 2 columns, in table order
+         */
+        constexpr Slice WithWidth(unsigned width) {
+            return width == 1
+                ? Slice(detail::EmojiTable::byWidth, 0, detail::EmojiTable::narrow)
+                : width == 2
+                    ? Slice(detail::EmojiTable::byWidth, detail::EmojiTable::narrow, detail::EmojiTable::count)
+                    : Slice(nullptr, 0, 0);
+        }
+
+        /**
+            The emojis introduced from version first to version last
+            inclusive, in tenths like Entry::version, ordered by version
+            and then by table order
+
+            Example:
+
+                // Everything that is safe on a terminal font from Emoji 12.0
+                for (const Canary::Emoji::Entry& entry : Canary::Emoji::ByVersion(0, 120)) {
+                    ...
+                }
+         */
+        constexpr Slice ByVersion(unsigned first, unsigned last) {
+            return first > last
+                ? Slice(nullptr, 0, 0)
+                : Slice(detail::EmojiTable::byVersion,
+                    detail::VersionBound(first, 0, detail::EmojiTable::count),
+                    detail::VersionBound(last + 1, 0, detail::EmojiTable::count));
+        }
+
+        // The emojis introduced in exactly one version
+        constexpr Slice IntroducedIn(unsigned version) {
+            return ByVersion(version, version);
+        }
+
+        /**
+            Decode the code points of the emoji at an index into out,
+            which has room for capacity of them. Returns the number of
+            code points, which may be larger than the capacity.
+         */
+        inline std::size_t Codepoints(std::size_t index, char32_t* out, std::size_t capacity) {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(
+                detail::EmojiTable::bytes + detail::EmojiTable::offsets[index]);
+            const unsigned char* end = p + detail::EmojiTable::lengths[index];
+
+            std::size_t count = 0;
+            while (p < end) {
+                char32_t codepoint;
+                if (*p < 0x80) {
+                    codepoint = *p++;
+                } else if (*p < 0xE0) {
+                    codepoint = (p[0] & 0x1Fu) << 6 | (p[1] & 0x3Fu);
+                    p += 2;
+                } else if (*p < 0xF0) {
+                    codepoint = (p[0] & 0x0Fu) << 12 | (p[1] & 0x3Fu) << 6 | (p[2] & 0x3Fu);
+                    p += 3;
+                } else {
+                    codepoint = (p[0] & 0x07u) << 18 | (p[1] & 0x3Fu) << 12 | (p[2] & 0x3Fu) << 6 | (p[3] & 0x3Fu);
+                    p += 4;
+                }
+                if (count < capacity) out[count] = codepoint;
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+            The emoji of an Id in the current mode of glyph.hpp,
+            null-terminated and without a trailing space, unlike the
+            constants. Whatever the mode, every call is a load of it and
+            two from a table.
+
+            Example:
+
+                std::cout << Canary::Emoji::Glyph(Canary::Emoji::Id::white_check_mark) << " Tests passed" << std::endl;
+         */
+        inline const char* Glyph(Id id) {
+            const detail::GlyphSet& glyphs = detail::ActiveGlyphs();
+            return glyphs.bytes + glyphs.offsets[static_cast<std::size_t>(id)];
+        }
+
+        // The length of Glyph(id) in bytes
+        inline std::size_t GlyphLength(Id id) {
+            return detail::ActiveGlyphs().lengths[static_cast<std::size_t>(id)];
+        }
+
+        // Append Glyph(id) to a string
+        inline void AppendGlyph(std::string& out, Id id) {
+            const detail::GlyphSet& glyphs = detail::ActiveGlyphs();
+            out.append(glyphs.bytes + glyphs.offsets[static_cast<std::size_t>(id)], glyphs.lengths[static_cast<std::size_t>(id)]);
+        }
+
+    } /* namespace Emoji */
+
+} /* namespace Canary */
@@ -0,0 +1,166 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <cctype>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace Canary {
+
+    namespace Emoji {
+
+        /**
+            How the library shows emojis: as emojis, or as short ASCII
+            replacements like "[ok]" and "*" for terminals and logs
+            without UTF-8 or an emoji font
+         */
+        enum class Mode {
+            Emoji,
+            Text
+        };
+
+    } /* namespace Emoji */
+
+    namespace detail {
+
+        // The value of a variable of the environment, nullptr if it is unset or empty
+        inline const char* Environment(const char* name) {
+            const char* value = std::getenv(name);
+            return value != nullptr && *value != '\0' ? value : nullptr;
+        }
+
+        /**
+            True if the terminal can show emojis: the locale of
+            LC_ALL, LC_CTYPE or LANG, the first that is set, is UTF-8
+            and TERM is not a console without an emoji font. Windows
+            consoles only show them in Windows Terminal.
+            CANARY_EMOJI=0 or 1 overrides it.
+         */
+        inline bool DetectEmoji() {
+            if (const char* forced = Environment("CANARY_EMOJI")) return std::strcmp(forced, "0") != 0;
+
+#if defined(_WIN32)
+            return Environment("WT_SESSION") != nullptr;
+#else
+            const char* term = Environment("TERM");
+            if (term != nullptr) {
+                std::string name(term);
+                if (name == "dumb" || name == "linux" || name == "vt100" || name == "vt220") return false;
+            }
+
+            const char* locale = Environment("LC_ALL");
+            if (locale == nullptr) locale = Environment("LC_CTYPE");
+            if (locale == nullptr) locale = Environment("LANG");
+            if (locale == nullptr) return false;
+
+            // en_US.UTF-8, C.utf8, ...
+            std::string charset;
+            for (const char* c = locale; *c != '\0' && *c != '@'; ++c) {
+                if (*c != '-') charset += static_cast<char>(std::tolower(static_cast<unsigned char>(*c)));
+            }
+            return charset.find("utf8") != std::string::npos;
+#endif
+        }
+
+        /**
+            The mode in use, a template only to have one definition of
+            its static members in every program before C++17. mode
+            starts at emojis as a constant, so it is valid in every
+            static initializer, and detected sets it before main.
+
+            text turns the bytes of an emoji into its replacement in
+            text mode, or nullptr if it knows none. It needs the emoji
+            tables, so it stays nullptr unless shortcode.hpp is included.
+         */
+        template<class = void>
+        struct Glyphs {
+            static Emoji::Mode mode;
+            static const bool detected;
+            static const char* (*text)(const char* bytes, std::size_t length);
+        };
+
+        template<class T> Emoji::Mode Glyphs<T>::mode = Emoji::Mode::Emoji;
+        template<class T> const bool Glyphs<T>::detected = (Glyphs<T>::mode = DetectEmoji() ? Emoji::Mode::Emoji : Emoji::Mode::Text, true);
+        template<class T> const char* (*Glyphs<T>::text)(const char*, std::size_t) = nullptr;
+
+        // Using detected makes it part of the program, reading it would cost a load
+        inline Emoji::Mode ActiveMode() {
+            static_cast<void>(&Glyphs<>::detected);
+            return Glyphs<>::mode;
+        }
+
+        // A glyph the library prints itself, in the current mode
+        inline const char* ModeGlyph(const char* emoji, const char* text) {
+            return ActiveMode() == Emoji::Mode::Emoji ? emoji : text;
+        }
+
+        // The ⚡ of "Done in" lines
+        inline const char* DoneGlyph() {
+            return ModeGlyph("\xE2\x9A\xA1", "*");
+        }
+
+        // The ✓ of finished tasks
+        inline const char* CheckGlyph() {
+            return ModeGlyph("\xE2\x9C\x93", "+");
+        }
+
+        // The ✗ of failed and cancelled tasks
+        inline const char* CrossGlyph() {
+            return ModeGlyph("\xE2\x9C\x97", "x");
+        }
+
+        /**
+            Append the emoji of a task and a space. In text mode that
+            is its replacement, or "*" for an emoji without one or when
+            the tables are not part of the program.
+         */
+        inline void AppendTaskEmoji(std::string& out, const std::string& emoji) {
+            if (emoji.empty()) return;
+
+            if (ActiveMode() == Emoji::Mode::Emoji) {
+                out += emoji;
+            } else {
+                const char* text = Glyphs<>::text != nullptr ? Glyphs<>::text(emoji.data(), emoji.size()) : nullptr;
+                out += text != nullptr ? text : "*";
+            }
+            out += " ";
+        }
+
+    } /* namespace detail */
+
+    namespace Emoji {
+
+        inline Mode CurrentMode() {
+            return detail::ActiveMode();
+        }
+
+        /**
+            Choose the mode instead of the detection, for a --no-emoji
+            flag or a log file. Set it in main, before other threads
+            print anything.
+         */
+        inline void SetMode(Mode mode) {
+            static_cast<void>(&detail::Glyphs<>::detected);
+            detail::Glyphs<>::mode = mode;
+        }
+
+    } /* namespace Emoji */
+
+} /* namespace Canary */
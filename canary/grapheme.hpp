@@ -0,0 +1,244 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "grapheme_data.hpp"
+
+namespace Canary {
+
+    namespace detail {
+
+        /**
+            Decode the code point at the start of text, at least one
+            byte, into its GraphemeProperty. Returns its length; bytes
+            that are not valid UTF-8 are one code point each, of no
+            property, so a cluster never reads past the end.
+         */
+        inline std::size_t DecodeGraphemeProperty(const unsigned char* text, std::size_t length, unsigned& property) {
+            std::uint32_t codepoint = text[0];
+            std::size_t size = 1;
+            if (codepoint >= 0x80) {
+                std::size_t expected = codepoint < 0xC0 ? 0 : codepoint < 0xE0 ? 2 : codepoint < 0xF0 ? 3 : codepoint < 0xF8 ? 4 : 0;
+                std::uint32_t decoded = codepoint & (0x7Fu >> expected);
+                codepoint = 0;
+                if (expected != 0 && expected <= length) {
+                    std::size_t i = 1;
+                    for (; i < expected && (text[i] & 0xC0) == 0x80; ++i) {
+                        decoded = decoded << 6 | (text[i] & 0x3Fu);
+                    }
+                    if (i == expected && decoded <= 0x10FFFF) {
+                        codepoint = decoded;
+                        size = expected;
+                    }
+                }
+            }
+
+            property = GraphemeTable::values[
+                (static_cast<std::size_t>(GraphemeTable::blocks[codepoint >> GraphemeTable::blockShift]) << GraphemeTable::blockShift)
+                | (codepoint & ((1u << GraphemeTable::blockShift) - 1))];
+            return size;
+        }
+
+        /**
+            The length of the extended grapheme cluster at the start of
+            text, which is not empty, by the rules of UAX #29
+         */
+        inline std::size_t NextGrapheme(const unsigned char* text, std::size_t length) {
+            // Two ASCII characters always break, but for \r\n
+            if (text[0] < 0x80) {
+                if (length == 1) return 1;
+                if (text[1] < 0x80) return text[0] == '\r' && text[1] == '\n' ? 2 : 1;
+            }
+
+            unsigned before;
+            std::size_t position = DecodeGraphemeProperty(text, length, before);
+
+            // In Extended_Pictographic Extend*, and right after its ZWJ
+            bool pictographic = before == GraphemeExtendedPictographic;
+            bool joined = false;
+            std::size_t regional = before == GraphemeRegionalIndicator ? 1 : 0;
+
+            while (position < length) {
+                unsigned after;
+                std::size_t size = DecodeGraphemeProperty(text + position, length - position, after);
+
+                unsigned pair = GraphemeTable::pairs[before * GraphemeTable::properties + after];
+                if (pair == GraphemeBreak
+                    || (pair == GraphemeKeepAfterPictographic && !joined)
+                    || (pair == GraphemeKeepOddRegional && regional % 2 == 0)) {
+                    break;
+                }
+
+                joined = after == GraphemeZWJ && pictographic;
+                pictographic = after == GraphemeExtendedPictographic || (pictographic && after == GraphemeExtend);
+                regional = after == GraphemeRegionalIndicator ? regional + 1 : 0;
+
+                before = after;
+                position += size;
+            }
+            return position;
+        }
+
+    } /* namespace detail */
+
+    namespace Grapheme {
+
+        /**
+            The length in bytes of the grapheme cluster at the start of
+            text, 0 if it is empty. A cluster is what a reader sees as
+            one character: an emoji with its skin tone, a ZWJ family,
+            a flag of two regional indicators, a letter with its accents.
+         */
+        inline std::size_t Next(const char* text, std::size_t length) {
+            return length == 0 ? 0 : detail::NextGrapheme(reinterpret_cast<const unsigned char*>(text), length);
+        }
+
+        /**
+            The number of grapheme clusters of text. Runs of ASCII are
+            counted eight bytes at a time.
+         */
+        inline std::size_t Count(const char* text, std::size_t length) {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(text);
+            std::size_t count = 0;
+            std::size_t i = 0;
+            while (i < length) {
+                // Every byte of an ASCII run is a cluster, but the \n of \r\n;
+                // its last byte may take the marks that follow it
+                std::size_t run = i;
+                std::uint64_t word;
+                while (run + 8 <= length && (std::memcpy(&word, p + run, 8), (word & 0x8080808080808080ull) == 0)) run += 8;
+                while (run < length && p[run] < 0x80) ++run;
+
+                if (run - i > 1) {
+                    count += run - 1 - i;
+                    for (std::size_t j = i + 1; j < run - 1; ++j) {
+                        count -= (p[j] == '\n') & (p[j - 1] == '\r');
+                    }
+                    i = run - 1;
+                    if (p[i] == '\n' && p[i - 1] == '\r') {
+                        ++i;
+                        continue;
+                    }
+                }
+
+                i += detail::NextGrapheme(p + i, length - i);
+                ++count;
+            }
+            return count;
+        }
+
+        inline std::size_t Count(const std::string& text) {
+            return Count(text.data(), text.size());
+        }
+
+        /**
+            The length in bytes of the first clusters grapheme clusters
+            of text, to truncate it without cutting an emoji in half
+
+            Example:
+
+                // At most 20 characters
+                message.resize(Canary::Grapheme::Prefix(message.data(), message.size(), 20));
+         */
+        inline std::size_t Prefix(const char* text, std::size_t length, std::size_t clusters) {
+            std::size_t position = 0;
+            for (std::size_t i = 0; i < clusters && position < length; ++i) {
+                position += detail::NextGrapheme(reinterpret_cast<const unsigned char*>(text) + position, length - position);
+            }
+            return position;
+        }
+
+        inline std::size_t Prefix(const std::string& text, std::size_t clusters) {
+            return Prefix(text.data(), text.size(), clusters);
+        }
+
+        // One grapheme cluster, which points into the text
+        struct Cluster {
+            const char* data;
+            std::size_t size;
+        };
+
+        /**
+            Clusters
+
+            The grapheme clusters of a text as a range. It points into
+            the text and allocates nothing.
+
+            Example:
+
+                for (Canary::Grapheme::Cluster cluster : Canary::Grapheme::Clusters(line)) {
+                    std::cout << std::string(cluster.data, cluster.size) << "\n";
+                }
+         */
+        class Clusters {
+        public:
+            class Iterator {
+            public:
+                Iterator(const char* position, const char* end)
+                    : position(position), end(end), size(Next(position, static_cast<std::size_t>(end - position))) {}
+
+                Cluster operator*() const {
+                    return Cluster{ position, size };
+                }
+
+                Iterator& operator++() {
+                    position += size;
+                    size = Next(position, static_cast<std::size_t>(end - position));
+                    return *this;
+                }
+
+                bool operator==(const Iterator& other) const {
+                    return position == other.position;
+                }
+
+                bool operator!=(const Iterator& other) const {
+                    return position != other.position;
+                }
+
+            private:
+                const char* position;
+                const char* end;
+                std::size_t size;
+            };
+
+            Clusters(const char* text, std::size_t length)
+                : text(text), length(length) {}
+
+            explicit Clusters(const std::string& text)
+                : text(text.data()), length(text.size()) {}
+
+            Iterator begin() const {
+                return Iterator(text, text + length);
+            }
+
+            Iterator end() const {
+                return Iterator(text + length, text + length);
+            }
+
+        private:
+            const char* text;
+            std::size_t length;
+        };
+
+    } /* namespace Grapheme */
+
+} /* namespace Canary */
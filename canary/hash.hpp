@@ -0,0 +1,166 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace Canary {
+
+    namespace detail {
+
+        constexpr std::uint64_t HashPrime1 = 0x9E3779B185EBCA87ull;
+        constexpr std::uint64_t HashPrime2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr std::uint64_t HashPrime3 = 0x165667B19E3779F9ull;
+        constexpr std::uint64_t HashPrime4 = 0x85EBCA77C2B2AE63ull;
+        constexpr std::uint64_t HashPrime5 = 0x27D4EB2F165667C5ull;
+
+        inline std::uint64_t RotateLeft(std::uint64_t value, int bits) {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        // Little endian loads, memcpy compiles to a single move
+        inline std::uint64_t Load64(const unsigned char* p) {
+            std::uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap64(value);
+#endif
+            return value;
+        }
+
+        inline std::uint32_t Load32(const unsigned char* p) {
+            std::uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap32(value);
+#endif
+            return value;
+        }
+
+        inline std::uint64_t HashRound(std::uint64_t accumulator, std::uint64_t input) {
+            accumulator += input * HashPrime2;
+            accumulator = RotateLeft(accumulator, 31);
+            return accumulator * HashPrime1;
+        }
+
+        inline std::uint64_t HashMergeRound(std::uint64_t accumulator, std::uint64_t value) {
+            accumulator ^= HashRound(0, value);
+            return accumulator * HashPrime1 + HashPrime4;
+        }
+
+    } /* namespace detail */
+
+    /**
+        Hash64
+
+        The 64 bit xxHash (XXH64) of a block of memory: a fast,
+        non-cryptographic hash that processes 32 bytes per round on four
+        independent lanes. Good to detect changed inputs, not to protect
+        against deliberate collisions.
+     */
+    inline std::uint64_t Hash64(const void* data, std::size_t size, std::uint64_t seed = 0) {
+        using namespace detail;
+
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        const unsigned char* const end = p + size;
+        std::uint64_t hash;
+
+        if (size >= 32) {
+            std::uint64_t v1 = seed + HashPrime1 + HashPrime2;
+            std::uint64_t v2 = seed + HashPrime2;
+            std::uint64_t v3 = seed;
+            std::uint64_t v4 = seed - HashPrime1;
+
+            const unsigned char* const limit = end - 32;
+            do {
+                v1 = HashRound(v1, Load64(p));
+                v2 = HashRound(v2, Load64(p + 8));
+                v3 = HashRound(v3, Load64(p + 16));
+                v4 = HashRound(v4, Load64(p + 24));
+                p += 32;
+            } while (p <= limit);
+
+            hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+            hash = HashMergeRound(hash, v1);
+            hash = HashMergeRound(hash, v2);
+            hash = HashMergeRound(hash, v3);
+            hash = HashMergeRound(hash, v4);
+        } else {
+            hash = seed + HashPrime5;
+        }
+
+        hash += static_cast<std::uint64_t>(size);
+
+        for (; p + 8 <= end; p += 8) {
+            hash ^= HashRound(0, Load64(p));
+            hash = RotateLeft(hash, 27) * HashPrime1 + HashPrime4;
+        }
+        if (p + 4 <= end) {
+            hash ^= static_cast<std::uint64_t>(Load32(p)) * HashPrime1;
+            hash = RotateLeft(hash, 23) * HashPrime2 + HashPrime3;
+            p += 4;
+        }
+        for (; p < end; ++p) {
+            hash ^= (*p) * HashPrime5;
+            hash = RotateLeft(hash, 11) * HashPrime1;
+        }
+
+        // Avalanche
+        hash ^= hash >> 33;
+        hash *= HashPrime2;
+        hash ^= hash >> 29;
+        hash *= HashPrime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    inline std::uint64_t Hash64(const std::string& data, std::uint64_t seed = 0) {
+        return Hash64(data.data(), data.size(), seed);
+    }
+
+    /**
+        Hasher
+
+        Combines many pieces into one 64 bit digest, each piece is hashed
+        with the digest so far as seed. The result depends on how the
+        data is split into pieces, so feed it the same way every time.
+     */
+    class Hasher {
+    public:
+        explicit Hasher(std::uint64_t seed = 0) : state(seed) {}
+
+        Hasher& Update(const void* data, std::size_t size) {
+            state = Hash64(data, size, state);
+            return *this;
+        }
+
+        Hasher& Update(const std::string& data) {
+            return Update(data.data(), data.size());
+        }
+
+        std::uint64_t Digest() const {
+            return state;
+        }
+
+    private:
+        std::uint64_t state;
+    };
+
+} /* namespace Canary */
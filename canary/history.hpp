@@ -0,0 +1,169 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage.hpp"
+#include "tasks.hpp"
+
+namespace Canary {
+
+    /**
+        TimingHistory
+
+        Remembers how long each task took, keyed by its message, in a
+        small binary file between runs. Pass it as the history of the
+        ExecutionOptions: ExecuteGraph then starts the longest work first
+        and the printers show the expected time that is left. Successful
+        tasks update the history at the end of every execution, each run
+        counts half against the runs before.
+
+        The file starts with the magic "CNRYTIM" and a version byte,
+        followed by the number of entries and the entries themselves,
+        each the length of the name, the name and the duration in
+        nanoseconds. All integers are little endian. A missing or broken
+        file is treated as an empty history.
+
+        Example:
+
+            Canary::TimingHistory history(".canary-timings");
+
+            Canary::ExecutionOptions options;
+            options.history = &history;
+            Canary::ExecuteGraph(graph, options);
+     */
+    class TimingHistory : public DurationHistory {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        // Loads the file, which is rewritten at the end of each execution
+        explicit TimingHistory(std::string path = ".canary-timings") : path(std::move(path)) {
+            Load();
+        }
+
+        std::chrono::nanoseconds Expected(const Task& task) const override {
+            auto it = durations.find(task.msg);
+            return it != durations.end() ? it->second : std::chrono::nanoseconds::zero();
+        }
+
+        // Number of known task names
+        std::size_t Size() const {
+            return durations.size();
+        }
+
+        void Begin(std::size_t tasks, unsigned) override {
+            runs.assign(tasks, Run());
+        }
+
+        void TaskStarted(unsigned, TaskId id, const Task& task) override {
+            runs[id].task = &task;
+            runs[id].start = Clock::now();
+        }
+
+        void TaskFinished(unsigned, TaskId id, const Task&, const TaskResult& result) override {
+            runs[id].duration = Clock::now() - runs[id].start;
+            runs[id].success = result.success;
+        }
+
+        void End() override {
+            // Tasks with the same name count with their average
+            std::unordered_map<std::string, std::pair<std::chrono::nanoseconds, std::int64_t>> measured;
+            for (const Run& run : runs) {
+                if (run.task == nullptr || !run.success) continue;
+
+                auto& sum = measured[run.task->msg];
+                sum.first += std::chrono::duration_cast<std::chrono::nanoseconds>(run.duration);
+                sum.second += 1;
+            }
+            runs.clear();
+
+            for (const auto& entry : measured) {
+                std::chrono::nanoseconds average = entry.second.first / entry.second.second;
+                auto it = durations.find(entry.first);
+                if (it == durations.end()) {
+                    durations.emplace(entry.first, average);
+                } else {
+                    it->second = (it->second + average) / 2;
+                }
+            }
+
+            if (!measured.empty()) Save();
+        }
+
+        /**
+            Read the file, replacing the known durations
+         */
+        void Load() {
+            durations.clear();
+
+            std::string data;
+            if (!detail::ReadFile(path, data)) return;
+
+            std::size_t pos = Magic().size();
+            std::uint64_t count = 0;
+            if (data.compare(0, pos, Magic()) != 0 || !detail::ReadInteger(data, pos, 4, count)) return;
+
+            std::unordered_map<std::string, std::chrono::nanoseconds> loaded;
+            for (std::uint64_t i = 0; i < count; ++i) {
+                std::string name;
+                std::uint64_t nanoseconds = 0;
+                if (!detail::ReadString(data, pos, name) || !detail::ReadInteger(data, pos, 8, nanoseconds)) return;
+
+                loaded[std::move(name)] = std::chrono::nanoseconds(static_cast<std::int64_t>(nanoseconds));
+            }
+            durations.swap(loaded);
+        }
+
+        /**
+            Write the file, replacing it atomically
+         */
+        void Save() const {
+            std::string data = Magic();
+            detail::WriteInteger(data, 4, durations.size());
+            for (const auto& entry : durations) {
+                detail::WriteString(data, entry.first);
+                detail::WriteInteger(data, 8, static_cast<std::uint64_t>(entry.second.count()));
+            }
+
+            detail::ReplaceFile(path, data);
+        }
+
+    private:
+        // Magic and format version
+        static std::string Magic() {
+            return std::string("CNRYTIM\x01", 8);
+        }
+
+        struct Run {
+            const Task* task = nullptr;
+            Clock::time_point start;
+            Clock::duration duration;
+            bool success = false;
+        };
+
+        std::string path;
+        std::unordered_map<std::string, std::chrono::nanoseconds> durations;
+        std::vector<Run> runs;
+    };
+
+} /* namespace Canary */
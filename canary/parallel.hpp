@@ -0,0 +1,360 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "aligned.hpp"
+#include "ansi.hpp"
+#include "cancel.hpp"
+#include "status.hpp"
+#include "tasks.hpp"
+#include "timer.hpp"
+
+namespace Canary {
+
+    namespace detail {
+
+        /**
+            ParallelLoop
+
+            Runs fn(i) for every index of a range on a set of workers.
+            Every worker owns a slice of the range and takes chunks from
+            its front; idle workers steal the back half of the slice of
+            a random victim. Slices are guarded by a mutex, which is only
+            taken once per chunk.
+
+            Chunks adapt to the cost of the items: a worker doubles its
+            chunk while a chunk takes less than the target time and
+            halves it while it takes much longer, so cheap items do not
+            pay for the synchronization and expensive ones still spread
+            over all workers.
+
+            Every worker counts the items it finished in a counter of
+            its own, which the progress display only reads.
+
+            Inside a task the loop is chained to the cancellation of
+            the task, so its timeout and a fail-fast stop the loop. The
+            cancellation of the options is checked after every chunk as
+            well. The task already has a line of its own, so a nested
+            loop shows neither a progress bar nor a finished line, and it
+            runs on the thread of the task unless the options ask for
+            more workers: the executor keeps the other cores busy.
+         */
+        template<class Fn>
+        class ParallelLoop {
+        public:
+            ParallelLoop(std::size_t first, std::size_t last, Fn& fn, const ExecutionOptions& options)
+                : first(first), size(last > first ? last - first : 0), fn(fn), options(options),
+                  nested(CurrentCancellationSlot() != nullptr),
+                  source(options.cancellation != nullptr ? &options.cancellation->State() : nullptr),
+                  execution(CurrentCancellationSlot() != nullptr ? CurrentCancellationSlot() : source) {
+                unsigned count = options.workers;
+                if (count == 0) count = nested ? 1u : std::max(1u, std::thread::hardware_concurrency());
+                count = static_cast<unsigned>(std::min<std::size_t>(count, std::max<std::size_t>(size, 1)));
+
+                // Equal slices to start with, stealing evens out the rest
+                for (unsigned i = 0; i < count; ++i) {
+                    workers.push_back(MakeAligned<Worker>());
+                    workers.back()->begin = first + size * i / count;
+                    workers.back()->end = first + size * (i + 1) / count;
+                }
+            }
+
+            void Run() {
+                if (size == 0) return;
+
+                const bool verbose = options.verbose && !nested;
+
+                std::unique_ptr<LiveStatus> status;
+                if (verbose && options.live && LiveStatus::Supported()) {
+                    status.reset(new LiveStatus(1));
+                    status->Track(0, [this]() { return ProgressLabel(); });
+                }
+
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+                // The calling thread is worker 0
+                std::vector<std::thread> threads;
+                for (unsigned i = 1; i < workers.size(); ++i) {
+                    threads.emplace_back(&ParallelLoop::Work, this, i);
+                }
+                Work(0);
+
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+
+                if (verbose) {
+                    std::string line = FinishedLine(std::chrono::steady_clock::now() - start);
+                    if (status) {
+                        status->Finish(0, std::move(line));
+                        status->Stop();
+                    } else {
+                        std::cout << line << std::endl;
+                    }
+                }
+
+                if (error) std::rethrow_exception(error);
+                if (execution.Expired()) throw DeadlineError("deadline exceeded");
+                if (execution.Cancelled()) throw CancelledError("execution cancelled");
+            }
+
+            // Items finished so far, summed over the workers
+            std::size_t Finished() const {
+                std::size_t total = 0;
+                for (const auto& worker : workers) {
+                    total += worker->finished.load(std::memory_order_relaxed);
+                }
+                return total;
+            }
+
+        private:
+            struct alignas(64) Worker {
+                std::mutex mutex;
+                std::size_t begin = 0, end = 0;
+
+                // Only written by the owner
+                alignas(64) std::atomic<std::size_t> finished{0};
+            };
+
+            // A chunk should take about 50 us
+            static Timer::Ticks TargetTicks() {
+                return std::max<Timer::Ticks>(1, static_cast<Timer::Ticks>(
+                    50000 / TimerCalibration::Instance().nanosecondsPerTick));
+            }
+
+            void Work(unsigned self) {
+                const CancellationState* previous = CurrentCancellationSlot();
+                CurrentCancellationSlot() = &execution;
+
+                Worker& worker = *workers[self];
+                std::uint64_t seed = 0x9E3779B97F4A7C15ull * (self + 1);
+                std::size_t chunk = 1;
+                const Timer::Ticks target = TargetTicks();
+
+                std::size_t begin, end;
+                while (!stopped.load(std::memory_order_relaxed)) {
+                    if (!Take(worker, chunk, begin, end) && !Steal(self, seed, chunk, begin, end)) break;
+
+                    Timer::Ticks start = Timer::Now();
+                    try {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            fn(i);
+                        }
+                    } catch (...) {
+                        Fail(std::current_exception());
+                        break;
+                    }
+                    Timer::Ticks took = Timer::Now() - start;
+
+                    worker.finished.store(worker.finished.load(std::memory_order_relaxed) + (end - begin),
+                                          std::memory_order_relaxed);
+
+                    if (took < target && chunk < (std::size_t(1) << 30)) {
+                        chunk *= 2;
+                    } else if (took > 4 * target && chunk > 1) {
+                        chunk /= 2;
+                    }
+
+                    // fn sees the source through the token from now on
+                    if (source != nullptr && source->Cancelled()) execution.Cancel();
+                    if (execution.Cancelled()) stopped.store(true, std::memory_order_relaxed);
+                }
+
+                CurrentCancellationSlot() = previous;
+            }
+
+            // The next chunk from the front of the own slice
+            bool Take(Worker& worker, std::size_t chunk, std::size_t& begin, std::size_t& end) {
+                std::lock_guard<std::mutex> lock(worker.mutex);
+                if (worker.begin == worker.end) return false;
+
+                begin = worker.begin;
+                end = begin + std::min(chunk, worker.end - worker.begin);
+                worker.begin = end;
+                return true;
+            }
+
+            // Move the back half of a victim's slice over, then take a chunk of it
+            bool Steal(unsigned self, std::uint64_t& seed, std::size_t chunk, std::size_t& begin, std::size_t& end) {
+                const std::size_t count = workers.size();
+                Worker& worker = *workers[self];
+
+                // xorshift to pick the first victim
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+
+                std::size_t victim = seed % count;
+                for (std::size_t i = 0; i < count; ++i, victim = (victim + 1) % count) {
+                    if (victim == self) continue;
+
+                    std::size_t stolenBegin, stolenEnd;
+                    {
+                        Worker& other = *workers[victim];
+                        std::lock_guard<std::mutex> lock(other.mutex);
+                        std::size_t left = other.end - other.begin;
+                        if (left == 0) continue;
+
+                        stolenEnd = other.end;
+                        stolenBegin = other.end - (left + 1) / 2;
+                        other.end = stolenBegin;
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(worker.mutex);
+                        worker.begin = stolenBegin;
+                        worker.end = stolenEnd;
+                    }
+                    return Take(worker, chunk, begin, end);
+                }
+                return false;
+            }
+
+            void Fail(std::exception_ptr taskError) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) error = taskError;
+                stopped.store(true, std::memory_order_relaxed);
+            }
+
+            // "█████░░░░░  45% 4500/10000 items"
+            std::string ProgressLabel() const {
+                const std::size_t done = Finished();
+                const std::size_t width = 30;
+                const std::size_t filled = size > 0 ? width * done / size : width;
+
+                const char* full = detail::ModeGlyph("\xE2\x96\x88", "#");
+                const char* empty = detail::ModeGlyph("\xE2\x96\x91", ".");
+
+                std::string label;
+                AppendStyle<Ansi::GreenForeground>(label);
+                for (std::size_t i = 0; i < filled; ++i) label += full;
+                AppendStyle<Ansi::Reset, Ansi::Faint>(label);
+                for (std::size_t i = filled; i < width; ++i) label += empty;
+                AppendStyle<Ansi::Reset>(label);
+
+                char numbers[64];
+                std::snprintf(numbers, sizeof(numbers), " %3zu%% %zu/%zu items", size > 0 ? 100 * done / size : 100, done, size);
+                label += numbers;
+                return label;
+            }
+
+            // "✓ 10000 of 10000 items (123 ms on 4 workers)"
+            std::string FinishedLine(std::chrono::steady_clock::duration took) const {
+                std::string line;
+                if (!error && !execution.Cancelled()) {
+                    AppendStyle<Ansi::GreenForeground>(line);
+                    line += detail::CheckGlyph();
+                    line += " ";
+                } else {
+                    AppendStyle<Ansi::RedForeground>(line);
+                    line += detail::CrossGlyph();
+                    line += " ";
+                }
+                AppendStyle<Ansi::Reset>(line);
+
+                line += std::to_string(Finished()) + " of " + std::to_string(size) + " items";
+                AppendStyle<Ansi::Faint>(line);
+                line += " (" + std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(took).count()) +
+                        " ms on " + std::to_string(workers.size()) + (workers.size() == 1 ? " worker)" : " workers)");
+                AppendStyle<Ansi::Reset>(line);
+                return line;
+            }
+
+            const std::size_t first, size;
+            Fn& fn;
+            const ExecutionOptions& options;
+
+            // Called from a task or from another loop
+            const bool nested;
+
+            std::vector<AlignedPtr<Worker>> workers;
+            const CancellationState* source;
+            CancellationState execution;
+            std::atomic<bool> stopped{false};
+
+            std::mutex errorMutex;
+            std::exception_ptr error;
+        };
+
+    } /* namespace detail */
+
+    /**
+        Call fn(i) for every i in [first, last) in parallel, on as many
+        workers as the options say. The calls are spread in adaptive
+        chunks with work stealing, so uneven items balance out.
+
+        With verbose and live options on a terminal, a progress bar
+        shows the finished items. It reads counters that every worker
+        keeps for itself, so there is no synchronization per item.
+
+        Inside a task of ExecuteTasks or ExecuteGraph, the loop prints
+        nothing, as the live region of the executor is on screen, and
+        runs on the calling thread only unless options.workers is set.
+
+        The first exception of fn stops the loop and is rethrown. A
+        cancelled execution, or the timeout of the task that runs the
+        loop, stops it with a CancelledError; fn can check
+        Canary::Cancelled() to stop even earlier.
+
+        Example:
+
+            Canary::ParallelFor(0, images.size(), [&](std::size_t i) {
+                thumbnails[i] = Scale(images[i]);
+            });
+     */
+    template<class Fn>
+    void ParallelFor(std::size_t first, std::size_t last, Fn fn, const ExecutionOptions& options = ExecutionOptions()) {
+        detail::ParallelLoop<Fn> loop(first, last, fn, options);
+        loop.Run();
+    }
+
+    /**
+        Call fn(item) for every item of a random access range in parallel
+
+        Example:
+
+            std::vector<std::string> files = ...;
+            Canary::ParallelFor(files, [](const std::string& file) {
+                Compress(file);
+            });
+     */
+    template<class Range, class Fn,
+             class = decltype(std::begin(std::declval<Range&>())[0])>
+    void ParallelFor(Range& range, Fn fn, const ExecutionOptions& options = ExecutionOptions()) {
+        auto begin = std::begin(range);
+        std::size_t size = static_cast<std::size_t>(std::distance(begin, std::end(range)));
+
+        auto call = [&fn, begin](std::size_t i) { fn(begin[static_cast<std::ptrdiff_t>(i)]); };
+        ParallelFor(0, size, call, options);
+    }
+
+} /* namespace Canary */
@@ -0,0 +1,478 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CANARY_SCAN_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CANARY_SCAN_NEON 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "emoji/view.hpp"
+#include "hash.hpp"
+#include "emoji_table.hpp"
+
+namespace Canary {
+
+    namespace detail {
+
+        /**
+            A hash for names of a few dozen bytes: every 8 byte word and
+            the last, possibly overlapping, word go through one multiply
+            each. Much cheaper than Hash64 on short keys and good enough
+            for the table, whose names all hash differently.
+            tools/emoji_tables.py mirrors it.
+         */
+        inline std::uint64_t ShortcodeHash(const char* name, std::size_t length) {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(name);
+            std::uint64_t hash = length * HashPrime1;
+            if (length >= 8) {
+                for (std::size_t i = 0; i + 8 < length; i += 8) {
+                    hash = RotateLeft(hash ^ Load64(p + i), 31) * HashPrime2;
+                }
+                hash = RotateLeft(hash ^ Load64(p + length - 8), 31) * HashPrime2;
+            } else if (length >= 4) {
+                std::uint64_t word = Load32(p) | static_cast<std::uint64_t>(Load32(p + length - 4)) << 32;
+                hash = RotateLeft(hash ^ word, 31) * HashPrime2;
+            } else if (length > 0) {
+                std::uint64_t word = p[0] | p[length / 2] << 8 | p[length - 1] << 16;
+                hash = RotateLeft(hash ^ word, 31) * HashPrime2;
+            }
+
+            hash ^= hash >> 33;
+            hash *= HashPrime3;
+            hash ^= hash >> 29;
+            return hash;
+        }
+
+        // Where a name with the hash lands for the pilot of its bucket, tools/emoji_tables.py mirrors it
+        inline std::size_t ShortcodeSlot(std::uint64_t hash, std::uint16_t pilot) {
+            std::uint64_t x = RotateLeft(hash, 32) ^ (pilot * HashPrime1);
+            x ^= x >> 29;
+            x *= HashPrime3;
+            x ^= x >> 32;
+            return static_cast<std::size_t>(x % EmojiTable::count);
+        }
+
+        /**
+            The index of the emoji of a name, NoEmoji for unknown names.
+            The table is a minimal perfect hash generated by
+            tools/emoji_tables.py: one hash, one pilot load and one
+            comparison, no heap.
+         */
+        constexpr std::size_t NoEmoji = ~std::size_t(0);
+
+        inline std::size_t FindShortcode(const char* name, std::size_t length) {
+            if (length == 0 || length > EmojiTable::longestName) return NoEmoji;
+
+            std::uint64_t hash = ShortcodeHash(name, length);
+            std::size_t index = EmojiTable::slots[ShortcodeSlot(hash, EmojiTable::pilots[hash % EmojiTable::buckets])];
+
+            if (EmojiTable::nameLengths[index] != length ||
+                std::memcmp(EmojiTable::names + EmojiTable::nameOffsets[index], name, length) != 0) {
+                return NoEmoji;
+            }
+            return index;
+        }
+
+        // Append the emoji at an index of the table
+        inline void AppendEmoji(std::string& out, std::size_t index) {
+            out.append(EmojiTable::bytes + EmojiTable::offsets[index], EmojiTable::lengths[index]);
+        }
+
+        inline unsigned CountTrailingZeros(std::uint64_t value) {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward64(&index, value);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctzll(value));
+#endif
+        }
+
+        inline unsigned PopCount(std::uint64_t value) {
+#if defined(_MSC_VER)
+            return static_cast<unsigned>(__popcnt64(value));
+#else
+            return static_cast<unsigned>(__builtin_popcountll(value));
+#endif
+        }
+
+        /**
+            The first colon in [p, end), end if there is none. Compares
+            32 bytes per step with SSE2 or NEON, the rest byte by byte.
+         */
+        inline const char* FindColon(const char* p, const char* end) {
+#if defined(CANARY_SCAN_SSE2)
+            const __m128i colon = _mm_set1_epi8(':');
+            for (; end - p >= 32; p += 32) {
+                __m128i low = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), colon);
+                __m128i high = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), colon);
+                std::uint64_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(low)) |
+                                     static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(high))) << 16;
+                if (mask != 0) return p + CountTrailingZeros(mask);
+            }
+#elif defined(CANARY_SCAN_NEON)
+            const uint8x16_t colon = vdupq_n_u8(':');
+            for (; end - p >= 16; p += 16) {
+                uint8x16_t equal = vceqq_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(p)), colon);
+
+                // Four bits per byte, there is no movemask
+                std::uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0);
+                if (mask != 0) return p + (CountTrailingZeros(mask) >> 2);
+            }
+#endif
+            for (; p < end; ++p) {
+                if (*p == ':') return p;
+            }
+            return end;
+        }
+
+        /**
+            Append text to out with the shortcodes replaced and return
+            how many bytes were used. Unless the text is final, it stops
+            at a colon that may open a shortcode which is not closed yet.
+            A colon that does not open a shortcode may still close one.
+         */
+        inline std::size_t ExpandShortcodes(const char* text, std::size_t length, std::string& out, bool final) {
+            const char* const end = text + length;
+            const char* copied = text;
+            const char* open = FindColon(text, end);
+
+            while (open != end) {
+                // A name is never longer than the table's longest, so neither is the search
+                const char* limit = end - open - 1 > static_cast<std::ptrdiff_t>(EmojiTable::longestName + 1)
+                                        ? open + 1 + EmojiTable::longestName + 1 : end;
+                const char* close = FindColon(open + 1, limit);
+
+                if (close == limit) {
+                    if (limit == end && !final) {
+                        out.append(copied, open);
+                        return static_cast<std::size_t>(open - text);
+                    }
+                    open = FindColon(limit, end);
+                    continue;
+                }
+
+                std::size_t index = FindShortcode(open + 1, static_cast<std::size_t>(close - open - 1));
+                if (index == NoEmoji) {
+                    // The closing colon may open the next one
+                    open = close;
+                    continue;
+                }
+
+                out.append(copied, open);
+                AppendEmoji(out, index);
+                copied = close + 1;
+                open = FindColon(copied, end);
+            }
+
+            out.append(copied, end);
+            return length;
+        }
+
+        // The child of a trie node for a byte, 0 if there is none
+        inline std::size_t ReverseChild(std::size_t node, unsigned char byte) {
+            if (node == 0) return EmojiTable::reverseRoot[byte];
+
+            const ReverseNode& parent = EmojiTable::reverseNodes[node];
+            std::uint64_t bit = std::uint64_t(1) << (byte & 0x3F);
+            if ((byte & 0xC0) != parent.high || (parent.children & bit) == 0) return 0;
+            return parent.first + PopCount(parent.children & (bit - 1));
+        }
+
+        /**
+            The length of the longest emoji at the start of the text, 0
+            if it does not start with one. The index of the emoji is
+            stored in index.
+         */
+        inline std::size_t MatchEmoji(const unsigned char* text, std::size_t length, std::size_t& index) {
+            const std::size_t limit = std::min(length, EmojiTable::longestEmoji);
+            std::size_t node = 0, matched = 0;
+            for (std::size_t i = 0; i < limit; ++i) {
+                node = ReverseChild(node, text[i]);
+                if (node == 0) break;
+
+                std::uint16_t found = EmojiTable::reverseNodes[node].emoji;
+                if (found != 0) {
+                    index = found - 1u;
+                    matched = i + 1;
+                }
+            }
+            return matched;
+        }
+
+        /**
+            The text mode replacement of the bytes of one emoji, with or
+            without the space of emoji.hpp, or nullptr if they are not
+            exactly one emoji
+         */
+        inline const char* TextOfEmoji(const char* bytes, std::size_t length) {
+            if (length > 0 && bytes[length - 1] == ' ') --length;
+
+            std::size_t index = 0;
+            std::size_t matched = MatchEmoji(reinterpret_cast<const unsigned char*>(bytes), length, index);
+            return matched == length && matched > 0 ? EmojiTable::text + EmojiTable::textOffsets[index] : nullptr;
+        }
+
+        // Gives the task printers of glyph.hpp the replacements of the
+        // emojis of tasks, in every program that includes this header
+        static const bool textOfEmojiHooked = (Glyphs<>::text = &TextOfEmoji, true);
+
+    } /* namespace detail */
+
+    namespace Emoji {
+
+        /**
+            The emoji of a name like "rocket", Emoji::rocket without its
+            trailing space, or nullptr if there is no emoji of that name
+
+            Example:
+
+                const char* emoji = Canary::Emoji::Find(config["icon"]);
+                if (emoji != nullptr) std::cout << emoji;
+         */
+        inline const char* Find(const char* name, std::size_t length) {
+            std::size_t index = detail::FindShortcode(name, length);
+            return index != detail::NoEmoji ? detail::EmojiTable::bytes + detail::EmojiTable::offsets[index] : nullptr;
+        }
+
+        inline const char* Find(const char* name) {
+            return Find(name, std::strlen(name));
+        }
+
+        inline const char* Find(const std::string& name) {
+            return Find(name.data(), name.size());
+        }
+
+#if defined(CANARY_STRING_VIEW)
+        inline const char* Find(std::string_view name) {
+            return Find(name.data(), name.size());
+        }
+#endif
+
+        /**
+            The name of an emoji, "rocket" for the bytes of Emoji::rocket,
+            or nullptr if the bytes are not exactly one emoji. Both the
+            emoji alone and the emoji with the space of emoji.hpp work,
+            as do emojis without their variation selector U+FE0F.
+         */
+        inline const char* NameOf(const char* bytes, std::size_t length) {
+            if (length > 0 && bytes[length - 1] == ' ') --length;
+
+            std::size_t index = 0;
+            std::size_t matched = detail::MatchEmoji(reinterpret_cast<const unsigned char*>(bytes), length, index);
+            return matched == length && matched > 0 ? detail::EmojiTable::names + detail::EmojiTable::nameOffsets[index] : nullptr;
+        }
+
+        inline const char* NameOf(const std::string& bytes) {
+            return NameOf(bytes.data(), bytes.size());
+        }
+
+        /**
+            Find the emojis in a text in one pass and call
+            fn(offset, length, name) for each. Where emojis overlap, the
+            longest wins: a ZWJ sequence like construction_worker_woman
+            is one emoji, not a worker and a woman sign. Bytes that no
+            emoji starts with are skipped with one table lookup.
+
+            Example:
+
+                std::map<std::string, int> counts;
+                Canary::Emoji::Scan(log.data(), log.size(),
+                    [&](std::size_t, std::size_t, const char* name) { ++counts[name]; });
+         */
+        template<class Fn>
+        void Scan(const char* text, std::size_t length, Fn fn) {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(text);
+            const std::uint16_t* root = detail::EmojiTable::reverseRoot;
+
+            std::size_t i = 0;
+            while (i < length) {
+                if (root[p[i]] == 0) {
+                    ++i;
+                    continue;
+                }
+
+                std::size_t index = 0;
+                std::size_t matched = detail::MatchEmoji(p + i, length - i, index);
+                if (matched == 0) {
+                    ++i;
+                    continue;
+                }
+
+                fn(i, matched, static_cast<const char*>(detail::EmojiTable::names + detail::EmojiTable::nameOffsets[index]));
+                i += matched;
+            }
+        }
+
+        /**
+            Replace the shortcodes like :sparkles: in the text by their
+            emojis. Colons that do not enclose a known name stay as they
+            are. The emojis are inserted without the trailing space of
+            the constants. Runs without shortcodes are copied in bulk, the colons
+            are searched with SIMD instructions.
+
+            Example:
+
+                std::cout << Canary::Emoji::Expand("Deployed :rocket:") << std::endl;
+         */
+        inline void Expand(const char* text, std::size_t length, std::string& out) {
+            out.reserve(out.size() + length);
+            detail::ExpandShortcodes(text, length, out, true);
+        }
+
+        inline std::string Expand(const std::string& text) {
+            std::string out;
+            Expand(text.data(), text.size(), out);
+            return out;
+        }
+
+        /**
+            Expander
+
+            Expands shortcodes in a stream of text that arrives in
+            pieces and writes the result to a stream. A shortcode may be
+            split across pieces: the unfinished end of a piece, at most
+            a colon and a name, waits for the next one. Flush() writes
+            it out as it is, the destructor flushes.
+
+            Example:
+
+                Canary::Emoji::Expander expander(std::cout);
+                while (std::getline(messages, line)) {
+                    expander.Write(line + "\n");
+                }
+         */
+        class Expander {
+        public:
+            explicit Expander(std::ostream& out) : out(out) {}
+
+            Expander(const Expander&) = delete;
+            Expander& operator=(const Expander&) = delete;
+
+            ~Expander() {
+                Flush();
+            }
+
+            void Write(const char* data, std::size_t size) {
+                buffer.clear();
+
+                if (!pending.empty()) {
+                    std::size_t used = Resume(data, size);
+                    data += used;
+                    size -= used;
+
+                    // The whole piece went into the unfinished name
+                    if (!pending.empty()) return;
+                }
+
+                std::size_t used = detail::ExpandShortcodes(data, size, buffer, false);
+                pending.assign(data + used, size - used);
+                Emit();
+            }
+
+            void Write(const std::string& text) {
+                Write(text.data(), text.size());
+            }
+
+            // Write out the end that waits for the rest of a shortcode
+            void Flush() {
+                if (!pending.empty()) {
+                    out.write(pending.data(), static_cast<std::streamsize>(pending.size()));
+                    pending.clear();
+                }
+                out.flush();
+            }
+
+        private:
+            /**
+                Finish the pending colon and name with the start of the
+                new data, return how many bytes of it were used. The
+                pending text never has a second colon.
+             */
+            std::size_t Resume(const char* data, std::size_t size) {
+                const std::size_t room = detail::EmojiTable::longestName + 1 - (pending.size() - 1);
+                const char* limit = data + std::min(size, room);
+                const char* close = detail::FindColon(data, limit);
+
+                if (close == limit) {
+                    if (size < room) {
+                        // Still not closed, wait for more
+                        pending.append(data, size);
+                        return size;
+                    }
+                    buffer += pending;
+                    pending.clear();
+                    return 0;
+                }
+
+                pending.append(data, close);
+                std::size_t index = detail::FindShortcode(pending.data() + 1, pending.size() - 1);
+                if (index == detail::NoEmoji) {
+                    // The closing colon may open the next one
+                    buffer += pending;
+                    pending.clear();
+                    return static_cast<std::size_t>(close - data);
+                }
+
+                detail::AppendEmoji(buffer, index);
+                pending.clear();
+                return static_cast<std::size_t>(close - data) + 1;
+            }
+
+            void Emit() {
+                if (!buffer.empty()) out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            }
+
+            std::ostream& out;
+
+            // The colon and the start of a name at the end of the last piece
+            std::string pending;
+
+            // The expanded piece, kept to reuse its memory
+            std::string buffer;
+        };
+
+        /**
+            Copy a stream to another with the shortcodes expanded
+         */
+        inline void Expand(std::istream& in, std::ostream& out) {
+            Expander expander(out);
+            char chunk[1 << 16];
+            while (in) {
+                in.read(chunk, sizeof(chunk));
+                if (in.gcount() > 0) expander.Write(chunk, static_cast<std::size_t>(in.gcount()));
+            }
+        }
+
+    } /* namespace Emoji */
+
+} /* namespace Canary */
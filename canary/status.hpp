@@ -0,0 +1,397 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+#include "aligned.hpp"
+#include "ansi.hpp"
+#include "capture.hpp"
+#include "glyph.hpp"
+
+namespace Canary {
+
+    namespace detail {
+
+        // Append the escape code of a style to a string
+        template<class... Styles>
+        void AppendStyle(std::string& out) {
+            using Code = Ansi::detail::EscapeCodes<Styles...>;
+            out += Ansi::detail::ConvertCompileTimeString<typename Code::AnsiCode>::Value;
+        }
+
+    } /* namespace detail */
+
+    /**
+        LiveStatus
+
+        A region at the bottom of the terminal with one line per running
+        job, showing a spinner, the elapsed time and a label. Permanent
+        log lines are printed above the region and scroll away with the
+        rest of the output.
+
+        All updates only touch the slot of the calling worker. A
+        separate thread redraws the region at a fixed rate and only
+        writes what changed since the last frame: rows whose label did
+        not change only get their spinner and time overwritten in place.
+
+        Example:
+
+            Canary::LiveStatus status(workers);
+
+            // On worker i
+            status.Start(i, "Compile a.cpp");
+            // ...
+            status.Finish(i, "Compiled a.cpp");
+     */
+    class LiveStatus {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        explicit LiveStatus(std::size_t slots, std::ostream& out = std::cout,
+                            std::chrono::milliseconds interval = std::chrono::milliseconds(80))
+            : out(out), interval(interval), slots(slots) {
+            for (auto& slot : this->slots) {
+                slot = detail::MakeAligned<Slot>();
+            }
+            renderer = std::thread(&LiveStatus::RenderLoop, this);
+        }
+
+        LiveStatus(const LiveStatus&) = delete;
+        LiveStatus& operator=(const LiveStatus&) = delete;
+
+        ~LiveStatus() {
+            Stop();
+        }
+
+        /**
+            Show a running job in the line of the slot, with the time it
+            is expected to take if that is known
+         */
+        void Start(std::size_t slot, std::string label, Clock::duration expected = Clock::duration::zero()) {
+            Slot& s = *slots[slot];
+            Clock::time_point now = Clock::now();
+
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.label = std::move(label);
+            s.track = nullptr;
+            s.start = now;
+            s.expected = expected;
+            s.active = true;
+        }
+
+        /**
+            Show a running job whose label is computed on every frame,
+            for example from progress counters. The function is called
+            on the render thread, with the lock of the slot held.
+         */
+        void Track(std::size_t slot, std::function<std::string()> label) {
+            Slot& s = *slots[slot];
+            Clock::time_point now = Clock::now();
+
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.label.clear();
+            s.track = std::move(label);
+            s.start = now;
+            s.expected = Clock::duration::zero();
+            s.active = true;
+        }
+
+        /**
+            Remove the line of the slot and print a permanent line
+            instead, followed by the output as one block
+         */
+        void Finish(std::size_t slot, std::string line, std::unique_ptr<OutputBuffer> output = nullptr) {
+            Slot& s = *slots[slot];
+            Entry entry{ NextSequence(), std::move(line), std::move(output) };
+
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.active = false;
+            s.track = nullptr;
+            s.logs.push_back(std::move(entry));
+        }
+
+        /**
+            Print a permanent line above the region
+         */
+        void Log(std::string line) {
+            Entry entry{ NextSequence(), std::move(line), nullptr };
+
+            std::lock_guard<std::mutex> lock(logMutex);
+            logs.push_back(std::move(entry));
+        }
+
+        /**
+            Print the outstanding log lines, remove the region and stop
+            the render thread. Called by the destructor.
+         */
+        void Stop() {
+            {
+                std::lock_guard<std::mutex> lock(renderMutex);
+                if (stopped) return;
+                stopped = true;
+            }
+            wakeup.notify_all();
+            renderer.join();
+
+            Render(true);
+        }
+
+        /**
+            The number of lines of the terminal on stdout, from LINES if
+            it cannot be asked and 24 if that is unset as well
+         */
+        static std::size_t TerminalHeight() {
+#if !defined(_WIN32)
+            struct winsize size;
+            if (ioctl(fileno(stdout), TIOCGWINSZ, &size) == 0 && size.ws_row > 0) return size.ws_row;
+#endif
+            const char* lines = std::getenv("LINES");
+            if (lines != nullptr && std::atoi(lines) > 0) return static_cast<std::size_t>(std::atoi(lines));
+            return 24;
+        }
+
+        /**
+            True if stdout is a terminal that understands the cursor
+            movement the region needs
+         */
+        static bool Supported() {
+            const char* term = std::getenv("TERM");
+            if (term != nullptr && std::string(term) == "dumb") return false;
+#if defined(_WIN32)
+            return _isatty(_fileno(stdout)) != 0;
+#else
+            return isatty(fileno(stdout)) != 0;
+#endif
+        }
+
+    private:
+        struct Entry {
+            std::uint64_t sequence;
+            std::string line;
+            std::unique_ptr<OutputBuffer> output;
+        };
+
+        struct alignas(64) Slot {
+            std::mutex mutex;
+            std::string label;
+            Clock::time_point start;
+            Clock::duration expected;
+            std::function<std::string()> track;
+            bool active = false;
+            std::vector<Entry> logs;
+        };
+
+        struct Row {
+            std::string status;
+            std::string label;
+        };
+
+        std::uint64_t NextSequence() {
+            return sequence.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void RenderLoop() {
+            std::unique_lock<std::mutex> lock(renderMutex);
+            while (!stopped) {
+                wakeup.wait_for(lock, interval);
+                if (stopped) break;
+
+                lock.unlock();
+                Render(false);
+                lock.lock();
+            }
+        }
+
+        // Spinner, elapsed and expected time, of the same width for all
+        // jobs with an expected time and for all without
+        std::string Status(Clock::time_point start, Clock::duration expected, Clock::time_point now) const {
+            static const char* const spinner[] = {
+                "\xE2\xA0\x8B", "\xE2\xA0\x99", "\xE2\xA0\xB9", "\xE2\xA0\xB8", "\xE2\xA0\xBC",
+                "\xE2\xA0\xB4", "\xE2\xA0\xA6", "\xE2\xA0\xA7", "\xE2\xA0\x87", "\xE2\xA0\x8F"
+            };
+
+            char elapsed[48];
+            if (expected > Clock::duration::zero()) {
+                char total[16];
+                std::snprintf(total, sizeof(total), "~%.1fs", std::chrono::duration<double>(expected).count());
+                std::snprintf(elapsed, sizeof(elapsed), "%6.1fs/%-7s ",
+                              std::chrono::duration<double>(now - start).count(), total);
+            } else {
+                std::snprintf(elapsed, sizeof(elapsed), "%6.1fs ",
+                              std::chrono::duration<double>(now - start).count());
+            }
+
+            std::string status = "  ";
+            detail::AppendStyle<Ansi::CyanForeground>(status);
+            if (Emoji::CurrentMode() == Emoji::Mode::Emoji) {
+                status += spinner[frame % 10];
+            } else {
+                status += "|/-\\"[frame % 4];
+            }
+            detail::AppendStyle<Ansi::Reset, Ansi::Faint>(status);
+            status += elapsed;
+            detail::AppendStyle<Ansi::Reset>(status);
+            return status;
+        }
+
+        void Render(bool last) {
+            Clock::time_point now = Clock::now();
+            ++frame;
+
+            // Collect the log lines and the running jobs
+            std::vector<Entry> pending;
+            {
+                std::lock_guard<std::mutex> lock(logMutex);
+                pending.swap(logs);
+            }
+
+            std::vector<Row> rows;
+            for (auto& slot : slots) {
+                std::lock_guard<std::mutex> lock(slot->mutex);
+                std::move(slot->logs.begin(), slot->logs.end(), std::back_inserter(pending));
+                slot->logs.clear();
+
+                if (slot->active && !last) {
+                    rows.push_back(Row{ Status(slot->start, slot->expected, now),
+                                        slot->track ? slot->track() : slot->label });
+                }
+            }
+
+            // Moving up more lines than the terminal has corrupts the
+            // region, the jobs that do not fit are summed up in the last row
+            const std::size_t height = std::max<std::size_t>(TerminalHeight(), 2) - 1;
+            if (rows.size() > height) {
+                std::size_t hidden = rows.size() - height + 1;
+                rows.resize(height - 1);
+
+                Row more{ "  ", std::string() };
+                detail::AppendStyle<Ansi::Faint>(more.label);
+                more.label += "+" + std::to_string(hidden) + " more";
+                detail::AppendStyle<Ansi::Reset>(more.label);
+                rows.push_back(std::move(more));
+            }
+
+            if (pending.empty() && rows.empty() && shown.empty()) return;
+
+            std::sort(pending.begin(), pending.end(), [](const Entry& a, const Entry& b) {
+                return a.sequence < b.sequence;
+            });
+
+            buffer.clear();
+
+            // Back to the first line of the region
+            if (!shown.empty()) {
+                buffer += "\r\033[" + std::to_string(shown.size()) + "A";
+            }
+
+            // New log lines push the region down, everything is redrawn
+            bool redraw = !pending.empty();
+            if (redraw) {
+                buffer += "\033[J";
+            }
+
+            for (const Entry& entry : pending) {
+                buffer += entry.line;
+                buffer += "\n";
+
+                if (entry.output != nullptr) {
+                    char last = '\n';
+                    entry.output->ForEachChunk([&](const char* data, std::size_t count) {
+                        if (buffer.size() + count > (1 << 16)) Flush();
+                        buffer.append(data, count);
+                        last = data[count - 1];
+                    });
+                    if (last != '\n') buffer += "\n";
+                }
+            }
+
+            // Long labels are cut instead of wrapped, otherwise the
+            // number of lines of the region would be unknown
+            buffer += "\033[?7l";
+            for (std::size_t i = 0; i < rows.size(); ++i) {
+                const Row& row = rows[i];
+                if (redraw || i >= shown.size() || shown[i].label != row.label ||
+                    shown[i].status.size() != row.status.size()) {
+                    buffer += "\033[2K";
+                    buffer += row.status;
+                    buffer += row.label;
+                } else if (shown[i].status != row.status) {
+                    buffer += row.status;
+                }
+                buffer += "\n";
+            }
+            buffer += "\033[?7h";
+
+            if (rows.size() < shown.size()) {
+                buffer += "\033[J";
+            }
+
+            shown.swap(rows);
+
+            Flush();
+            out.flush();
+        }
+
+        void Flush() {
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+
+        std::ostream& out;
+        const std::chrono::milliseconds interval;
+
+        std::vector<detail::AlignedPtr<Slot>> slots;
+        std::atomic<std::uint64_t> sequence{0};
+
+        std::mutex logMutex;
+        std::vector<Entry> logs;
+
+        std::mutex renderMutex;
+        std::condition_variable wakeup;
+        bool stopped = false;
+        std::thread renderer;
+
+        // Only touched by the render thread
+        std::vector<Row> shown;
+        std::size_t frame = 0;
+        std::string buffer;
+    };
+
+} /* namespace Canary */
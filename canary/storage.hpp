@@ -0,0 +1,99 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace Canary {
+
+    namespace detail {
+
+        /**
+            Helpers for the small binary files that keep state between
+            runs, like the TimingHistory and the TaskCache. Integers are
+            stored little endian with a fixed number of bytes.
+         */
+        inline void WriteInteger(std::string& out, int bytes, std::uint64_t value) {
+            for (int i = 0; i < bytes; ++i) {
+                out += static_cast<char>((value >> (8 * i)) & 0xFF);
+            }
+        }
+
+        // False if the data ends before the integer
+        inline bool ReadInteger(const std::string& in, std::size_t& pos, int bytes, std::uint64_t& value) {
+            if (in.size() - pos < static_cast<std::size_t>(bytes)) return false;
+
+            value = 0;
+            for (int i = 0; i < bytes; ++i) {
+                value |= static_cast<std::uint64_t>(static_cast<unsigned char>(in[pos + i])) << (8 * i);
+            }
+            pos += static_cast<std::size_t>(bytes);
+            return true;
+        }
+
+        // A string with its length in front
+        inline void WriteString(std::string& out, const std::string& value) {
+            WriteInteger(out, 4, value.size());
+            out += value;
+        }
+
+        inline bool ReadString(const std::string& in, std::size_t& pos, std::string& value) {
+            std::uint64_t length = 0;
+            if (!ReadInteger(in, pos, 4, length) || in.size() - pos < length) return false;
+
+            value.assign(in, pos, static_cast<std::size_t>(length));
+            pos += static_cast<std::size_t>(length);
+            return true;
+        }
+
+        // False if the file cannot be read
+        inline bool ReadFile(const std::string& path, std::string& data) {
+            std::ifstream file(path, std::ios::binary);
+            if (!file) return false;
+
+            data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return !file.bad();
+        }
+
+        /**
+            Replace a file atomically through a temporary file next to
+            it, so an interrupted run never leaves a broken file behind
+         */
+        inline void ReplaceFile(const std::string& path, const std::string& data) {
+            std::string temporary = path + ".tmp";
+            {
+                std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+                file.write(data.data(), static_cast<std::streamsize>(data.size()));
+                if (!file) {
+                    throw std::runtime_error("Canary: cannot write '" + temporary + "'");
+                }
+            }
+            if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+                std::remove(temporary.c_str());
+                throw std::runtime_error("Canary: cannot replace '" + path + "'");
+            }
+        }
+
+    } /* namespace detail */
+
+} /* namespace Canary */
@@ -0,0 +1,352 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ansi.hpp"
+#include "status.hpp"
+#include "tasks.hpp"
+#include "timeline.hpp"
+#include "usage.hpp"
+
+namespace Canary {
+
+    /**
+        TaskSummary
+
+        Evaluates the timeline of an execution: the slowest tasks with
+        their share of the total task time, the critical path through
+        the dependencies, and how well the workers were used. With
+        resource measurements, the slowest tasks also show their CPU
+        time, peak memory and voluntary/involuntary context switches.
+
+        The parallel efficiency is the summed task time divided by the
+        wall time times the number of workers. Coroutine tasks do not
+        hold a worker while they wait, so with them it only covers the
+        tasks on worker threads and their time is reported on its own. The critical path bounds
+        the wall time from below, so the summed task time divided by its
+        length is the best speedup any number of workers can reach.
+
+        Example:
+
+            Canary::TaskSummary summary;
+
+            Canary::ExecutionOptions options;
+            options.observers.push_back(&summary);
+            Canary::ExecuteGraph(graph, options);
+
+            summary.Print();
+     */
+    class TaskSummary : public TaskTimeline {
+    public:
+        // Show the given number of slowest tasks
+        explicit TaskSummary(std::size_t rows = 10) : rows(rows) {}
+
+        /**
+            The longest chain of dependent tasks, measured by the time
+            the tasks took, from the first task to the last one
+         */
+        std::vector<TaskId> CriticalPath() const {
+            std::vector<TaskId> order = Order();
+            std::vector<Clock::duration> finish(entries.size(), Clock::duration::zero());
+            std::vector<TaskId> previous(entries.size(), entries.size());
+
+            TaskId last = entries.size();
+            for (TaskId id : order) {
+                const Entry& entry = entries[id];
+                for (TaskId dependency : entry.dependencies) {
+                    if (previous[id] == entries.size() || finish[dependency] > finish[previous[id]]) {
+                        previous[id] = dependency;
+                    }
+                }
+
+                finish[id] = (previous[id] < entries.size() ? finish[previous[id]] : Clock::duration::zero()) + Length(entry);
+                if (last == entries.size() || finish[id] > finish[last]) {
+                    last = id;
+                }
+            }
+
+            std::vector<TaskId> path;
+            for (TaskId id = last; id < entries.size(); id = previous[id]) {
+                path.push_back(id);
+            }
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+        // The time all tasks took together
+        Clock::duration TaskTime() const {
+            Clock::duration total = Clock::duration::zero();
+            for (const Entry& entry : entries) {
+                total += Length(entry);
+            }
+            return total;
+        }
+
+        // The time the workers spent on tasks. Coroutine tasks do not
+        // occupy a worker while they wait, so they are left out.
+        Clock::duration WorkerTime() const {
+            Clock::duration total = Clock::duration::zero();
+            for (const Entry& entry : entries) {
+                if (entry.worker < workers) total += Length(entry);
+            }
+            return total;
+        }
+
+        // The time of the coroutine tasks, which ran on the event loop
+        Clock::duration CoroutineTime() const {
+            return TaskTime() - WorkerTime();
+        }
+
+        // Worker time / (wall time * workers), between 0 and 1
+        double Efficiency() const {
+            double capacity = std::chrono::duration<double>(WallTime()).count() * workers;
+            return capacity > 0 ? std::chrono::duration<double>(WorkerTime()).count() / capacity : 0;
+        }
+
+        /**
+            Print the summary of the last execution
+         */
+        void Print(std::ostream& out = std::cout) const {
+            std::vector<TaskId> slowest;
+            bool dependencies = false;
+            bool measured = false;
+            for (TaskId id = 0; id < entries.size(); ++id) {
+                if (!entries[id].ran) continue;
+                slowest.push_back(id);
+                dependencies = dependencies || !entries[id].dependencies.empty();
+                measured = measured || Measured(entries[id].usage);
+            }
+            if (slowest.empty()) return;
+
+            std::size_t shown = std::min(rows, slowest.size());
+            std::partial_sort(slowest.begin(), slowest.begin() + shown, slowest.end(), [this](TaskId a, TaskId b) {
+                return entries[a].Duration() > entries[b].Duration();
+            });
+
+            Clock::duration total = TaskTime();
+            std::string text;
+            AppendStyle<Ansi::Bold>(text);
+            text += "Slowest tasks:";
+            AppendStyle<Ansi::Reset>(text);
+            text += "\n";
+            if (measured) {
+                AppendStyle<Ansi::Faint>(text);
+                text += "     wall  share        cpu     memory  switches";
+                AppendStyle<Ansi::Reset>(text);
+                text += "\n";
+            }
+
+            char numbers[96];
+            for (std::size_t i = 0; i < shown; ++i) {
+                const Entry& entry = entries[slowest[i]];
+                double share = total > Clock::duration::zero() ? 100.0 * Seconds(Length(entry)) / Seconds(total) : 0;
+
+                // Tasks that dominate stand out
+                if (share >= 25) {
+                    AppendStyle<Ansi::RedForeground>(text);
+                } else if (share >= 10) {
+                    AppendStyle<Ansi::YellowForeground>(text);
+                }
+                std::snprintf(numbers, sizeof(numbers), "%9s %5.1f%%  ", Milliseconds(entry.Duration()).c_str(), share);
+                text += numbers;
+                AppendStyle<Ansi::Reset>(text);
+                if (measured) {
+                    AppendUsage(text, entry);
+                }
+                AppendName(text, entry);
+                std::string character = measured ? Character(entry) : std::string();
+                if (!character.empty()) {
+                    AppendStyle<Ansi::Faint>(text);
+                    text += character;
+                    AppendStyle<Ansi::Reset>(text);
+                }
+                text += "\n";
+            }
+
+            if (dependencies) {
+                std::vector<TaskId> path = CriticalPath();
+                Clock::duration length = Clock::duration::zero();
+                for (TaskId id : path) {
+                    length += Length(entries[id]);
+                }
+
+                AppendStyle<Ansi::Bold>(text);
+                text += "Critical path:";
+                AppendStyle<Ansi::Reset>(text);
+                text += " " + Milliseconds(length) + " of " + Milliseconds(WallTime()) + " wall time";
+                if (length > Clock::duration::zero()) {
+                    std::snprintf(numbers, sizeof(numbers), "%.1f", Seconds(total) / Seconds(length));
+                    AppendStyle<Ansi::Faint>(text);
+                    text += std::string(" (limits the speedup to ") + numbers + "x)";
+                    AppendStyle<Ansi::Reset>(text);
+                }
+                text += "\n    ";
+                for (std::size_t i = 0; i < path.size(); ++i) {
+                    if (i > 0) {
+                        AppendStyle<Ansi::Faint>(text);
+                        text += detail::ModeGlyph(" \xE2\x86\x92 ", " -> ");
+                        AppendStyle<Ansi::Reset>(text);
+                    }
+                    AppendName(text, entries[path[i]]);
+                }
+                text += "\n";
+            }
+
+            // Only tasks on worker threads count, without any the
+            // efficiency says nothing
+            bool onWorkers = false;
+            bool coroutines = false;
+            for (TaskId id : slowest) {
+                onWorkers = onWorkers || entries[id].worker < workers;
+                coroutines = coroutines || entries[id].worker >= workers;
+            }
+
+            AppendStyle<Ansi::Bold>(text);
+            text += coroutines ? "Worker thread efficiency:" : "Parallel efficiency:";
+            AppendStyle<Ansi::Reset>(text);
+            text += " ";
+            if (onWorkers) {
+                double efficiency = Efficiency();
+                if (efficiency >= 0.75) {
+                    AppendStyle<Ansi::GreenForeground>(text);
+                } else if (efficiency >= 0.4) {
+                    AppendStyle<Ansi::YellowForeground>(text);
+                } else {
+                    AppendStyle<Ansi::RedForeground>(text);
+                }
+                std::snprintf(numbers, sizeof(numbers), "%.0f%%", 100 * efficiency);
+                text += numbers;
+                AppendStyle<Ansi::Reset>(text);
+                AppendStyle<Ansi::Faint>(text);
+                text += " (" + Milliseconds(WorkerTime()) + " of task time on " + std::to_string(workers) +
+                        (workers == 1 ? " worker" : " workers");
+            } else {
+                text += "n/a";
+                AppendStyle<Ansi::Faint>(text);
+                text += " (no task ran on a worker thread";
+            }
+            if (coroutines) {
+                text += ", " + Milliseconds(CoroutineTime()) + " in coroutine tasks";
+            }
+            text += ")";
+            AppendStyle<Ansi::Reset>(text);
+            text += "\n";
+
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+            out.flush();
+        }
+
+    private:
+        template<class... Styles>
+        static void AppendStyle(std::string& out) {
+            detail::AppendStyle<Styles...>(out);
+        }
+
+        static void AppendName(std::string& out, const Entry& entry) {
+            detail::AppendTaskEmoji(out, entry.emoji);
+            out += entry.name;
+        }
+
+        static bool Measured(const ResourceUsage& usage) {
+            return usage.Cpu() > std::chrono::microseconds::zero() || usage.voluntarySwitches > 0 ||
+                   usage.involuntarySwitches > 0;
+        }
+
+        // "cpu memory voluntary/involuntary" columns
+        static void AppendUsage(std::string& out, const Entry& entry) {
+            char numbers[64];
+            std::snprintf(numbers, sizeof(numbers), "%9s %10s %9s  ",
+                          Milliseconds(entry.usage.Cpu()).c_str(), Kilobytes(entry.usage.PeakRss()).c_str(),
+                          (std::to_string(entry.usage.voluntarySwitches) + "/" +
+                           std::to_string(entry.usage.involuntarySwitches)).c_str());
+            out += numbers;
+        }
+
+        /**
+            What kept a task busy: mostly CPU time means it computed,
+            little CPU time for a long task means it waited on something
+            like I/O, a lock or a sleep
+         */
+        static std::string Character(const Entry& entry) {
+            double wall = Seconds(entry.Duration());
+            if (wall < 0.01) return std::string();
+
+            double cpu = std::chrono::duration<double>(entry.usage.Cpu()).count() / wall;
+            if (cpu >= 0.8) return " (CPU-bound)";
+            if (cpu <= 0.2) return " (waiting)";
+            return std::string();
+        }
+
+        static std::string Kilobytes(long kilobytes) {
+            char text[32];
+            if (kilobytes >= 1024 * 1024) {
+                std::snprintf(text, sizeof(text), "%.1f GB", kilobytes / (1024.0 * 1024.0));
+            } else if (kilobytes >= 1024) {
+                std::snprintf(text, sizeof(text), "%.1f MB", kilobytes / 1024.0);
+            } else {
+                std::snprintf(text, sizeof(text), "%ld KB", kilobytes);
+            }
+            return text;
+        }
+
+        // Tasks that were skipped did not take any time
+        static Clock::duration Length(const Entry& entry) {
+            return entry.ran ? entry.Duration() : Clock::duration::zero();
+        }
+
+        static double Seconds(Clock::duration duration) {
+            return std::chrono::duration<double>(duration).count();
+        }
+
+        static std::string Milliseconds(Clock::duration duration) {
+            return std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()) + " ms";
+        }
+
+        // The tasks in an order where every task follows its dependencies
+        std::vector<TaskId> Order() const {
+            std::vector<std::size_t> pending(entries.size());
+            std::vector<std::vector<TaskId>> dependents(entries.size());
+            std::vector<TaskId> order;
+            order.reserve(entries.size());
+
+            for (TaskId id = 0; id < entries.size(); ++id) {
+                pending[id] = entries[id].dependencies.size();
+                for (TaskId dependency : entries[id].dependencies) {
+                    dependents[dependency].push_back(id);
+                }
+                if (pending[id] == 0) order.push_back(id);
+            }
+
+            for (std::size_t i = 0; i < order.size(); ++i) {
+                for (TaskId dependent : dependents[order[i]]) {
+                    if (--pending[dependent] == 0) order.push_back(dependent);
+                }
+            }
+            return order;
+        }
+
+        std::size_t rows;
+    };
+
+} /* namespace Canary */
@@ -0,0 +1,1655 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "aligned.hpp"
+#include "ansi.hpp"
+#include "benchmark.hpp"
+#include "cancel.hpp"
+#include "capture.hpp"
+#include "glyph.hpp"
+#include "hash.hpp"
+#include "status.hpp"
+#include "timer.hpp"
+#include "usage.hpp"
+
+namespace Canary {
+
+    /**
+        Index of a task inside a TaskGraph
+     */
+    using TaskId = std::size_t;
+
+    /**
+        Task
+
+        A single step with an optional emoji, a message that is printed
+        when the step starts and the function that does the work.
+
+        Tasks that are added to a TaskGraph may declare the tasks they
+        depend on. They are only started after all of them finished.
+
+        Tasks may also declare the files and parameters their result
+        depends on. With a TaskCache they are skipped as long as these
+        did not change since their last successful run.
+
+        A task with a timeout fails if it runs longer. Its cancellation
+        token is cancelled once the time is up, so the task can stop
+        early by checking Canary::Cancelled().
+
+        Example:
+
+            Canary::TaskGraph graph;
+            auto fetch = graph.Add(Canary::Task("Fetch", fetchFn));
+            auto build = graph.Add(Canary::Task("Build", buildFn).After(fetch));
+     */
+    struct Task {
+        std::string emoji;
+        std::string msg;
+        std::function<void()> fn;
+        std::vector<TaskId> dependencies;
+        std::vector<std::string> inputs;
+        std::vector<std::string> params;
+
+        // Zero means no time limit
+        std::chrono::milliseconds timeout{0};
+
+        // Set by AsyncTask of coroutine.hpp, starts the coroutine and
+        // calls done with the context once it finished. fn then waits
+        // for it.
+        std::function<void(void (*done)(void*, std::exception_ptr), void* context)> coroutine;
+
+        Task(std::string emoji, std::string msg, std::function<void()> fn)
+            : emoji(std::move(emoji)), msg(std::move(msg)), fn(std::move(fn)) {}
+        Task(std::string msg, std::function<void()> fn) : msg(std::move(msg)), fn(std::move(fn)) {}
+
+        /**
+            Declare that this task has to wait for the given tasks
+         */
+        template<class... Ids>
+        Task& After(TaskId id, Ids... ids) {
+            dependencies.insert(dependencies.end(), { id, static_cast<TaskId>(ids)... });
+            return *this;
+        }
+
+        /**
+            Declare files whose contents decide if the task has to run
+         */
+        template<class... Paths>
+        Task& Inputs(std::string path, Paths... paths) {
+            inputs.insert(inputs.end(), { std::move(path), std::string(std::move(paths))... });
+            return *this;
+        }
+
+        /**
+            Declare values besides the inputs, like compiler flags, that
+            decide if the task has to run
+         */
+        template<class... Values>
+        Task& Params(std::string value, Values... values) {
+            params.insert(params.end(), { std::move(value), std::string(std::move(values))... });
+            return *this;
+        }
+
+        /**
+            Let the task fail if it takes longer than the given time
+         */
+        Task& Timeout(std::chrono::milliseconds limit) {
+            timeout = limit;
+            return *this;
+        }
+
+        void operator()() {
+            fn();
+        }
+    };
+
+    /**
+        Thrown if the dependencies of a TaskGraph do not form a DAG.
+        The message contains the messages of the tasks on the cycle.
+     */
+    struct CycleError : std::logic_error {
+        using std::logic_error::logic_error;
+    };
+
+    /**
+        TaskGraph
+
+        A set of tasks with dependencies between them. The tasks are
+        stored contiguously and referenced by the TaskId that Add()
+        returned. Dependencies can be added later through operator[],
+        they are validated once the graph is executed.
+     */
+    class TaskGraph {
+    public:
+        TaskGraph() = default;
+
+        // Take over a list of tasks, their ids are their positions
+        explicit TaskGraph(std::vector<Task> tasks) : tasks(std::move(tasks)) {}
+
+        void Reserve(std::size_t size) {
+            tasks.reserve(size);
+        }
+
+        TaskId Add(Task task) {
+            tasks.push_back(std::move(task));
+            return tasks.size() - 1;
+        }
+
+        std::size_t Size() const {
+            return tasks.size();
+        }
+
+        Task& operator[](TaskId id) {
+            return tasks[id];
+        }
+
+        const Task& operator[](TaskId id) const {
+            return tasks[id];
+        }
+
+        /**
+            Returns the tasks in an order in which every task comes
+            after its dependencies. Throws a CycleError if there is none.
+         */
+        std::vector<TaskId> TopologicalOrder() const {
+            const std::size_t size = tasks.size();
+
+            for (const Task& task : tasks) {
+                for (TaskId dependency : task.dependencies) {
+                    if (dependency >= size) {
+                        throw std::out_of_range("Canary::TaskGraph: unknown dependency of task '" + task.msg + "'");
+                    }
+                }
+            }
+
+            std::vector<std::size_t> offsets, dependents;
+            BuildDependents(offsets, dependents);
+
+            std::vector<std::size_t> pending(size);
+            std::vector<TaskId> order;
+            order.reserve(size);
+
+            for (TaskId id = 0; id < size; ++id) {
+                pending[id] = tasks[id].dependencies.size();
+                if (pending[id] == 0) order.push_back(id);
+            }
+
+            // Kahn's algorithm, the order vector doubles as the queue
+            for (std::size_t head = 0; head < order.size(); ++head) {
+                TaskId id = order[head];
+                for (std::size_t i = offsets[id]; i < offsets[id + 1]; ++i) {
+                    if (--pending[dependents[i]] == 0) order.push_back(dependents[i]);
+                }
+            }
+
+            if (order.size() != size) {
+                throw CycleError(DescribeCycle(pending));
+            }
+
+            return order;
+        }
+
+        /**
+            Inverts the dependency lists into a compressed adjacency
+            list: the tasks waiting for task i are
+            dependents[offsets[i]] ... dependents[offsets[i + 1] - 1].
+         */
+        void BuildDependents(std::vector<std::size_t>& offsets, std::vector<std::size_t>& dependents) const {
+            const std::size_t size = tasks.size();
+
+            offsets.assign(size + 1, 0);
+            for (const Task& task : tasks) {
+                for (TaskId dependency : task.dependencies) {
+                    ++offsets[dependency + 1];
+                }
+            }
+
+            for (std::size_t i = 0; i < size; ++i) {
+                offsets[i + 1] += offsets[i];
+            }
+
+            dependents.resize(offsets[size]);
+            std::vector<std::size_t> fill(offsets.begin(), offsets.end() - 1);
+            for (TaskId id = 0; id < size; ++id) {
+                for (TaskId dependency : tasks[id].dependencies) {
+                    dependents[fill[dependency]++] = id;
+                }
+            }
+        }
+
+    private:
+        /**
+            Walks backwards along unfinished dependencies until a task
+            repeats and returns the loop as "a -> b -> a".
+         */
+        std::string DescribeCycle(const std::vector<std::size_t>& pending) const {
+            TaskId start = 0;
+            while (pending[start] == 0) ++start;
+
+            std::vector<std::size_t> seenAt(tasks.size(), tasks.size());
+            std::vector<TaskId> path;
+            TaskId current = start;
+            while (seenAt[current] == tasks.size()) {
+                seenAt[current] = path.size();
+                path.push_back(current);
+                for (TaskId dependency : tasks[current].dependencies) {
+                    if (pending[dependency] != 0) {
+                        current = dependency;
+                        break;
+                    }
+                }
+            }
+
+            std::string message = "Canary::TaskGraph: dependency cycle ";
+            for (std::size_t i = path.size(); i-- > seenAt[current];) {
+                message += "'" + tasks[path[i]].msg + "' -> ";
+            }
+            return message + "'" + tasks[path.back()].msg + "'";
+        }
+
+        std::vector<Task> tasks;
+    };
+
+    /**
+        What the execution of a task produced
+     */
+    struct TaskResult {
+        bool success = true;
+
+        // The exception the task threw
+        std::exception_ptr error;
+
+        // The task stopped because the execution was cancelled
+        bool cancelled = false;
+
+        // The captured output, nullptr if capturing is disabled.
+        // Observers may move the content out of it.
+        OutputBuffer* output = nullptr;
+
+        // CPU time, memory and context switches, zero if not measured
+        ResourceUsage usage;
+    };
+
+    /**
+        TaskObserver
+
+        Gets notified whenever a task starts or finishes. The calls for
+        one worker are sequential, but different workers call in
+        parallel, so implementations have to synchronize themselves.
+
+        Coroutine tasks are reported with the number of workers as their
+        worker. They overlap, and their calls come from any worker or
+        the event loop; only the calls for one task are sequential.
+     */
+    struct TaskObserver {
+        virtual ~TaskObserver() {}
+
+        // Before the first task starts
+        virtual void Begin(std::size_t /* tasks */, unsigned /* workers */) {}
+
+        virtual void TaskStarted(unsigned /* worker */, TaskId /* id */, const Task& /* task */) {}
+
+        virtual void TaskFinished(unsigned /* worker */, TaskId /* id */, const Task& /* task */, const TaskResult& /* result */) {}
+
+        // Instead of start and finish, if the inputs of the task did not change
+        virtual void TaskCached(unsigned /* worker */, TaskId /* id */, const Task& /* task */) {}
+
+        // Instead of start and finish, if the task does not run because a
+        // task failed or the execution was cancelled
+        virtual void TaskSkipped(unsigned /* worker */, TaskId /* id */, const Task& /* task */) {}
+
+        // After the last task finished
+        virtual void End() {}
+    };
+
+    /**
+        DurationHistory
+
+        An observer that knows how long tasks took in earlier runs, like
+        the TimingHistory. With such a history, ExecuteGraph starts the
+        tasks with the longest chain of work ahead first, and the
+        printers show the expected time that is left.
+     */
+    struct DurationHistory : TaskObserver {
+        // The expected duration of a task, zero if it is unknown
+        virtual std::chrono::nanoseconds Expected(const Task& task) const = 0;
+    };
+
+    /**
+        DigestCache
+
+        Remembers the digest of the inputs and parameters of every task
+        that succeeded, like the TaskCache. With such a cache, the
+        executor skips the tasks whose digest did not change since their
+        last successful run. It is used from all workers at once.
+     */
+    struct DigestCache {
+        virtual ~DigestCache() = default;
+
+        // True if the last successful run of the task had this digest
+        virtual bool Fresh(const std::string& name, std::uint64_t digest) const = 0;
+
+        // Remember the digest of a successful run
+        virtual void Store(const std::string& name, std::uint64_t digest) = 0;
+
+        // The task failed, it has to run again next time
+        virtual void Forget(const std::string& name) = 0;
+
+        // After the last task finished
+        virtual void Save() = 0;
+    };
+
+    /**
+        Settings for ExecuteTasks and ExecuteGraph
+     */
+    struct ExecutionOptions {
+        // Number of worker threads of ExecuteGraph, 0 means one per hardware thread
+        unsigned workers = 0;
+
+        // Print a line for every task
+        bool verbose = true;
+
+        // Stop at the first failure: cancel the running tasks and skip all
+        // others. Otherwise only the tasks that depend on a failed task are
+        // skipped, and the first error is thrown after everything else ran.
+        bool failFast = true;
+
+        // Cancels the execution from the outside
+        const CancellationSource* cancellation = nullptr;
+
+        // Show the running tasks in a live region if stdout is a terminal
+        bool live = true;
+
+        // Collect the output of each task and print it as one block when
+        // the task finished, instead of interleaving it with other tasks
+        bool capture = true;
+
+        // Bytes of output per task that are kept in memory before the
+        // rest goes to a temporary file
+        std::size_t captureLimit = 1 << 20;
+
+        // Measure the CPU time, memory and context switches of every
+        // task and of the commands it runs, see ResourceUsage
+        bool resources = true;
+
+        // Further observers, they have to outlive the execution
+        std::vector<TaskObserver*> observers;
+
+        // Durations of earlier runs for the scheduling order and the ETAs.
+        // It is notified like the observers, so it learns from this run.
+        DurationHistory* history = nullptr;
+
+        // Skip tasks whose inputs and parameters did not change
+        DigestCache* cache = nullptr;
+
+        // Let ExecuteTasks measure repeated runs of every task instead
+        Benchmark* benchmark = nullptr;
+    };
+
+    namespace detail {
+
+        // Print the "[pos/size] emoji message" line of a task
+        inline void PrintTask(std::size_t size, std::size_t pos, const Task& task) {
+            // Task
+            {
+                Canary::Ansi::Faint faint(std::cout);
+                std::cout << "[" << pos << "/" << size << "] ";
+            }
+
+            // Message
+            std::string line;
+            AppendTaskEmoji(line, task.emoji);
+            line += task.msg;
+            std::cout << line << std::endl;
+        }
+
+        // The message of an exception, if it is a std::exception
+        inline std::string ErrorMessage(const std::exception_ptr& error) {
+            try {
+                std::rethrow_exception(error);
+            } catch (const std::exception& e) {
+                return e.what();
+            } catch (...) {
+                return "unknown exception";
+            }
+        }
+
+        /**
+            The digest of the parameters, the input paths and the input
+            contents of a task. Zero if the task declares neither, or if
+            an input cannot be read; such tasks always run.
+         */
+        inline std::uint64_t InputDigest(const Task& task) {
+            if (task.inputs.empty() && task.params.empty()) return 0;
+
+            // The counts keep parameters from passing as inputs
+            Hasher hasher;
+            std::uint64_t counts[2] = { task.params.size(), task.inputs.size() };
+            hasher.Update(counts, sizeof(counts));
+            for (const std::string& param : task.params) {
+                hasher.Update(param);
+            }
+
+            char chunk[1 << 16];
+            for (const std::string& input : task.inputs) {
+                std::ifstream file(input, std::ios::binary);
+                if (!file) return 0;
+
+                hasher.Update(input);
+                while (file.read(chunk, sizeof(chunk)) || file.gcount() > 0) {
+                    hasher.Update(chunk, static_cast<std::size_t>(file.gcount()));
+                }
+                if (file.bad()) return 0;
+            }
+
+            return hasher.Digest() != 0 ? hasher.Digest() : 1;
+        }
+
+        /**
+            The expected duration of every task of a list or graph. Tasks
+            without history are expected to take as long as the average
+            known task, so new tasks are neither preferred nor delayed.
+         */
+        template<class Tasks>
+        std::vector<std::chrono::nanoseconds> ExpectedDurations(const DurationHistory& history, const Tasks& tasks, std::size_t size) {
+            std::vector<std::chrono::nanoseconds> expected(size);
+            std::chrono::nanoseconds known(0);
+            std::size_t count = 0;
+
+            for (TaskId id = 0; id < size; ++id) {
+                expected[id] = history.Expected(tasks[id]);
+                if (expected[id] > std::chrono::nanoseconds::zero()) {
+                    known += expected[id];
+                    ++count;
+                }
+            }
+
+            if (count > 0 && count < size) {
+                std::chrono::nanoseconds average = known / static_cast<std::int64_t>(count);
+                for (auto& duration : expected) {
+                    if (duration == std::chrono::nanoseconds::zero()) duration = average;
+                }
+            }
+            return expected;
+        }
+
+        /**
+            Base of the printers: keeps track of the start time of the
+            task of every worker and formats the line of a finished task
+         */
+        class Printer : public TaskObserver {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            void Begin(std::size_t tasks, unsigned workers) override {
+                size = tasks;
+                this->workers = workers;
+                starts.assign(tasks, Clock::time_point());
+            }
+
+            // Expected durations by task, before Begin, to show ETAs. A
+            // history that knows none of the tasks gives no ETAs at all.
+            void Expect(const std::vector<std::chrono::nanoseconds>* durations) {
+                std::chrono::nanoseconds total(0);
+                if (durations != nullptr) {
+                    for (auto duration : *durations) total += duration;
+                }
+
+                expected = total > std::chrono::nanoseconds::zero() ? durations : nullptr;
+                remaining.store(total.count(), std::memory_order_relaxed);
+            }
+
+            void TaskStarted(unsigned, TaskId id, const Task&) override {
+                starts[id] = Clock::now();
+            }
+
+            void TaskSkipped(unsigned, TaskId id, const Task&) override {
+                CountFinished(id);
+                skipped.fetch_add(1, std::memory_order_relaxed);
+            }
+
+        protected:
+            // "[pos/size] ✓ emoji message (duration, ETA)" and the error message
+            std::string FinishedLine(TaskId id, std::size_t pos, const Task& task, const TaskResult& result) {
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - starts[id]);
+
+                std::string line;
+                AppendStyle<Ansi::Faint>(line);
+                line += "[" + std::to_string(pos) + "/" + std::to_string(size) + "] ";
+                if (result.success) {
+                    AppendStyle<Ansi::Reset, Ansi::GreenForeground>(line);
+                    line += CheckGlyph();
+                    line += " ";
+                } else if (result.cancelled) {
+                    AppendStyle<Ansi::Reset, Ansi::YellowForeground>(line);
+                    line += CrossGlyph();
+                    line += " ";
+                } else {
+                    AppendStyle<Ansi::Reset, Ansi::RedForeground>(line);
+                    line += CrossGlyph();
+                    line += " ";
+                }
+                AppendStyle<Ansi::Reset>(line);
+                AppendTaskEmoji(line, task.emoji);
+                line += task.msg;
+                AppendStyle<Ansi::Faint>(line);
+                line += " (" + std::to_string(duration.count()) + " ms";
+                if (result.cancelled) {
+                    line += ", cancelled";
+                } else if (expected != nullptr && pos < size) {
+                    line += ", ~" + Left() + " left";
+                }
+                line += ")";
+                AppendStyle<Ansi::Reset>(line);
+
+                if (result.error && !result.cancelled) {
+                    line += "\n";
+                    AppendStyle<Ansi::RedForeground>(line);
+                    line += ErrorMessage(result.error);
+                    AppendStyle<Ansi::Reset>(line);
+                }
+
+                return line;
+            }
+
+            // "[pos/size] ✓ emoji message (cached)", all faint
+            std::string CachedLine(std::size_t pos, const Task& task) {
+                std::string line;
+                AppendStyle<Ansi::Faint>(line);
+                line += "[" + std::to_string(pos) + "/" + std::to_string(size) + "] ";
+                line += CheckGlyph();
+                line += " ";
+                AppendTaskEmoji(line, task.emoji);
+                line += task.msg + " (cached)";
+                AppendStyle<Ansi::Reset>(line);
+                return line;
+            }
+
+            // "N tasks skipped" in yellow, empty if none were
+            std::string SkippedLine() const {
+                std::size_t count = skipped.load(std::memory_order_relaxed);
+                if (count == 0) return std::string();
+
+                std::string line;
+                AppendStyle<Ansi::YellowForeground>(line);
+                line += std::to_string(count) + (count == 1 ? " task" : " tasks") + " skipped";
+                AppendStyle<Ansi::Reset>(line);
+                return line;
+            }
+
+            // Position of a task in the order of finishing
+            std::size_t CountFinished(TaskId id) {
+                if (expected != nullptr) {
+                    remaining.fetch_sub((*expected)[id].count(), std::memory_order_relaxed);
+                }
+                return finished.fetch_add(1, std::memory_order_relaxed) + 1;
+            }
+
+            // The expected work that is left, spread over the workers
+            std::string Left() const {
+                double seconds = std::max<std::int64_t>(0, remaining.load(std::memory_order_relaxed)) / 1e9 / workers;
+                if (seconds < 1) return std::to_string(static_cast<long>(seconds * 1000)) + " ms";
+
+                char text[32];
+                std::snprintf(text, sizeof(text), "%.1f s", seconds);
+                return text;
+            }
+
+            // The expected duration of a task, zero without history
+            std::chrono::nanoseconds Expected(TaskId id) const {
+                return expected != nullptr ? (*expected)[id] : std::chrono::nanoseconds::zero();
+            }
+
+            std::size_t size = 0;
+            unsigned workers = 1;
+
+        private:
+            std::vector<Clock::time_point> starts;
+            std::atomic<std::size_t> finished{0};
+            std::atomic<std::size_t> skipped{0};
+
+            const std::vector<std::chrono::nanoseconds>* expected = nullptr;
+            std::atomic<std::int64_t> remaining{0};
+        };
+
+        /**
+            Prints a line when a task starts. Captured output and errors
+            are printed as one block under the line of the finished task.
+         */
+        class LinePrinter : public Printer {
+        public:
+            void TaskStarted(unsigned worker, TaskId id, const Task& task) override {
+                Printer::TaskStarted(worker, id, task);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                PrintTask(size, ++started, task);
+            }
+
+            void TaskFinished(unsigned, TaskId id, const Task& task, const TaskResult& result) override {
+                std::size_t pos = CountFinished(id);
+                bool output = result.output != nullptr && !result.output->Empty();
+                if (!output && result.success) return;
+
+                std::string line = FinishedLine(id, pos, task, result);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                std::cout << line << "\n";
+                if (output) result.output->Replay(std::cout);
+                std::cout.flush();
+            }
+
+            void TaskCached(unsigned, TaskId id, const Task& task) override {
+                std::string line = CachedLine(CountFinished(id), task);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                ++started;
+                std::cout << line << std::endl;
+            }
+
+            void End() override {
+                std::string line = SkippedLine();
+                if (!line.empty()) std::cout << line << std::endl;
+            }
+
+        private:
+            std::mutex mutex;
+            std::size_t started = 0;
+        };
+
+        /**
+            Shows the running tasks in a LiveStatus region and prints
+            a line with the duration and the captured output when a task
+            finishes
+         */
+        class LivePrinter : public Printer {
+        public:
+            void Begin(std::size_t tasks, unsigned workers) override {
+                Printer::Begin(tasks, workers);
+
+                // The last row sums up the waiting coroutine tasks
+                status.reset(new LiveStatus(workers + 1));
+            }
+
+            void TaskStarted(unsigned worker, TaskId id, const Task& task) override {
+                Printer::TaskStarted(worker, id, task);
+
+                if (worker == workers) {
+                    std::lock_guard<std::mutex> lock(coroutineMutex);
+                    ShowCoroutines(++coroutines);
+                    return;
+                }
+                std::string label;
+                AppendTaskEmoji(label, task.emoji);
+                status->Start(worker, label + task.msg, Expected(id));
+            }
+
+            void TaskFinished(unsigned worker, TaskId id, const Task& task, const TaskResult& result) override {
+                std::unique_ptr<OutputBuffer> output;
+                if (result.output != nullptr && !result.output->Empty()) {
+                    output.reset(new OutputBuffer(std::move(*result.output)));
+                }
+
+                std::string line = FinishedLine(id, CountFinished(id), task, result);
+                if (worker == workers) {
+                    std::lock_guard<std::mutex> lock(coroutineMutex);
+                    status->Finish(worker, std::move(line), std::move(output));
+                    if (--coroutines > 0) ShowCoroutines(coroutines);
+                    return;
+                }
+                status->Finish(worker, std::move(line), std::move(output));
+            }
+
+            void TaskCached(unsigned, TaskId id, const Task& task) override {
+                status->Log(CachedLine(CountFinished(id), task));
+            }
+
+            void End() override {
+                std::string line = SkippedLine();
+                if (!line.empty()) status->Log(std::move(line));
+                status->Stop();
+            }
+
+        private:
+            void ShowCoroutines(std::size_t count) {
+                status->Start(workers, std::to_string(count) + (count == 1 ? " coroutine task" : " coroutine tasks") + " waiting");
+            }
+
+            std::unique_ptr<LiveStatus> status;
+
+            std::mutex coroutineMutex;
+            std::size_t coroutines = 0;
+        };
+
+        /**
+            Runner
+
+            Runs single tasks for the executors: captures their output
+            into a buffer per worker, catches their exceptions and
+            notifies the printer chosen by the options and the observers
+            of the user. It keeps the first error and the cancellation of
+            the execution, which every task token is chained to.
+         */
+        class Runner {
+        public:
+            explicit Runner(const ExecutionOptions& options)
+                : options(options), observers(options.observers),
+                  execution(options.cancellation != nullptr ? &options.cancellation->State() : nullptr) {
+                if (options.verbose) {
+                    if (options.live && LiveStatus::Supported()) {
+                        printer.reset(new LivePrinter());
+                    } else {
+                        printer.reset(new LinePrinter());
+                    }
+                    observers.insert(observers.begin(), printer.get());
+                }
+                if (options.history != nullptr) {
+                    observers.push_back(options.history);
+                }
+            }
+
+            /**
+                Expected durations by task, from the history of the
+                options, empty without history
+             */
+            template<class Tasks>
+            const std::vector<std::chrono::nanoseconds>& Expect(const Tasks& tasks, std::size_t size) {
+                if (options.history != nullptr) {
+                    expected = ExpectedDurations(*options.history, tasks, size);
+                    if (printer) printer->Expect(&expected);
+                }
+                return expected;
+            }
+
+            void Begin(std::size_t tasks, unsigned workers) {
+                if (options.capture) {
+                    for (unsigned i = 0; i < workers; ++i) {
+                        buffers.emplace_back(new OutputBuffer(options.captureLimit));
+                    }
+                    if (!StandardStreamRedirect::Active()) {
+                        redirect.reset(new StandardStreamRedirect());
+                    }
+                }
+
+                for (unsigned i = 0; i < workers; ++i) {
+                    cancellations.emplace_back(new CancellationState(&execution));
+                }
+                this->workers = workers;
+
+                for (TaskObserver* observer : observers) observer->Begin(tasks, workers);
+            }
+
+            // Returns true if the task succeeded or was cached
+            bool Run(unsigned worker, TaskId id, Task& task) {
+                std::uint64_t digest = 0;
+                if (Cached(worker, id, task, digest)) return true;
+
+                for (TaskObserver* observer : observers) observer->TaskStarted(worker, id, task);
+
+                CancellationState& cancellation = *cancellations[worker];
+                cancellation.cancelled.store(false, std::memory_order_relaxed);
+                cancellation.deadline = Deadline(task);
+
+                TaskResult result;
+                if (options.capture) {
+                    CaptureScope scope(*buffers[worker]);
+                    Invoke(task, cancellation, result);
+                    result.output = buffers[worker].get();
+                } else {
+                    Invoke(task, cancellation, result);
+                }
+
+                return Conclude(worker, id, task, cancellation, result, digest);
+            }
+
+            /**
+                Start a coroutine task, it runs on the calling thread until
+                it suspends for the first time and on the event loop after.
+                done(success) is called once it finished, which may happen
+                before Start returns. Observers see these tasks on the
+                worker after the last one.
+             */
+            void Start(TaskId id, Task& task, std::function<void(bool)> done) {
+                const unsigned worker = workers;
+
+                std::uint64_t digest = 0;
+                if (Cached(worker, id, task, digest)) {
+                    done(true);
+                    return;
+                }
+
+                for (TaskObserver* observer : observers) observer->TaskStarted(worker, id, task);
+
+                // Every coroutine needs a buffer and a cancellation of its
+                // own, it lives until the coroutine finished
+                AsyncRun* run = new AsyncRun(*this, id, task, digest, std::move(done));
+                run->cancellation.deadline = Deadline(task);
+
+                OutputBuffer* previousOutput = CurrentOutputSlot();
+                const CancellationState* previousCancellation = CurrentCancellationSlot();
+                ResourceUsage* previousUsage = CurrentUsageSlot();
+                CurrentOutputSlot() = run->output.get();
+                CurrentCancellationSlot() = &run->cancellation;
+                CurrentUsageSlot() = options.resources ? &run->usage : nullptr;
+                try {
+                    task.coroutine(&AsyncRun::Finished, run);
+                } catch (...) {
+                    // Creating the coroutine failed, its body never ran
+                    AsyncRun::Finished(run, std::current_exception());
+                }
+                CurrentOutputSlot() = previousOutput;
+                CurrentCancellationSlot() = previousCancellation;
+                CurrentUsageSlot() = previousUsage;
+            }
+
+            // A task that does not run, because of a failure or cancellation
+            void Skip(unsigned worker, TaskId id, const Task& task) {
+                for (TaskObserver* observer : observers) observer->TaskSkipped(worker, id, task);
+            }
+
+            // True once tasks should no longer start
+            bool Cancelled() const {
+                return execution.Cancelled();
+            }
+
+            /**
+                End every observer and save the cache, even if one of them
+                throws, like a history whose file cannot be written. The
+                first of these errors is only reported if no task failed.
+             */
+            void End() {
+                std::exception_ptr ending;
+                for (TaskObserver* observer : observers) {
+                    try {
+                        observer->End();
+                    } catch (...) {
+                        if (!ending) ending = std::current_exception();
+                    }
+                }
+                redirect.reset();
+
+                try {
+                    if (options.cache != nullptr) options.cache->Save();
+                } catch (...) {
+                    if (!ending) ending = std::current_exception();
+                }
+
+                if (ending && !failed.exchange(true, std::memory_order_acq_rel)) {
+                    error = ending;
+                }
+            }
+
+            /**
+                The first error of a task, or a CancelledError if the
+                execution was cancelled from the outside. Only valid
+                after the workers stopped.
+             */
+            std::exception_ptr Error() const {
+                if (!error && execution.Cancelled()) {
+                    return std::make_exception_ptr(CancelledError("execution cancelled"));
+                }
+                return error;
+            }
+
+        private:
+            using CancellationState = detail::CancellationState;
+
+            // The state of a running coroutine task
+            struct AsyncRun {
+                AsyncRun(Runner& runner, TaskId id, Task& task, std::uint64_t digest, std::function<void(bool)> done)
+                    : runner(runner), id(id), task(task), digest(digest), done(std::move(done)),
+                      cancellation(&runner.execution),
+                      output(runner.options.capture ? new OutputBuffer(runner.options.captureLimit) : nullptr) {}
+
+                // The completion of the coroutine, frees the run
+                static void Finished(void* context, std::exception_ptr error) {
+                    std::function<void(bool)> done;
+                    bool success = false;
+                    {
+                        std::unique_ptr<AsyncRun> run(static_cast<AsyncRun*>(context));
+
+                        // The printers write to the standard streams, which
+                        // must not end up in the buffer of the task
+                        CurrentOutputSlot() = nullptr;
+                        CurrentCancellationSlot() = nullptr;
+                        CurrentUsageSlot() = nullptr;
+
+                        TaskResult result;
+                        if (error) {
+                            result.success = false;
+                            result.error = std::move(error);
+                        }
+                        result.output = run->output.get();
+                        result.usage = run->usage;
+
+                        Runner& runner = run->runner;
+                        success = runner.Conclude(runner.workers, run->id, run->task, run->cancellation, result, run->digest);
+                        done = std::move(run->done);
+                    }
+
+                    // Last, the execution may end as soon as it knows
+                    done(success);
+                }
+
+                Runner& runner;
+                TaskId id;
+                Task& task;
+                std::uint64_t digest;
+                std::function<void(bool)> done;
+                CancellationState cancellation;
+                std::unique_ptr<OutputBuffer> output;
+
+                // Only subprocesses, the coroutine moves between threads
+                ResourceUsage usage;
+            };
+
+            /**
+                Inputs are hashed right before the task would start, as
+                its dependencies may have just written them. Returns true
+                and notifies the observers if the task can be skipped.
+             */
+            bool Cached(unsigned worker, TaskId id, const Task& task, std::uint64_t& digest) {
+                if (options.cache == nullptr) return false;
+
+                digest = InputDigest(task);
+                if (digest == 0 || !options.cache->Fresh(task.msg, digest)) return false;
+
+                for (TaskObserver* observer : observers) observer->TaskCached(worker, id, task);
+                return true;
+            }
+
+            static CancellationState::Clock::time_point Deadline(const Task& task) {
+                return task.timeout > std::chrono::milliseconds::zero()
+                           ? CancellationState::Clock::now() + task.timeout
+                           : CancellationState::Clock::time_point::max();
+            }
+
+            void Invoke(Task& task, const CancellationState& cancellation, TaskResult& result) const {
+                const CancellationState* previous = CurrentCancellationSlot();
+                CurrentCancellationSlot() = &cancellation;
+                if (options.resources) {
+                    // Commands add their subprocesses through the slot
+                    ResourceUsage* previousUsage = CurrentUsageSlot();
+                    CurrentUsageSlot() = &result.usage;
+                    UsageMeter meter;
+                    Call(task, result);
+                    meter.Stop(result.usage);
+                    CurrentUsageSlot() = previousUsage;
+                } else {
+                    Call(task, result);
+                }
+                CurrentCancellationSlot() = previous;
+            }
+
+            static void Call(Task& task, TaskResult& result) {
+                try {
+                    task();
+                } catch (...) {
+                    result.success = false;
+                    result.error = std::current_exception();
+                }
+            }
+
+            /**
+                Turns deadlines and cancellations into the result, notifies
+                the observers about the finished task and updates the cache
+             */
+            bool Conclude(unsigned worker, TaskId id, Task& task, const CancellationState& cancellation,
+                          TaskResult& result, std::uint64_t digest) {
+                if (cancellation.Expired()) {
+                    // Late tasks fail, even if they did not notice
+                    result.success = false;
+                    result.error = std::make_exception_ptr(DeadlineError(
+                        "timed out after " + std::to_string(task.timeout.count()) + " ms"));
+                } else if (!result.success && execution.Cancelled()) {
+                    result.cancelled = true;
+                }
+
+                if (!result.success && !result.cancelled) {
+                    Fail(result.error);
+                }
+
+                // In reverse, so the observers that were notified last about
+                // the start (like timers) are notified first about the end
+                for (auto it = observers.rbegin(); it != observers.rend(); ++it) {
+                    (*it)->TaskFinished(worker, id, task, result);
+                }
+
+                if (result.output != nullptr) result.output->Clear();
+
+                if (digest != 0) {
+                    if (result.success) {
+                        options.cache->Store(task.msg, digest);
+                    } else {
+                        options.cache->Forget(task.msg);
+                    }
+                }
+                return result.success;
+            }
+
+            void Fail(std::exception_ptr taskError) {
+                if (!failed.exchange(true, std::memory_order_acq_rel)) {
+                    error = taskError;
+                }
+                if (options.failFast) {
+                    execution.Cancel();
+                }
+            }
+
+            const ExecutionOptions& options;
+            std::unique_ptr<Printer> printer;
+            std::vector<TaskObserver*> observers;
+            std::vector<std::chrono::nanoseconds> expected;
+            std::vector<std::unique_ptr<OutputBuffer>> buffers;
+            std::unique_ptr<StandardStreamRedirect> redirect;
+
+            unsigned workers = 1;
+            CancellationState execution;
+            std::vector<std::unique_ptr<CancellationState>> cancellations;
+            std::atomic<bool> failed{false};
+            std::exception_ptr error;
+        };
+
+        /**
+            WorkStealingDeque
+
+            The lock-free Chase-Lev deque (in the formulation of Lê et al.
+            for weak memory models). The owning worker pushes and pops at
+            the bottom without contention, other workers steal from the top.
+            Retired buffers are kept until destruction, so a thief can
+            never read from freed memory. Its indices are on cache lines
+            of their own, allocate it with MakeAligned.
+         */
+        template<class T>
+        class WorkStealingDeque {
+        public:
+            explicit WorkStealingDeque(std::size_t capacity = 64) : top(0), bottom(0) {
+                std::size_t size = 1;
+                while (size < capacity) size <<= 1;
+                buffers.emplace_back(new Buffer(size));
+                buffer.store(buffers.back().get(), std::memory_order_relaxed);
+            }
+
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            // Owner only
+            void Push(T item) {
+                std::int64_t b = bottom.load(std::memory_order_relaxed);
+                std::int64_t t = top.load(std::memory_order_acquire);
+                Buffer* a = buffer.load(std::memory_order_relaxed);
+
+                if (b - t > static_cast<std::int64_t>(a->mask)) {
+                    a = Grow(a, t, b);
+                }
+
+                a->Put(b, item);
+                std::atomic_thread_fence(std::memory_order_release);
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+
+            // Owner only
+            bool Pop(T& item) {
+                std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+                Buffer* a = buffer.load(std::memory_order_relaxed);
+                bottom.store(b, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::int64_t t = top.load(std::memory_order_relaxed);
+
+                if (t > b) {
+                    bottom.store(b + 1, std::memory_order_relaxed);
+                    return false;
+                }
+
+                item = a->Get(b);
+                if (t == b) {
+                    // Last item, race against the thieves
+                    bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                    bottom.store(b + 1, std::memory_order_relaxed);
+                    return won;
+                }
+
+                return true;
+            }
+
+            // Any thread
+            bool Steal(T& item) {
+                std::int64_t t = top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::int64_t b = bottom.load(std::memory_order_acquire);
+
+                if (t >= b) return false;
+
+                Buffer* a = buffer.load(std::memory_order_acquire);
+                item = a->Get(t);
+                return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            }
+
+            bool Empty() const {
+                return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+            }
+
+        private:
+            struct Buffer {
+                explicit Buffer(std::size_t size) : mask(size - 1), items(new std::atomic<T>[size]) {}
+
+                T Get(std::int64_t i) const {
+                    return items[static_cast<std::size_t>(i) & mask].load(std::memory_order_relaxed);
+                }
+
+                void Put(std::int64_t i, T item) {
+                    items[static_cast<std::size_t>(i) & mask].store(item, std::memory_order_relaxed);
+                }
+
+                std::size_t mask;
+                std::unique_ptr<std::atomic<T>[]> items;
+            };
+
+            Buffer* Grow(Buffer* old, std::int64_t t, std::int64_t b) {
+                buffers.emplace_back(new Buffer(2 * (old->mask + 1)));
+                Buffer* grown = buffers.back().get();
+                for (std::int64_t i = t; i < b; ++i) {
+                    grown->Put(i, old->Get(i));
+                }
+                buffer.store(grown, std::memory_order_release);
+                return grown;
+            }
+
+            alignas(64) std::atomic<std::int64_t> top;
+            alignas(64) std::atomic<std::int64_t> bottom;
+            alignas(64) std::atomic<Buffer*> buffer;
+            std::vector<std::unique_ptr<Buffer>> buffers;
+        };
+
+        /**
+            GraphExecutor
+
+            Runs a TaskGraph on a set of workers. Every worker owns a
+            deque; a finished task decrements the pending counters of its
+            dependents and pushes those that became ready onto the deque
+            of the worker that finished it. Idle workers steal from a
+            random victim and only go to sleep if all deques are empty.
+            Coroutine tasks only occupy a worker until they suspend, the
+            event loop queues them for the workers once they finished.
+         */
+        class GraphExecutor {
+        public:
+            GraphExecutor(TaskGraph& graph, const ExecutionOptions& options)
+                : graph(graph), runner(options), size(graph.Size()),
+                  pending(new std::atomic<std::size_t>[graph.Size()]),
+                  blocked(new std::atomic<bool>[graph.Size()]) {
+                // Fails before anything runs if there is a cycle
+                std::vector<TaskId> order = graph.TopologicalOrder();
+                graph.BuildDependents(offsets, dependents);
+
+                // With history, the priority of a task is the longest chain
+                // of expected work from its start to the end of the graph.
+                // For independent tasks that is longest processing time first.
+                const std::vector<std::chrono::nanoseconds>& expected = runner.Expect(graph, size);
+                if (!expected.empty()) {
+                    priorities.resize(size);
+                    for (std::size_t i = order.size(); i-- > 0;) {
+                        TaskId id = order[i];
+                        std::chrono::nanoseconds longest(0);
+                        for (std::size_t j = offsets[id]; j < offsets[id + 1]; ++j) {
+                            longest = std::max(longest, priorities[dependents[j]]);
+                        }
+                        priorities[id] = expected[id] + longest;
+                    }
+                }
+
+                unsigned count = options.workers;
+                if (count == 0) count = std::max(1u, std::thread::hardware_concurrency());
+                count = static_cast<unsigned>(std::min<std::size_t>(count, std::max<std::size_t>(size, 1)));
+
+                for (unsigned i = 0; i < count; ++i) {
+                    deques.push_back(MakeAligned<WorkStealingDeque<TaskId>>(std::max<std::size_t>(64, 2 * size / count)));
+                }
+
+                std::vector<TaskId> roots;
+                for (TaskId id = 0; id < size; ++id) {
+                    pending[id].store(graph[id].dependencies.size(), std::memory_order_relaxed);
+                    blocked[id].store(false, std::memory_order_relaxed);
+                    if (graph[id].dependencies.empty()) {
+                        roots.push_back(id);
+                    }
+                }
+
+                if (!priorities.empty()) {
+                    std::stable_sort(roots.begin(), roots.end(), [this](TaskId a, TaskId b) {
+                        return priorities[a] > priorities[b];
+                    });
+                    ready.resize(count);
+                }
+
+                // Distribute the initially ready tasks round robin. The
+                // owners pop from the bottom, so push them in reverse to
+                // start them in the order they were added, or by priority.
+                for (std::size_t i = roots.size(); i-- > 0;) {
+                    deques[i % count]->Push(roots[i]);
+                }
+            }
+
+            void Run() {
+                if (size == 0) return;
+
+                runner.Begin(size, static_cast<unsigned>(deques.size()));
+
+                // The calling thread is worker 0
+                std::vector<std::thread> threads;
+                for (unsigned i = 1; i < deques.size(); ++i) {
+                    threads.emplace_back(&GraphExecutor::Work, this, i);
+                }
+                Work(0);
+
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+
+                runner.End();
+
+                if (std::exception_ptr error = runner.Error()) {
+                    std::rethrow_exception(error);
+                }
+            }
+
+        private:
+            void Work(unsigned self) {
+                std::uint64_t seed = 0x9E3779B97F4A7C15ull * (self + 1);
+                TaskId id;
+
+                while (!done.load(std::memory_order_acquire)) {
+                    bool succeeded = false;
+                    if (TakeCompletion(id, succeeded)) {
+                        Finish(self, id, succeeded);
+                    } else if (deques[self]->Pop(id) || TrySteal(self, seed, id)) {
+                        Execute(self, id);
+                    } else {
+                        Sleep(self, seed);
+                    }
+                }
+            }
+
+            bool TrySteal(unsigned self, std::uint64_t& seed, TaskId& id) {
+                const std::size_t count = deques.size();
+                if (count == 1) return false;
+
+                // xorshift to pick the first victim
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+
+                std::size_t victim = seed % count;
+                for (std::size_t i = 0; i < count; ++i, victim = (victim + 1) % count) {
+                    if (victim != self && deques[victim]->Steal(id)) return true;
+                }
+                return false;
+            }
+
+            void Sleep(unsigned self, std::uint64_t& seed) {
+                TaskId id;
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                sleepers.fetch_add(1, std::memory_order_seq_cst);
+
+                // Re-check after announcing ourselves, a push in between
+                // either shows up here or sees the sleeper and notifies.
+                // Completions are queued under the lock and always notify.
+                bool found = deques[self]->Pop(id) || TrySteal(self, seed, id);
+                if (!found && completions.empty() && !done.load(std::memory_order_acquire)) {
+                    wakeup.wait(lock);
+                }
+
+                sleepers.fetch_sub(1, std::memory_order_relaxed);
+                lock.unlock();
+
+                if (found) Execute(self, id);
+            }
+
+            /**
+                Coroutine tasks finish on the event loop, which queues them
+                for the workers: releasing dependents pushes onto the deque
+                of the finishing worker, which only its owner may do.
+             */
+            void Complete(TaskId id, bool success) {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                completions.emplace_back(id, success);
+                pendingCompletions.store(completions.size(), std::memory_order_release);
+                wakeup.notify_one();
+            }
+
+            bool TakeCompletion(TaskId& id, bool& success) {
+                if (pendingCompletions.load(std::memory_order_acquire) == 0) return false;
+
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                if (completions.empty()) return false;
+
+                id = completions.back().first;
+                success = completions.back().second;
+                completions.pop_back();
+                pendingCompletions.store(completions.size(), std::memory_order_release);
+                return true;
+            }
+
+            void Execute(unsigned self, TaskId id) {
+                Task& task = graph[id];
+
+                // Skipped tasks still release their dependents, so the
+                // remaining work drains without running anything
+                if (runner.Cancelled() || blocked[id].load(std::memory_order_relaxed)) {
+                    runner.Skip(self, id, task);
+                    Finish(self, id, false);
+                    return;
+                }
+
+                // The worker moves on while the coroutine waits
+                if (task.coroutine) {
+                    runner.Start(id, task, [this, id](bool success) { Complete(id, success); });
+                    return;
+                }
+
+                Finish(self, id, runner.Run(self, id, task));
+            }
+
+            void Finish(unsigned self, TaskId id, bool success) {
+                // Release the dependents that are now ready, the ones of a
+                // failed or skipped task are skipped as well
+                std::size_t pushed = 0;
+                for (std::size_t i = offsets[id]; i < offsets[id + 1]; ++i) {
+                    TaskId dependent = dependents[i];
+                    if (!success) blocked[dependent].store(true, std::memory_order_relaxed);
+                    if (pending[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        if (priorities.empty()) {
+                            deques[self]->Push(dependent);
+                        } else {
+                            ready[self].push_back(dependent);
+                        }
+                        ++pushed;
+                    }
+                }
+
+                // The most urgent one goes to the bottom, where we pop it next
+                if (!priorities.empty() && pushed > 0) {
+                    std::vector<TaskId>& released = ready[self];
+                    std::sort(released.begin(), released.end(), [this](TaskId a, TaskId b) {
+                        return priorities[a] < priorities[b];
+                    });
+                    for (TaskId dependent : released) {
+                        deques[self]->Push(dependent);
+                    }
+                    released.clear();
+                }
+
+                // We keep one of them ourselves, wake up helpers for the rest
+                if (pushed > 1) {
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (sleepers.load(std::memory_order_seq_cst) > 0) {
+                        std::lock_guard<std::mutex> lock(sleepMutex);
+                        if (pushed == 2) wakeup.notify_one();
+                        else wakeup.notify_all();
+                    }
+                }
+
+                if (finished.fetch_add(1, std::memory_order_acq_rel) + 1 == size) {
+                    std::lock_guard<std::mutex> lock(sleepMutex);
+                    done.store(true, std::memory_order_release);
+                    wakeup.notify_all();
+                }
+            }
+
+            TaskGraph& graph;
+            Runner runner;
+            const std::size_t size;
+
+            std::vector<std::size_t> offsets, dependents;
+            std::unique_ptr<std::atomic<std::size_t>[]> pending;
+            std::unique_ptr<std::atomic<bool>[]> blocked;
+            std::vector<AlignedPtr<WorkStealingDeque<TaskId>>> deques;
+
+            // Empty without history
+            std::vector<std::chrono::nanoseconds> priorities;
+            std::vector<std::vector<TaskId>> ready;
+
+            alignas(64) std::atomic<std::size_t> finished{0};
+            alignas(64) std::atomic<unsigned> sleepers{0};
+            std::atomic<bool> done{false};
+
+            std::mutex sleepMutex;
+            std::condition_variable wakeup;
+
+            // Finished coroutine tasks, guarded by the sleepMutex
+            std::vector<std::pair<TaskId, bool>> completions;
+            std::atomic<std::size_t> pendingCompletions{0};
+        };
+
+        // True if all types are Tasks
+        template<class... Ts>
+        struct AreTasks : std::true_type {};
+
+        template<class T, class... Ts>
+        struct AreTasks<T, Ts...> : std::integral_constant<bool,
+            std::is_same<typename std::decay<T>::type, Task>::value && AreTasks<Ts...>::value> {};
+
+        /**
+            Run every task the warmup and measured times of the benchmark,
+            one after another. A failing task is reported and the next
+            one measured, or the execution stops with failFast.
+         */
+        inline void DoBenchmark(std::vector<Task>& tasks, const ExecutionOptions& options) {
+            Benchmark& benchmark = *options.benchmark;
+            benchmark.Begin(tasks.size());
+
+            // The output of the runs would only distort them
+            OutputBuffer discarded(options.captureLimit);
+            std::unique_ptr<StandardStreamRedirect> redirect;
+            if (options.capture && !StandardStreamRedirect::Active()) {
+                redirect.reset(new StandardStreamRedirect());
+            }
+
+            CancellationState execution(options.cancellation != nullptr ? &options.cancellation->State() : nullptr);
+            const CancellationState* previous = CurrentCancellationSlot();
+            CurrentCancellationSlot() = &execution;
+
+            std::exception_ptr error;
+            std::vector<std::chrono::nanoseconds> samples;
+            for (TaskId id = 0; id < tasks.size() && !execution.Cancelled(); ++id) {
+                Task& task = tasks[id];
+                if (options.verbose) {
+                    PrintTask(tasks.size(), id + 1, task);
+                }
+
+                samples.clear();
+                samples.reserve(benchmark.Runs());
+                try {
+                    for (unsigned run = 0; run < benchmark.Warmup() + benchmark.Runs(); ++run) {
+                        if (execution.Cancelled()) throw CancelledError("execution cancelled");
+
+                        CaptureScope scope(discarded);
+                        Timer::Ticks start = Timer::Now();
+                        task();
+                        Timer::Ticks end = Timer::Now();
+                        discarded.Clear();
+
+                        if (run >= benchmark.Warmup()) samples.push_back(Timer::ToDuration(end - start));
+                    }
+                    benchmark.Record(task.msg, task.emoji, samples);
+                } catch (...) {
+                    discarded.Clear();
+                    if (!error) error = std::current_exception();
+                    benchmark.RecordFailure(task.msg, task.emoji, ErrorMessage(std::current_exception()));
+                    if (options.failFast) break;
+                }
+            }
+
+            CurrentCancellationSlot() = previous;
+            redirect.reset();
+
+            if (options.verbose) benchmark.Print();
+
+            if (!error && execution.Cancelled()) {
+                error = std::make_exception_ptr(CancelledError("execution cancelled"));
+            }
+            if (error) std::rethrow_exception(error);
+        }
+
+        // Execute the tasks one after another in the given order
+        inline void DoTasks(std::vector<Task>& tasks, const ExecutionOptions& options) {
+            if (options.benchmark != nullptr) {
+                DoBenchmark(tasks, options);
+                return;
+            }
+
+            Runner runner(options);
+            runner.Expect(tasks, tasks.size());
+            runner.Begin(tasks.size(), 1);
+
+            for (TaskId id = 0; id < tasks.size(); ++id) {
+                if (runner.Cancelled()) {
+                    runner.Skip(0, id, tasks[id]);
+                } else {
+                    runner.Run(0, id, tasks[id]);
+                }
+            }
+
+            runner.End();
+
+            if (std::exception_ptr error = runner.Error()) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        template<class Clock>
+        void PrintFinished(typename Clock::time_point start, typename Clock::time_point end) {
+            // Green finished
+            {
+                Canary::Ansi::GreenForeground green(std::cout);
+                std::cout << "Finished." << std::endl;
+            }
+
+            // Print time
+            std::cout << DoneGlyph()
+                      << " Done in "
+                      << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                      << " ms."
+                      << std::endl;
+        }
+
+    } /* namespace detail */
+
+    /**
+        Execute and pretty print a list of tasks, one after another.
+        The first exception of a task is rethrown at the end, the tasks
+        after it only run if failFast is disabled.
+
+        The list is taken by value, so pass it with std::move to hand
+        the tasks over without copying them.
+
+        With a Benchmark in the options, every task runs repeatedly
+        instead and a table with the statistics of its run times is
+        printed at the end.
+     */
+    inline void ExecuteTasks(std::vector<Task> tasks, const ExecutionOptions& options = ExecutionOptions()) {
+        // Start time measurement
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        // Start execution
+        detail::DoTasks(tasks, options);
+
+        // Stop measurement
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        if (options.verbose) {
+            detail::PrintFinished<std::chrono::steady_clock>(start, end);
+        }
+    }
+
+    /**
+        Execute the tasks of a range, moving each of them out of it
+     */
+    template<class Iterator, class = decltype(Task(std::move(*std::declval<Iterator>())))>
+    void ExecuteTasks(Iterator first, Iterator last, const ExecutionOptions& options = ExecutionOptions()) {
+        std::vector<Task> tasks;
+        tasks.reserve(static_cast<std::size_t>(std::distance(first, last)));
+        for (; first != last; ++first) {
+            tasks.push_back(std::move(*first));
+        }
+
+        ExecuteTasks(std::move(tasks), options);
+    }
+
+    /**
+        Execute the given tasks, for example
+
+            Canary::ExecuteTasks(
+                Canary::Task("Task 1", fn1),
+                Canary::Task("Task 2", fn2)
+            );
+     */
+    template<class... Fs, class = typename std::enable_if<detail::AreTasks<Fs...>::value>::type>
+    void ExecuteTasks(Fs&&... fns) {
+        std::vector<Task> tasks;
+        tasks.reserve(sizeof...(fns));
+
+        int expand[] = { (tasks.push_back(std::forward<Fs>(fns)), 0)... };
+        (void)expand;
+
+        ExecuteTasks(std::move(tasks));
+    }
+
+    /**
+        Execute all tasks of a graph in parallel, each one as soon as
+        its dependencies finished.
+
+        Throws a CycleError before running anything if the dependencies
+        contain a cycle. If a task throws, no further tasks are started
+        and the running ones are cancelled, unless failFast is disabled:
+        then only the tasks that depend on it are skipped. The first
+        exception is rethrown once the workers stopped.
+     */
+    inline void ExecuteGraph(TaskGraph& graph, const ExecutionOptions& options = ExecutionOptions()) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        detail::GraphExecutor executor(graph, options);
+        executor.Run();
+
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        if (options.verbose) {
+            detail::PrintFinished<std::chrono::steady_clock>(start, end);
+        }
+    }
+
+} /* namespace Canary */
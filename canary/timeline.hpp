@@ -0,0 +1,126 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "tasks.hpp"
+#include "usage.hpp"
+
+namespace Canary {
+
+    /**
+        TaskTimeline
+
+        Records when and on which worker every task ran, and what it
+        consumed meanwhile. It is the base of the observers that evaluate
+        the timing of an execution, like the TraceRecorder and the
+        TaskSummary.
+
+        Every task runs exactly once, so the timeline keeps one slot per
+        task that is allocated before the first task starts. Workers only
+        write the time stamps of their own tasks into it, without any
+        synchronization. Names and dependencies are copied at the end,
+        so the timeline stays valid after the tasks are gone.
+     */
+    class TaskTimeline : public TaskObserver {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct Entry {
+            Clock::time_point start, end;
+            unsigned worker = 0;
+            bool success = false;
+            ResourceUsage usage;
+
+            // Filled in at the end
+            bool ran = false;
+            std::string name, emoji;
+            std::vector<TaskId> dependencies;
+
+            Clock::duration Duration() const {
+                return end - start;
+            }
+        };
+
+        void Begin(std::size_t tasks, unsigned workers) override {
+            entries.assign(tasks, Entry());
+            running.assign(tasks, nullptr);
+            this->workers = workers;
+            begin = Clock::now();
+        }
+
+        void TaskStarted(unsigned worker, TaskId id, const Task& task) override {
+            Entry& entry = entries[id];
+            entry.worker = worker;
+            running[id] = &task;
+            entry.start = Clock::now();
+        }
+
+        void TaskFinished(unsigned, TaskId id, const Task&, const TaskResult& result) override {
+            Entry& entry = entries[id];
+            entry.end = Clock::now();
+            entry.success = result.success;
+            entry.usage = result.usage;
+        }
+
+        void End() override {
+            end = Clock::now();
+
+            for (TaskId id = 0; id < entries.size(); ++id) {
+                if (running[id] == nullptr) continue;
+
+                Entry& entry = entries[id];
+                entry.ran = true;
+                entry.name = running[id]->msg;
+                entry.emoji = running[id]->emoji;
+                entry.dependencies = running[id]->dependencies;
+            }
+            running.clear();
+        }
+
+        // One entry per task, indexed by TaskId
+        const std::vector<Entry>& Entries() const {
+            return entries;
+        }
+
+        unsigned Workers() const {
+            return workers;
+        }
+
+        Clock::time_point BeginTime() const {
+            return begin;
+        }
+
+        Clock::time_point EndTime() const {
+            return end;
+        }
+
+        Clock::duration WallTime() const {
+            return end - begin;
+        }
+
+    protected:
+        std::vector<Entry> entries;
+        std::vector<const Task*> running;
+        unsigned workers = 0;
+        Clock::time_point begin, end;
+    };
+
+} /* namespace Canary */
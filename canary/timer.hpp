@@ -0,0 +1,241 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#define CANARY_CYCLE_COUNTER 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CANARY_CYCLE_COUNTER 1
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define CANARY_CYCLE_COUNTER 1
+#endif
+
+#include "glyph.hpp"
+
+namespace Canary {
+
+    namespace detail {
+
+#if defined(CANARY_CYCLE_COUNTER)
+        // The time stamp counter on x86, the virtual counter on ARM
+        inline std::uint64_t ReadCycleCounter() {
+#if defined(__aarch64__)
+            std::uint64_t ticks;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+            return ticks;
+#elif defined(_MSC_VER)
+            return __rdtsc();
+#else
+            // The builtin of x86intrin.h, which costs more to parse than all of Canary
+            return __builtin_ia32_rdtsc();
+#endif
+        }
+
+        // Only a counter with a constant rate that keeps running in sleep states can be converted to time
+        inline bool CycleCounterInvariant() {
+#if defined(__aarch64__)
+            return true;
+#elif defined(_MSC_VER)
+            int registers[4];
+            __cpuid(registers, 0x80000000);
+            if (static_cast<unsigned>(registers[0]) < 0x80000007u) return false;
+            __cpuid(registers, 0x80000007);
+            return (registers[3] & (1 << 8)) != 0;
+#else
+            unsigned eax, ebx, ecx, edx;
+            if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u) return false;
+            __cpuid(0x80000007u, eax, ebx, ecx, edx);
+            return (edx & (1u << 8)) != 0;
+#endif
+        }
+#endif
+
+        /**
+            How Timer ticks translate to time. Measured once, on first
+            use: the cycle counter runs next to steady_clock for a few
+            milliseconds. Without a usable counter the ticks are the
+            nanoseconds of steady_clock.
+         */
+        struct TimerCalibration {
+            bool cycles = false;
+            double nanosecondsPerTick = 1;
+
+            static const TimerCalibration& Instance() {
+                static const TimerCalibration calibration = Measure();
+                return calibration;
+            }
+
+        private:
+            static TimerCalibration Measure() {
+                TimerCalibration calibration;
+#if defined(CANARY_CYCLE_COUNTER)
+                if (!CycleCounterInvariant()) return calibration;
+
+                using Clock = std::chrono::steady_clock;
+                Clock::time_point start = Clock::now();
+                std::uint64_t first = ReadCycleCounter();
+
+                Clock::time_point end;
+                do {
+                    end = Clock::now();
+                } while (end - start < std::chrono::milliseconds(10));
+                std::uint64_t last = ReadCycleCounter();
+
+                // A counter that does not advance is of no use
+                if (last <= first) return calibration;
+
+                calibration.cycles = true;
+                calibration.nanosecondsPerTick =
+                    static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) /
+                    static_cast<double>(last - first);
+#endif
+                return calibration;
+            }
+        };
+
+        // "12.3 ms", three significant digits in the largest fitting unit
+        inline std::string FormatDuration(std::chrono::nanoseconds duration) {
+            double value = static_cast<double>(duration.count());
+            const char* unit = "ns";
+            if (value >= 1e9) {
+                value /= 1e9;
+                unit = "s";
+            } else if (value >= 1e6) {
+                value /= 1e6;
+                unit = "ms";
+            } else if (value >= 1e3) {
+                value /= 1e3;
+                unit = "us";
+            }
+
+            char text[32];
+            std::snprintf(text, sizeof(text), value >= 100 ? "%.0f %s" : value >= 10 ? "%.1f %s" : "%.2f %s", value, unit);
+            return text;
+        }
+
+    } /* namespace detail */
+
+    /**
+        Timer
+
+        Measures short intervals with the cycle counter of the CPU where
+        it runs at a constant rate (rdtsc on x86, cntvct_el0 on ARM),
+        which takes a few nanoseconds to read instead of the tens that
+        steady_clock::now() may take. The counter is calibrated against
+        steady_clock once, on first use. Elsewhere, the timer falls back
+        to steady_clock.
+
+        Ticks of different threads are comparable on systems with an
+        invariant, synchronized counter, which all current ones have.
+
+        Example:
+
+            Canary::Timer timer;
+            Parse(input);
+            std::chrono::nanoseconds took = timer.Elapsed();
+     */
+    class Timer {
+    public:
+        using Ticks = std::uint64_t;
+
+        Timer() : start(Now()) {}
+
+        void Restart() {
+            start = Now();
+        }
+
+        std::chrono::nanoseconds Elapsed() const {
+            return ToDuration(Now() - start);
+        }
+
+        // The current tick count, only differences are meaningful
+        static Ticks Now() {
+#if defined(CANARY_CYCLE_COUNTER)
+            if (detail::TimerCalibration::Instance().cycles) return detail::ReadCycleCounter();
+#endif
+            return static_cast<Ticks>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        static std::chrono::nanoseconds ToDuration(Ticks ticks) {
+            return std::chrono::nanoseconds(static_cast<std::int64_t>(
+                static_cast<double>(ticks) * detail::TimerCalibration::Instance().nanosecondsPerTick));
+        }
+
+        // True if the cycle counter is used, false for steady_clock
+        static bool CycleCounter() {
+            return detail::TimerCalibration::Instance().cycles;
+        }
+
+    private:
+        Ticks start;
+    };
+
+    /**
+        ScopedTimer
+
+        Prints how long a scope took when it ends, in the style of the
+        executions: "⚡ Done in 1.23 ms." or, with a label,
+        "⚡ Parse done in 1.23 ms.".
+
+        Example:
+
+            {
+                Canary::ScopedTimer timer("Parse");
+                Parse(input);
+            }
+     */
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(std::string label = "", std::ostream& out = std::cout)
+            : label(std::move(label)), out(out) {}
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        ~ScopedTimer() {
+            std::chrono::nanoseconds elapsed = timer.Elapsed();
+
+            std::string line;
+            line += detail::DoneGlyph();
+            line += label.empty() ? " Done in " : " " + label + " done in ";
+            line += detail::FormatDuration(elapsed) + ".\n";
+            out << line << std::flush;
+        }
+
+        std::chrono::nanoseconds Elapsed() const {
+            return timer.Elapsed();
+        }
+
+    private:
+        std::string label;
+        std::ostream& out;
+
+        // Last, so it starts after everything else was set up
+        Timer timer;
+    };
+
+} /* namespace Canary */
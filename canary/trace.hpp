@@ -0,0 +1,187 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "tasks.hpp"
+#include "timeline.hpp"
+
+namespace Canary {
+
+    namespace detail {
+
+        // Append a string as JSON string literal
+        inline void AppendJsonString(std::string& out, const std::string& value) {
+            out += '"';
+            for (char c : value) {
+                switch (c) {
+                    case '"': out += "\\\""; break;
+                    case '\\': out += "\\\\"; break;
+                    case '\n': out += "\\n"; break;
+                    case '\r': out += "\\r"; break;
+                    case '\t': out += "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            char escaped[8];
+                            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                            out += escaped;
+                        } else {
+                            out += c;
+                        }
+                }
+            }
+            out += '"';
+        }
+
+    } /* namespace detail */
+
+    /**
+        TraceRecorder
+
+        Writes the timeline of an execution as a Chrome Trace Event
+        file, which chrome://tracing and Perfetto (ui.perfetto.dev) show
+        with one row per worker. Recording happens in the TaskTimeline,
+        the JSON is only built at the end.
+
+        Example:
+
+            Canary::TraceRecorder trace("build.trace.json");
+
+            Canary::ExecutionOptions options;
+            options.observers.push_back(&trace);
+            Canary::ExecuteGraph(graph, options);
+     */
+    class TraceRecorder : public TaskTimeline {
+    public:
+        // The trace is written to the file at the end if a path is given
+        explicit TraceRecorder(std::string path = "") : path(std::move(path)) {}
+
+        /**
+            Write the file. A trace is not worth failing the execution
+            for, so a file that cannot be written is reported on stderr
+            and in Written().
+         */
+        void End() override {
+            TaskTimeline::End();
+
+            if (!path.empty()) {
+                std::ofstream file(path);
+                if (file) Write(file);
+                written = static_cast<bool>(file);
+                if (!written) {
+                    std::cerr << "Canary::TraceRecorder: cannot write '" << path << "'" << std::endl;
+                }
+            }
+        }
+
+        // False if the file of the last execution could not be written
+        bool Written() const {
+            return written;
+        }
+
+        /**
+            Write the trace of the last execution as JSON
+         */
+        void Write(std::ostream& out) const {
+            std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+            // Name the rows of the workers, the last one shows the total
+            for (unsigned worker = 0; worker <= workers; ++worker) {
+                json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(worker) +
+                        ",\"args\":{\"name\":\"" + (worker < workers ? "worker " + std::to_string(worker) : "total") + "\"}},\n";
+            }
+
+            char numbers[96];
+            for (TaskId id = 0; id < entries.size(); ++id) {
+                const Entry& entry = entries[id];
+                if (!entry.ran) continue;
+
+                // Coroutine tasks overlap, so they become async events that
+                // get rows of their own instead of a worker row
+                if (entry.worker >= workers) {
+                    AppendEvent(json, id, entry, "b", Microseconds(begin, entry.start));
+                    AppendEvent(json, id, entry, "e", Microseconds(begin, entry.end));
+                    continue;
+                }
+
+                json += "{\"name\":";
+                detail::AppendJsonString(json, entry.name);
+                std::snprintf(numbers, sizeof(numbers), ",\"cat\":\"task\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f",
+                              Microseconds(begin, entry.start), Microseconds(entry.start, entry.end));
+                json += numbers;
+                json += ",\"pid\":1,\"tid\":" + std::to_string(entry.worker);
+                AppendArgs(json, id, entry);
+            }
+
+            // The whole execution on its own row
+            std::snprintf(numbers, sizeof(numbers), "\"ph\":\"X\",\"ts\":0,\"dur\":%.3f",
+                          Microseconds(begin, end));
+            json += "{\"name\":\"Execution\",\"cat\":\"execution\",";
+            json += numbers;
+            json += ",\"pid\":1,\"tid\":" + std::to_string(workers) + "}\n]}\n";
+
+            out.write(json.data(), static_cast<std::streamsize>(json.size()));
+        }
+
+    private:
+        // The begin or end of the async event of a coroutine task
+        void AppendEvent(std::string& json, TaskId id, const Entry& entry, const char* phase, double ts) const {
+            char numbers[96];
+            json += "{\"name\":";
+            detail::AppendJsonString(json, entry.name);
+            std::snprintf(numbers, sizeof(numbers), ",\"cat\":\"coroutine\",\"ph\":\"%s\",\"ts\":%.3f,\"id\":%zu",
+                          phase, ts, id);
+            json += numbers;
+            json += ",\"pid\":1,\"tid\":" + std::to_string(workers);
+            AppendArgs(json, id, entry);
+        }
+
+        static void AppendArgs(std::string& json, TaskId id, const Entry& entry) {
+            json += ",\"args\":{\"id\":" + std::to_string(id);
+            json += entry.success ? ",\"success\":true" : ",\"success\":false";
+
+            // Microseconds and KiB, like getrusage
+            const ResourceUsage& usage = entry.usage;
+            json += ",\"cpu_user_us\":" + std::to_string(usage.user.count());
+            json += ",\"cpu_system_us\":" + std::to_string(usage.system.count());
+            json += ",\"peak_rss_delta_kb\":" + std::to_string(usage.peakRssDelta);
+            json += ",\"child_peak_rss_kb\":" + std::to_string(usage.childPeakRss);
+            json += ",\"voluntary_switches\":" + std::to_string(usage.voluntarySwitches);
+            json += ",\"involuntary_switches\":" + std::to_string(usage.involuntarySwitches);
+            if (!entry.emoji.empty()) {
+                json += ",\"emoji\":";
+                detail::AppendJsonString(json, entry.emoji);
+            }
+            json += "}},\n";
+        }
+
+        static double Microseconds(Clock::time_point from, Clock::time_point to) {
+            return std::chrono::duration<double, std::micro>(to - from).count();
+        }
+
+        std::string path;
+        bool written = true;
+    };
+
+} /* namespace Canary */
@@ -0,0 +1,141 @@
+/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+namespace Canary {
+
+    /**
+        ResourceUsage
+
+        What a task consumed besides wall time: the CPU time and context
+        switches of the thread that ran it and of the subprocesses it
+        waited for, and how much memory it needed. A task that spent
+        most of its wall time on the CPU is CPU-bound, one with many
+        voluntary switches and little CPU time was blocked.
+
+        The thread is measured with getrusage(RUSAGE_THREAD), which only
+        Linux has; elsewhere only subprocesses are counted. Coroutine
+        tasks move between threads, so only their subprocesses count.
+     */
+    struct ResourceUsage {
+        std::chrono::microseconds user{0};
+        std::chrono::microseconds system{0};
+
+        // KiB the peak resident set of the whole process grew by
+        // while the task ran, zero if an earlier peak was higher
+        long peakRssDelta = 0;
+
+        // KiB, the largest peak resident set of a subprocess
+        long childPeakRss = 0;
+
+        long voluntarySwitches = 0;
+        long involuntarySwitches = 0;
+
+        std::chrono::microseconds Cpu() const {
+            return user + system;
+        }
+
+        // The larger of both peaks, the memory the task needed at most
+        long PeakRss() const {
+            return std::max(peakRssDelta, childPeakRss);
+        }
+    };
+
+    namespace detail {
+
+#if !defined(_WIN32)
+        inline std::chrono::microseconds ToMicroseconds(const timeval& time) {
+            return std::chrono::seconds(time.tv_sec) + std::chrono::microseconds(time.tv_usec);
+        }
+
+        // ru_maxrss is in KiB, except on Apple systems
+        inline long MaxRssKiB(const rusage& usage) {
+#if defined(__APPLE__)
+            return static_cast<long>(usage.ru_maxrss / 1024);
+#else
+            return static_cast<long>(usage.ru_maxrss);
+#endif
+        }
+
+        /**
+            Add the usage of a subprocess that was reaped with wait4
+         */
+        inline void AddChildUsage(ResourceUsage& usage, const rusage& child) {
+            usage.user += ToMicroseconds(child.ru_utime);
+            usage.system += ToMicroseconds(child.ru_stime);
+            usage.voluntarySwitches += child.ru_nvcsw;
+            usage.involuntarySwitches += child.ru_nivcsw;
+            usage.childPeakRss = std::max(usage.childPeakRss, MaxRssKiB(child));
+        }
+#endif
+
+        // The usage of the task on the current thread, where subprocesses are added
+        inline ResourceUsage*& CurrentUsageSlot() {
+            thread_local ResourceUsage* current = nullptr;
+            return current;
+        }
+
+        /**
+            UsageMeter
+
+            Measures the calling thread between construction and Stop().
+            Costs two getrusage calls.
+         */
+        class UsageMeter {
+        public:
+            UsageMeter() {
+#if defined(RUSAGE_THREAD)
+                valid = ::getrusage(RUSAGE_THREAD, &start) == 0;
+#endif
+            }
+
+            // Add what the thread used since the construction
+            void Stop(ResourceUsage& usage) const {
+#if defined(RUSAGE_THREAD)
+                rusage end;
+                if (!valid || ::getrusage(RUSAGE_THREAD, &end) != 0) return;
+
+                usage.user += ToMicroseconds(end.ru_utime) - ToMicroseconds(start.ru_utime);
+                usage.system += ToMicroseconds(end.ru_stime) - ToMicroseconds(start.ru_stime);
+                usage.voluntarySwitches += end.ru_nvcsw - start.ru_nvcsw;
+                usage.involuntarySwitches += end.ru_nivcsw - start.ru_nivcsw;
+
+                // The peak is the one of the process even for RUSAGE_THREAD
+                usage.peakRssDelta = std::max(usage.peakRssDelta, MaxRssKiB(end) - MaxRssKiB(start));
+#else
+                (void)usage;
+#endif
+            }
+
+        private:
+#if defined(RUSAGE_THREAD)
+            rusage start;
+            bool valid = false;
+#endif
+        };
+
+    } /* namespace detail */
+
+} /* namespace Canary */
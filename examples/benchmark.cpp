@@ -0,0 +1,48 @@
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../canary.hpp"
+
+// Sort a shuffled copy of the numbers
+std::function<void()> Sort(std::size_t count) {
+    return [count]() {
+        std::vector<int> numbers(count);
+        std::iota(numbers.begin(), numbers.end(), 0);
+        std::reverse(numbers.begin() + count / 3, numbers.end());
+        std::sort(numbers.begin(), numbers.end());
+    };
+}
+
+// Build a long string piece by piece
+std::function<void()> Concatenate(std::size_t count) {
+    return [count]() {
+        std::string text;
+        for (std::size_t i = 0; i < count; ++i) {
+            text += std::to_string(i);
+        }
+    };
+}
+
+int main(int argc, char** argv) {
+    // Each step runs 5 times to warm up and 50 times measured. Run it
+    // twice: the second run compares against the medians of the first
+    // and shows the regressions in red.
+    Canary::Benchmark benchmark(50, 5);
+    benchmark.CompareTo(".canary-benchmark");
+
+    Canary::ExecutionOptions options;
+    options.benchmark = &benchmark;
+    Canary::ExecuteTasks({
+        Canary::Task(Canary::Emoji::bar_chart, "Sort 10k numbers", Sort(10000)),
+        Canary::Task(Canary::Emoji::bar_chart, "Sort 100k numbers", Sort(100000)),
+        Canary::Task(Canary::Emoji::scroll, "Concatenate 10k numbers", Concatenate(10000))
+    }, options);
+
+    // Only a run without regressions becomes the new baseline
+    if (benchmark.Regressions() == 0) {
+        benchmark.Save(".canary-benchmark");
+    }
+}
@@ -0,0 +1,30 @@
+#include <iostream>
+
+#include "../canary.hpp"
+#include "../canary/command.hpp"
+
+int main(int argc, char** argv) {
+    // External commands as steps of a pipeline. Their output is
+    // captured and printed as one block under the finished line.
+    Canary::TaskGraph graph;
+
+    auto info = graph.Add(Canary::CommandTask(Canary::Emoji::computer, "System", { "uname", "-a" }));
+    auto list = graph.Add(Canary::CommandTask(Canary::Emoji::file_folder, "List sources", Canary::Command::Shell("ls -1 | head -5")));
+    graph.Add(Canary::CommandTask(Canary::Emoji::hourglass, "Wait", { "sleep", "1" }).After(info, list));
+    auto broken = graph.Add(Canary::CommandTask(Canary::Emoji::boom, "Broken step", Canary::Command::Shell("echo 'something went wrong' >&2; exit 3")).After(info));
+    graph.Add(Canary::CommandTask(Canary::Emoji::package, "Package", { "true" }).After(broken));
+
+    // Gets a SIGTERM once its time is up
+    graph.Add(Canary::CommandTask(Canary::Emoji::snail, "Slow step", { "sleep", "10" }).Timeout(std::chrono::milliseconds(500)));
+
+    // Keep going after the broken step, only the packaging depends on it
+    Canary::ExecutionOptions options;
+    options.failFast = false;
+
+    try {
+        Canary::ExecuteGraph(graph, options);
+    } catch (const Canary::CommandError& error) {
+        Canary::Ansi::RedForeground red(std::cout);
+        std::cout << "Pipeline failed: " << error.what() << std::endl;
+    }
+}
@@ -0,0 +1,69 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+
+#include "../canary.hpp"
+#include "../canary/coroutine.hpp"
+#include "../canary/summary.hpp"
+
+#if defined(CANARY_COROUTINES)
+
+#include <spawn.h>
+
+extern char** environ;
+
+// Fake download that waits without occupying a worker
+Canary::Async Download(int ms) {
+    co_await Canary::SleepFor(std::chrono::milliseconds(ms));
+}
+
+// Runs a shell command as a child process and waits for it to exit
+Canary::Async Shell(std::string command) {
+    const char* argv[] = { "sh", "-c", command.c_str(), nullptr };
+    pid_t pid;
+    if (posix_spawn(&pid, "/bin/sh", nullptr, nullptr, const_cast<char**>(argv), environ) != 0) {
+        throw std::runtime_error("cannot start '" + command + "'");
+    }
+
+    int status = co_await Canary::ChildExit(pid);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        throw std::runtime_error("'" + command + "' failed");
+    }
+}
+
+int main(int argc, char** argv) {
+    // A thousand downloads of 200 to 700 ms each on two workers. As
+    // threads they would take minutes, as coroutines they overlap and
+    // the whole graph takes little more than the longest of them.
+    Canary::TaskGraph graph;
+
+    std::vector<Canary::TaskId> downloads;
+    for (int i = 0; i < 1000; ++i) {
+        int ms = 200 + (i * 37) % 500;
+        downloads.push_back(graph.Add(Canary::AsyncTask(Canary::Emoji::truck, "Download package " + std::to_string(i), [ms] {
+            return Download(ms);
+        })));
+    }
+
+    auto unpack = graph.Add(Canary::AsyncTask(Canary::Emoji::package, "Unpack", [] { return Shell("sleep 0.3"); }));
+    for (Canary::TaskId download : downloads) {
+        graph[unpack].After(download);
+    }
+
+    Canary::TaskSummary summary(5);
+
+    Canary::ExecutionOptions options;
+    options.workers = 2;
+    options.observers.push_back(&summary);
+    Canary::ExecuteGraph(graph, options);
+
+    summary.Print();
+}
+
+#else
+
+int main() {
+    std::cout << "Coroutine tasks need C++20" << std::endl;
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <chrono>
+#include <thread>
+
+#include "../canary.hpp"
+#include "../canary/history.hpp"
+#include "../canary/summary.hpp"
+#include "../canary/trace.hpp"
+
+// Fake work that takes the given time
+std::function<void()> Sleep(int ms) {
+    return [ms]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    };
+}
+
+// Fake compiler that prints warnings while it works
+std::function<void()> Compile(const std::string& file, int ms) {
+    return [file, ms]() {
+        for (int i = 0; i < 3; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(ms / 3));
+            std::cout << file << ":" << 10 * (i + 1) << ": warning: unused variable" << std::endl;
+        }
+    };
+}
+
+int main(int argc, char** argv) {
+    // A small build-like pipeline: both compile steps only wait
+    // for the fetch, the link step waits for both of them. The
+    // output of the compile steps is printed as one block each.
+    Canary::TaskGraph graph;
+
+    auto fetch = graph.Add(Canary::Task(Canary::Emoji::truck, "Fetch sources", Sleep(200)));
+    auto generate = graph.Add(Canary::Task(Canary::Emoji::gear, "Generate headers", Sleep(100)));
+    auto compileA = graph.Add(Canary::Task(Canary::Emoji::hammer, "Compile a.cpp", Compile("a.cpp", 400)).After(fetch, generate));
+    auto compileB = graph.Add(Canary::Task(Canary::Emoji::hammer, "Compile b.cpp", Compile("b.cpp", 300)).After(fetch));
+    auto link = graph.Add(Canary::Task(Canary::Emoji::package, "Link", Sleep(100)).After(compileA, compileB));
+    graph.Add(Canary::Task(Canary::Emoji::sparkles, "Test", Sleep(200)).After(link));
+
+    // Show where the time went and what bounds the build. The
+    // history makes later runs start the longest chain first.
+    Canary::TaskSummary summary;
+    Canary::TimingHistory history(".canary-timings");
+
+    Canary::ExecutionOptions pipeline;
+    pipeline.observers.push_back(&summary);
+    pipeline.history = &history;
+    Canary::ExecuteGraph(graph, pipeline);
+    summary.Print();
+
+    // Many fine-grained tasks: 100 layers of 200 tasks, each one
+    // depending on two tasks of the previous layer
+    Canary::TaskGraph layers;
+    const std::size_t width = 200, depth = 100;
+    std::atomic<std::size_t> counter(0);
+
+    for (std::size_t layer = 0; layer < depth; ++layer) {
+        for (std::size_t i = 0; i < width; ++i) {
+            Canary::Task task("Step", [&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+            if (layer > 0) {
+                std::size_t previous = (layer - 1) * width;
+                task.After(previous + i, previous + (i + 1) % width);
+            }
+            layers.Add(std::move(task));
+        }
+    }
+
+    // Record a timeline that can be opened in ui.perfetto.dev
+    Canary::TraceRecorder trace("layers.trace.json");
+
+    Canary::ExecutionOptions options;
+    options.verbose = false;
+    options.observers.push_back(&trace);
+    Canary::ExecuteGraph(layers, options);
+    std::cout << counter.load() << " tasks executed." << std::endl;
+
+    // Cycles are reported before anything runs
+    Canary::TaskGraph cyclic;
+    auto a = cyclic.Add(Canary::Task("A", Sleep(0)));
+    auto b = cyclic.Add(Canary::Task("B", Sleep(0)).After(a));
+    cyclic[a].After(b);
+
+    try {
+        Canary::ExecuteGraph(cyclic);
+    } catch (const Canary::CycleError& error) {
+        Canary::Ansi::RedForeground red(std::cout);
+        std::cout << error.what() << std::endl;
+    }
+}
@@ -0,0 +1,53 @@
+#include <fstream>
+#include <iostream>
+
+#include "../canary.hpp"
+#include "../canary/cache.hpp"
+#include "../canary/command.hpp"
+
+// Write a file with the given contents
+void WriteFile(const std::string& path, const std::string& contents) {
+    std::ofstream(path) << contents;
+}
+
+// Builds "app" from two sources. Each step declares the files and
+// flags it depends on, so only the steps whose inputs changed run.
+void Build(Canary::TaskCache& cache, const std::string& flags) {
+    Canary::TaskGraph graph;
+
+    auto a = graph.Add(Canary::CommandTask(Canary::Emoji::hammer, "Compile a.c", Canary::Command::Shell("sleep 0.3; cat a.c > a.o"))
+                           .Inputs("a.c")
+                           .Params(flags));
+    auto b = graph.Add(Canary::CommandTask(Canary::Emoji::hammer, "Compile b.c", Canary::Command::Shell("sleep 0.3; cat b.c > b.o"))
+                           .Inputs("b.c")
+                           .Params(flags));
+    graph.Add(Canary::CommandTask(Canary::Emoji::package, "Link app", Canary::Command::Shell("sleep 0.2; cat a.o b.o > app"))
+                  .Inputs("a.o", "b.o")
+                  .After(a, b));
+
+    Canary::ExecutionOptions options;
+    options.cache = &cache;
+    Canary::ExecuteGraph(graph, options);
+}
+
+int main(int argc, char** argv) {
+    WriteFile("a.c", "int a;\n");
+    WriteFile("b.c", "int b;\n");
+
+    Canary::TaskCache cache(".canary-cache");
+    cache.Clear();
+
+    // Everything runs the first time
+    Build(cache, "-O2");
+
+    // Nothing changed, everything is cached
+    Build(cache, "-O2");
+
+    // Only b.c and the link step run again
+    WriteFile("b.c", "int b = 1;\n");
+    Build(cache, "-O2");
+
+    // Other flags rebuild the objects, the link step is cached
+    // again if they come out the same
+    Build(cache, "-O3");
+}
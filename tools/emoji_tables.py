@@ -0,0 +1,752 @@
+#!/usr/bin/env python3
+#
+# Copyright 2017 The Canary Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate canary/emoji.hpp, canary/emoji/, canary/emoji.cppm and canary/emoji_data.hpp.
+
+The emojis are the names and code points of tools/emoji-names.txt, joined
+with the Unicode data of tools/emoji-test.txt for their group, the version
+that introduced them and their width: two columns for fully-qualified
+emojis, one for unqualified ones that default to text presentation. The
+tables are in the order of emoji-test.txt, so every group is contiguous.
+
+emoji.hpp has a constant for every name, in one header per group in
+canary/emoji, and emoji.cppm makes them a module. emoji_data.hpp has the
+tables:
+
+Metadata: arrays of the group, version and width of every emoji, where
+every group starts, and the emojis ordered by version and by width.
+
+Storage: the UTF-8 bytes of all emojis in one blob and all names in
+another, each followed by a null character, with offset and length arrays.
+
+Text: a third blob of that layout with an ASCII replacement for every
+emoji, from tools/emoji-text.txt or :name: for emojis it does not have,
+and Canary::Emoji::Id, an enumerator with the table index of every name.
+
+Name to emoji: the names are hashed with a short key hash, as
+Canary::detail::ShortcodeHash does, which reads the name in overlapping 8
+byte words. A name goes to bucket hash % buckets. Every bucket gets a
+pilot, found here, such that ShortcodeSlot(hash, pilot) puts all names of
+all buckets into distinct slots of a table with one slot per name (hash
+and displace, PTHash style).
+
+Emoji to name: a byte trie over the UTF-8 sequences, in breadth first
+order so that the children of a node are contiguous. The root maps every
+byte to its child directly. Below it, all children of a node are either
+continuation bytes or lead bytes, so their low six bits index a 64 bit
+mask and the rank of the bit in the mask is the child. Sequences that end
+in U+FE0F VARIATION SELECTOR-16 are also added without it, as text often
+leaves it out.
+
+To update the emojis, replace tools/emoji-test.txt with the file of a new
+Unicode version, add names to tools/emoji-names.txt and run
+
+    tools/emoji_tables.py
+"""
+
+import os
+import re
+import sys
+
+MASK = (1 << 64) - 1
+PRIME1 = 0x9E3779B185EBCA87
+PRIME2 = 0xC2B2AE3D27D4EB4F
+PRIME3 = 0x165667B19E3779F9
+
+# Names per bucket on average, more is a smaller table but a longer search
+BUCKET_SIZE = 4
+
+VARIATION_SELECTOR = b"\xEF\xB8\x8F"
+
+# The groups of emoji-test.txt, their names in Canary::Emoji::Group and
+# their headers in canary/emoji
+GROUPS = [
+    ("Smileys & Emotion", "SmileysEmotion", "smileys_emotion.hpp"),
+    ("People & Body", "PeopleBody", "people_body.hpp"),
+    ("Component", "Component", "component.hpp"),
+    ("Animals & Nature", "AnimalsNature", "animals_nature.hpp"),
+    ("Food & Drink", "FoodDrink", "food_drink.hpp"),
+    ("Travel & Places", "TravelPlaces", "travel_places.hpp"),
+    ("Activities", "Activities", "activities.hpp"),
+    ("Objects", "Objects", "objects.hpp"),
+    ("Symbols", "Symbols", "symbols.hpp"),
+    ("Flags", "Flags", "flags.hpp"),
+]
+
+
+class Emoji(object):
+    def __init__(self, name, codepoints):
+        self.name = name
+        self.codepoints = codepoints
+        self.data = "".join(chr(c) for c in codepoints).encode("utf-8")
+        self.order = 0
+        self.group = 0
+        self.version = 0
+        self.width = 2
+        self.tone = False
+        self.gender = False
+
+
+def read_names(path):
+    emojis = []
+    with open(path) as f:
+        for line in f:
+            line = line.split("#", 1)[0].split()
+            if line:
+                emojis.append(Emoji(line[0], [int(code, 16) for code in line[1:]]))
+    return emojis
+
+
+def read_texts(path):
+    texts = {}
+    with open(path) as f:
+        for line in f:
+            if line.startswith("#"):
+                continue
+            line = line.split()
+            if line:
+                texts[line[0]] = line[1].encode("ascii")
+    return texts
+
+
+def composed(emoji, tone, gender):
+    """The code points Canary::Emoji::Compose makes of an emoji."""
+    first, rest = emoji.codepoints[0], list(emoji.codepoints[1:])
+    codepoints = [first]
+    if tone:
+        # The tone replaces the variation selector after the first code point
+        if rest[:1] == [0xFE0F]:
+            rest = rest[1:]
+        codepoints.append(0x1F3FB)
+    codepoints.extend(rest)
+    if gender:
+        codepoints.extend([0x200D, gender, 0xFE0F])
+    return tuple(codepoints)
+
+
+def read_tests(path):
+    """Code points to (order, status, group, version in tenths)."""
+    pattern = re.compile(r"^([0-9A-F ]+?)\s*;\s*([\w-]+)\s*#\s*\S+\s+E(\d+)\.(\d+)\s")
+    groups = [group[0] for group in GROUPS]
+    tests = {}
+    group = None
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            if line.startswith("# group:"):
+                group = groups.index(line.split(":", 1)[1].strip())
+                continue
+            match = pattern.match(line)
+            if match:
+                codepoints = tuple(int(code, 16) for code in match.group(1).split())
+                version = int(match.group(3)) * 10 + int(match.group(4))
+                tests[codepoints] = (len(tests), match.group(2), group, version)
+    return tests
+
+
+def rotate_left(value, bits):
+    return ((value << bits) | (value >> (64 - bits))) & MASK
+
+
+def load(data, position, size):
+    return int.from_bytes(data[position:position + size], "little")
+
+
+def short_hash(data):
+    """The same as Canary::detail::ShortcodeHash."""
+    size = len(data)
+    h = (size * PRIME1) & MASK
+    if size >= 8:
+        p = 0
+        while p + 8 < size:
+            h = (rotate_left(h ^ load(data, p, 8), 31) * PRIME2) & MASK
+            p += 8
+        h = (rotate_left(h ^ load(data, size - 8, 8), 31) * PRIME2) & MASK
+    elif size >= 4:
+        h = (rotate_left(h ^ (load(data, 0, 4) | load(data, size - 4, 4) << 32), 31) * PRIME2) & MASK
+    elif size > 0:
+        h = (rotate_left(h ^ (data[0] | data[size // 2] << 8 | data[size - 1] << 16), 31) * PRIME2) & MASK
+
+    h ^= h >> 33
+    h = (h * PRIME3) & MASK
+    h ^= h >> 29
+    return h
+
+
+def slot(h, pilot, size):
+    """The same as Canary::detail::ShortcodeSlot."""
+    x = rotate_left(h, 32) ^ ((pilot * PRIME1) & MASK)
+    x ^= x >> 29
+    x = (x * PRIME3) & MASK
+    x ^= x >> 32
+    return x % size
+
+
+def build_hash(names):
+    """The pilots of the buckets and the index of the name in every slot."""
+    size = len(names)
+    buckets = max(1, (size + BUCKET_SIZE - 1) // BUCKET_SIZE)
+    hashes = [short_hash(name.encode()) for name in names]
+    if len(set(hashes)) != size:
+        sys.exit("names with the same hash, change short_hash")
+
+    members = [[] for _ in range(buckets)]
+    for index, h in enumerate(hashes):
+        members[h % buckets].append(index)
+
+    pilots = [0] * buckets
+    table = [None] * size
+
+    # Largest buckets first, while there are many free slots
+    for bucket in sorted(range(buckets), key=lambda b: -len(members[b])):
+        if not members[bucket]:
+            continue
+        for pilot in range(1 << 16):
+            slots = [slot(hashes[i], pilot, size) for i in members[bucket]]
+            if len(set(slots)) == len(slots) and all(table[s] is None for s in slots):
+                break
+        else:
+            sys.exit("no pilot for bucket %d, change BUCKET_SIZE" % bucket)
+
+        pilots[bucket] = pilot
+        for i, s in zip(members[bucket], slots):
+            table[s] = i
+
+    return pilots, table
+
+
+def build_trie(emojis):
+    """The nodes as (mask, first child, index + 1, high bits) and the root table."""
+    keys = {}
+    for index, emoji in enumerate(emojis):
+        keys[emoji.data] = index + 1
+    for index, emoji in enumerate(emojis):
+        data = emoji.data
+        if data.endswith(VARIATION_SELECTOR) and data[:-3] and data[:-3] not in keys:
+            keys[data[:-3]] = index + 1
+
+    # Nested dicts first, numbered breadth first afterwards
+    root = {}
+    values = {}
+    for data, value in keys.items():
+        node = root
+        for byte in data:
+            node = node.setdefault(byte, {})
+        values[id(node)] = value
+
+    order = [root]
+    index = 0
+    nodes = []
+    while index < len(order):
+        node = order[index]
+        index += 1
+        labels = sorted(node)
+        first = len(order)
+        order.extend(node[label] for label in labels)
+
+        mask, high = 0, 0
+        if node is not root:
+            for label in labels:
+                if label < 0x80 or (high and (label & 0xC0) != high):
+                    sys.exit("mixed children below the root")
+                high = label & 0xC0
+                mask |= 1 << (label & 0x3F)
+        nodes.append((mask, first if labels else 0, values.get(id(node), 0), high))
+
+    root_table = [0] * 256
+    for k, label in enumerate(sorted(root)):
+        root_table[label] = 1 + k
+    if len(order) >= 1 << 16:
+        sys.exit("too many nodes for 16 bit indexes")
+    return nodes, root_table
+
+
+LICENSE = """/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/emoji_tables.py from tools/emoji-names.txt and
+// tools/emoji-test.txt, do not edit
+"""
+
+COMMON_HEADER = LICENSE + """
+#pragma once
+
+#include <cstddef>
+
+// Inline variables have one definition across all translation units,
+// before C++17 constexpr variables have a copy in every unit that uses them
+#if defined(__cpp_inline_variables)
+#define CANARY_INLINE_VARIABLE inline
+#else
+#define CANARY_INLINE_VARIABLE
+#endif
+
+namespace Canary {
+namespace detail {
+
+    /**
+        Whether Compose may add a skin tone or a gender sign to an
+        emoji constant. The header of a group sets them for its emojis
+        that have such sequences in emoji-test.txt.
+     */
+    template<bool Tone, bool Gender>
+    struct ModifierFlags {
+        static constexpr bool tone = Tone;
+        static constexpr bool gender = Gender;
+    };
+
+    template<const char* E>
+    struct EmojiModifiers : ModifierFlags<false, false> {};
+
+} /* namespace detail */
+
+namespace Emoji {
+
+    /**
+        The emojis are constexpr character arrays: their length is part
+        of their type and they still convert to const char* and
+        std::string like string literals. Length() gives the length
+        without strlen, as does View() of view.hpp.
+
+        Every constant ends in a space, to print it before a message.
+        The emoji table of emoji_table.hpp has them without. The
+        constants are in one header per group in canary/emoji, which
+        all include this one.
+
+        Example:
+
+            std::string line;
+            line.append(Canary::Emoji::rocket, Canary::Emoji::Length(Canary::Emoji::rocket));
+     */
+    template<std::size_t N>
+    constexpr std::size_t Length(const char (&)[N]) {
+        return N - 1;
+    }
+
+} /* namespace Emoji */
+} /* namespace Canary */
+"""
+
+VIEW_HEADER = LICENSE + """
+#pragma once
+
+#include <cstddef>
+
+#if defined(__has_include)
+#if __has_include(<string_view>) && __cplusplus >= 201703L
+#include <string_view>
+#define CANARY_STRING_VIEW 1
+#endif
+#endif
+
+namespace Canary {
+namespace Emoji {
+
+#if defined(CANARY_STRING_VIEW)
+    /**
+        An emoji constant as a std::string_view, in its own header as
+        <string_view> costs more to parse than all the constants of a
+        group
+     */
+    template<std::size_t N>
+    constexpr std::string_view View(const char (&emoji)[N]) {
+        return std::string_view(emoji, N - 1);
+    }
+#endif
+
+} /* namespace Emoji */
+} /* namespace Canary */
+"""
+
+GROUP_HEADER = LICENSE + """
+#pragma once
+
+#include "common.hpp"
+
+namespace Canary {
+namespace Emoji {
+
+    // %(group)s
+
+%(constants)s
+} /* namespace Emoji */
+%(modifiers)s} /* namespace Canary */
+"""
+
+MODIFIERS = """
+namespace detail {
+
+    // The emojis of the group that Compose gives a skin tone or a gender
+
+%(specializations)s
+} /* namespace detail */
+"""
+
+EMOJI_HEADER = LICENSE + """
+#pragma once
+
+/**
+    All emoji constants and View(). The constants are in one header
+    per group, to include only the ones a translation unit uses:
+
+%(list)s
+
+    Example:
+
+        #include "canary/emoji/travel_places.hpp"
+
+        std::cout << Canary::Emoji::zap << "Done" << std::endl;
+ */
+
+#include "emoji/view.hpp"
+%(includes)s
+"""
+
+MODULE_UNIT = LICENSE + """
+// The emoji constants and the composition of modifiers as a C++20 module.
+// A translation unit imports it or includes the emoji headers, not both.
+//
+// Example:
+//
+//     import canary.emoji;
+//
+//     std::cout << Canary::Emoji::zap << "Done" << std::endl;
+
+module;
+
+// The headers the emoji headers include, first, so that the module has
+// only Canary in it and importers share the standard library with it
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__has_include)
+#if __has_include(<string_view>)
+#include <string_view>
+#endif
+#endif
+
+export module canary.emoji;
+
+export {
+#include "emoji.hpp"
+#include "compose.hpp"
+}
+"""
+
+DATA_HEADER = LICENSE + """
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Canary {
+
+    namespace detail {
+
+        // A node of the trie from emoji bytes to emojis
+        struct ReverseNode {
+            // Bit b is set if there is a child for the byte high | b
+            std::uint64_t children;
+            std::uint16_t first;
+            // The index + 1 of the emoji that ends here, 0 if none does
+            std::uint16_t emoji;
+            std::uint8_t high;
+        };
+
+        /**
+            The emoji tables, a template only to have one definition of
+            its static members in every program before C++17
+         */
+        template<class = void>
+        struct EmojiTables {
+            static constexpr std::size_t count = %(count)d;
+            static constexpr std::size_t groups = %(group_count)d;
+
+            // The UTF-8 bytes of all emojis, each followed by a null character
+            static constexpr char bytes[] =
+%(bytes)s
+            static constexpr std::uint16_t offsets[count] = {
+%(offsets)s
+            };
+            static constexpr std::uint8_t lengths[count] = {
+%(lengths)s
+            };
+
+            // All names, each followed by a null character
+            static constexpr char names[] =
+%(names)s;
+            static constexpr std::uint16_t nameOffsets[count] = {
+%(name_offsets)s
+            };
+            static constexpr std::uint8_t nameLengths[count] = {
+%(name_lengths)s
+            };
+            static constexpr std::size_t longestName = %(longest_name)d;
+
+            // The ASCII replacements, each followed by a null character
+            static constexpr char text[] =
+%(text)s;
+            static constexpr std::uint16_t textOffsets[count] = {
+%(text_offsets)s
+            };
+            static constexpr std::uint8_t textLengths[count] = {
+%(text_lengths)s
+            };
+
+            // Canary::Emoji::Group, the version in tenths (E13.1 is 131) and the width in columns
+            static constexpr std::uint8_t group[count] = {
+%(groups)s
+            };
+            static constexpr std::uint8_t version[count] = {
+%(versions)s
+            };
+            static constexpr std::uint8_t width[count] = {
+%(widths)s
+            };
+
+            // Indexes: where every group starts, with the end as the last
+            // element, and all emojis by version and by width, narrow first
+            static constexpr std::uint16_t groupStart[groups + 1] = {
+%(group_start)s
+            };
+            static constexpr std::uint16_t byVersion[count] = {
+%(by_version)s
+            };
+            static constexpr std::uint16_t byWidth[count] = {
+%(by_width)s
+            };
+            static constexpr std::size_t narrow = %(narrow)d;
+
+            // The perfect hash from names to emojis
+            static constexpr std::size_t buckets = %(buckets)d;
+            static constexpr std::uint16_t pilots[buckets] = {
+%(pilots)s
+            };
+            static constexpr std::uint16_t slots[count] = {
+%(slots)s
+            };
+
+            // The trie from bytes to emojis, the root is node 0
+            static constexpr std::size_t longestEmoji = %(longest_emoji)d;
+            static constexpr std::uint16_t reverseRoot[256] = {
+%(root)s
+            };
+            static constexpr ReverseNode reverseNodes[%(node_count)d] = {
+%(nodes)s
+            };
+        };
+
+        template<class T> constexpr std::size_t EmojiTables<T>::count;
+        template<class T> constexpr std::size_t EmojiTables<T>::groups;
+        template<class T> constexpr char EmojiTables<T>::bytes[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::offsets[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::lengths[];
+        template<class T> constexpr char EmojiTables<T>::names[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::nameOffsets[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::nameLengths[];
+        template<class T> constexpr std::size_t EmojiTables<T>::longestName;
+        template<class T> constexpr char EmojiTables<T>::text[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::textOffsets[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::textLengths[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::group[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::version[];
+        template<class T> constexpr std::uint8_t EmojiTables<T>::width[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::groupStart[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::byVersion[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::byWidth[];
+        template<class T> constexpr std::size_t EmojiTables<T>::narrow;
+        template<class T> constexpr std::size_t EmojiTables<T>::buckets;
+        template<class T> constexpr std::uint16_t EmojiTables<T>::pilots[];
+        template<class T> constexpr std::uint16_t EmojiTables<T>::slots[];
+        template<class T> constexpr std::size_t EmojiTables<T>::longestEmoji;
+        template<class T> constexpr std::uint16_t EmojiTables<T>::reverseRoot[];
+        template<class T> constexpr ReverseNode EmojiTables<T>::reverseNodes[];
+
+        using EmojiTable = EmojiTables<>;
+
+    } /* namespace detail */
+
+    namespace Emoji {
+
+        // The table index of every emoji, by the name of its constant
+        enum class Id : std::uint16_t {
+%(ids)s
+        };
+
+    } /* namespace Emoji */
+
+} /* namespace Canary */
+"""
+
+
+def escape(data):
+    return "".join("\\x%02X" % byte for byte in data)
+
+
+def numbers(values, per_line=16, indent=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(" " * indent + ", ".join(str(value) for value in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    tools = os.path.dirname(os.path.abspath(__file__))
+    canary = os.path.join(tools, "..", "canary")
+
+    emojis = read_names(os.path.join(tools, "emoji-names.txt"))
+    tests = read_tests(os.path.join(tools, "emoji-test.txt"))
+    texts = read_texts(os.path.join(tools, "emoji-text.txt"))
+
+    for name in texts:
+        if not any(emoji.name == name for emoji in emojis):
+            sys.exit("%s of emoji-text.txt is not in emoji-names.txt" % name)
+
+    for emoji in emojis:
+        test = tests.get(tuple(emoji.codepoints))
+        if test is None:
+            sys.exit("%s is not in emoji-test.txt" % emoji.name)
+        emoji.order, status, emoji.group, emoji.version = test
+        emoji.width = 1 if status in ("unqualified", "minimally-qualified") else 2
+        emoji.tone = composed(emoji, True, None) in tests
+        emoji.gender = all(composed(emoji, False, sign) in tests for sign in (0x2640, 0x2642))
+    emojis.sort(key=lambda emoji: (emoji.order, emoji.name))
+
+    pilots, slots = build_hash([emoji.name for emoji in emojis])
+    nodes, root = build_trie(emojis)
+
+    # emoji.hpp and the headers of the groups in emoji/ with the constants
+    headers = os.path.join(canary, "emoji")
+    os.makedirs(headers, exist_ok=True)
+    with open(os.path.join(headers, "common.hpp"), "w") as f:
+        f.write(COMMON_HEADER)
+    with open(os.path.join(headers, "view.hpp"), "w") as f:
+        f.write(VIEW_HEADER)
+
+    written = []
+    for group, (title, _, header) in enumerate(GROUPS):
+        constants = ['    CANARY_INLINE_VARIABLE constexpr char %s[] = "%s ";' % (emoji.name, escape(emoji.data))
+                     for emoji in emojis if emoji.group == group]
+        if not constants:
+            continue
+        specializations = ["    template<> struct EmojiModifiers<Emoji::%s> : ModifierFlags<%s, %s> {};"
+                           % (emoji.name, str(emoji.tone).lower(), str(emoji.gender).lower())
+                           for emoji in emojis if emoji.group == group and (emoji.tone or emoji.gender)]
+        modifiers = MODIFIERS % {"specializations": "\n".join(specializations) + "\n"} if specializations else ""
+        with open(os.path.join(headers, header), "w") as f:
+            f.write(GROUP_HEADER % {"group": title, "constants": "\n".join(constants) + "\n", "modifiers": modifiers})
+        written.append((title, header, len(constants)))
+
+    with open(os.path.join(canary, "emoji.hpp"), "w") as f:
+        f.write(EMOJI_HEADER % {
+            "list": "\n".join("        emoji/%-20s %s, %d emojis" % (header, title, count) for title, header, count in written),
+            "includes": "\n".join('#include "emoji/%s"' % header for _, header, _ in written),
+        })
+
+    with open(os.path.join(canary, "emoji.cppm"), "w") as f:
+        f.write(MODULE_UNIT)
+
+    # emoji_data.hpp, the tables
+    offsets, name_offsets = [], []
+    byte_lines, name_lines = [], []
+    position, name_position = 0, 0
+    for emoji in emojis:
+        offsets.append(position)
+        name_offsets.append(name_position)
+        byte_lines.append('                "%s\\0" // %s' % (escape(emoji.data), emoji.name))
+        name_lines.append('                "%s\\0"' % emoji.name)
+        position += len(emoji.data) + 1
+        name_position += len(emoji.name) + 1
+    byte_lines[-1] = byte_lines[-1].replace('" //', '"; //', 1)
+
+    text_offsets, text_lengths, text_lines = [], [], []
+    text_position = 0
+    for emoji in emojis:
+        replacement = texts.get(emoji.name, b":" + emoji.name.encode("ascii") + b":")
+        text_offsets.append(text_position)
+        text_lengths.append(len(replacement))
+        text_lines.append('                "%s\\0"' % replacement.decode("ascii").replace("\\", "\\\\").replace('"', '\\"'))
+        text_position += len(replacement) + 1
+
+    id_lines = []
+    group = None
+    for emoji in emojis:
+        if emoji.group != group:
+            if group is not None:
+                id_lines.append("")
+            group = emoji.group
+            id_lines.append("            // %s" % GROUPS[group][0])
+        id_lines.append("            %s," % emoji.name)
+
+    if position >= 1 << 16 or name_position >= 1 << 16 or text_position >= 1 << 16:
+        sys.exit("too many emojis for 16 bit offsets")
+
+    group_start = [0] * (len(GROUPS) + 1)
+    for emoji in emojis:
+        group_start[emoji.group + 1] += 1
+    for group in range(len(GROUPS)):
+        group_start[group + 1] += group_start[group]
+
+    node_lines = []
+    for mask, first, index, high in nodes:
+        node_lines.append("                { 0x%016Xull, %d, %d, 0x%02X }," % (mask, first, index, high))
+
+    with open(os.path.join(canary, "emoji_data.hpp"), "w") as f:
+        f.write(DATA_HEADER % {
+            "count": len(emojis),
+            "group_count": len(GROUPS),
+            "bytes": "\n".join(byte_lines),
+            "offsets": numbers(offsets),
+            "lengths": numbers([len(emoji.data) for emoji in emojis]),
+            "names": "\n".join(name_lines),
+            "name_offsets": numbers(name_offsets),
+            "name_lengths": numbers([len(emoji.name) for emoji in emojis]),
+            "longest_name": max(len(emoji.name) for emoji in emojis),
+            "text": "\n".join(text_lines),
+            "text_offsets": numbers(text_offsets),
+            "text_lengths": numbers(text_lengths),
+            "ids": "\n".join(id_lines),
+            "groups": numbers([emoji.group for emoji in emojis]),
+            "versions": numbers([emoji.version for emoji in emojis]),
+            "widths": numbers([emoji.width for emoji in emojis]),
+            "group_start": numbers(group_start),
+            "by_version": numbers(sorted(range(len(emojis)), key=lambda i: (emojis[i].version, i))),
+            "by_width": numbers(sorted(range(len(emojis)), key=lambda i: (emojis[i].width, i))),
+            "narrow": sum(1 for emoji in emojis if emoji.width == 1),
+            "buckets": len(pilots),
+            "pilots": numbers(pilots),
+            "slots": numbers(slots),
+            "longest_emoji": max(len(emoji.data) for emoji in emojis),
+            "root": numbers(root),
+            "node_count": len(nodes),
+            "nodes": "\n".join(node_lines),
+        })
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+#
+# Copyright 2017 The Canary Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate canary/grapheme_data.hpp.
+
+The tables of Canary::Grapheme, from the Grapheme_Cluster_Break and
+Extended_Pictographic properties of tools/grapheme-break.txt:
+
+Properties: a two stage table. The code point without its low BLOCK_SHIFT
+bits indexes blocks, which holds the number of a block of properties;
+blocks with the same properties are stored once.
+
+Pairs: for every two properties, whether UAX #29 keeps them in one
+cluster. Two rules need more than the pair, which the iterator keeps
+track of: GB11 keeps ZWJ x Extended_Pictographic only after
+Extended_Pictographic Extend* and GB12/GB13 keep regional indicators in
+pairs.
+
+To update the properties, replace the lines of tools/grapheme-break.txt
+with those of GraphemeBreakProperty.txt and emoji-data.txt of a new
+Unicode version and run
+
+    tools/grapheme_tables.py
+"""
+
+import os
+import sys
+
+BLOCK_SHIFT = 7
+
+# The properties in the order of Canary::detail::GraphemeProperty
+PROPERTIES = [
+    ("Other", "Other"),
+    ("CR", "CR"),
+    ("LF", "LF"),
+    ("Control", "Control"),
+    ("Extend", "Extend"),
+    ("ZWJ", "ZWJ"),
+    ("Regional_Indicator", "RegionalIndicator"),
+    ("Prepend", "Prepend"),
+    ("SpacingMark", "SpacingMark"),
+    ("L", "L"),
+    ("V", "V"),
+    ("T", "T"),
+    ("LV", "LV"),
+    ("LVT", "LVT"),
+    ("Extended_Pictographic", "ExtendedPictographic"),
+]
+
+# The values of the pair table
+BREAK, KEEP, KEEP_AFTER_PICTOGRAPHIC, KEEP_ODD_REGIONAL = range(4)
+
+
+def read_properties(path):
+    names = [name for name, _ in PROPERTIES]
+    properties = [0] * 0x110000
+    with open(path) as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            codes, name = (part.strip() for part in line.split(";"))
+            if name not in names:
+                sys.exit("unknown property %s" % name)
+            first, _, last = codes.partition("..")
+            for code in range(int(first, 16), int(last or first, 16) + 1):
+                properties[code] = names.index(name)
+    return properties
+
+
+def pair(before, after):
+    """The rules GB3 to GB999 of UAX #29 for two properties."""
+    b, a = PROPERTIES[before][0], PROPERTIES[after][0]
+    if b == "CR" and a == "LF":
+        return KEEP
+    if b in ("Control", "CR", "LF") or a in ("Control", "CR", "LF"):
+        return BREAK
+    if b == "L" and a in ("L", "V", "LV", "LVT"):
+        return KEEP
+    if b in ("LV", "V") and a in ("V", "T"):
+        return KEEP
+    if b in ("LVT", "T") and a == "T":
+        return KEEP
+    if a in ("Extend", "ZWJ", "SpacingMark") or b == "Prepend":
+        return KEEP
+    if b == "ZWJ" and a == "Extended_Pictographic":
+        return KEEP_AFTER_PICTOGRAPHIC
+    if b == "Regional_Indicator" and a == "Regional_Indicator":
+        return KEEP_ODD_REGIONAL
+    return BREAK
+
+
+LICENSE = """/**
+   Copyright 2017 The Canary Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+// Generated by tools/grapheme_tables.py from tools/grapheme-break.txt, do not edit
+"""
+
+DATA_HEADER = LICENSE + """
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Canary {
+
+    namespace detail {
+
+        // The Grapheme_Cluster_Break of a code point, or Extended_Pictographic
+        enum GraphemeProperty : std::uint8_t {
+%(properties)s
+        };
+
+        // Whether two properties stay in one cluster
+        enum GraphemePair : std::uint8_t {
+            GraphemeBreak,
+            GraphemeKeep,
+            // GB11, after Extended_Pictographic Extend* ZWJ
+            GraphemeKeepAfterPictographic,
+            // GB12 and GB13, after an odd number of regional indicators
+            GraphemeKeepOddRegional
+        };
+
+        /**
+            The grapheme tables, a template only to have one definition
+            of its static members in every program before C++17
+         */
+        template<class = void>
+        struct GraphemeTables {
+            static constexpr std::size_t blockShift = %(block_shift)d;
+            static constexpr std::size_t properties = %(property_count)d;
+
+            // The block of every 1 << blockShift code points
+            static constexpr std::uint8_t blocks[%(block_count)d] = {
+%(blocks)s
+            };
+
+            // The GraphemeProperty of every code point of every distinct block
+            static constexpr std::uint8_t values[%(value_count)d] = {
+%(values)s
+            };
+
+            // The GraphemePair of properties before * properties + after
+            static constexpr std::uint8_t pairs[properties * properties] = {
+%(pairs)s
+            };
+        };
+
+        template<class T> constexpr std::size_t GraphemeTables<T>::blockShift;
+        template<class T> constexpr std::size_t GraphemeTables<T>::properties;
+        template<class T> constexpr std::uint8_t GraphemeTables<T>::blocks[];
+        template<class T> constexpr std::uint8_t GraphemeTables<T>::values[];
+        template<class T> constexpr std::uint8_t GraphemeTables<T>::pairs[];
+
+        using GraphemeTable = GraphemeTables<>;
+
+    } /* namespace detail */
+
+} /* namespace Canary */
+"""
+
+
+def numbers(values, per_line=16, indent=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(" " * indent + ", ".join(str(value) for value in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    tools = os.path.dirname(os.path.abspath(__file__))
+    canary = os.path.join(tools, "..", "canary")
+
+    properties = read_properties(os.path.join(tools, "grapheme-break.txt"))
+
+    size = 1 << BLOCK_SHIFT
+    distinct = {}
+    blocks, values = [], []
+    for start in range(0, len(properties), size):
+        block = tuple(properties[start:start + size])
+        if block not in distinct:
+            distinct[block] = len(distinct)
+            values.extend(block)
+        blocks.append(distinct[block])
+    if len(distinct) > 256:
+        sys.exit("too many blocks for 8 bit block numbers")
+
+    count = len(PROPERTIES)
+    pairs = [pair(before, after) for before in range(count) for after in range(count)]
+
+    with open(os.path.join(canary, "grapheme_data.hpp"), "w") as f:
+        f.write(DATA_HEADER % {
+            "properties": "\n".join("            Grapheme%s," % name for _, name in PROPERTIES),
+            "block_shift": BLOCK_SHIFT,
+            "property_count": count,
+            "block_count": len(blocks),
+            "blocks": numbers(blocks),
+            "value_count": len(values),
+            "values": numbers(values, per_line=32),
+            "pairs": numbers(pairs, per_line=count),
+        })
+
+
+if __name__ == "__main__":
+    main()